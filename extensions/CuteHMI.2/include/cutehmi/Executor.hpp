@@ -0,0 +1,210 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_EXECUTOR_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_EXECUTOR_HPP
+
+#include "internal/common.hpp"
+#include "Future.hpp"
+#include "NonCopyable.hpp"
+#include "NonMovable.hpp"
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QThread>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace cutehmi {
+
+/**
+ * %Executor. Pool of threads, which run tasks concurrently.
+ *
+ * Each thread of the pool owns a double-ended queue of tasks. Tasks submitted from within a pool thread are pushed to the back of
+ * that thread's queue and the thread takes them from the back too, which keeps recently produced data hot in the cache. Tasks
+ * submitted from outside of the pool land in a shared injection queue. A thread, which has run out of tasks, takes them from the
+ * injection queue and then tries to steal them from the front of the queues of other threads.
+ *
+ * %Executor keeps @ref threadCount() "core threads" alive for its whole lifetime. If @ref maxThreadCount() "maximal number of
+ * threads" is greater than the number of core threads, executor is elastic - it spawns additional threads when tasks are submitted
+ * and all threads are busy. Additional threads retire, when they remain idle for @ref expiryTimeout() "expiry timeout".
+ *
+ * Tasks are run with run(), which returns a Future, or post(), which is a fire-and-forget variant. Worker objects can be employed
+ * by an executor with Worker::employ(Executor &, bool).
+ *
+ * Process-wide executor can be obtained with Default() function.
+ */
+class CUTEHMI_API Executor:
+	public NonCopyable,
+	public NonMovable
+{
+	public:
+		static constexpr int INITIAL_EXPIRY_TIMEOUT = 30000;
+
+		/**
+		 * Get default executor. Default executor is created upon first call of this function with number of core threads equal to
+		 * QThread::idealThreadCount(). It is destroyed by destroySingletonInstances().
+		 * @return default executor.
+		 */
+		static Executor & Default();
+
+		/**
+		 * Constructor.
+		 * @param threadCount number of core threads. If value is not positive, QThread::idealThreadCount() is used.
+		 * @param maxThreadCount maximal number of threads. If value is smaller than effective number of core threads, executor has
+		 * fixed number of threads.
+		 */
+		explicit Executor(int threadCount = 0, int maxThreadCount = 0);
+
+		/**
+		 * Destructor. Destructor waits until all tasks, which have been submitted so far, are done and then it joins the threads.
+		 */
+		virtual ~Executor();
+
+		/**
+		 * Get number of core threads.
+		 * @return number of core threads.
+		 */
+		int threadCount() const;
+
+		/**
+		 * Get maximal number of threads.
+		 * @return maximal number of threads.
+		 */
+		int maxThreadCount() const;
+
+		/**
+		 * Get number of threads, which are currently alive.
+		 * @return number of alive threads.
+		 *
+		 * @threadsafe
+		 */
+		int activeThreadCount() const;
+
+		/**
+		 * Get expiry timeout.
+		 * @return amount of time [ms] after which idle additional thread retires.
+		 */
+		int expiryTimeout() const;
+
+		/**
+		 * Set expiry timeout.
+		 * @param expiryTimeout amount of time [ms] after which idle additional thread retires.
+		 *
+		 * @threadsafe
+		 */
+		void setExpiryTimeout(int expiryTimeout);
+
+		/**
+		 * Run function.
+		 * @param function function to be run. It has to be copy constructible.
+		 * @return future, which holds result of the @a function.
+		 *
+		 * @threadsafe
+		 */
+		template <typename F>
+		auto run(F && function)
+		{
+			typedef std::invoke_result_t<std::decay_t<F>> R;
+
+			auto state = std::make_shared<internal::FutureState<R>>();
+			post([state, function = std::forward<F>(function)]() mutable {
+				internal::fulfill(*state, function);
+			});
+			return Future<R>(state, this);
+		}
+
+		/**
+		 * Post task. Unlike run() this function does not provide a handle to the result. Exceptions thrown by @a task are logged and
+		 * suppressed.
+		 * @param task task to be run.
+		 *
+		 * @threadsafe
+		 */
+		void post(std::function<void()> task);
+
+		/**
+		 * Wait until all tasks are done.
+		 *
+		 * @threadsafe
+		 *
+		 * @warning calling this function from within a task run by the same executor results in a deadlock.
+		 */
+		void waitForDone() const;
+
+		/**
+		 * Check whether current thread belongs to the executor.
+		 * @return @p true if function is called from a thread of this executor, @p false otherwise.
+		 *
+		 * @threadsafe
+		 */
+		bool isExecutorThread() const;
+
+	private:
+		typedef std::function<void()> Task;
+
+		struct ThreadSlot
+		{
+			mutable QMutex mutex;
+			std::deque<Task> tasks;
+			std::unique_ptr<QThread> thread;
+			bool alive = false;
+		};
+
+		void spawn(int index);
+
+		void loop(int index);
+
+		bool take(int index, Task & task);
+
+		void execute(Task & task);
+
+		void retire(int index);
+
+		struct Members
+		{
+			int threadCount;
+			int maxThreadCount;
+			int expiryTimeout;
+			std::vector<std::unique_ptr<ThreadSlot>> threadSlots;
+			std::deque<Task> injected;
+			std::atomic<int> pending;
+			std::atomic<int> outstanding;
+			int idle;
+			int alive;
+			bool stopping;
+			mutable QMutex mutex;
+			QWaitCondition workCondition;
+			mutable QWaitCondition doneCondition;
+
+			Members(int p_threadCount, int p_maxThreadCount):
+				threadCount(p_threadCount),
+				maxThreadCount(p_maxThreadCount),
+				expiryTimeout(INITIAL_EXPIRY_TIMEOUT),
+				pending(0),
+				outstanding(0),
+				idle(0),
+				alive(0),
+				stopping(false)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,200 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_FUTURE_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_FUTURE_HPP
+
+#include "internal/common.hpp"
+#include "internal/FutureState.hpp"
+
+#include <QObject>
+#include <QMetaObject>
+#include <QPointer>
+
+#include <memory>
+#include <stdexcept>
+
+namespace cutehmi {
+
+/**
+ * %Future. Handle to a result of a task submitted to an Executor. %Future is a lightweight, copyable object - all copies refer to
+ * the same shared state.
+ *
+ * Continuations can be attached with then() functions. Continuation receives the result of the antecedent future (or no arguments
+ * if the result type is @p void) and its own result is available through the future returned by then(). If antecedent task has
+ * thrown an exception, continuation is not called and the exception is propagated to the returned future.
+ *
+ * Unlike QFuture this class does not support progress reporting, multiple results or cancellation.
+ */
+template <typename T>
+class Future
+{
+		template <typename>
+		friend class Future;
+
+		friend class Executor;
+
+	public:
+		/**
+		 * Default constructor. Constructs invalid future.
+		 */
+		Future():
+			m_executor(nullptr)
+		{
+		}
+
+		/**
+		 * Check if future is valid.
+		 * @return @p true if future refers to a shared state, @p false otherwise.
+		 */
+		bool isValid() const
+		{
+			return m_state != nullptr;
+		}
+
+		/**
+		 * Check if task has finished.
+		 * @return @p true if task has finished, @p false otherwise.
+		 *
+		 * @threadsafe
+		 */
+		bool isFinished() const
+		{
+			return m_state->isFinished();
+		}
+
+		/**
+		 * Wait for the task to finish.
+		 *
+		 * @threadsafe
+		 *
+		 * @warning waiting from within a task running on the same executor can exhaust executor threads, if executor is not elastic.
+		 */
+		void waitForFinished() const
+		{
+			m_state->wait();
+		}
+
+		/**
+		 * Get result. Function blocks until the result is available.
+		 * @return result of the task.
+		 * @throw exception thrown by the task.
+		 *
+		 * @threadsafe
+		 */
+		T result() const
+		{
+			if constexpr (std::is_void_v<T>)
+				m_state->result();
+			else
+				return m_state->result();
+		}
+
+		/**
+		 * Attach continuation, which is run by the executor, that has run the antecedent task.
+		 * @param continuation continuation function. It has to be copy constructible.
+		 * @return future of the continuation.
+		 */
+		template <typename F>
+		auto then(F && continuation) const
+		{
+			return then(m_executor, std::forward<F>(continuation));
+		}
+
+		/**
+		 * Attach continuation, which is run by specified executor.
+		 * @param executor executor, which should run the continuation.
+		 * @param continuation continuation function. It has to be copy constructible.
+		 * @return future of the continuation.
+		 */
+		template <typename F>
+		auto then(Executor & executor, F && continuation) const
+		{
+			return then(& executor, std::forward<F>(continuation));
+		}
+
+		/**
+		 * Attach continuation, which is run in the thread of @a context object. Continuation is queued through Qt event loop, so
+		 * this function can be used to deliver results back to QObjects, for example GUI models.
+		 * @param context context object. If context object is destroyed before continuation gets called, continuation is dropped
+		 * and returned future finishes with std::runtime_error.
+		 * @param continuation continuation function. It has to be copy constructible.
+		 * @return future of the continuation.
+		 */
+		template <typename F>
+		auto then(QObject * context, F && continuation) const
+		{
+			typedef typename internal::ContinuationResult<T, F>::type R;
+
+			auto state = std::make_shared<internal::FutureState<R>>();
+			auto antecedent = m_state;
+			QPointer<QObject> contextPtr(context);
+			m_state->addContinuation([antecedent, state, contextPtr, continuation = std::forward<F>(continuation)]() mutable {
+				if (std::exception_ptr exception = antecedent->exception()) {
+					state->reportException(exception);
+					return;
+				}
+				if (contextPtr.isNull()) {
+					state->reportException(std::make_exception_ptr(std::runtime_error("Continuation context has been destroyed.")));
+					return;
+				}
+				// Queued call is dropped without being called, if context object gets destroyed in the meantime. Guard finishes the
+				// state in such case.
+				auto guard = std::make_shared<internal::ContinuationGuard>(state);
+				QMetaObject::invokeMethod(contextPtr.data(), [antecedent, state, guard, continuation]() mutable {
+					guard->dismiss();
+					Call(*state, continuation, *antecedent);
+				}, Qt::QueuedConnection);
+			});
+			return Future<R>(state, m_executor);
+		}
+
+	private:
+		Future(std::shared_ptr<internal::FutureState<T>> state, Executor * executor):
+			m_state(std::move(state)),
+			m_executor(executor)
+		{
+		}
+
+		template <typename F>
+		auto then(Executor * executor, F && continuation) const
+		{
+			typedef typename internal::ContinuationResult<T, F>::type R;
+
+			auto state = std::make_shared<internal::FutureState<R>>();
+			auto antecedent = m_state;
+			m_state->addContinuation([antecedent, state, executor, continuation = std::forward<F>(continuation)]() mutable {
+				if (std::exception_ptr exception = antecedent->exception())
+					state->reportException(exception);
+				else
+					internal::postToExecutor(executor, [antecedent, state, continuation]() mutable {
+						Call(*state, continuation, *antecedent);
+					});
+			});
+			return Future<R>(state, executor);
+		}
+
+		template <typename R, typename F>
+		static void Call(internal::FutureState<R> & state, F & continuation, const internal::FutureState<T> & antecedent)
+		{
+			if constexpr (std::is_void_v<T>)
+				internal::fulfill(state, continuation);
+			else
+				internal::fulfill(state, continuation, antecedent.result());
+		}
+
+		std::shared_ptr<internal::FutureState<T>> m_state;
+		Executor * m_executor;
+};
+
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -19,6 +19,12 @@ namespace cutehmi {
  *
  * Classes registered as meta types can be used in string-based, queued signal-slot connections and various functions that rely on
  * QMetaType features.
+ *
+ * If @p CUTEHMI_ASYNC_LOGGING environment variable is set to non-zero value, asynchronous logging is installed (see
+ * installAsyncLogging()).
+ *
+ * If @p CUTEHMI_TRACE_FILE environment variable is set, tracer starts recording and the trace is saved to the specified file, when
+ * extension is deinitialized (see @ref cutehmi-trace).
  */
 class CUTEHMI_API Init final:
 	public Initializer<Init>
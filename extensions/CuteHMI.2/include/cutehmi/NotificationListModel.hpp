@@ -5,11 +5,18 @@
 #include "Notification.hpp"
 
 #include <QAbstractListModel>
+#include <QHash>
+#include <QPair>
+
+#include <vector>
 
 namespace cutehmi {
 
 /**
  * %Notification list model.
+ *
+ * Notifications are kept in a growable ring buffer, so that rows can be removed from either end in constant time. Identical
+ * notifications (same type and text) can be coalesced into a single row with a repeat counter.
  */
 class CUTEHMI_API NotificationListModel:
 	public QAbstractListModel
@@ -20,7 +27,8 @@ class CUTEHMI_API NotificationListModel:
 	public:
 		enum Role {
 			TYPE_ROLE = Qt::UserRole,
-			DATE_TIME_ROLE
+			DATE_TIME_ROLE,
+			REPEAT_COUNT_ROLE
 		};
 
 		NotificationListModel(QObject * parent = nullptr);
@@ -35,6 +43,15 @@ class CUTEHMI_API NotificationListModel:
 
 		void append(std::unique_ptr<Notification> notification);
 
+		/**
+		 * Append batch of notifications. New rows are inserted at once. Notification, which is identical (same type and text) to a
+		 * notification, which occurred not earlier than @a deduplicationInterval milliseconds before, does not create a new row.
+		 * Instead repeat count of existing row is incremented and its date is updated to the date of the repeated notification.
+		 * @param notifications notifications to append.
+		 * @param deduplicationInterval deduplication interval [ms]. Non-positive value disables deduplication.
+		 */
+		void append(std::vector<std::unique_ptr<Notification>> notifications, int deduplicationInterval);
+
 		void prepend(std::unique_ptr<Notification> notification);
 
 		void removeFirst(int num = 1);
@@ -44,11 +61,43 @@ class CUTEHMI_API NotificationListModel:
 		void clear();
 
 	private:
-		typedef QList<Notification *> NotificationsContainer;
+		typedef QPair<int, QString> Key;
+
+		struct Entry
+		{
+			std::unique_ptr<Notification> notification;
+			int repeatCount;
+		};
+
+		typedef std::vector<Entry> EntriesContainer;
+
+		typedef QHash<Key, qint64> SequencesContainer;
+
+		static Key KeyOf(const Notification & notification);
+
+		const Entry & entryAt(int row) const;
+
+		Entry & entryAt(int row);
+
+		void pushBack(Entry entry);
+
+		void pushFront(Entry entry);
+
+		void popFront();
+
+		void popBack();
+
+		void reserve(int capacity);
+
+		void forget(const Entry & entry, qint64 sequence);
 
 		struct Members
 		{
-			NotificationsContainer notifications;
+			EntriesContainer entries;	///< Ring buffer.
+			int head;	///< Index of the first row within the ring buffer.
+			int count;	///< Number of rows.
+			qint64 first;	///< Sequence number of the first row.
+			SequencesContainer sequences;	///< Sequence numbers of latest rows, which may be coalesced.
 		};
 
 		MPtr<Members> m;
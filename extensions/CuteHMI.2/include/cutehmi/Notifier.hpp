@@ -6,15 +6,21 @@
 #include "Singleton.hpp"
 
 #include <QObject>
+#include <QBasicTimer>
 #include <QMutexLocker>
 #include <QQmlEngine>
 
 #include <limits>
+#include <vector>
 
 namespace cutehmi {
 
 /**
  * %Notifier.
+ *
+ * Notifications can be added from any thread. They are collected and inserted into the model in batches, at most once per
+ * @ref batchInterval, so that bursts of notifications do not force views to rebuild continuously. Identical notifications, which
+ * repeat within @ref deduplicationInterval, are coalesced into a single row with a repeat counter.
  */
 class CUTEHMI_API Notifier:
 	public QObject,
@@ -32,10 +38,26 @@ class CUTEHMI_API Notifier:
 		friend class Singleton<Notifier>;
 
 	public:
+		static constexpr int INITIAL_BATCH_INTERVAL = 50;
+
+		static constexpr int INITIAL_DEDUPLICATION_INTERVAL = 10000;
+
 		Q_PROPERTY(cutehmi::NotificationListModel * model READ model CONSTANT)
 
 		Q_PROPERTY(int maxNotifications READ maxNotifications WRITE setMaxNotifications NOTIFY maxNotificationsChanged)
 
+		/**
+		  Batch interval [ms]. Notifications are inserted into the model at most once per this interval. If set to @p 0, then
+		  notifications added from Notifier thread are inserted immediately.
+		  */
+		Q_PROPERTY(int batchInterval READ batchInterval WRITE setBatchInterval NOTIFY batchIntervalChanged)
+
+		/**
+		  Deduplication interval [ms]. Identical notification (same type and text) repeated within this interval increments repeat
+		  count of existing row instead of creating a new one. Non-positive value disables deduplication.
+		  */
+		Q_PROPERTY(int deduplicationInterval READ deduplicationInterval WRITE setDeduplicationInterval NOTIFY deduplicationIntervalChanged)
+
 		NotificationListModel * model() const;
 
 		/**
@@ -52,6 +74,14 @@ class CUTEHMI_API Notifier:
 
 		void setMaxNotifications(int maxNotifications);
 
+		int batchInterval() const;
+
+		void setBatchInterval(int batchInterval);
+
+		int deduplicationInterval() const;
+
+		void setDeduplicationInterval(int deduplicationInterval);
+
 	public slots:
 		/**
 		 * Add notification.
@@ -67,17 +97,37 @@ class CUTEHMI_API Notifier:
 	signals:
 		void maxNotificationsChanged();
 
+		void batchIntervalChanged();
+
+		void deduplicationIntervalChanged();
+
+		/**
+		 * Notification added. Signal is emitted once per batch of notifications inserted into the model.
+		 */
 		void notificationAdded();
 
 	protected:
 		explicit Notifier(QObject * parent = nullptr);
 
+		void timerEvent(QTimerEvent * event) override;
+
 	private:
+		typedef std::vector<std::unique_ptr<Notification>> PendingContainer;
+
+		void scheduleFlush();
+
+		void flush();
+
 		struct Members
 		{
 			std::unique_ptr<NotificationListModel> model {new NotificationListModel};
-			QMutex modelMutex {};
+			QMutex pendingMutex {};
+			PendingContainer pending {};
+			bool flushScheduled {false};
+			QBasicTimer flushTimer {};
 			int maxNotifications {std::numeric_limits<int>::max()};
+			int batchInterval {INITIAL_BATCH_INTERVAL};
+			int deduplicationInterval {INITIAL_DEDUPLICATION_INTERVAL};
 		};
 
 		MPtr<Members> m;
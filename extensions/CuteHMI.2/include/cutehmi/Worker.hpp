@@ -13,11 +13,16 @@
 
 namespace cutehmi {
 
+class Executor;
+
 /**
  * %Worker. This class acts as a container that allows specified code to be run in a specified thread. This class is useful when
  * dealing with databases, because Qt SQL module does not allow for sharing database connections across threads. Thus if SQL
  * connection is established in dedicated thread, a worker can run a task in that thread and send ready() signal when the task is
  * finished.
+ *
+ * Worker can be also employed by an Executor. In such case job() is run by one of the executor threads, so that CPU-bound jobs
+ * of many workers can be spread across available cores.
  */
 class CUTEHMI_API Worker:
 	public QObject
@@ -87,9 +92,17 @@ class CUTEHMI_API Worker:
 		 */
 		void employ(QThread & thread, bool start = true);
 
+		/**
+		 * Employ worker by an executor. Job is going to be run by one of the threads of the @a executor. Worker object itself
+		 * stays in its current thread, so the ready() signal is emitted from an executor thread.
+		 * @param executor executor, which should run worker's job.
+		 * @param start start work. If start is set to @p true, then work() is called immediately.
+		 */
+		void employ(Executor & executor, bool start = true);
+
 		/**
 		 * Do work. This function posts WorkEvent, which tells worker to process the job() inside the thread in which it is
-		 * employed.
+		 * employed. If worker is employed by an executor, job is posted to the executor instead.
 		 *
 		 * @threadsafe
 		 */
@@ -134,6 +147,8 @@ class CUTEHMI_API Worker:
 		bool event(QEvent * event) override;
 
 	private:
+		void process();
+
 		enum class State {
 			UNEMPLOYED,
 			EMPLOYED,
@@ -145,13 +160,15 @@ class CUTEHMI_API Worker:
 		{
 			State state;
 			std::function<void()> task;
+			Executor * executor;
 			mutable QMutex stateMutex;
 			mutable QWaitCondition waitCondition;
 			mutable QMutex workMutex;
 
 			Members(std::function<void()> p_task):
 				state(State::UNEMPLOYED),
-				task(p_task)
+				task(p_task),
+				executor(nullptr)
 			{
 			}
 		};
@@ -0,0 +1,142 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_ASYNCMESSAGEHANDLER_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_ASYNCMESSAGEHANDLER_HPP
+
+#include "common.hpp"
+#include "RingBuffer.hpp"
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace cutehmi {
+namespace internal {
+
+/**
+ * Asynchronous message handler. Handler captures messages into a ring buffer together with their category, type and timestamp.
+ * Background thread passes them to the message handler, which has been installed previously (typically Qt default message handler,
+ * which writes to stderr or journald).
+ *
+ * Each category is throttled with a token bucket. Messages exceeding the rate are counted and a summary is written, once the
+ * category calms down. Critical messages are not throttled. When the buffer is full, messages are dropped and counted as well, so
+ * that producers never block.
+ *
+ * Fatal messages and messages logged by the background thread itself are passed to the previous handler synchronously. Before
+ * fatal message is passed, the buffer is flushed by the calling thread.
+ */
+class CUTEHMI_PRIVATE AsyncMessageHandler
+{
+	public:
+		static constexpr int IDLE_INTERVAL = 5;
+
+		static void Install(int capacity, int rate, int burst);
+
+		static void Uninstall();
+
+		static bool IsInstalled();
+
+	private:
+		struct Record
+		{
+			QtMsgType type = QtDebugMsg;
+			QByteArray category;
+			const char * file = nullptr;
+			int line = 0;
+			const char * function = nullptr;
+			QString message;
+			qint64 timestamp = 0;
+		};
+
+		struct Bucket
+		{
+			qreal tokens;
+			qint64 updated;
+			int suppressed;
+		};
+
+		typedef QHash<QByteArray, Bucket> BucketsContainer;
+
+		static void Handle(QtMsgType type, const QMessageLogContext & context, const QString & message);
+
+		AsyncMessageHandler(QtMessageHandler previous, int capacity, int rate, int burst);
+
+		~AsyncMessageHandler();
+
+		void enqueue(QtMsgType type, const QMessageLogContext & context, const QString & message);
+
+		void run();
+
+		/**
+		 * Flush the buffer. Pending messages are processed by calling thread.
+		 */
+		void flush();
+
+		/**
+		 * Process messages, which are in the buffer.
+		 * @return @p true if any message has been processed, @p false otherwise.
+		 *
+		 * @pre consumer mutex must be locked.
+		 */
+		bool drain();
+
+		void process(const Record & record);
+
+		bool admit(Bucket & bucket, qint64 timestamp);
+
+		void reportSuppressed(bool force);
+
+		void reportDropped();
+
+		void write(QtMsgType type, const char * category, const QString & message) const;
+
+		static std::atomic<AsyncMessageHandler *> Instance;
+
+		static std::atomic<int> Producers;
+
+		struct Members
+		{
+			QtMessageHandler previous;
+			RingBuffer<Record> buffer;
+			qreal rate;
+			int burst;
+			std::atomic<bool> running;
+			std::atomic<quint64> dropped;
+			std::once_flag startFlag;
+			std::thread thread;
+			std::atomic<std::thread::id> threadId;
+			std::mutex consumerMutex;
+			BucketsContainer buckets;
+
+			Members(QtMessageHandler p_previous, int capacity, int p_rate, int p_burst):
+				previous(p_previous),
+				buffer(static_cast<std::size_t>(capacity)),
+				rate(p_rate),
+				burst(p_burst),
+				running(true),
+				dropped(0),
+				threadId(std::thread::id())
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,188 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_FUTURESTATE_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_FUTURESTATE_HPP
+
+#include "platform.hpp"
+
+#include <QMutex>
+#include <QWaitCondition>
+#include <QList>
+
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace cutehmi {
+
+class Executor;
+
+namespace internal {
+
+/**
+ * Post task to an executor. This function allows Future to dispatch continuations without depending on complete Executor type.
+ * @param executor executor.
+ * @param task task.
+ */
+CUTEHMI_API void postToExecutor(Executor * executor, std::function<void()> task);
+
+/**
+ * Shared state of a future. Base class holds completion flag, exception and continuations, which do not depend on the type of
+ * a result.
+ */
+class CUTEHMI_API FutureStateBase
+{
+	public:
+		typedef std::function<void()> Continuation;
+
+		FutureStateBase();
+
+		virtual ~FutureStateBase();
+
+		bool isFinished() const;
+
+		void wait() const;
+
+		/**
+		 * Add continuation. Continuation is called from a thread, which finishes the state or, if state has already been finished,
+		 * it is called immediately from within this function.
+		 * @param continuation continuation.
+		 */
+		void addContinuation(Continuation continuation);
+
+		std::exception_ptr exception() const;
+
+		void reportException(std::exception_ptr exception);
+
+	protected:
+		/**
+		 * Mark state as finished, wake up waiting threads and call continuations.
+		 */
+		void finish();
+
+		/**
+		 * Wait for the state to finish and rethrow exception, if it has been reported.
+		 */
+		void waitAndRethrow() const;
+
+	private:
+		mutable QMutex m_mutex;
+		mutable QWaitCondition m_finishedCondition;
+		bool m_finished;
+		std::exception_ptr m_exception;
+		QList<Continuation> m_continuations;
+};
+
+/**
+ * Continuation guard. Guard finishes the state with an error if it gets destroyed before being dismissed. It allows to detect
+ * continuations, which have been dropped without being called.
+ */
+class CUTEHMI_API ContinuationGuard
+{
+	public:
+		explicit ContinuationGuard(std::shared_ptr<FutureStateBase> state);
+
+		~ContinuationGuard();
+
+		/**
+		 * Dismiss the guard. Function should be called, when continuation is about to be called.
+		 */
+		void dismiss();
+
+	private:
+		std::shared_ptr<FutureStateBase> m_state;
+};
+
+template <typename T>
+class FutureState:
+	public FutureStateBase
+{
+	public:
+		void reportResult(T result)
+		{
+			m_result.emplace(std::move(result));
+			finish();
+		}
+
+		/**
+		 * Get result. Function blocks until state is finished.
+		 * @return result.
+		 * @throw exception reported by the task, which was supposed to produce the result.
+		 */
+		const T & result() const
+		{
+			waitAndRethrow();
+			return *m_result;
+		}
+
+	private:
+		std::optional<T> m_result;
+};
+
+template <>
+class FutureState<void>:
+	public FutureStateBase
+{
+	public:
+		void reportResult()
+		{
+			finish();
+		}
+
+		void result() const
+		{
+			waitAndRethrow();
+		}
+};
+
+/**
+ * Result type of a continuation. Continuation takes result of antecedent future as an argument, unless antecedent result type is
+ * @p void.
+ */
+template <typename T, typename F>
+struct ContinuationResult
+{
+	typedef std::invoke_result_t<std::decay_t<F>, const T &> type;
+};
+
+template <typename F>
+struct ContinuationResult<void, F>
+{
+	typedef std::invoke_result_t<std::decay_t<F>> type;
+};
+
+/**
+ * Call a function and store its result or exception in a state.
+ * @param state state.
+ * @param function function.
+ * @param args function arguments.
+ */
+template <typename T, typename F, typename... ARGS>
+void fulfill(FutureState<T> & state, F & function, ARGS &&... args)
+{
+	try {
+		if constexpr (std::is_void_v<T>) {
+			std::invoke(function, std::forward<ARGS>(args)...);
+			state.reportResult();
+		} else
+			state.reportResult(std::invoke(function, std::forward<ARGS>(args)...));
+	} catch (...) {
+		state.reportException(std::current_exception());
+	}
+}
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
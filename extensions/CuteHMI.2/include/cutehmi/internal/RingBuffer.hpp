@@ -0,0 +1,120 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_RINGBUFFER_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_INTERNAL_RINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace cutehmi {
+namespace internal {
+
+/**
+ * Bounded lock-free ring buffer. Buffer can be written by multiple producers and it can be read by a single consumer. Each cell
+ * carries a sequence number, which tells whether it is ready to be written or read, so that producers only contend on a single
+ * atomic index and they never block - if buffer is full, push() fails immediately.
+ *
+ * @internal Dmitry Vyukov "Bounded MPMC queue" (restricted here to a single consumer).
+ */
+template <typename T>
+class RingBuffer
+{
+	public:
+		/**
+		 * Constructor.
+		 * @param capacity capacity of the buffer. It is rounded up to a power of 2.
+		 */
+		explicit RingBuffer(std::size_t capacity):
+			m_mask(RoundUp(capacity) - 1),
+			m_cells(new Cell[m_mask + 1]),
+			m_enqueuePos(0),
+			m_dequeuePos(0)
+		{
+			for (std::size_t i = 0; i <= m_mask; i++)
+				m_cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		std::size_t capacity() const
+		{
+			return m_mask + 1;
+		}
+
+		/**
+		 * Push element.
+		 * @param element element to be pushed.
+		 * @return @p true on success, @p false if buffer is full.
+		 *
+		 * @threadsafe
+		 */
+		bool push(T && element)
+		{
+			std::size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+			Cell * cell;
+			while (true) {
+				cell = & m_cells[pos & m_mask];
+				std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<std::ptrdiff_t>(pos);
+				if (diff == 0) {
+					if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				} else if (diff < 0)
+					return false;
+				else
+					pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+			cell->element = std::move(element);
+			cell->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Pop element. This function must be called only from a consumer thread.
+		 * @param element placeholder for popped element.
+		 * @return @p true on success, @p false if buffer is empty.
+		 */
+		bool pop(T & element)
+		{
+			Cell * cell = & m_cells[m_dequeuePos & m_mask];
+			if (cell->sequence.load(std::memory_order_acquire) != m_dequeuePos + 1)
+				return false;
+			element = std::move(cell->element);
+			cell->element = T();
+			cell->sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+			m_dequeuePos++;
+			return true;
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<std::size_t> sequence;
+			T element;
+		};
+
+		static std::size_t RoundUp(std::size_t capacity)
+		{
+			std::size_t result = 2;
+			while (result < capacity)
+				result <<= 1;
+			return result;
+		}
+
+		const std::size_t m_mask;
+		std::unique_ptr<Cell[]> m_cells;
+		alignas(64) std::atomic<std::size_t> m_enqueuePos;
+		alignas(64) std::size_t m_dequeuePos;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
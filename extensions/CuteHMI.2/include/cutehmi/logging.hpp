@@ -19,6 +19,43 @@ const QLoggingCategory & loggingCategory()
 	return cutehmi_loggingCategory();
 }
 
+constexpr int INITIAL_ASYNC_LOGGING_CAPACITY = 4096;
+
+constexpr int INITIAL_ASYNC_LOGGING_RATE = 50;
+
+constexpr int INITIAL_ASYNC_LOGGING_BURST = 200;
+
+/**
+ * Install asynchronous logging. Messages logged with Qt logging functions (including @ref cutehmi-loggingMacros
+ * "CUTEHMI_* logging macros") are captured into a lock-free ring buffer and a background thread passes them to previously installed
+ * message handler. Calling thread thus does not wait for messages to be written to stderr or journald. Messages of each logging
+ * category, except critical messages, are rate-limited and messages that do not fit into the buffer are dropped. Number of
+ * suppressed and dropped messages is reported. Pending messages are written before a fatal message.
+ *
+ * Asynchronous logging can be also enabled by setting @p CUTEHMI_ASYNC_LOGGING environment variable to non-zero value. Parameters
+ * can be then adjusted with @p CUTEHMI_ASYNC_LOGGING_CAPACITY, @p CUTEHMI_ASYNC_LOGGING_RATE and @p CUTEHMI_ASYNC_LOGGING_BURST
+ * variables.
+ *
+ * @param capacity capacity of the ring buffer (number of messages).
+ * @param rate sustained number of messages per second allowed for each logging category. Non-positive value disables rate
+ * limiting.
+ * @param burst number of messages of a single logging category, that can be logged at once, before rate limit takes effect.
+ *
+ * @note message patterns containing time placeholders reflect the time at which the message has been written rather than captured.
+ */
+CUTEHMI_API void installAsyncLogging(int capacity = INITIAL_ASYNC_LOGGING_CAPACITY, int rate = INITIAL_ASYNC_LOGGING_RATE, int burst = INITIAL_ASYNC_LOGGING_BURST);
+
+/**
+ * Uninstall asynchronous logging. Function writes pending messages and restores previous message handler.
+ */
+CUTEHMI_API void uninstallAsyncLogging();
+
+/**
+ * Check if asynchronous logging is installed.
+ * @return @p true if asynchronous logging is installed, @p false otherwise.
+ */
+CUTEHMI_API bool isAsyncLoggingInstalled();
+
 }
 
 #endif
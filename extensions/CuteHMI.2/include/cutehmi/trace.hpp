@@ -0,0 +1,222 @@
+#ifndef H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_TRACE_HPP
+#define H_EXTENSIONS_CUTEHMI_2_INCLUDE_CUTEHMI_TRACE_HPP
+
+#include "internal/platform.hpp"
+#include "NonCopyable.hpp"
+
+#include <QtGlobal>
+#include <QString>
+
+#include <atomic>
+
+class QIODevice;
+
+/**
+ * @defgroup cutehmi-trace Tracing
+ *
+ * Tracing.
+ *
+ * Lightweight instrumentation, which helps to find out where the time goes between modules. Scoped spans and instant events are
+ * recorded into per-thread buffers, which can be exported as Chrome trace JSON (viewable with `chrome://tracing` or
+ * [Perfetto UI](https://ui.perfetto.dev)).
+ *	- CUTEHMI_TRACE_SCOPE - record a span covering the rest of enclosing scope.
+ *	- CUTEHMI_TRACE_INSTANT - record an instant event.
+ *	- CUTEHMI_TRACE_ENABLED - check if category is enabled at compile time.
+ *	.
+ *
+ * Each event belongs to a category (see cutehmi::TraceCategory). Categories can be switched off at compile time by defining
+ * @p CUTEHMI_TRACE_CATEGORIES bitmask and whole instrumentation can be removed by defining @p CUTEHMI_NTRACE. Instrumentation that
+ * is compiled in costs a single relaxed atomic load, unless recording has been started with cutehmi::Tracer::Start().
+ *
+ * Recording can be also enabled by setting @p CUTEHMI_TRACE_FILE environment variable. In such case recording is started when
+ * CuteHMI extension is initialized and trace is saved to the specified file when it is deinitialized.
+ */
+///@{
+
+#ifndef CUTEHMI_TRACE_CATEGORIES
+	#define CUTEHMI_TRACE_CATEGORIES 0xFFFFFFFFu
+#endif
+
+#define CUTEHMI_INTERNAL_TRACE_CONCAT_IMPL(A, B) A ## B
+#define CUTEHMI_INTERNAL_TRACE_CONCAT(A, B) CUTEHMI_INTERNAL_TRACE_CONCAT_IMPL(A, B)
+
+/**
+  @def CUTEHMI_TRACE_ENABLED(CATEGORY)
+  Check if category is enabled at compile time. Can be used to guard manual calls to cutehmi::Tracer functions.
+  @param CATEGORY trace category (see cutehmi::TraceCategory).
+  */
+#ifndef CUTEHMI_NTRACE
+	#define CUTEHMI_TRACE_ENABLED(CATEGORY) ((static_cast<quint32>(CATEGORY) & (CUTEHMI_TRACE_CATEGORIES)) != 0)
+#else
+	#define CUTEHMI_TRACE_ENABLED(CATEGORY) false
+#endif
+
+/**
+  @def CUTEHMI_TRACE_SCOPE(CATEGORY, NAME)
+  Record span. Span starts at the point of macro invocation and ends with enclosing scope.
+  @param CATEGORY trace category (see cutehmi::TraceCategory).
+  @param NAME name of the span. It must be a string literal or a string with static storage duration.
+  */
+#ifndef CUTEHMI_NTRACE
+	#define CUTEHMI_TRACE_SCOPE(CATEGORY, NAME) cutehmi::TraceSpan<CUTEHMI_TRACE_ENABLED(CATEGORY)> CUTEHMI_INTERNAL_TRACE_CONCAT(cutehmi_traceSpan_, __LINE__)(CATEGORY, NAME)
+#else
+	#define CUTEHMI_TRACE_SCOPE(CATEGORY, NAME) (void)0
+#endif
+
+/**
+  @def CUTEHMI_TRACE_INSTANT(CATEGORY, NAME)
+  Record instant event.
+  @param CATEGORY trace category (see cutehmi::TraceCategory).
+  @param NAME name of the event. It must be a string literal or a string with static storage duration.
+  */
+#ifndef CUTEHMI_NTRACE
+	#define CUTEHMI_TRACE_INSTANT(CATEGORY, NAME) do { if constexpr (CUTEHMI_TRACE_ENABLED(CATEGORY)) cutehmi::Tracer::RecordInstant(CATEGORY, NAME); } while (false)
+#else
+	#define CUTEHMI_TRACE_INSTANT(CATEGORY, NAME) (void)0
+#endif
+
+///@}
+
+namespace cutehmi {
+
+/**
+ * Trace category.
+ */
+enum TraceCategory : quint32 {
+	TRACE_MODBUS = 0x00000001,	///< Modbus devices and backends.
+	TRACE_CONTROLLERS = 0x00000002,	///< Register controllers.
+	TRACE_DATABASE = 0x00000004,	///< Database workers.
+	TRACE_SERVICES = 0x00000008,	///< Service state machines.
+	TRACE_USER = 0x80000000	///< Application specific events.
+};
+
+/**
+ * %Tracer. Tracer records events into per-thread ring buffers. Each thread writes to its own buffer without locks; registry of
+ * buffers is locked only when a thread records its first event. When buffer is full, oldest events are overwritten.
+ */
+class CUTEHMI_API Tracer
+{
+	public:
+		static constexpr int INITIAL_CAPACITY = 65536;
+
+		/**
+		 * Start recording. Events recorded previously are discarded.
+		 * @param capacity capacity of each per-thread buffer (number of events).
+		 *
+		 * @threadsafe
+		 */
+		static void Start(int capacity = INITIAL_CAPACITY);
+
+		/**
+		 * Stop recording. Function returns once no thread is in the middle of writing an event.
+		 *
+		 * @threadsafe
+		 */
+		static void Stop();
+
+		/**
+		 * Check if tracer is recording.
+		 * @return @p true if tracer is recording, @p false otherwise.
+		 *
+		 * @threadsafe
+		 */
+		static bool IsRecording()
+		{
+			return Recording.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * Get current time.
+		 * @return monotonic time [ns] elapsed since tracer epoch.
+		 */
+		static qint64 Now();
+
+		/**
+		 * Record complete event (span).
+		 * @param category category.
+		 * @param name name of the event. It must be a string literal or a string with static storage duration.
+		 * @param begin beginning of the event (see Now()).
+		 * @param end end of the event (see Now()).
+		 */
+		static void RecordComplete(quint32 category, const char * name, qint64 begin, qint64 end);
+
+		/**
+		 * Record instant event.
+		 * @param category category.
+		 * @param name name of the event. It must be a string literal or a string with static storage duration.
+		 */
+		static void RecordInstant(quint32 category, const char * name);
+
+		/**
+		 * Export recorded events as Chrome trace JSON. Recording is stopped before the events are exported.
+		 * @param device output device.
+		 * @return @p true on success, @p false if writing to the device has failed.
+		 */
+		static bool ExportChromeJson(QIODevice & device);
+
+		/**
+		 * Save recorded events as Chrome trace JSON file. Recording is stopped before the events are saved.
+		 * @param fileName name of the file.
+		 * @return @p true on success, @p false otherwise.
+		 */
+		static bool Save(const QString & fileName);
+
+	private:
+		static void Record(quint32 category, const char * name, qint64 begin, qint64 duration);
+
+		static std::atomic<bool> Recording;
+};
+
+/**
+ * Trace span. Span records complete event, which begins when the object is constructed and ends when it is destroyed. Typically it
+ * is not used directly, but through CUTEHMI_TRACE_SCOPE macro.
+ * @tparam ENABLED whether category of the span is enabled at compile time.
+ */
+template <bool ENABLED>
+class TraceSpan:
+	public NonCopyable
+{
+	public:
+		TraceSpan(quint32 category, const char * name):
+			m_category(category),
+			m_name(name),
+			m_begin(Tracer::IsRecording() ? Tracer::Now() : -1)
+		{
+		}
+
+		~TraceSpan()
+		{
+			if (m_begin >= 0)
+				Tracer::RecordComplete(m_category, m_name, m_begin, Tracer::Now());
+		}
+
+	private:
+		quint32 m_category;
+		const char * m_name;
+		qint64 m_begin;
+};
+
+template <>
+class TraceSpan<false>:
+	public NonCopyable
+{
+	public:
+		TraceSpan(quint32, const char *)
+		{
+		}
+};
+
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
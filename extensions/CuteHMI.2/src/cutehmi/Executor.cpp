@@ -0,0 +1,268 @@
+#include "../../include/cutehmi/Executor.hpp"
+#include "../../include/cutehmi/Singleton.hpp"
+
+#include <algorithm>
+#include <climits>
+
+namespace cutehmi {
+
+namespace {
+
+class DefaultExecutor:
+	public Executor,
+	public Singleton<DefaultExecutor>
+{
+};
+
+struct CurrentThread
+{
+	const Executor * executor = nullptr;
+	int index = -1;
+};
+
+thread_local CurrentThread currentThread;
+
+}
+
+constexpr int Executor::INITIAL_EXPIRY_TIMEOUT;
+
+Executor & Executor::Default()
+{
+	return DefaultExecutor::Instance();
+}
+
+Executor::Executor(int threadCount, int maxThreadCount):
+	m(new Members(threadCount > 0 ? threadCount : QThread::idealThreadCount(), 0))
+{
+	if (m->threadCount < 1)
+		m->threadCount = 1;
+	m->maxThreadCount = std::max(m->threadCount, maxThreadCount);
+
+	for (int i = 0; i < m->maxThreadCount; i++)
+		m->threadSlots.emplace_back(new ThreadSlot);
+
+	QMutexLocker locker(& m->mutex);
+	for (int i = 0; i < m->threadCount; i++)
+		spawn(i);
+}
+
+Executor::~Executor()
+{
+	{
+		QMutexLocker locker(& m->mutex);
+		m->stopping = true;
+		m->workCondition.wakeAll();
+	}
+
+	for (auto && threadSlot : m->threadSlots)
+		if (threadSlot->thread)
+			threadSlot->thread->wait();
+}
+
+int Executor::threadCount() const
+{
+	return m->threadCount;
+}
+
+int Executor::maxThreadCount() const
+{
+	return m->maxThreadCount;
+}
+
+int Executor::activeThreadCount() const
+{
+	QMutexLocker locker(& m->mutex);
+	return m->alive;
+}
+
+int Executor::expiryTimeout() const
+{
+	QMutexLocker locker(& m->mutex);
+	return m->expiryTimeout;
+}
+
+void Executor::setExpiryTimeout(int expiryTimeout)
+{
+	QMutexLocker locker(& m->mutex);
+	m->expiryTimeout = expiryTimeout;
+}
+
+void Executor::post(std::function<void()> task)
+{
+	int index = isExecutorThread() ? currentThread.index : -1;
+
+	// Counters must be incremented before the task becomes visible to other threads, which may take it and run it immediately.
+	m->outstanding++;
+	m->pending++;
+
+	if (index >= 0) {
+		ThreadSlot & threadSlot = *m->threadSlots[index];
+		QMutexLocker slotLocker(& threadSlot.mutex);
+		threadSlot.tasks.push_back(std::move(task));
+	}
+
+	QMutexLocker locker(& m->mutex);
+	if (index < 0)
+		m->injected.push_back(std::move(task));
+	if (m->idle > 0)
+		m->workCondition.wakeOne();
+	// Idle threads may have been woken already by preceding posts, so more threads are needed if there are more pending tasks.
+	if (m->pending.load() > m->idle && m->alive < m->maxThreadCount && !m->stopping)
+		for (int i = m->threadCount; i < m->maxThreadCount; i++)
+			if (!m->threadSlots[i]->alive) {
+				spawn(i);
+				break;
+			}
+}
+
+void Executor::waitForDone() const
+{
+	QMutexLocker locker(& m->mutex);
+	while (m->outstanding.load() > 0)
+		m->doneCondition.wait(& m->mutex);
+}
+
+bool Executor::isExecutorThread() const
+{
+	return currentThread.executor == this;
+}
+
+void Executor::spawn(int index)
+{
+	// Pool mutex must be locked by the caller.
+
+	ThreadSlot & threadSlot = *m->threadSlots[index];
+	if (threadSlot.thread)
+		// Retired thread has already left the loop, so it won't attempt to lock pool mutex.
+		threadSlot.thread->wait();
+	threadSlot.thread.reset(QThread::create([this, index]() {
+		loop(index);
+	}));
+	threadSlot.alive = true;
+	m->alive++;
+	threadSlot.thread->start();
+}
+
+void Executor::loop(int index)
+{
+	currentThread.executor = this;
+	currentThread.index = index;
+
+	bool core = index < m->threadCount;
+	while (true) {
+		Task task;
+		if (take(index, task)) {
+			execute(task);
+			continue;
+		}
+
+		QMutexLocker locker(& m->mutex);
+		// Posting thread locks pool mutex after incrementing pending counter to wake up idle threads, so checking the counter here
+		// prevents lost wake-ups.
+		if (m->pending.load() > 0)
+			continue;
+		if (m->stopping) {
+			retire(index);
+			break;
+		}
+		m->idle++;
+		bool woken = m->workCondition.wait(& m->mutex, core ? ULONG_MAX : static_cast<unsigned long>(m->expiryTimeout));
+		m->idle--;
+		if (!woken && m->pending.load() <= 0) {
+			retire(index);
+			break;
+		}
+	}
+
+	currentThread = CurrentThread();
+}
+
+bool Executor::take(int index, Task & task)
+{
+	// Own tasks are taken from the back.
+	{
+		ThreadSlot & threadSlot = *m->threadSlots[index];
+		QMutexLocker slotLocker(& threadSlot.mutex);
+		if (!threadSlot.tasks.empty()) {
+			task = std::move(threadSlot.tasks.back());
+			threadSlot.tasks.pop_back();
+			m->pending--;
+			return true;
+		}
+	}
+
+	{
+		QMutexLocker locker(& m->mutex);
+		if (!m->injected.empty()) {
+			task = std::move(m->injected.front());
+			m->injected.pop_front();
+			m->pending--;
+			return true;
+		}
+	}
+
+	// Steal from the front of other threads' queues, starting with the neighbour to spread the contention.
+	int count = static_cast<int>(m->threadSlots.size());
+	for (int i = 1; i < count; i++) {
+		ThreadSlot & victim = *m->threadSlots[(index + i) % count];
+		QMutexLocker slotLocker(& victim.mutex);
+		if (!victim.tasks.empty()) {
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			m->pending--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void Executor::execute(Task & task)
+{
+	try {
+		task();
+	} catch (const std::exception & e) {
+		CUTEHMI_CRITICAL("Executor task has thrown an exception: " << e.what());
+	} catch (...) {
+		CUTEHMI_CRITICAL("Executor task has thrown an unknown exception.");
+	}
+
+	if (--m->outstanding == 0) {
+		// Mutex is locked to prevent lost wake-up in waitForDone().
+		QMutexLocker locker(& m->mutex);
+		m->doneCondition.wakeAll();
+	}
+}
+
+void Executor::retire(int index)
+{
+	// Pool mutex must be locked by the caller.
+
+	m->threadSlots[index]->alive = false;
+	m->alive--;
+}
+
+namespace internal {
+
+void postToExecutor(Executor * executor, std::function<void()> task)
+{
+	if (executor)
+		executor->post(std::move(task));
+	else
+		Executor::Default().post(std::move(task));
+}
+
+}
+
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
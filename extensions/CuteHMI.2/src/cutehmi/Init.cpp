@@ -2,14 +2,40 @@
 #include <cutehmi/ErrorInfo.hpp>
 #include <cutehmi/InplaceError.hpp>
 #include <cutehmi/Message.hpp>
+#include <cutehmi/logging.hpp>
+#include <cutehmi/trace.hpp>
 
 namespace cutehmi {
 
+namespace {
+
+int environmentValue(const char * name, int defaultValue)
+{
+	bool ok;
+	int value = qEnvironmentVariableIntValue(name, & ok);
+	return ok ? value : defaultValue;
+}
+
+}
+
 Init::Init():
 	Initializer<Init>([]() {
 	qRegisterMetaType<cutehmi::ErrorInfo>();
 	qRegisterMetaType<cutehmi::InplaceError>();
 	qRegisterMetaType<cutehmi::Message::Button>();
+
+	if (qEnvironmentVariableIntValue("CUTEHMI_ASYNC_LOGGING"))
+		installAsyncLogging(environmentValue("CUTEHMI_ASYNC_LOGGING_CAPACITY", INITIAL_ASYNC_LOGGING_CAPACITY),
+				environmentValue("CUTEHMI_ASYNC_LOGGING_RATE", INITIAL_ASYNC_LOGGING_RATE),
+				environmentValue("CUTEHMI_ASYNC_LOGGING_BURST", INITIAL_ASYNC_LOGGING_BURST));
+
+	if (qEnvironmentVariableIsSet("CUTEHMI_TRACE_FILE"))
+		Tracer::Start(environmentValue("CUTEHMI_TRACE_CAPACITY", Tracer::INITIAL_CAPACITY));
+}, []() {
+	if (qEnvironmentVariableIsSet("CUTEHMI_TRACE_FILE"))
+		Tracer::Save(qEnvironmentVariable("CUTEHMI_TRACE_FILE"));
+
+	uninstallAsyncLogging();
 }
 )
 {
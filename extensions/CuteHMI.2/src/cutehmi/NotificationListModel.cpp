@@ -1,10 +1,12 @@
 #include "../../include/cutehmi/NotificationListModel.hpp"
 
+#include <algorithm>
+
 namespace cutehmi {
 
 NotificationListModel::NotificationListModel(QObject * parent):
 	QAbstractListModel(parent),
-	m(new Members)
+	m(new Members{{}, 0, 0, 0, {}})
 {
 }
 
@@ -18,7 +20,7 @@ int NotificationListModel::rowCount(const QModelIndex & parent) const
 	if (parent.isValid())
 		return 0;
 
-	return m->notifications.count();
+	return m->count;
 }
 
 QVariant NotificationListModel::data(const QModelIndex & index, int role) const
@@ -27,13 +29,16 @@ QVariant NotificationListModel::data(const QModelIndex & index, int role) const
 		return QVariant();
 
 	if (role == Qt::DisplayRole)
-		return m->notifications.at(index.row())->text();
+		return entryAt(index.row()).notification->text();
 
 	if (role == TYPE_ROLE)
-		return m->notifications.at(index.row())->type();
+		return entryAt(index.row()).notification->type();
 
 	if (role == DATE_TIME_ROLE)
-		return m->notifications.at(index.row())->dateTime();
+		return entryAt(index.row()).notification->dateTime();
+
+	if (role == REPEAT_COUNT_ROLE)
+		return entryAt(index.row()).repeatCount;
 
 	return QVariant();
 }
@@ -43,20 +48,62 @@ QHash<int, QByteArray> NotificationListModel::roleNames() const
 	QHash<int, QByteArray> result = Parent::roleNames();
 	result[TYPE_ROLE] = "type";
 	result[DATE_TIME_ROLE] = "dateTime";
+	result[REPEAT_COUNT_ROLE] = "repeatCount";
 	return result;
 }
 
 void NotificationListModel::append(std::unique_ptr<Notification> notification)
 {
-	beginInsertRows(QModelIndex(), m->notifications.count(), m->notifications.count());
-	m->notifications.append(notification.release());
+	beginInsertRows(QModelIndex(), m->count, m->count);
+	pushBack(Entry{std::move(notification), 1});
+	endInsertRows();
+}
+
+void NotificationListModel::append(std::vector<std::unique_ptr<Notification>> notifications, int deduplicationInterval)
+{
+	EntriesContainer newEntries;
+	int firstChanged = m->count;
+	int lastChanged = -1;
+	for (auto && notification : notifications) {
+		if (deduplicationInterval > 0) {
+			Key key = KeyOf(*notification);
+			qint64 sequence = m->first + m->count + static_cast<qint64>(newEntries.size());
+			SequencesContainer::iterator it = m->sequences.find(key);
+			if (it != m->sequences.end() && *it >= m->first) {
+				int row = static_cast<int>(*it - m->first);
+				Entry & entry = row < m->count ? entryAt(row) : newEntries[static_cast<std::size_t>(row - m->count)];
+				if (entry.notification->dateTime().msecsTo(notification->dateTime()) <= deduplicationInterval) {
+					entry.notification = std::move(notification);
+					entry.repeatCount++;
+					if (row < m->count) {
+						firstChanged = std::min(firstChanged, row);
+						lastChanged = std::max(lastChanged, row);
+					}
+					continue;
+				}
+			}
+			m->sequences.insert(key, sequence);
+		}
+		newEntries.push_back(Entry{std::move(notification), 1});
+	}
+
+	if (lastChanged >= 0)
+		emit dataChanged(index(firstChanged), index(lastChanged), {DATE_TIME_ROLE, REPEAT_COUNT_ROLE});
+
+	if (newEntries.empty())
+		return;
+
+	beginInsertRows(QModelIndex(), m->count, m->count + static_cast<int>(newEntries.size()) - 1);
+	reserve(m->count + static_cast<int>(newEntries.size()));
+	for (auto && entry : newEntries)
+		pushBack(std::move(entry));
 	endInsertRows();
 }
 
 void NotificationListModel::prepend(std::unique_ptr<Notification> notification)
 {
 	beginInsertRows(QModelIndex(), 0, 0);
-	m->notifications.prepend(notification.release());
+	pushFront(Entry{std::move(notification), 1});
 	endInsertRows();
 }
 
@@ -69,7 +116,7 @@ void NotificationListModel::removeFirst(int num)
 
 	beginRemoveRows(QModelIndex(), 0, num - 1);
 	while (num > 0) {
-		delete m->notifications.takeFirst();
+		popFront();
 		num--;
 	}
 	endRemoveRows();
@@ -82,9 +129,9 @@ void NotificationListModel::removeLast(int num)
 	if (num <= 0)
 		return;
 
-	beginRemoveRows(QModelIndex(), m->notifications.count() - num, m->notifications.count() - 1);
+	beginRemoveRows(QModelIndex(), m->count - num, m->count - 1);
 	while (num > 0) {
-		delete m->notifications.takeLast();
+		popBack();
 		num--;
 	}
 	endRemoveRows();
@@ -92,15 +139,87 @@ void NotificationListModel::removeLast(int num)
 
 void NotificationListModel::clear()
 {
-	if (m->notifications.isEmpty())
+	if (m->count == 0)
 		return;
 
-	beginRemoveRows(QModelIndex(), 0, m->notifications.count() - 1);
-	while (!m->notifications.isEmpty())
-		delete m->notifications.takeFirst();
+	beginRemoveRows(QModelIndex(), 0, m->count - 1);
+	m->entries.clear();
+	m->sequences.clear();
+	m->first += m->count;
+	m->head = 0;
+	m->count = 0;
 	endRemoveRows();
 }
 
+NotificationListModel::Key NotificationListModel::KeyOf(const Notification & notification)
+{
+	return Key(notification.type(), notification.text());
+}
+
+const NotificationListModel::Entry & NotificationListModel::entryAt(int row) const
+{
+	return m->entries[static_cast<std::size_t>((m->head + row) % static_cast<int>(m->entries.size()))];
+}
+
+NotificationListModel::Entry & NotificationListModel::entryAt(int row)
+{
+	return m->entries[static_cast<std::size_t>((m->head + row) % static_cast<int>(m->entries.size()))];
+}
+
+void NotificationListModel::pushBack(Entry entry)
+{
+	reserve(m->count + 1);
+	m->count++;
+	entryAt(m->count - 1) = std::move(entry);
+}
+
+void NotificationListModel::pushFront(Entry entry)
+{
+	reserve(m->count + 1);
+	m->head = (m->head + static_cast<int>(m->entries.size()) - 1) % static_cast<int>(m->entries.size());
+	m->count++;
+	m->first--;
+	entryAt(0) = std::move(entry);
+}
+
+void NotificationListModel::popFront()
+{
+	Entry & entry = entryAt(0);
+	forget(entry, m->first);
+	entry = Entry{nullptr, 0};
+	m->head = (m->head + 1) % static_cast<int>(m->entries.size());
+	m->count--;
+	m->first++;
+}
+
+void NotificationListModel::popBack()
+{
+	Entry & entry = entryAt(m->count - 1);
+	forget(entry, m->first + m->count - 1);
+	entry = Entry{nullptr, 0};
+	m->count--;
+}
+
+void NotificationListModel::reserve(int capacity)
+{
+	if (capacity <= static_cast<int>(m->entries.size()))
+		return;
+
+	// Capacity grows geometrically, so that pushing is constant in amortized time.
+	EntriesContainer entries(static_cast<std::size_t>(std::max(capacity, 2 * static_cast<int>(m->entries.size()))));
+	for (int row = 0; row < m->count; row++)
+		entries[static_cast<std::size_t>(row)] = std::move(entryAt(row));
+	m->entries.swap(entries);
+	m->head = 0;
+}
+
+void NotificationListModel::forget(const Entry & entry, qint64 sequence)
+{
+	SequencesContainer::iterator it = m->sequences.find(KeyOf(*entry.notification));
+	if (it != m->sequences.end() && *it == sequence)
+		m->sequences.erase(it);
+}
+
 }
 
 //(c)C: Copyright © 2018-2020, Michał Policht <michal@policht.pl>. All rights reserved.
@@ -1,7 +1,14 @@
 #include "../../include/cutehmi/Notifier.hpp"
 
+#include <QThread>
+#include <QTimerEvent>
+
 namespace cutehmi {
 
+constexpr int Notifier::INITIAL_BATCH_INTERVAL;
+
+constexpr int Notifier::INITIAL_DEDUPLICATION_INTERVAL;
+
 Notifier::Notifier(QObject * parent):
 	QObject(parent),
 	m(new Members)
@@ -38,10 +45,34 @@ void Notifier::setMaxNotifications(int maxNotifications)
 	}
 }
 
-void Notifier::add(Notification * notification_l)
+int Notifier::batchInterval() const
+{
+	return m->batchInterval;
+}
+
+void Notifier::setBatchInterval(int batchInterval)
+{
+	if (m->batchInterval != batchInterval) {
+		m->batchInterval = batchInterval;
+		emit batchIntervalChanged();
+	}
+}
+
+int Notifier::deduplicationInterval() const
 {
-	QMutexLocker locker(& m->modelMutex);
+	return m->deduplicationInterval;
+}
+
+void Notifier::setDeduplicationInterval(int deduplicationInterval)
+{
+	if (m->deduplicationInterval != deduplicationInterval) {
+		m->deduplicationInterval = deduplicationInterval;
+		emit deduplicationIntervalChanged();
+	}
+}
 
+void Notifier::add(Notification * notification_l)
+{
 	switch (notification_l->type()) {
 		case Notification::INFO:
 			CUTEHMI_INFO("[NOTIFICATION] " << notification_l->text());
@@ -57,19 +88,70 @@ void Notifier::add(Notification * notification_l)
 			CUTEHMI_CRITICAL("[NOTIFICATION] " << notification_l->text());
 	}
 
-	m->model->append(notification_l->clone());
-
-	if (m->model->rowCount() > maxNotifications())
-		m->model->removeFirst();
+	bool schedule = false;
+	{
+		QMutexLocker locker(& m->pendingMutex);
+		m->pending.push_back(notification_l->clone());
+		schedule = !m->flushScheduled;
+		m->flushScheduled = true;
+	}
 
-	emit notificationAdded();
+	if (schedule) {
+		if (QThread::currentThread() == thread())
+			scheduleFlush();
+		else
+			QMetaObject::invokeMethod(this, [this]() {
+				scheduleFlush();
+			}, Qt::QueuedConnection);
+	}
 }
 
 void Notifier::clear()
 {
+	{
+		QMutexLocker locker(& m->pendingMutex);
+		m->pending.clear();
+	}
 	m->model->clear();
 }
 
+void Notifier::timerEvent(QTimerEvent * event)
+{
+	if (event->timerId() == m->flushTimer.timerId()) {
+		m->flushTimer.stop();
+		flush();
+	} else
+		QObject::timerEvent(event);
+}
+
+void Notifier::scheduleFlush()
+{
+	if (m->batchInterval <= 0)
+		flush();
+	else if (!m->flushTimer.isActive())
+		m->flushTimer.start(m->batchInterval, this);
+}
+
+void Notifier::flush()
+{
+	PendingContainer batch;
+	{
+		QMutexLocker locker(& m->pendingMutex);
+		batch.swap(m->pending);
+		m->flushScheduled = false;
+	}
+
+	if (batch.empty())
+		return;
+
+	m->model->append(std::move(batch), m->deduplicationInterval);
+
+	if (m->model->rowCount() > maxNotifications())
+		m->model->removeFirst(m->model->rowCount() - maxNotifications());
+
+	emit notificationAdded();
+}
+
 }
 
 //(c)C: Copyright © 2019-2022, Michał Policht <michal@policht.pl>. All rights reserved.
@@ -1,4 +1,5 @@
 #include "../../include/cutehmi/Worker.hpp"
+#include "../../include/cutehmi/Executor.hpp"
 
 #include <QCoreApplication>
 
@@ -55,6 +56,7 @@ bool Worker::isWorking() const
 
 void Worker::employ(QThread & thread, bool start)
 {
+	m->executor = nullptr;
 	if (& thread != QThread::currentThread()) {
 		moveToThread(& thread);
 		m->state = State::EMPLOYED;
@@ -63,6 +65,14 @@ void Worker::employ(QThread & thread, bool start)
 		work();
 }
 
+void Worker::employ(Executor & executor, bool start)
+{
+	m->executor = & executor;
+	m->state = State::EMPLOYED;
+	if (start)
+		work();
+}
+
 void Worker::work()
 {
 	m->workMutex.lock();
@@ -74,6 +84,12 @@ void Worker::work()
 		// Do not post event if worker has not been employed or current thread might get stuck waiting on unproceessed work event.
 		WorkEvent workEvent;
 		QCoreApplication::sendEvent(this, & workEvent);
+	} else if (m->executor) {
+		m->state = State::WORKING;
+		m->stateMutex.unlock();
+		m->executor->post([this]() {
+			process();
+		});
 	} else {
 		m->state = State::WORKING;
 		m->stateMutex.unlock();
@@ -90,22 +106,27 @@ void Worker::job()
 bool Worker::event(QEvent * event)
 {
 	if (event->type() == WorkEvent::RegisteredType()) {
-		job();
-		m->stateMutex.lock();
-		m->state = State::READY;
-		emit ready();
-		m->waitCondition.wakeAll();
-		m->stateMutex.unlock();
+		process();
+		return true;
+	}
+
+	return Parent::event(event);
+}
+
+void Worker::process()
+{
+	job();
+	m->stateMutex.lock();
+	m->state = State::READY;
+	emit ready();
+	m->waitCondition.wakeAll();
+	m->stateMutex.unlock();
 
 //<principle id="cutehmi::Worker-member_access_forbidden">
 // After unlocking m->workMutex object may be deleted from its former thread.
 // From now on members of Worker object must not be accessed from within itself or undefined behaviour will occur.
-		m->workMutex.unlock();
-		return true;
+	m->workMutex.unlock();
 //</principle>
-	}
-
-	return Parent::event(event);
 }
 
 QEvent::Type Worker::WorkEvent::RegisteredType() noexcept
@@ -0,0 +1,215 @@
+#include "../../../include/cutehmi/internal/AsyncMessageHandler.hpp"
+
+#include <QDateTime>
+
+#include <algorithm>
+#include <chrono>
+
+namespace cutehmi {
+namespace internal {
+
+constexpr int AsyncMessageHandler::IDLE_INTERVAL;
+
+std::atomic<AsyncMessageHandler *> AsyncMessageHandler::Instance(nullptr);
+
+std::atomic<int> AsyncMessageHandler::Producers(0);
+
+void AsyncMessageHandler::Install(int capacity, int rate, int burst)
+{
+	if (IsInstalled())
+		return;
+
+	// Previous handler is obtained before instance is created, so that Handle() never sees incomplete instance. In the meantime
+	// messages are handled by Qt default message handler.
+	QtMessageHandler previous = qInstallMessageHandler(nullptr);
+	Instance.store(new AsyncMessageHandler(previous, capacity, rate, burst), std::memory_order_release);
+	qInstallMessageHandler(& AsyncMessageHandler::Handle);
+}
+
+void AsyncMessageHandler::Uninstall()
+{
+	AsyncMessageHandler * handler = Instance.load(std::memory_order_acquire);
+	if (!handler)
+		return;
+
+	qInstallMessageHandler(handler->m->previous);
+
+	// Withdrawing the instance and checking producers pairs with incrementing producers and loading the instance in Handle(). Both
+	// sides store and then load different variables, so that only sequential consistency guarantees that at least one of them
+	// sees the store of the other one. Weaker ordering would allow Handle() to use the instance, which is about to be deleted.
+	Instance.store(nullptr, std::memory_order_seq_cst);
+
+	// Wait for the producers, which might have obtained the instance before it has been withdrawn.
+	while (Producers.load(std::memory_order_seq_cst) > 0)
+		std::this_thread::yield();
+
+	delete handler;
+}
+
+bool AsyncMessageHandler::IsInstalled()
+{
+	return Instance.load(std::memory_order_acquire) != nullptr;
+}
+
+void AsyncMessageHandler::Handle(QtMsgType type, const QMessageLogContext & context, const QString & message)
+{
+	// See Uninstall() for a reason of sequentially consistent ordering.
+	Producers.fetch_add(1, std::memory_order_seq_cst);
+	AsyncMessageHandler * handler = Instance.load(std::memory_order_seq_cst);
+	if (handler) {
+		if (type == QtFatalMsg) {
+			// Fatal message aborts the application, so pending messages are written first. Background thread can not wait for
+			// itself though.
+			if (std::this_thread::get_id() != handler->m->threadId.load())
+				handler->flush();
+			handler->m->previous(type, context, message);
+		} else if (std::this_thread::get_id() == handler->m->threadId.load())
+			handler->m->previous(type, context, message);
+		else
+			handler->enqueue(type, context, message);
+	} else
+		qt_message_output(type, context, message);
+	Producers.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+AsyncMessageHandler::AsyncMessageHandler(QtMessageHandler previous, int capacity, int rate, int burst):
+	m(new Members(previous, capacity, rate, burst))
+{
+}
+
+AsyncMessageHandler::~AsyncMessageHandler()
+{
+	m->running.store(false);
+	if (m->thread.joinable())
+		m->thread.join();
+}
+
+void AsyncMessageHandler::enqueue(QtMsgType type, const QMessageLogContext & context, const QString & message)
+{
+	// Thread is started lazily, because handler may be installed during static initialization.
+	std::call_once(m->startFlag, [this]() {
+		m->thread = std::thread(& AsyncMessageHandler::run, this);
+	});
+
+	Record record;
+	record.type = type;
+	record.category = context.category;
+	record.file = context.file;
+	record.line = context.line;
+	record.function = context.function;
+	record.message = message;
+	record.timestamp = QDateTime::currentMSecsSinceEpoch();
+	if (!m->buffer.push(std::move(record)))
+		m->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncMessageHandler::run()
+{
+	m->threadId.store(std::this_thread::get_id());
+
+	while (true) {
+		std::unique_lock<std::mutex> lock(m->consumerMutex);
+		bool idle = !drain();
+
+		if (!m->running.load()) {
+			if (idle) {
+				reportSuppressed(true);
+				break;
+			}
+		} else if (idle) {
+			reportSuppressed(false);
+			lock.unlock();
+			std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_INTERVAL));
+		}
+	}
+}
+
+void AsyncMessageHandler::flush()
+{
+	std::lock_guard<std::mutex> lock(m->consumerMutex);
+	drain();
+	reportSuppressed(true);
+}
+
+bool AsyncMessageHandler::drain()
+{
+	bool result = false;
+	Record record;
+	while (m->buffer.pop(record)) {
+		result = true;
+		process(record);
+	}
+	reportDropped();
+	return result;
+}
+
+void AsyncMessageHandler::process(const Record & record)
+{
+	// Critical messages are never suppressed.
+	if (m->rate > 0.0 && record.type != QtCriticalMsg) {
+		BucketsContainer::iterator bucket = m->buckets.find(record.category);
+		if (bucket == m->buckets.end())
+			bucket = m->buckets.insert(record.category, Bucket{static_cast<qreal>(m->burst), record.timestamp, 0});
+		if (!admit(*bucket, record.timestamp)) {
+			bucket->suppressed++;
+			return;
+		}
+		if (bucket->suppressed > 0) {
+			write(QtWarningMsg, record.category.constData(), QStringLiteral("Suppressed %1 messages of this category due to rate limiting.").arg(bucket->suppressed));
+			bucket->suppressed = 0;
+		}
+	}
+
+	QMessageLogContext context(record.file, record.line, record.function, record.category.constData());
+	m->previous(record.type, context, record.message);
+}
+
+bool AsyncMessageHandler::admit(Bucket & bucket, qint64 timestamp)
+{
+	if (timestamp > bucket.updated) {
+		bucket.tokens = std::min(static_cast<qreal>(m->burst), bucket.tokens + (timestamp - bucket.updated) * m->rate / 1000.0);
+		bucket.updated = timestamp;
+	}
+	if (bucket.tokens < 1.0)
+		return false;
+
+	bucket.tokens -= 1.0;
+	return true;
+}
+
+void AsyncMessageHandler::reportSuppressed(bool force)
+{
+	qint64 now = QDateTime::currentMSecsSinceEpoch();
+	for (BucketsContainer::iterator bucket = m->buckets.begin(); bucket != m->buckets.end(); ++bucket)
+		if (bucket->suppressed > 0 && (force || admit(*bucket, now))) {
+			write(QtWarningMsg, bucket.key().constData(), QStringLiteral("Suppressed %1 messages of this category due to rate limiting.").arg(bucket->suppressed));
+			bucket->suppressed = 0;
+		}
+}
+
+void AsyncMessageHandler::reportDropped()
+{
+	quint64 dropped = m->dropped.exchange(0, std::memory_order_relaxed);
+	if (dropped > 0)
+		write(QtWarningMsg, loggingCategory().categoryName(), QStringLiteral("Dropped %1 messages, because logging buffer was full.").arg(dropped));
+}
+
+void AsyncMessageHandler::write(QtMsgType type, const char * category, const QString & message) const
+{
+	QMessageLogContext context(nullptr, 0, nullptr, category);
+	m->previous(type, context, message);
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
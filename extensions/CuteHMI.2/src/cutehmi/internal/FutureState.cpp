@@ -0,0 +1,106 @@
+#include "../../../include/cutehmi/internal/FutureState.hpp"
+
+#include <stdexcept>
+
+namespace cutehmi {
+namespace internal {
+
+FutureStateBase::FutureStateBase():
+	m_finished(false)
+{
+}
+
+FutureStateBase::~FutureStateBase()
+{
+}
+
+bool FutureStateBase::isFinished() const
+{
+	QMutexLocker locker(& m_mutex);
+	return m_finished;
+}
+
+void FutureStateBase::wait() const
+{
+	QMutexLocker locker(& m_mutex);
+	while (!m_finished)
+		m_finishedCondition.wait(& m_mutex);
+}
+
+void FutureStateBase::addContinuation(Continuation continuation)
+{
+	{
+		QMutexLocker locker(& m_mutex);
+		if (!m_finished) {
+			m_continuations.append(std::move(continuation));
+			return;
+		}
+	}
+	continuation();
+}
+
+std::exception_ptr FutureStateBase::exception() const
+{
+	QMutexLocker locker(& m_mutex);
+	return m_exception;
+}
+
+void FutureStateBase::reportException(std::exception_ptr exception)
+{
+	{
+		QMutexLocker locker(& m_mutex);
+		m_exception = exception;
+	}
+	finish();
+}
+
+void FutureStateBase::finish()
+{
+	QList<Continuation> continuations;
+	{
+		QMutexLocker locker(& m_mutex);
+		m_finished = true;
+		continuations.swap(m_continuations);
+		m_finishedCondition.wakeAll();
+	}
+	// Continuations are called without holding the mutex, so that they can freely access the state.
+	for (auto && continuation : continuations)
+		continuation();
+}
+
+void FutureStateBase::waitAndRethrow() const
+{
+	wait();
+	if (std::exception_ptr exception = this->exception())
+		std::rethrow_exception(exception);
+}
+
+ContinuationGuard::ContinuationGuard(std::shared_ptr<FutureStateBase> state):
+	m_state(std::move(state))
+{
+}
+
+ContinuationGuard::~ContinuationGuard()
+{
+	if (m_state)
+		m_state->reportException(std::make_exception_ptr(std::runtime_error("Continuation context has been destroyed.")));
+}
+
+void ContinuationGuard::dismiss()
+{
+	m_state.reset();
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
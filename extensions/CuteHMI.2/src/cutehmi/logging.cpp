@@ -1,8 +1,28 @@
 #include "../../include/cutehmi/logging.hpp"
 #include "../../include/cutehmi/metadata.hpp"
+#include "../../include/cutehmi/internal/AsyncMessageHandler.hpp"
 
 Q_LOGGING_CATEGORY(cutehmi_loggingCategory, CUTEHMI_NAME)
 
+namespace cutehmi {
+
+void installAsyncLogging(int capacity, int rate, int burst)
+{
+	internal::AsyncMessageHandler::Install(capacity, rate, burst);
+}
+
+void uninstallAsyncLogging()
+{
+	internal::AsyncMessageHandler::Uninstall();
+}
+
+bool isAsyncLoggingInstalled()
+{
+	return internal::AsyncMessageHandler::IsInstalled();
+}
+
+}
+
 //(c)C: Copyright © 2018-2020, Michał Policht <michal@policht.pl>. All rights reserved.
 //(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
 //(c)C: This file is a part of CuteHMI.
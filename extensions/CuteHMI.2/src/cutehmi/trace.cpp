@@ -0,0 +1,279 @@
+#include "../../include/cutehmi/trace.hpp"
+#include "../../include/cutehmi/logging.hpp"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QThread>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace cutehmi {
+
+namespace {
+
+struct Event
+{
+	qint64 begin;
+	qint64 duration;	// Negative duration denotes instant event.
+	const char * name;
+	quint32 category;
+};
+
+struct ThreadBuffer
+{
+	std::unique_ptr<Event[]> events;
+	quint64 capacity;
+	quint64 generation;
+	int tid;
+	QByteArray threadName;
+	std::atomic<quint64> head;
+	std::atomic<bool> busy;
+
+	ThreadBuffer(quint64 p_capacity, quint64 p_generation, int p_tid, const QByteArray & p_threadName):
+		events(new Event[p_capacity]),
+		capacity(p_capacity),
+		generation(p_generation),
+		tid(p_tid),
+		threadName(p_threadName),
+		head(0),
+		busy(false)
+	{
+	}
+};
+
+struct Registry
+{
+	QMutex mutex;
+	std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+	std::atomic<quint64> generation;
+	quint64 capacity;
+	int nextTid;
+	std::chrono::steady_clock::time_point epoch;
+
+	Registry():
+		generation(0),
+		capacity(Tracer::INITIAL_CAPACITY),
+		nextTid(1),
+		epoch(std::chrono::steady_clock::now())
+	{
+	}
+};
+
+Registry & registry()
+{
+	static Registry instance;
+	return instance;
+}
+
+// Thread keeps a shared pointer to its buffer, so that the buffer outlives the thread until it is exported or cleared.
+thread_local std::shared_ptr<ThreadBuffer> LocalBuffer;
+
+ThreadBuffer * localBuffer()
+{
+	Registry & reg = registry();
+	quint64 generation = reg.generation.load(std::memory_order_acquire);
+	if (LocalBuffer && LocalBuffer->generation == generation)
+		return LocalBuffer.get();
+
+	QMutexLocker locker(& reg.mutex);
+	QByteArray threadName;
+	if (QThread::currentThread())
+		threadName = QThread::currentThread()->objectName().toUtf8();
+	int tid = reg.nextTid++;
+	if (threadName.isEmpty())
+		threadName = "Thread " + QByteArray::number(tid);
+	LocalBuffer = std::make_shared<ThreadBuffer>(reg.capacity, reg.generation.load(std::memory_order_relaxed), tid, threadName);
+	reg.buffers.push_back(LocalBuffer);
+	return LocalBuffer.get();
+}
+
+const char * categoryName(quint32 category)
+{
+	switch (category) {
+		case TRACE_MODBUS:
+			return "modbus";
+		case TRACE_CONTROLLERS:
+			return "controllers";
+		case TRACE_DATABASE:
+			return "database";
+		case TRACE_SERVICES:
+			return "services";
+		case TRACE_USER:
+			return "user";
+		default:
+			return "cutehmi";
+	}
+}
+
+void appendEscaped(QByteArray & json, const char * string)
+{
+	for (const char * c = string; *c != '\0'; c++) {
+		switch (*c) {
+			case '"':
+				json.append("\\\"");
+				break;
+			case '\\':
+				json.append("\\\\");
+				break;
+			default:
+				if (static_cast<unsigned char>(*c) < 0x20)
+					json.append("\\u00").append(QByteArray::number(static_cast<unsigned char>(*c), 16).rightJustified(2, '0'));
+				else
+					json.append(*c);
+		}
+	}
+}
+
+void appendMicroseconds(QByteArray & json, qint64 nanoseconds)
+{
+	json.append(QByteArray::number(nanoseconds / 1000)).append('.').append(QByteArray::number(nanoseconds % 1000).rightJustified(3, '0'));
+}
+
+}
+
+constexpr int Tracer::INITIAL_CAPACITY;
+
+std::atomic<bool> Tracer::Recording(false);
+
+void Tracer::Start(int capacity)
+{
+	Stop();
+
+	Registry & reg = registry();
+	QMutexLocker locker(& reg.mutex);
+	reg.buffers.clear();
+	reg.capacity = static_cast<quint64>(qMax(capacity, 1));
+	reg.nextTid = 1;
+	// Bumping generation makes threads allocate fresh buffers on their next event.
+	reg.generation.fetch_add(1, std::memory_order_acq_rel);
+	Recording.store(true);
+}
+
+void Tracer::Stop()
+{
+	Recording.store(false);
+
+	// Wait for the writers, which might have checked recording flag before it has been cleared.
+	Registry & reg = registry();
+	QMutexLocker locker(& reg.mutex);
+	for (auto && buffer : reg.buffers)
+		while (buffer->busy.load())
+			std::this_thread::yield();
+}
+
+qint64 Tracer::Now()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - registry().epoch).count();
+}
+
+void Tracer::RecordComplete(quint32 category, const char * name, qint64 begin, qint64 end)
+{
+	if (IsRecording())
+		Record(category, name, begin, qMax(end - begin, Q_INT64_C(0)));
+}
+
+void Tracer::RecordInstant(quint32 category, const char * name)
+{
+	if (IsRecording())
+		Record(category, name, Now(), -1);
+}
+
+bool Tracer::ExportChromeJson(QIODevice & device)
+{
+	Stop();
+
+	Registry & reg = registry();
+	QMutexLocker locker(& reg.mutex);
+
+	QByteArray pid = QByteArray::number(QCoreApplication::applicationPid());
+	QByteArray json;
+	json.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+	bool first = true;
+	auto flush = [& device, & json]() -> bool {
+		bool result = device.write(json) == json.size();
+		json.clear();
+		return result;
+	};
+
+	for (auto && buffer : reg.buffers) {
+		QByteArray tid = QByteArray::number(buffer->tid);
+
+		if (!first)
+			json.append(',');
+		first = false;
+		json.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":").append(pid).append(",\"tid\":").append(tid).append(",\"args\":{\"name\":\"");
+		appendEscaped(json, buffer->threadName.constData());
+		json.append("\"}}");
+
+		quint64 head = buffer->head.load(std::memory_order_acquire);
+		quint64 tail = head > buffer->capacity ? head - buffer->capacity : 0;
+		for (quint64 i = tail; i < head; i++) {
+			const Event & event = buffer->events[i % buffer->capacity];
+			json.append(",{\"name\":\"");
+			appendEscaped(json, event.name);
+			json.append("\",\"cat\":\"").append(categoryName(event.category)).append("\",\"ph\":\"");
+			if (event.duration < 0)
+				json.append("i\",\"s\":\"t\"");
+			else {
+				json.append("X\",\"dur\":");
+				appendMicroseconds(json, event.duration);
+			}
+			json.append(",\"ts\":");
+			appendMicroseconds(json, event.begin);
+			json.append(",\"pid\":").append(pid).append(",\"tid\":").append(tid).append('}');
+
+			if (json.size() > 65536 && !flush())
+				return false;
+		}
+	}
+	json.append("]}\n");
+
+	return flush();
+}
+
+bool Tracer::Save(const QString & fileName)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		CUTEHMI_WARNING("Could not open file '" << fileName << "' to save the trace: " << file.errorString());
+		return false;
+	}
+	if (!ExportChromeJson(file)) {
+		CUTEHMI_WARNING("Could not save the trace to file '" << fileName << "': " << file.errorString());
+		return false;
+	}
+	return true;
+}
+
+void Tracer::Record(quint32 category, const char * name, qint64 begin, qint64 duration)
+{
+	ThreadBuffer * buffer = localBuffer();
+
+	// Busy flag is raised before recording flag is re-checked, so that Stop() either sees the writer or the writer sees the recording
+	// has been stopped (both use sequentially consistent ordering).
+	buffer->busy.store(true);
+	if (Recording.load()) {
+		quint64 head = buffer->head.load(std::memory_order_relaxed);
+		buffer->events[head % buffer->capacity] = Event{begin, duration, name, category};
+		buffer->head.store(head + 1, std::memory_order_release);
+	}
+	buffer->busy.store(false);
+}
+
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,201 @@
+#include <cutehmi/Executor.hpp>
+#include <cutehmi/Worker.hpp>
+
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace cutehmi {
+
+class test_Executor:
+	public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void run();
+
+		void then();
+
+		void thenException();
+
+		void thenContext();
+
+		void thenContextDestroyed();
+
+		void nestedPost();
+
+		void elastic();
+
+		void worker();
+};
+
+void test_Executor::run()
+{
+	Executor executor(4);
+	QCOMPARE(executor.threadCount(), 4);
+	QCOMPARE(executor.maxThreadCount(), 4);
+
+	QList<Future<int>> futures;
+	for (int i = 0; i < 100; i++)
+		futures.append(executor.run([i]() {
+			return i * i;
+		}));
+
+	for (int i = 0; i < futures.count(); i++)
+		QCOMPARE(futures.at(i).result(), i * i);
+}
+
+void test_Executor::then()
+{
+	Executor executor(2);
+
+	Future<QString> future = executor.run([]() {
+		return 21;
+	}).then([](int value) {
+		return value * 2;
+	}).then([](int value) {
+		return QString::number(value);
+	});
+	QCOMPARE(future.result(), QString("42"));
+
+	std::atomic<bool> called(false);
+	Future<void> voidFuture = executor.run([]() {}).then([& called]() {
+		called = true;
+	});
+	voidFuture.waitForFinished();
+	QVERIFY(voidFuture.isFinished());
+	QVERIFY(called);
+}
+
+void test_Executor::thenException()
+{
+	Executor executor(2);
+
+	std::atomic<bool> called(false);
+	Future<int> future = executor.run([]() -> int {
+		throw std::runtime_error("failure");
+	}).then([& called](int value) {
+		called = true;
+		return value;
+	});
+	QVERIFY_EXCEPTION_THROWN(future.result(), std::runtime_error);
+	QVERIFY(!called);
+}
+
+void test_Executor::thenContext()
+{
+	Executor executor(2);
+
+	QThread * continuationThread = nullptr;
+	Future<void> future = executor.run([]() {
+		return 1;
+	}).then(this, [& continuationThread](int) {
+		continuationThread = QThread::currentThread();
+	});
+	QTRY_VERIFY(future.isFinished());
+	QCOMPARE(continuationThread, thread());
+}
+
+void test_Executor::thenContextDestroyed()
+{
+	Executor executor(2);
+
+	Future<int> antecedent = executor.run([]() {
+		return 1;
+	});
+	antecedent.waitForFinished();
+
+	// Continuation is queued, but context object is destroyed before event loop gets a chance to call it.
+	bool called = false;
+	QObject * context = new QObject;
+	Future<void> future = antecedent.then(context, [& called](int) {
+		called = true;
+	});
+	QVERIFY(!future.isFinished());
+	delete context;
+	QVERIFY(future.isFinished());
+	QVERIFY_EXCEPTION_THROWN(future.result(), std::runtime_error);
+	QCoreApplication::processEvents();
+	QVERIFY(!called);
+}
+
+void test_Executor::nestedPost()
+{
+	Executor executor(4);
+
+	std::atomic<int> counter(0);
+	std::atomic<int> foreignThreads(0);
+	for (int i = 0; i < 16; i++)
+		executor.post([& executor, & counter, & foreignThreads]() {
+			if (!executor.isExecutorThread())
+				foreignThreads++;
+			for (int j = 0; j < 16; j++)
+				executor.post([& counter]() {
+					counter++;
+				});
+		});
+	executor.waitForDone();
+	QCOMPARE(counter.load(), 256);
+	QCOMPARE(foreignThreads.load(), 0);
+	QVERIFY(!executor.isExecutorThread());
+}
+
+void test_Executor::elastic()
+{
+	Executor executor(1, 4);
+	executor.setExpiryTimeout(50);
+	QCOMPARE(executor.activeThreadCount(), 1);
+
+	QSemaphore started;
+	QSemaphore release;
+	for (int i = 0; i < 4; i++)
+		executor.post([& started, & release]() {
+			started.release();
+			release.acquire();
+		});
+	// All tasks can only start, if additional threads have been spawned.
+	QVERIFY(started.tryAcquire(4, 5000));
+	QCOMPARE(executor.activeThreadCount(), 4);
+	release.release(4);
+	executor.waitForDone();
+
+	QTRY_COMPARE(executor.activeThreadCount(), 1);
+}
+
+void test_Executor::worker()
+{
+	Executor executor(2);
+
+	std::atomic<int> counter(0);
+	Worker worker([& counter]() {
+		counter++;
+	});
+	QSignalSpy readySpy(& worker, & Worker::ready);
+	worker.employ(executor);
+	worker.wait();
+	QVERIFY(worker.isReady());
+	QCOMPARE(counter.load(), 1);
+
+	worker.work();
+	worker.wait();
+	QCOMPARE(counter.load(), 2);
+	QTRY_COMPARE(readySpy.count(), 2);
+}
+
+}
+
+QTEST_MAIN(cutehmi::test_Executor)
+#include "test_Executor.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,107 @@
+#include <cutehmi/Notifier.hpp>
+#include <cutehmi/Notification.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+
+class test_Notifier:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void init();
+
+		void batch();
+
+		void deduplicate();
+
+		void maxNotifications();
+
+		void immediate();
+};
+
+void test_Notifier::init()
+{
+	Notifier & notifier = Notifier::Instance();
+	notifier.setBatchInterval(Notifier::INITIAL_BATCH_INTERVAL);
+	notifier.setDeduplicationInterval(Notifier::INITIAL_DEDUPLICATION_INTERVAL);
+	notifier.setMaxNotifications(std::numeric_limits<int>::max());
+	notifier.clear();
+}
+
+void test_Notifier::batch()
+{
+	Notifier & notifier = Notifier::Instance();
+	QSignalSpy addedSpy(& notifier, & Notifier::notificationAdded);
+	QSignalSpy insertedSpy(notifier.model(), & QAbstractItemModel::rowsInserted);
+
+	for (int i = 0; i < 200; i++)
+		Notification::Warning(QString("Service %1 has failed.").arg(i));
+	QCOMPARE(notifier.model()->rowCount(), 0);
+
+	QTRY_COMPARE(notifier.model()->rowCount(), 200);
+	QCOMPARE(insertedSpy.count(), 1);
+	QCOMPARE(addedSpy.count(), 1);
+	QCOMPARE(notifier.model()->data(notifier.model()->index(199)).toString(), QString("Service 199 has failed."));
+}
+
+void test_Notifier::deduplicate()
+{
+	Notifier & notifier = Notifier::Instance();
+	NotificationListModel * model = notifier.model();
+
+	for (int i = 0; i < 100; i++)
+		Notification::Critical("Connection lost.");
+	QTRY_COMPARE(model->rowCount(), 1);
+	QCOMPARE(model->data(model->index(0), NotificationListModel::REPEAT_COUNT_ROLE).toInt(), 100);
+
+	QSignalSpy changedSpy(model, & QAbstractItemModel::dataChanged);
+	Notification::Critical("Connection lost.");
+	Notification::Warning("Connection lost.");
+	QTRY_COMPARE(model->rowCount(), 2);
+	QCOMPARE(changedSpy.count(), 1);
+	QCOMPARE(model->data(model->index(0), NotificationListModel::REPEAT_COUNT_ROLE).toInt(), 101);
+	QCOMPARE(model->data(model->index(1), NotificationListModel::REPEAT_COUNT_ROLE).toInt(), 1);
+}
+
+void test_Notifier::maxNotifications()
+{
+	Notifier & notifier = Notifier::Instance();
+	NotificationListModel * model = notifier.model();
+	notifier.setMaxNotifications(10);
+
+	for (int round = 0; round < 3; round++) {
+		for (int i = 0; i < 25; i++)
+			Notification::Info(QString("Notification %1.").arg(round * 25 + i));
+		QTRY_COMPARE(model->data(model->index(9)).toString(), QString("Notification %1.").arg(round * 25 + 24));
+		QCOMPARE(model->rowCount(), 10);
+		QCOMPARE(model->data(model->index(0)).toString(), QString("Notification %1.").arg(round * 25 + 15));
+	}
+}
+
+void test_Notifier::immediate()
+{
+	Notifier & notifier = Notifier::Instance();
+	notifier.setBatchInterval(0);
+
+	Notification::Info("Immediate.");
+	QCOMPARE(notifier.model()->rowCount(), 1);
+}
+
+}
+
+QTEST_MAIN(cutehmi::test_Notifier)
+#include "test_Notifier.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -2,6 +2,10 @@
 
 #include <QtTest/QtTest>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 namespace cutehmi {
 
 class test_logging:
@@ -10,14 +14,135 @@ class test_logging:
 	Q_OBJECT
 
 	private slots:
+		void cleanup();
+
 		void loggingCategory();
+
+		void asyncLogging();
+
+		void asyncLoggingCritical();
+
+		void concurrentInstall();
+
+	private:
+		static void CaptureMessage(QtMsgType type, const QMessageLogContext & context, const QString & message);
+
+		static int SumCounts(const QRegularExpression & expression);
+
+		static QMutex CapturedMutex;
+		static QStringList CapturedMessages;
+		static QList<std::thread::id> CapturedThreads;
 };
 
+QMutex test_logging::CapturedMutex;
+QStringList test_logging::CapturedMessages;
+QList<std::thread::id> test_logging::CapturedThreads;
+
 void test_logging::loggingCategory()
 {
 	QCOMPARE(cutehmi::loggingCategory().categoryName(), "CuteHMI.2");
 }
 
+void test_logging::asyncLogging()
+{
+	QtMessageHandler previous = qInstallMessageHandler(& test_logging::CaptureMessage);
+
+	installAsyncLogging(16, 1, 5);
+	QVERIFY(isAsyncLoggingInstalled());
+	for (int i = 0; i < 100; i++)
+		CUTEHMI_WARNING("Message " << i);
+	uninstallAsyncLogging();
+	QVERIFY(!isAsyncLoggingInstalled());
+
+	qInstallMessageHandler(previous);
+
+	QMutexLocker locker(& CapturedMutex);
+	// Burst of 5 messages passes, the rest is either suppressed by rate limiter or dropped due to full buffer. Few more messages may
+	// pass, if test runs slowly and rate limiter refills its bucket, but each message must be accounted for.
+	int passed = CapturedMessages.filter(QRegularExpression("^Message \\d+$")).count();
+	QVERIFY(passed >= 5);
+	QCOMPARE(passed + SumCounts(QRegularExpression("^Suppressed (\\d+) messages")) + SumCounts(QRegularExpression("^Dropped (\\d+) messages")), 100);
+	QCOMPARE(CapturedMessages.first(), QString("Message 0"));
+	QVERIFY(!CapturedThreads.contains(std::this_thread::get_id()));
+}
+
+void test_logging::asyncLoggingCritical()
+{
+	QtMessageHandler previous = qInstallMessageHandler(& test_logging::CaptureMessage);
+
+	installAsyncLogging(64, 1, 5);
+	for (int i = 0; i < 20; i++)
+		CUTEHMI_CRITICAL("Critical " << i);
+	uninstallAsyncLogging();
+
+	qInstallMessageHandler(previous);
+
+	// Critical messages are not rate-limited.
+	QMutexLocker locker(& CapturedMutex);
+	QCOMPARE(CapturedMessages.filter(QRegularExpression("^Critical \\d+$")).count(), 20);
+	QCOMPARE(SumCounts(QRegularExpression("^Suppressed (\\d+) messages")), 0);
+}
+
+void test_logging::concurrentInstall()
+{
+	QtMessageHandler previous = qInstallMessageHandler(& test_logging::CaptureMessage);
+
+	// Producers log messages, while handler is being installed and uninstalled. Uninstall must not delete the handler, while any of
+	// the producers is still using it.
+	std::atomic<bool> running(true);
+	std::vector<std::thread> producers;
+	for (int i = 0; i < 4; i++)
+		producers.emplace_back([& running]() {
+			while (running.load())
+				qInfo("Concurrent message");
+		});
+
+	for (int i = 0; i < 200; i++) {
+		installAsyncLogging(64, 0, 0);
+		QVERIFY(isAsyncLoggingInstalled());
+		std::this_thread::yield();
+		uninstallAsyncLogging();
+		QVERIFY(!isAsyncLoggingInstalled());
+	}
+
+	running.store(false);
+	for (auto && producer : producers)
+		producer.join();
+
+	qInstallMessageHandler(previous);
+
+	QMutexLocker locker(& CapturedMutex);
+	QVERIFY(!CapturedMessages.filter("Concurrent message").isEmpty());
+}
+
+void test_logging::cleanup()
+{
+	QMutexLocker locker(& CapturedMutex);
+	CapturedMessages.clear();
+	CapturedThreads.clear();
+}
+
+int test_logging::SumCounts(const QRegularExpression & expression)
+{
+	int result = 0;
+	for (auto message : CapturedMessages) {
+		QRegularExpressionMatch match = expression.match(message);
+		if (match.hasMatch())
+			result += match.captured(1).toInt();
+	}
+	return result;
+}
+
+void test_logging::CaptureMessage(QtMsgType type, const QMessageLogContext & context, const QString & message)
+{
+	Q_UNUSED(type)
+	Q_UNUSED(context)
+
+	QMutexLocker locker(& CapturedMutex);
+	CapturedMessages.append(message);
+	CapturedThreads.append(std::this_thread::get_id());
+}
+
 }
 
 QTEST_MAIN(cutehmi::test_logging)
@@ -0,0 +1,140 @@
+#include <cutehmi/trace.hpp>
+
+#include <QtTest/QtTest>
+
+#include <QBuffer>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace cutehmi {
+
+class test_trace:
+	public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void scope();
+
+		void instant();
+
+		void threads();
+
+		void notRecording();
+
+		void overwrite();
+
+	private:
+		static QJsonArray Export(const QString & name = QString());
+};
+
+QJsonArray test_trace::Export(const QString & name)
+{
+	QBuffer buffer;
+	buffer.open(QIODevice::WriteOnly);
+	if (!Tracer::ExportChromeJson(buffer))
+		return QJsonArray();
+
+	QJsonParseError error;
+	QJsonDocument document = QJsonDocument::fromJson(buffer.data(), & error);
+	if (error.error != QJsonParseError::NoError)
+		return QJsonArray();
+
+	QJsonArray result;
+	for (const QJsonValue & event : document.object().value("traceEvents").toArray())
+		if (name.isNull() || event.toObject().value("name").toString() == name)
+			result.append(event);
+	return result;
+}
+
+void test_trace::scope()
+{
+	Tracer::Start();
+	QVERIFY(Tracer::IsRecording());
+	{
+		CUTEHMI_TRACE_SCOPE(TRACE_USER, "scope");
+		QTest::qWait(10);
+	}
+	QJsonArray events = Export("scope");
+	QVERIFY(!Tracer::IsRecording());
+
+	QCOMPARE(events.count(), 1);
+	QJsonObject event = events.first().toObject();
+	QCOMPARE(event.value("ph").toString(), QString("X"));
+	QCOMPARE(event.value("cat").toString(), QString("user"));
+	QVERIFY(event.value("dur").toDouble() >= 10000.0);
+}
+
+void test_trace::instant()
+{
+	Tracer::Start();
+	CUTEHMI_TRACE_INSTANT(TRACE_SERVICES, "instant");
+	QJsonArray events = Export("instant");
+
+	QCOMPARE(events.count(), 1);
+	QJsonObject event = events.first().toObject();
+	QCOMPARE(event.value("ph").toString(), QString("i"));
+	QCOMPARE(event.value("cat").toString(), QString("services"));
+}
+
+void test_trace::threads()
+{
+	Tracer::Start();
+	QList<QThread *> threads;
+	for (int i = 0; i < 4; i++) {
+		threads.append(QThread::create([]() {
+			for (int j = 0; j < 100; j++) {
+				CUTEHMI_TRACE_SCOPE(TRACE_USER, "thread");
+			}
+		}));
+		threads.last()->setObjectName(QString("Tracer %1").arg(i));
+		threads.last()->start();
+	}
+	for (QThread * thread : threads) {
+		QVERIFY(thread->wait(5000));
+		delete thread;
+	}
+	QCOMPARE(Export("thread").count(), 400);
+
+	QSet<int> tids;
+	for (const QJsonValue & event : Export("thread_name"))
+		if (event.toObject().value("args").toObject().value("name").toString().startsWith("Tracer"))
+			tids.insert(event.toObject().value("tid").toInt());
+	QCOMPARE(tids.count(), 4);
+}
+
+void test_trace::notRecording()
+{
+	Tracer::Start();
+	Tracer::Stop();
+	{
+		CUTEHMI_TRACE_SCOPE(TRACE_USER, "stopped");
+	}
+	CUTEHMI_TRACE_INSTANT(TRACE_USER, "stopped");
+	QVERIFY(Export("stopped").isEmpty());
+}
+
+void test_trace::overwrite()
+{
+	Tracer::Start(16);
+	for (int i = 0; i < 100; i++)
+		CUTEHMI_TRACE_INSTANT(TRACE_USER, "overwrite");
+	QCOMPARE(Export("overwrite").count(), 16);
+}
+
+}
+
+QTEST_MAIN(cutehmi::test_trace)
+#include "test_trace.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -6,8 +6,10 @@
 #include "Schema.hpp"
 
 #include <cutehmi/services/Serviceable.hpp>
+#include <cutehmi/shareddatabase/NotificationListener.hpp>
 
 #include <QAbstractListModel>
+#include <QElapsedTimer>
 
 namespace cutehmi {
 namespace dataacquisition {
@@ -26,6 +28,8 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 	public:
 		static constexpr int INITIAL_INTERVAL = 1000;
 
+		static constexpr bool INITIAL_PUSH = false;
+
 		/**
 		  busy status. Indicates that object is busy processing SQL request.
 		  */
@@ -39,6 +43,21 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 		  */
 		Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
 
+		/**
+		  Push mode. In push mode model is not updated periodically. Instead it listens to notifications sent by the writers and
+		  updates itself only after the data has changed. Interval is then used as a minimal delay between the notification and
+		  the update, so that bursts of notifications result in a single update. Models of append-only tables (EventModel,
+		  HistoryModel) then select only rows newer than the most recent one they hold, as long as selection criteria remain the
+		  same. Rows committed with a time older than that are picked up on next full selection.
+		  */
+		Q_PROPERTY(bool push READ push WRITE setPush NOTIFY pushChanged)
+
+		/**
+		  Latency [ms] of last update. Time elapsed between the request and arrival of the results. Requests superseded by
+		  newer ones are not accounted.
+		  */
+		Q_PROPERTY(int latency READ latency NOTIFY latencyChanged)
+
 		Q_PROPERTY(cutehmi::dataacquisition::Schema * schema READ schema WRITE setSchema NOTIFY schemaChanged)
 
 		AbstractListModel(QObject * parent = nullptr);
@@ -49,6 +68,12 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 
 		void setInterval(int interval);
 
+		bool push() const;
+
+		void setPush(bool push);
+
+		int latency() const;
+
 		Schema * schema() const;
 
 		void setSchema(Schema * schema);
@@ -81,6 +106,10 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 	signals:
 		void intervalChanged();
 
+		void pushChanged();
+
+		void latencyChanged();
+
 		void schemaChanged();
 
 		void busyChanged();
@@ -105,6 +134,23 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 
 		Q_SIGNAL void updateFinished();
 
+		/**
+		 * Check whether notification concerns the model. Default implementation accepts all the notifications of the schema.
+		 * @param payload notification payload, which contains stem of the table that has changed.
+		 * @return @p true if model should be updated in response to the notification, @p false otherwise.
+		 */
+		virtual bool acceptsNotification(const QString & payload) const;
+
+		/**
+		 * Start measuring latency. Should be called, when update is requested. Restarts the measurement, if previous request is
+		 * still pending.
+		 */
+		void startLatencyTimer();
+
+		/**
+		 * Update latency property. Should be called, when results of the request arrive.
+		 */
+		void updateLatency();
 
 	private slots:
 		void onSchemaValidated(bool result);
@@ -113,17 +159,31 @@ class CUTEHMI_DATAACQUISITION_API AbstractListModel:
 
 		void stopUpdateTimer();
 
+		void updateListener();
+
+		void onNotified(const QString & payload);
+
 	private:
 		void configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus);
 
 		struct Members {
 			Schema * schema;
 			int interval;
+			bool push;
+			bool notified;
+			bool awaitingNotification;
+			int latency;
+			QElapsedTimer latencyTimer;
 			QTimer updateTimer;
+			shareddatabase::NotificationListener listener;
 
 			Members():
 				schema(nullptr),
-				interval(INITIAL_INTERVAL)
+				interval(INITIAL_INTERVAL),
+				push(INITIAL_PUSH),
+				notified(false),
+				awaitingNotification(false),
+				latency(0)
 			{
 			}
 		};
@@ -77,6 +77,12 @@ class CUTEHMI_DATAACQUISITION_API AbstractWriter:
 
 		const TagValueContainer & values() const;
 
+		/**
+		 * Get names of tags.
+		 * @return names of tags of all the values.
+		 */
+		QStringList tagNames() const;
+
 	private slots:
 		void onSchemaValidated(bool result);
 
@@ -64,6 +64,16 @@ class CUTEHMI_DATAACQUISITION_API EventModel:
 
 		int rowCount(const QModelIndex & parent = QModelIndex()) const override;
 
+		/**
+		 * Reconstruct value of a tag at given time. Numeric values are interpolated linearly between adjacent events, so that
+		 * reconstructed value of a compressed tag does not deviate from the original one by more than TagValue::compressionDeviation
+		 * plus deadband. Boolean values are held until next event.
+		 * @param tag tag name.
+		 * @param time time.
+		 * @return reconstructed value or invalid value if there are no events of the tag at or before @a time in the model.
+		 */
+		Q_INVOKABLE QVariant interpolate(const QString & tag, const QDateTime & time) const;
+
 	signals:
 		void tagsChanged();
 
@@ -82,6 +92,8 @@ class CUTEHMI_DATAACQUISITION_API EventModel:
 		void confirmUpdateFinished() override;
 
 	protected:
+		bool acceptsNotification(const QString & payload) const override;
+
 		void setBegin(const QDateTime & begin);
 
 		void setEnd(const QDateTime & end);
@@ -91,6 +103,8 @@ class CUTEHMI_DATAACQUISITION_API EventModel:
 
 		void onSelected(internal::EventCollective::ColumnValues columnValues, QDateTime minTime, QDateTime maxTime);
 
+		void onSelectedNewer(internal::EventCollective::ColumnValues columnValues);
+
 	private:
 		struct Members {
 			internal::EventCollective::ColumnValues columnValues;
@@ -100,6 +114,10 @@ class CUTEHMI_DATAACQUISITION_API EventModel:
 			QDateTime end;
 			QDateTime from;
 			QDateTime to;
+			QStringList selectedTags;
+			QDateTime selectedFrom;
+			QDateTime selectedTo;
+			bool selectPending;
 		};
 
 		MPtr<Members> m;
@@ -2,14 +2,25 @@
 #define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_EVENTWRITER_HPP
 
 #include "internal/EventCollective.hpp"
+#include "internal/EventCompressor.hpp"
 #include "internal/DbServiceableMixin.hpp"
 #include "AbstractWriter.hpp"
 
 #include <cutehmi/services/Serviceable.hpp>
 
+#include <QHash>
+#include <QTimer>
+
 namespace cutehmi {
 namespace dataacquisition {
 
+/**
+ * Event writer. Writer stores changes of tag values in the database.
+ *
+ * Numeric values can be filtered with deadbands and compressed with swinging door trending algorithm, as configured by
+ * TagValue::deadband, TagValue::deadbandPercent and TagValue::compressionDeviation properties. Values, which are held back by the
+ * compression, are stored at the latest after @ref maxInterval and when writer stops.
+ */
 class CUTEHMI_DATAACQUISITION_API EventWriter:
 	public cutehmi::dataacquisition::AbstractWriter,
 	private internal::DbServiceableMixin<EventWriter>
@@ -20,8 +31,23 @@ class CUTEHMI_DATAACQUISITION_API EventWriter:
 		friend class internal::DbServiceableMixin<EventWriter>;
 
 	public:
+		static constexpr int INITIAL_MAX_INTERVAL = 0;
+
+		/**
+		  Maximal interval [ms] between stored points of a tag. Once interval elapses, values held back by the compression are
+		  stored along with the current value. If set to 0, points are stored only as the compression dictates.
+
+		  @assumption{cutehmi::dataacquisition::EventWriter-maxInterval_non_negative}
+		  Value of @a maxInterval property should be non-negative.
+		  */
+		Q_PROPERTY(int maxInterval READ maxInterval WRITE setMaxInterval NOTIFY maxIntervalChanged)
+
 		EventWriter(QObject * parent = nullptr);
 
+		int maxInterval() const;
+
+		void setMaxInterval(int maxInterval);
+
 		void configureStarting(QState * starting, AssignStatusFunction assignStatus) override;
 
 		void configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus) override;
@@ -44,6 +70,9 @@ class CUTEHMI_DATAACQUISITION_API EventWriter:
 
 		std::unique_ptr<QAbstractTransition> transitionToIdling() const override;
 
+	signals:
+		void maxIntervalChanged();
+
 	protected:
 		Q_SIGNAL void collectiveFinished();
 
@@ -54,6 +83,8 @@ class CUTEHMI_DATAACQUISITION_API EventWriter:
 	private slots:
 		void onSchemaChanged();
 
+		void preloadTags();
+
 		void insertEvent(cutehmi::dataacquisition::TagValue * tagValue);
 
 		void connectValueChangedSignals();
@@ -62,17 +93,31 @@ class CUTEHMI_DATAACQUISITION_API EventWriter:
 
 		void confirmCollectiveFinished();
 
+		void flushCompressors();
+
+		void releaseCompressors();
+
+		void scheduleFlush();
+
 	private:
 		void configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus);
 
 		void connectValueChangedSignal(TagValue * value);
 
+		void insertPoints(const TagValue * tagValue, const internal::EventCompressor::PointsContainer & points);
+
+		typedef QHash<TagValue *, internal::EventCompressor> CompressorsContainer;
+
 		struct Members
 		{
+			int maxInterval;
 			bool valueChangedConnectionsActive;
 			internal::EventCollective dbCollective;
+			CompressorsContainer compressors;
+			QTimer flushTimer;
 
 			Members():
+				maxInterval(INITIAL_MAX_INTERVAL),
 				valueChangedConnectionsActive(false)
 			{
 			}
@@ -89,6 +89,8 @@ class CUTEHMI_DATAACQUISITION_API HistoryModel:
 		void confirmUpdateFinished() override;
 
 	protected:
+		bool acceptsNotification(const QString & payload) const override;
+
 		void setBegin(const QDateTime & begin);
 
 		void setEnd(const QDateTime & end);
@@ -98,6 +100,8 @@ class CUTEHMI_DATAACQUISITION_API HistoryModel:
 
 		void onSelected(internal::HistoryCollective::ColumnValues columnValues, QDateTime minOpenTime, QDateTime maxCloseTime);
 
+		void onSelectedNewer(internal::HistoryCollective::ColumnValues columnValues);
+
 	private:
 		struct Members {
 			internal::HistoryCollective::ColumnValues columnValues;
@@ -107,6 +111,10 @@ class CUTEHMI_DATAACQUISITION_API HistoryModel:
 			QDateTime end;
 			QDateTime from;
 			QDateTime to;
+			QStringList selectedTags;
+			QDateTime selectedFrom;
+			QDateTime selectedTo;
+			bool selectPending;
 		};
 
 		MPtr<Members> m;
@@ -2,6 +2,7 @@
 #define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_HISTORYWRITER_HPP
 
 #include "internal/HistoryCollective.hpp"
+#include "internal/SamplingEngine.hpp"
 #include "internal/DbServiceableMixin.hpp"
 #include "AbstractWriter.hpp"
 
@@ -12,6 +13,14 @@
 namespace cutehmi {
 namespace dataacquisition {
 
+/**
+ * History writer. Writer samples values in constant intervals and stores candles (open, close, min, max and number of samples)
+ * in the database.
+ *
+ * Only current values are copied when sample is taken. Samples are aggregated into candles by internal sampling engine on a worker
+ * thread, so that sampling of large number of values does not burden the thread, which writer lives in (typically GUI thread).
+ * When writer is stopped, samples collected so far are stored as incomplete candles.
+ */
 class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 	public cutehmi::dataacquisition::AbstractWriter,
 	private internal::DbServiceableMixin<HistoryWriter>
@@ -81,7 +90,7 @@ class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 	protected slots:
 		void sampleValues();
 
-		void insertValues();
+		void insertValues(const cutehmi::dataacquisition::internal::HistoryCollective::TuplesContainer & tuples);
 
 	protected:
 		Q_SIGNAL void initialized();
@@ -98,6 +107,8 @@ class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 
 		Q_SIGNAL void collectiveFinished();
 
+		Q_SIGNAL void samplesFlushed();
+
 		void onValueAppend(TagValue * tagValue)	override;
 
 		void onValueRemove(TagValue * tagValue) override;
@@ -105,6 +116,8 @@ class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 	private slots:
 		void onSchemaChanged();
 
+		void preloadTags();
+
 		void initialize();
 
 		void adjustSamplingTimer();
@@ -113,6 +126,10 @@ class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 
 		void stopSamplingTimer();
 
+		void insertCandles();
+
+		void flushSamples();
+
 		void confirmCollectiveFinished();
 
 	private:
@@ -120,22 +137,17 @@ class CUTEHMI_DATAACQUISITION_API HistoryWriter:
 
 		void clearData();
 
-		template <typename T>
-		void addSample(T value, internal::HistoryCollective::Tuple & tuple);
-
 		struct Members
 		{
-			internal::HistoryCollective::TuplesContainer tuples;
 			internal::HistoryCollective dbCollective;
+			internal::SamplingEngine samplingEngine;
 			QTimer samplingTimer;
 			int interval;
 			int samples;
-			int sampleCounter;
 
 			Members():
 				interval(INITIAL_INTERVAL),
-				samples(INITIAL_SAMPLES),
-				sampleCounter(0)
+				samples(INITIAL_SAMPLES)
 			{
 			}
 		};
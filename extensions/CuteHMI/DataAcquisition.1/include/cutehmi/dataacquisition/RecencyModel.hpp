@@ -10,6 +10,13 @@
 namespace cutehmi {
 namespace dataacquisition {
 
+/**
+ * Recency model. Model provides most recent values of tags.
+ *
+ * Values written by RecencyWriter objects living in the same process are served from a process-wide recency cache. Database is
+ * queried only for the tags, which are not available in the cache. If @ref tags list is empty, all the tags are selected from the
+ * database and cached values take precedence over database values, unless the latter are more recent.
+ */
 class CUTEHMI_DATAACQUISITION_API RecencyModel:
 	public cutehmi::dataacquisition::AbstractListModel,
 	private internal::ModelMixin<RecencyModel>
@@ -53,16 +60,24 @@ class CUTEHMI_DATAACQUISITION_API RecencyModel:
 	protected slots:
 		void confirmUpdateFinished() override;
 
+	protected:
+		bool acceptsNotification(const QString & payload) const override;
+
 	private slots:
 		void onSchemaChanged();
 
 		void onSelected(internal::RecencyCollective::ColumnValues columnValues);
 
 	private:
+		static void AppendTuple(internal::RecencyCollective::ColumnValues & columnValues, const QString & tag, const internal::RecencyCollective::Tuple & tuple);
+
+		internal::RecencyCollective::ColumnValues mergeCached(const internal::RecencyCollective::ColumnValues & dbValues) const;
+
 		struct Members {
 			internal::RecencyCollective::ColumnValues columnValues;
 			internal::RecencyCollective dbCollective;
 			QStringList tags;
+			internal::RecencyCollective::TuplesContainer cachedTuples;
 		};
 
 		MPtr<Members> m;
@@ -8,10 +8,24 @@
 #include <cutehmi/services/Serviceable.hpp>
 
 #include <QTimer>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QDateTime>
 
 namespace cutehmi {
 namespace dataacquisition {
 
+/**
+ * Recency writer. Writer stores most recent values of tags in the database.
+ *
+ * Writer keeps track of values that have changed since last update and only these values are written to the database, along with
+ * the time of change. Additionally, once per @ref heartbeatInterval all the values are rewritten. Values, which have not changed
+ * since last update are then stamped with current time, thus time stored in the database is the time of last change or last
+ * heartbeat, whichever is later. Reader may treat values with time older than heartbeat interval as stale.
+ *
+ * Values written to the database are also published in a process-wide recency cache, so that RecencyModel objects living in the
+ * same process can read them without querying the database. Values are withdrawn from the cache, when writer stops or breaks.
+ */
 class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 	public cutehmi::dataacquisition::AbstractWriter,
 	private internal::DbServiceableMixin<RecencyWriter>
@@ -24,6 +38,8 @@ class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 	public:
 		static constexpr int INITIAL_INTERVAL = 1000;
 
+		static constexpr int INITIAL_HEARTBEAT_INTERVAL = 60000;
+
 		/**
 		  Interval [ms] between samples.
 
@@ -32,12 +48,26 @@ class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 		  */
 		Q_PROPERTY(int interval READ interval WRITE setInterval NOTIFY intervalChanged)
 
+		/**
+		  Interval [ms] between rewrites of all the values. If set to 0, values are rewritten only once, when writer starts.
+
+		  @assumption{cutehmi::dataacquisition::RecencyWriter-heartbeatInterval_non_negative}
+		  Value of @a heartbeatInterval property should be non-negative.
+		  */
+		Q_PROPERTY(int heartbeatInterval READ heartbeatInterval WRITE setHeartbeatInterval NOTIFY heartbeatIntervalChanged)
+
 		RecencyWriter(QObject * parent = nullptr);
 
+		~RecencyWriter() override;
+
 		int interval() const;
 
 		void setInterval(int interval);
 
+		int heartbeatInterval() const;
+
+		void setHeartbeatInterval(int heartbeatInterval);
+
 		void configureStarting(QState * starting, AssignStatusFunction assignStatus) override;
 
 		void configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus) override;
@@ -63,6 +93,8 @@ class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 	signals:
 		void intervalChanged();
 
+		void heartbeatIntervalChanged();
+
 	protected:
 		Q_SIGNAL void updateTimerStarted();
 
@@ -77,15 +109,23 @@ class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 	private slots:
 		void updateValues();
 
+		void markDirty(cutehmi::dataacquisition::TagValue * tagValue);
+
 		void onSchemaChanged();
 
+		void preloadTags();
+
 		void startUpdateTimer();
 
 		void stopUpdateTimer();
 
 		void confirmCollectiveFinished();
 
+		void withdrawPublished();
+
 	private:
+		typedef QHash<TagValue *, QDateTime> DirtyValuesContainer;
+
 		void configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus);
 
 		struct Members
@@ -93,9 +133,13 @@ class CUTEHMI_DATAACQUISITION_API RecencyWriter:
 			internal::RecencyCollective dbCollective;
 			QTimer updateTimer;
 			int interval;
+			int heartbeatInterval;
+			QElapsedTimer heartbeatTimer;
+			DirtyValuesContainer dirtyValues;
 
 			Members():
-				interval(INITIAL_INTERVAL)
+				interval(INITIAL_INTERVAL),
+				heartbeatInterval(INITIAL_HEARTBEAT_INTERVAL)
 			{
 			}
 		};
@@ -21,6 +21,12 @@ class CUTEHMI_DATAACQUISITION_API TagValue:
 		QML_NAMED_ELEMENT(TagValue)
 
 	public:
+		static constexpr qreal INITIAL_DEADBAND = 0.0;
+
+		static constexpr qreal INITIAL_DEADBAND_PERCENT = 0.0;
+
+		static constexpr qreal INITIAL_COMPRESSION_DEVIATION = 0.0;
+
 		/**
 		  Tag name.
 		  */
@@ -31,6 +37,34 @@ class CUTEHMI_DATAACQUISITION_API TagValue:
 		  */
 		Q_PROPERTY(QVariant value READ value WRITE setValue NOTIFY valueChanged)
 
+		/**
+		  Absolute deadband. Event writer does not store numeric values, which differ from last stored value by no more than
+		  deadband.
+
+		  @assumption{cutehmi::dataacquisition::TagValue-deadband_non_negative}
+		  Value of @a deadband property should be non-negative.
+		  */
+		Q_PROPERTY(qreal deadband READ deadband WRITE setDeadband NOTIFY deadbandChanged)
+
+		/**
+		  Percent deadband. Deadband expressed as a percentage of magnitude of last stored value. If both deadbands are set, the
+		  greater one is applied.
+
+		  @assumption{cutehmi::dataacquisition::TagValue-deadbandPercent_non_negative}
+		  Value of @a deadbandPercent property should be non-negative.
+		  */
+		Q_PROPERTY(qreal deadbandPercent READ deadbandPercent WRITE setDeadbandPercent NOTIFY deadbandPercentChanged)
+
+		/**
+		  Compression deviation. If positive, event writer applies swinging door trending compression to numeric values, so that
+		  linear interpolation between stored points does not deviate from the received values by more than compression
+		  deviation (plus deadband).
+
+		  @assumption{cutehmi::dataacquisition::TagValue-compressionDeviation_non_negative}
+		  Value of @a compressionDeviation property should be non-negative.
+		  */
+		Q_PROPERTY(qreal compressionDeviation READ compressionDeviation WRITE setCompressionDeviation NOTIFY compressionDeviationChanged)
+
 		/**
 		 * Constructor.
 		 * @param parent parent object.
@@ -67,15 +101,36 @@ class CUTEHMI_DATAACQUISITION_API TagValue:
 		 */
 		Q_INVOKABLE QString typeName() const;
 
+		qreal deadband() const;
+
+		void setDeadband(qreal deadband);
+
+		qreal deadbandPercent() const;
+
+		void setDeadbandPercent(qreal deadbandPercent);
+
+		qreal compressionDeviation() const;
+
+		void setCompressionDeviation(qreal compressionDeviation);
+
 	signals:
 		void nameChanged();
 
 		void valueChanged();
 
+		void deadbandChanged();
+
+		void deadbandPercentChanged();
+
+		void compressionDeviationChanged();
+
 	private:
 		struct Members {
 			QString name;
 			QVariant value;
+			qreal deadband = INITIAL_DEADBAND;
+			qreal deadbandPercent = INITIAL_DEADBAND_PERCENT;
+			qreal compressionDeviation = INITIAL_COMPRESSION_DEVIATION;
 		};
 
 		MPtr<Members> m;
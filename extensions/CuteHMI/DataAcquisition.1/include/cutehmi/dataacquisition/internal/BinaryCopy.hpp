@@ -0,0 +1,108 @@
+#ifndef H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_BINARYCOPY_HPP
+#define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_BINARYCOPY_HPP
+
+#include "common.hpp"
+
+#include <QByteArray>
+#include <QDataStream>
+#include <QDateTime>
+#include <QSqlDatabase>
+#include <QSqlError>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+/**
+ * PostgreSQL binary copy. Class encodes rows in PostgreSQL binary copy format and streams them to the server with
+ * <tt>COPY ... FROM STDIN (FORMAT binary)</tt> statement through libpq.
+ *
+ * Binary copy is available only if extension has been built against libpq and database connection uses QPSQL driver. Callers
+ * should fall back to QSqlQuery::execBatch() otherwise.
+ */
+class CUTEHMI_DATAACQUISITION_PRIVATE BinaryCopy
+{
+	public:
+		/**
+		 * Check whether binary copy is available.
+		 * @param db database connection.
+		 * @return @p true if binary copy can be used with @a db connection, @p false otherwise.
+		 */
+		static bool IsAvailable(const QSqlDatabase & db);
+
+		BinaryCopy();
+
+		/**
+		 * Begin row.
+		 * @param fieldCount number of fields that are going to be appended to the row.
+		 */
+		void beginRow(int fieldCount);
+
+		void append(bool value);
+
+		void append(int value);
+
+		void append(double value);
+
+		void append(const QDateTime & value);
+
+		/**
+		 * Get number of rows.
+		 * @return number of rows appended so far.
+		 */
+		int rowCount() const;
+
+		/**
+		 * Get encoded data.
+		 * @return rows encoded in binary copy format, including header and trailer.
+		 */
+		QByteArray data() const;
+
+		/**
+		 * Execute copy.
+		 * @param db database connection.
+		 * @param statement copy statement.
+		 * @return error object, which is invalid on success.
+		 */
+		QSqlError exec(QSqlDatabase & db, const QString & statement);
+
+	private:
+		/**
+		 * PostgreSQL epoch (2000-01-01 00:00:00 UTC) expressed as a number of milliseconds since Unix epoch.
+		 */
+		static constexpr qint64 POSTGRES_EPOCH_MSECS = Q_INT64_C(946684800000);
+
+		void appendField(qint32 length);
+
+		struct Members
+		{
+			QByteArray data;
+			QDataStream stream;
+			int rowCount;
+
+			Members():
+				stream(& data, QIODevice::WriteOnly),
+				rowCount(0)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
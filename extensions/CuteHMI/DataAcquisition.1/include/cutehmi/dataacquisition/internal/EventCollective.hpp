@@ -53,16 +53,31 @@ class CUTEHMI_DATAACQUISITION_PRIVATE EventCollective:
 
 		void insert(const TagValue & tag);
 
+		void insert(const QString & tagName, const QVariant & value, const QDateTime & time);
+
 		void select(const QStringList & tags, const QDateTime & from, const QDateTime & to);
 
+		/**
+		 * Select events newer than the ones, which have been selected already. Unlike select(), function does not query min and
+		 * max time of the tables. Results are emitted with selectedNewer() signal.
+		 * @param tags tags.
+		 * @param after time of the most recent event selected so far. Only events with time greater than @a after are selected.
+		 * @param to upper bound of time.
+		 */
+		void selectNewer(const QStringList & tags, const QDateTime & after, const QDateTime & to);
+
 	signals:
 		void selected(cutehmi::dataacquisition::internal::EventCollective::ColumnValues result, QDateTime minTime, QDateTime maxTime);
 
+		void selectedNewer(cutehmi::dataacquisition::internal::EventCollective::ColumnValues result);
+
 	private:
-		QString selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to);
+		QString selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to, const QDateTime & after);
 
 		template<typename T>
-		bool tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to);
+		bool tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after = QDateTime());
+
+		bool mergedSelect(QSqlDatabase & db, ColumnValues & mergedValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after = QDateTime());
 
 		template<typename T>
 		bool tableMinTime(QSqlDatabase & db, QDateTime & minTime, const QString & schemaName);
@@ -71,7 +86,7 @@ class CUTEHMI_DATAACQUISITION_PRIVATE EventCollective:
 		bool tableMaxTime(QSqlDatabase & db, QDateTime & maxTime, const QString & schemaName);
 
 		template <typename T>
-		void insertIntoTable(const TagValue & tag);
+		void insertIntoTable(const QString & tagName, const Tuple & tuple);
 };
 
 }
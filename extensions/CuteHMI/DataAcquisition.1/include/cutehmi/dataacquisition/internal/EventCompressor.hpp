@@ -0,0 +1,114 @@
+#ifndef H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_EVENTCOMPRESSOR_HPP
+#define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_EVENTCOMPRESSOR_HPP
+
+#include "common.hpp"
+
+#include <QVariant>
+#include <QDateTime>
+#include <QList>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+/**
+ * Event compressor. Compressor decides which events of a single tag have to be stored.
+ *
+ * Numeric values pass through two filters. First, unless a point is held back, values which do not differ from last stored value
+ * by more than a deadband are discarded. Effective deadband is the greater of absolute deadband and a percentage of magnitude of
+ * last stored value. Values, that pass the deadband are then subjected to swinging door trending compression, if compression
+ * deviation is positive. Swinging door holds most recent value back as long as all the values received since last stored point lie
+ * within the corridor of compression deviation around a line connecting the stored point with the held one. Once the line leaves
+ * the corridor, held point is stored and it becomes a pivot of a new corridor.
+ *
+ * Linear interpolation between stored points of a numeric tag (see Interpolate()) differs from any of the received values by no
+ * more than compression deviation plus effective deadband. Boolean values and values changing their type are always stored.
+ */
+class CUTEHMI_DATAACQUISITION_PRIVATE EventCompressor
+{
+	public:
+		struct Point
+		{
+			QVariant value;
+			QDateTime time;
+		};
+
+		typedef QList<Point> PointsContainer;
+
+		/**
+		 * Reconstruct value at given time from two adjacent stored points.
+		 * @param before point stored at or before @a time.
+		 * @param after point stored after @a time. If point is not valid, value of @a before is returned.
+		 * @param time time.
+		 * @return linearly interpolated value for numeric values (as @p double) or value of @a before point for other values.
+		 */
+		static QVariant Interpolate(const Point & before, const Point & after, const QDateTime & time);
+
+		EventCompressor();
+
+		void configure(qreal deadband, qreal deadbandPercent, qreal deviation);
+
+		/**
+		 * Process value.
+		 * @param value value.
+		 * @param time time of the value.
+		 * @return points, which should be stored.
+		 */
+		PointsContainer process(const QVariant & value, const QDateTime & time);
+
+		/**
+		 * Release points, which are held back or have been filtered out by the deadband.
+		 * @return points, which should be stored.
+		 */
+		PointsContainer release();
+
+		/**
+		 * Flush compressor. Points are released and last received value is additionally stamped with @a time.
+		 * @param time time of flush.
+		 * @return points, which should be stored. If no value has been received yet, empty container is returned.
+		 */
+		PointsContainer flush(const QDateTime & time);
+
+		/**
+		 * Get time of last stored point.
+		 * @return time of last stored point or invalid date time if no point has been stored yet.
+		 */
+		QDateTime lastStoredTime() const;
+
+		void reset();
+
+	private:
+		static bool IsNumeric(const QVariant & value);
+
+		qreal effectiveDeadband() const;
+
+		void store(const Point & point, PointsContainer & points);
+
+		void hold(const Point & point);
+
+		qreal m_deadband;
+		qreal m_deadbandPercent;
+		qreal m_deviation;
+		Point m_stored;
+		Point m_held;
+		Point m_latest;
+		qreal m_upperSlope;
+		qreal m_lowerSlope;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -66,9 +66,21 @@ class CUTEHMI_DATAACQUISITION_PRIVATE HistoryCollective:
 
 		void select(const QStringList & tags, const QDateTime & from, const QDateTime & to);
 
+		/**
+		 * Select rows newer than the ones, which have been selected already. Unlike select(), function does not query min open
+		 * time and max close time of the tables. Results are emitted with selectedNewer() signal.
+		 * @param tags tags.
+		 * @param after close time of the most recent row selected so far. Only rows with close time greater than @a after are
+		 * selected.
+		 * @param to upper bound of close time.
+		 */
+		void selectNewer(const QStringList & tags, const QDateTime & after, const QDateTime & to);
+
 	signals:
 		void selected(cutehmi::dataacquisition::internal::HistoryCollective::ColumnValues result, QDateTime minOpenTime, QDateTime maxCloseTime);
 
+		void selectedNewer(cutehmi::dataacquisition::internal::HistoryCollective::ColumnValues result);
+
 	private:
 		static QVariant::Type TupleVariantType(const Tuple & tuple);
 
@@ -76,13 +88,15 @@ class CUTEHMI_DATAACQUISITION_PRIVATE HistoryCollective:
 
 		QString insertQuery(const QString & driverName, const QString & schemaName, const QString & tableName);
 
-		QString selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to);
+		QString selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to, const QDateTime & after);
 
 		template<typename T>
-		void tableInsert(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues);
+		bool tableInsert(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues);
 
 		template<typename T>
-		bool tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to);
+		bool tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after = QDateTime());
+
+		bool mergedSelect(QSqlDatabase & db, ColumnValues & mergedValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after = QDateTime());
 
 		template<typename T>
 		bool tableMinOpenTime(QSqlDatabase & db, QDateTime & minOpenTime, const QString & schemaName);
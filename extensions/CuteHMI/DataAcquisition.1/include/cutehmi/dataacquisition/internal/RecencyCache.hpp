@@ -0,0 +1,106 @@
+#ifndef H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_RECENCYCACHE_HPP
+#define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_RECENCYCACHE_HPP
+
+#include "common.hpp"
+#include "RecencyCollective.hpp"
+
+#include <cutehmi/Singleton.hpp>
+
+#include <QReadWriteLock>
+#include <QSet>
+
+namespace cutehmi {
+namespace dataacquisition {
+
+class Schema;
+
+namespace internal {
+
+/**
+ * Recency cache. Process-wide cache of most recent values of tags.
+ *
+ * Recency writers publish values, which they have committed to the database, and recency models look them up, so that values
+ * written by the same process are served from memory. Entries are grouped by a key, which identifies a schema within particular
+ * database connection. Multiple writers may share the key and the tags, thus each entry keeps track of its owners and it is
+ * removed only after all of them have withdrawn it.
+ */
+class CUTEHMI_DATAACQUISITION_PRIVATE RecencyCache:
+	public Singleton<RecencyCache>
+{
+		friend class Singleton<RecencyCache>;
+
+	public:
+		/**
+		 * Get cache key.
+		 * @param schema schema.
+		 * @return key, which identifies @a schema within its database connection.
+		 */
+		static QString Key(const Schema * schema);
+
+		/**
+		 * Publish values.
+		 * @param key cache key.
+		 * @param tuples values to be stored. Existing entries are replaced.
+		 * @param owner owner of the entries.
+		 */
+		void publish(const QString & key, const RecencyCollective::TuplesContainer & tuples, const void * owner);
+
+		/**
+		 * Withdraw values.
+		 * @param key cache key.
+		 * @param tags names of tags to be withdrawn.
+		 * @param owner owner of the entries. Entry is removed, when it has no owners left.
+		 */
+		void withdraw(const QString & key, const QStringList & tags, const void * owner);
+
+		/**
+		 * Withdraw all values published by an owner.
+		 * @param key cache key.
+		 * @param owner owner of the entries. Entry is removed, when it has no owners left.
+		 */
+		void withdraw(const QString & key, const void * owner);
+
+		/**
+		 * Look up values.
+		 * @param key cache key.
+		 * @param tags names of tags to look for. If list is empty, all the values stored under @a key are returned.
+		 * @return values found in the cache.
+		 */
+		RecencyCollective::TuplesContainer lookup(const QString & key, const QStringList & tags) const;
+
+	protected:
+		RecencyCache();
+
+	private:
+		typedef QHash<QString, RecencyCollective::TuplesContainer> EntriesContainer;
+
+		typedef QHash<QString, QHash<QString, QSet<const void *>>> OwnersContainer;
+
+		void release(const QString & key, const QString & tag, const void * owner);
+
+		struct Members
+		{
+			EntriesContainer entries;
+			OwnersContainer owners;
+			mutable QReadWriteLock lock;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -6,6 +6,7 @@
 
 #include <QHash>
 #include <QList>
+#include <QMutex>
 
 namespace cutehmi {
 namespace dataacquisition {
@@ -52,10 +53,29 @@ class CUTEHMI_DATAACQUISITION_PRIVATE RecencyCollective:
 
 		RecencyCollective();
 
+		~RecencyCollective() override;
+
+		/**
+		 * Update values. Values are published in RecencyCache after they have been committed to the database.
+		 * @param tuples values to be updated.
+		 */
 		void update(const TuplesContainer & tuples);
 
 		void select(const QStringList & tags);
 
+		/**
+		 * Set cache key, under which updated values are published in RecencyCache. Values published under previous key are
+		 * withdrawn.
+		 * @param key cache key. Empty key disables publishing.
+		 */
+		void setCacheKey(const QString & key);
+
+		/**
+		 * Withdraw values from RecencyCache.
+		 * @param tags names of tags to be withdrawn.
+		 */
+		void withdraw(const QStringList & tags);
+
 	signals:
 		void selected(cutehmi::dataacquisition::internal::RecencyCollective::ColumnValues result);
 
@@ -68,10 +88,20 @@ class CUTEHMI_DATAACQUISITION_PRIVATE RecencyCollective:
 		QString selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings);
 
 		template<typename T>
-		void tableUpdate(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues);
+		bool tableUpdate(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues);
 
 		template<typename T>
 		bool tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags);
+
+		void publish(const QString & cacheKey, const TuplesContainer & tuples);
+
+		struct Members
+		{
+			QString cacheKey;
+			QMutex cacheKeyMutex;
+		};
+
+		MPtr<Members> m;
 };
 
 }
@@ -0,0 +1,204 @@
+#ifndef H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_SAMPLINGENGINE_HPP
+#define H_EXTENSIONS_CUTEHMI_DATAACQUISITION_1_INCLUDE_CUTEHMI_DATAACQUISITION_INTERNAL_SAMPLINGENGINE_HPP
+
+#include "common.hpp"
+#include "HistoryCollective.hpp"
+
+#include <QObject>
+#include <QThread>
+#include <QTimer>
+#include <QMutex>
+#include <QStringList>
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+/**
+ * Sampling engine. Engine aggregates samples into candles on a worker thread.
+ *
+ * Each value is assigned a slot, addressed by index. Current values of the slots are kept by the engine in typed form, so that
+ * taking a sample merely copies them into a ring buffer. Buffer is single-producer single-consumer and it does not use locks. Worker
+ * thread periodically drains the buffer and aggregates samples into candles (open, close, min, max, count). Once specified number
+ * of samples has been collected, candles are closed and they can be obtained with takeCandles(). Candle of a value, which changes
+ * its type, is closed early, so that its samples are not lost.
+ *
+ * Functions appendSlot(), setName(), setValue(), clearSlots() and sample() must be called from the thread the engine lives in.
+ */
+class CUTEHMI_DATAACQUISITION_PRIVATE SamplingEngine:
+	public QObject
+{
+		Q_OBJECT
+
+	public:
+		typedef QList<HistoryCollective::TuplesContainer> CandleSetsContainer;
+
+		static constexpr std::size_t CAPACITY = 256;	///< Capacity of the ring buffer (number of samples).
+
+		static constexpr int MIN_DRAIN_INTERVAL = 10;	///< Minimal interval [ms] between subsequent drains of the ring buffer.
+
+		explicit SamplingEngine(QObject * parent = nullptr);
+
+		~SamplingEngine() override;
+
+		/**
+		 * Set number of samples per candle.
+		 * @param samples number of samples.
+		 *
+		 * @threadsafe
+		 */
+		void setSamples(int samples);
+
+		/**
+		 * Set interval between drains of the ring buffer. Usually this is the same as sampling interval.
+		 * @param interval interval [ms].
+		 */
+		void setInterval(int interval);
+
+		int appendSlot(const QString & name);
+
+		void setName(int index, const QString & name);
+
+		void setValue(int index, const QVariant & value);
+
+		/**
+		 * Clear slots. Samples, which have been taken before slots have been cleared are discarded.
+		 */
+		void clearSlots();
+
+		/**
+		 * Take a sample of current values.
+		 * @return @p true if sample has been put into the ring buffer, @p false if the buffer was full and sample was dropped.
+		 */
+		bool sample();
+
+		void start();
+
+		void stop();
+
+		/**
+		 * Reset engine. Pending samples and candles are discarded.
+		 */
+		void reset();
+
+		/**
+		 * Take closed candles.
+		 * @return sets of candles in the order, in which they have been closed.
+		 *
+		 * @threadsafe
+		 */
+		CandleSetsContainer takeCandles();
+
+		/**
+		 * Flush engine. Samples pending in the ring buffer are aggregated and candles are closed, even if they have not collected
+		 * specified number of samples. Function blocks until worker thread handles the request.
+		 * @return sets of candles, which have not been taken yet, including the ones closed by the flush.
+		 */
+		CandleSetsContainer flush();
+
+	signals:
+		/**
+		 * Candles are ready. Signal is emitted from worker thread, when closed candles become available to takeCandles().
+		 */
+		void candlesReady();
+
+	private:
+		enum Type : quint8 {
+			NONE,
+			INT,
+			BOOL,
+			DOUBLE
+		};
+
+		struct Sample
+		{
+			double value = 0.0;
+			Type type = NONE;
+		};
+
+		typedef std::vector<Sample> SamplesContainer;
+
+		struct Frame
+		{
+			qint64 time = 0;
+			quint32 generation = 0;
+			SamplesContainer samples;
+		};
+
+		typedef std::array<Frame, CAPACITY> FramesContainer;
+
+		struct Candle
+		{
+			double open;
+			double close;
+			double min;
+			double max;
+			qint64 openTime;
+			qint64 closeTime;
+			int count = 0;
+			Type type = NONE;
+		};
+
+		typedef std::vector<Candle> CandlesContainer;
+
+		static QVariant ToVariant(double value, Type type);
+
+		static HistoryCollective::Tuple ToTuple(const Candle & candle);
+
+		void drain();
+
+		void closeCandles(quint32 generation);
+
+		void closeCandle(std::size_t index, quint32 generation);
+
+		void publish(const HistoryCollective::TuplesContainer & tuples);
+
+		struct Members
+		{
+			// Accessed by the thread, which engine lives in.
+			SamplesContainer current;
+			quint32 generation = 0;
+
+			// Shared.
+			FramesContainer frames;
+			std::atomic<std::size_t> head{0};
+			std::atomic<std::size_t> tail{0};
+			std::atomic<int> samples{1};
+			QStringList names;
+			quint32 namesGeneration = 0;
+			QMutex namesMutex;
+			CandleSetsContainer closedCandles;
+			QMutex closedCandlesMutex;
+
+			// Accessed by worker thread.
+			CandlesContainer candles;
+			quint32 candlesGeneration = 0;
+			int sampleCounter = 0;
+			QObject worker;
+			QTimer drainTimer;
+			QThread thread;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -6,6 +6,13 @@
 #include "TagCache.hpp"
 
 #include <QObject>
+#include <QMutex>
+
+#include <atomic>
+
+class QSqlDriver;
+
+struct pg_cancel;
 
 namespace cutehmi {
 namespace dataacquisition {
@@ -19,9 +26,58 @@ class CUTEHMI_DATAACQUISITION_PRIVATE TableCollective:
 	public:
 		TableCollective();
 
+		/**
+		 * Preload tag cache. Tags are loaded from the database in bulk and missing ones are created in batches, so that subsequent
+		 * queries do not have to wait for them.
+		 * @param tags names of tags, which are going to be used.
+		 */
+		void preloadTags(const QStringList & tags);
+
 	protected:
+		/**
+		 * Cancellation scope. While scope object exists, query executed on behalf of the collective can be cancelled by
+		 * supersede().
+		 */
+		class CancellationScope
+		{
+			public:
+				CancellationScope(TableCollective & collective, QSqlDatabase & db);
+
+				~CancellationScope();
+
+			private:
+				TableCollective & m_collective;
+		};
+
 		TagCache * tagCache() const;
 
+		/**
+		 * Supersede pending selections. Selections, which have been started with older tickets should be discarded. Query that
+		 * is being executed within cancellation scope is cancelled, providing that database driver supports it.
+		 * @return ticket of a new selection.
+		 */
+		quint64 supersede();
+
+		/**
+		 * Discard selection if it has been superseded. Errors accumulated in the meantime are cleared, because they might have
+		 * been caused by cancellation.
+		 * @param ticket ticket of the selection.
+		 * @return @p true if selection has been superseded and should be abandoned, @p false otherwise.
+		 *
+		 * @threadsafe
+		 */
+		bool discardIfSuperseded(quint64 ticket);
+
+		/**
+		 * Notify listeners that table contents has changed. Notification is sent to a channel named after the schema, with table
+		 * stem as a payload. PostgreSQL notification is sent with @p pg_notify() function, so that listeners from all the
+		 * processes are notified. For other drivers notification is dispatched within the process only.
+		 * @param db database.
+		 * @param schemaName schema name.
+		 * @param tableStem table stem.
+		 */
+		void notifyChanged(QSqlDatabase & db, const QString & schemaName, const QString & tableStem);
+
 	private slots:
 		void onSchemaChanged();
 
@@ -29,6 +85,10 @@ class CUTEHMI_DATAACQUISITION_PRIVATE TableCollective:
 		struct Members
 		{
 			std::unique_ptr<TagCache> tagCache;
+			std::atomic<quint64> ticket{0};
+			QMutex cancellationMutex;
+			QSqlDriver * cancellableDriver = nullptr;
+			pg_cancel * pgCancel = nullptr;
 		};
 
 		MPtr<Members> m;
@@ -4,33 +4,81 @@
 #include "common.hpp"
 #include "TableObject.hpp"
 
-#include <QReadWriteLock>
+#include <QMutex>
+#include <QStringList>
+
+#include <memory>
 
 namespace cutehmi {
 namespace dataacquisition {
 namespace internal {
 
+/**
+ * Tag cache. Cache maps tag names to their ids.
+ *
+ * Readers look up tag ids in an immutable snapshot of the map, which is swapped atomically each time cache is updated, so they do
+ * not take any locks, unless tag is missing. Missing tags are created in batches, with a single statement per batch.
+ */
 class CUTEHMI_DATAACQUISITION_PRIVATE TagCache:
 	public TableObject
 {
 	public:
+		static constexpr int INSERT_BATCH_SIZE = 500;	///< Maximal number of tags created with a single statement.
+
 		explicit TagCache(Schema * schema, QObject * parent = nullptr);
 
+		/**
+		 * Get tag id. Tag is created if it does not exist.
+		 * @param name tag name.
+		 * @param db database.
+		 * @return tag id or -1 if tag could not be obtained.
+		 */
 		int getId(const QString & name, QSqlDatabase & db);
 
+		/**
+		 * Get tag ids. Missing tags are created in batches.
+		 * @param names tag names.
+		 * @param db database.
+		 * @return list of tag ids, corresponding to @a names. If particular tag could not be obtained its id is -1.
+		 */
+		QList<int> getIds(const QStringList & names, QSqlDatabase & db);
+
+		/**
+		 * Preload cache. All the tags are loaded from the database and missing tags are created.
+		 * @param names names of tags, which are going to be used.
+		 * @param db database.
+		 */
+		void preload(const QStringList & names, QSqlDatabase & db);
+
 	protected:
-		void insert(const QString & name, QSqlDatabase & db);
+		void insert(const QStringList & names, QSqlDatabase & db);
 
 		void update(QSqlDatabase & db);
 
 	private:
 		typedef QHash<QString, int> TagIdContainter;
 
+		typedef std::shared_ptr<const TagIdContainter> SnapshotPtr;
+
+		SnapshotPtr snapshot() const;
+
+		void publish(SnapshotPtr snapshot);
+
+		QStringList missing(const QStringList & names, const SnapshotPtr & snapshot) const;
+
+		/**
+		 * Obtain missing tags.
+		 * @param names tag names.
+		 * @param db database.
+		 *
+		 * @pre m->updateMutex must be locked.
+		 */
+		void obtain(const QStringList & names, QSqlDatabase & db);
+
 		struct Members
 		{
-			Schema * schema;
-			TagIdContainter tagIds;
-			QReadWriteLock tagIdsLock;
+			SnapshotPtr snapshot;	///< Snapshot must be accessed with atomic functions (std::atomic_load(), std::atomic_store()).
+			QMutex updateMutex;
 		};
 
 		MPtr<Members> m;
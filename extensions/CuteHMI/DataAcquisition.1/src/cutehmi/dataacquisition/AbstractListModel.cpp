@@ -4,12 +4,14 @@ namespace cutehmi {
 namespace dataacquisition {
 
 constexpr int AbstractListModel::INITIAL_INTERVAL;
+constexpr bool AbstractListModel::INITIAL_PUSH;
 
 AbstractListModel::AbstractListModel(QObject * parent):
 	QAbstractListModel(parent),
 	m(new Members)
 {
 	m->updateTimer.setSingleShot(true);
+	connect(& m->listener, & shareddatabase::NotificationListener::notified, this, & AbstractListModel::onNotified);
 }
 
 int AbstractListModel::interval() const
@@ -27,6 +29,25 @@ void AbstractListModel::setInterval(int interval)
 	}
 }
 
+bool AbstractListModel::push() const
+{
+	return m->push;
+}
+
+void AbstractListModel::setPush(bool push)
+{
+	if (m->push != push) {
+		m->push = push;
+		updateListener();
+		emit pushChanged();
+	}
+}
+
+int AbstractListModel::latency() const
+{
+	return m->latency;
+}
+
 Schema * AbstractListModel::schema() const
 {
 	return m->schema;
@@ -39,11 +60,14 @@ void AbstractListModel::setSchema(Schema * schema)
 			m->schema->disconnect(this);
 
 		m->schema = schema;
+		updateListener();
 		emit schemaChanged();
 
 		if (m->schema) {
 			connect(m->schema, & Schema::validated, this, & AbstractListModel::onSchemaValidated);
 			connect(m->schema, & Schema::errored, this, & AbstractListModel::broke);
+			connect(m->schema, & Schema::nameChanged, this, & AbstractListModel::updateListener);
+			connect(m->schema, & Schema::connectionNameChanged, this, & AbstractListModel::updateListener);
 		}
 	}
 }
@@ -62,6 +86,9 @@ void AbstractListModel::configureStarted(QState * active, const QState * idling,
 	QState * updating = new QState(active);
 	assignStatus(*updating, tr("Updating model"));
 	active->setInitialState(updating);
+	connect(updating, & QState::entered, this, [this]() {
+		m->awaitingNotification = false;
+	});
 	connect(updating, & QState::entered, this, & AbstractListModel::requestUpdate);
 }
 
@@ -126,6 +153,31 @@ std::unique_ptr<QAbstractTransition> AbstractListModel::transitionToIdling() con
 	return std::make_unique<QSignalTransition>(this, & AbstractListModel::updateFinished);
 }
 
+bool AbstractListModel::acceptsNotification(const QString & payload) const
+{
+	Q_UNUSED(payload)
+
+	return true;
+}
+
+void AbstractListModel::startLatencyTimer()
+{
+	m->latencyTimer.start();
+}
+
+void AbstractListModel::updateLatency()
+{
+	if (!m->latencyTimer.isValid())
+		return;
+
+	int latency = static_cast<int>(m->latencyTimer.elapsed());
+	m->latencyTimer.invalidate();
+	if (m->latency != latency) {
+		m->latency = latency;
+		emit latencyChanged();
+	}
+}
+
 void AbstractListModel::onSchemaValidated(bool result)
 {
 	if (result)
@@ -136,16 +188,46 @@ void AbstractListModel::onSchemaValidated(bool result)
 
 void AbstractListModel::startUpdateTimer()
 {
-	m->updateTimer.start(interval());
+	// In push mode timer is started only if notification has been received in the meantime.
+	if (!m->push || m->notified) {
+		m->notified = false;
+		m->updateTimer.start(interval());
+	} else
+		m->awaitingNotification = true;
 	emit updateTimerStarted();
 }
 
 void AbstractListModel::stopUpdateTimer()
 {
 	m->updateTimer.stop();
+	m->notified = false;
+	m->awaitingNotification = false;
 	emit updateTimerStopped();
 }
 
+void AbstractListModel::updateListener()
+{
+	if (m->push && m->schema) {
+		m->listener.setChannel(QString());
+		m->listener.setConnectionName(m->schema->connectionName());
+		m->listener.setChannel(m->schema->name());
+	} else
+		m->listener.setChannel(QString());
+}
+
+void AbstractListModel::onNotified(const QString & payload)
+{
+	if (!acceptsNotification(payload))
+		return;
+
+	// If model is idling, update is scheduled right away, otherwise it is going to be scheduled, when model enters idling state.
+	if (m->awaitingNotification) {
+		m->awaitingNotification = false;
+		m->updateTimer.start(interval());
+	} else if (!m->updateTimer.isActive())
+		m->notified = true;
+}
+
 void AbstractListModel::configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus)
 {
 	QState * startingTimer = new QState(parent);
@@ -65,6 +65,14 @@ const AbstractWriter::TagValueContainer & AbstractWriter::values() const
 	return m->values;
 }
 
+QStringList AbstractWriter::tagNames() const
+{
+	QStringList result;
+	for (auto && value : m->values)
+		result.append(value->name());
+	return result;
+}
+
 void AbstractWriter::onSchemaValidated(bool result)
 {
 	if (result)
@@ -1,4 +1,5 @@
 #include <cutehmi/dataacquisition/EventModel.hpp>
+#include <cutehmi/dataacquisition/internal/EventCompressor.hpp>
 
 namespace cutehmi {
 namespace dataacquisition {
@@ -12,10 +13,15 @@ EventModel::EventModel(QObject * parent):
 	{},
 	{},
 	{},
-	{}})
+	{},
+	{},
+	{},
+	{},
+	false})
 {
 	connect(this, & EventModel::schemaChanged, this, & EventModel::onSchemaChanged);
 	connect(& m->dbCollective, & internal::EventCollective::selected, this, & EventModel::onSelected);
+	connect(& m->dbCollective, & internal::EventCollective::selectedNewer, this, & EventModel::onSelectedNewer);
 	connect(& m->dbCollective, & internal::EventCollective::busyChanged, this, & EventModel::confirmUpdateFinished);
 	connect(& m->dbCollective, & internal::EventCollective::errored, this, & EventModel::broke);
 	connect(& m->dbCollective, & internal::EventCollective::busyChanged, this, & EventModel::busyChanged);
@@ -109,9 +115,44 @@ int EventModel::rowCount(const QModelIndex & parent) const
 	return m->columnValues.length();
 }
 
+QVariant EventModel::interpolate(const QString & tag, const QDateTime & time) const
+{
+	internal::EventCompressor::Point before;
+	internal::EventCompressor::Point after;
+
+	// Events are sorted by time in descending order.
+	for (int i = 0; i < m->columnValues.length(); i++) {
+		if (m->columnValues.tagName.at(i) != tag)
+			continue;
+
+		QDateTime eventTime = m->columnValues.time.at(i).toDateTime();
+		if (eventTime > time)
+			after = {m->columnValues.value.at(i), eventTime};
+		else {
+			before = {m->columnValues.value.at(i), eventTime};
+			break;
+		}
+	}
+
+	return internal::EventCompressor::Interpolate(before, after, time);
+}
+
 void EventModel::requestUpdate()
 {
-	m->dbCollective.select(tags(), from(), to());
+	startLatencyTimer();
+
+	// In push mode model is updated, when writers report new rows, so unless selection criteria have changed, it is enough to
+	// select rows newer than the most recent one. Rows are sorted in descending order, thus the most recent one comes first. Rows
+	// match selection criteria only once full selection has completed; until then incremental selection would supersede it.
+	if (push() && rowCount() > 0 && !m->selectPending && m->selectedTags == tags() && m->selectedFrom == from() && m->selectedTo == to())
+		m->dbCollective.selectNewer(tags(), m->columnValues.time.first().toDateTime(), to());
+	else {
+		m->selectedTags = tags();
+		m->selectedFrom = from();
+		m->selectedTo = to();
+		m->selectPending = true;
+		m->dbCollective.select(tags(), from(), to());
+	}
 }
 
 void EventModel::confirmUpdateFinished()
@@ -120,6 +161,11 @@ void EventModel::confirmUpdateFinished()
 		emit updateFinished();
 }
 
+bool EventModel::acceptsNotification(const QString & payload) const
+{
+	return payload == internal::EventCollective::TABLE_STEM;
+}
+
 void EventModel::setBegin(const QDateTime & begin)
 {
 	if (m->begin != begin) {
@@ -146,7 +192,24 @@ void EventModel::onSelected(internal::EventCollective::ColumnValues columnValues
 	setBegin(minTime);
 	setEnd(maxTime);
 
+	m->selectPending = false;
 	internal::ModelMixin<EventModel>::onSelected(columnValues);
+	updateLatency();
+}
+
+void EventModel::onSelectedNewer(internal::EventCollective::ColumnValues columnValues)
+{
+	if (columnValues.length() > 0) {
+		beginInsertRows(QModelIndex(), 0, columnValues.length() - 1);
+		for (int i = 0; i < columnValues.length(); i++)
+			m->columnValues.insert(i, columnValues);
+		endInsertRows();
+
+		QDateTime newest = columnValues.time.first().toDateTime();
+		if (newest > end())
+			setEnd(newest);
+	}
+	updateLatency();
 }
 
 }
@@ -3,12 +3,35 @@
 namespace cutehmi {
 namespace dataacquisition {
 
+constexpr int EventWriter::INITIAL_MAX_INTERVAL;
+
 EventWriter::EventWriter(QObject * parent):
 	AbstractWriter(parent),
 	m(new Members)
 {
+	m->flushTimer.setSingleShot(true);
+
 	connect(this, & AbstractWriter::schemaChanged, this, & EventWriter::onSchemaChanged);
+	connect(this, & EventWriter::schemaValidated, this, & EventWriter::preloadTags);
 	connect(& m->dbCollective, & internal::EventCollective::busyChanged, this, & EventWriter::confirmCollectiveFinished);
+	connect(& m->flushTimer, & QTimer::timeout, this, & EventWriter::flushCompressors);
+}
+
+int EventWriter::maxInterval() const
+{
+	return m->maxInterval;
+}
+
+void EventWriter::setMaxInterval(int maxInterval)
+{
+	CUTEHMI_ASSERT(maxInterval >= 0, "Value of 'maxInterval' property should be non-negative.");
+
+	if (m->maxInterval != maxInterval) {
+		m->maxInterval = maxInterval;
+		if (m->valueChangedConnectionsActive)
+			scheduleFlush();
+		emit maxIntervalChanged();
+	}
 }
 
 void EventWriter::configureStarting(QState * starting, AssignStatusFunction assignStatus)
@@ -34,6 +57,8 @@ void EventWriter::configureStopping(QState * stopping, AssignStatusFunction assi
 	QState * waitingForWorkers = new QState(stopping);
 	stopping->setInitialState(waitingForWorkers);
 	assignStatus(*waitingForWorkers, tr("Waiting for database workers to finish"));
+	// Values held back by the compression have to be stored before workers are awaited.
+	connect(waitingForWorkers, & QState::entered, this, & EventWriter::releaseCompressors);
 	connect(waitingForWorkers, & QState::entered, this, & EventWriter::confirmCollectiveFinished);
 }
 
@@ -95,8 +120,11 @@ void EventWriter::onValueAppend(TagValue * tagValue)
 
 void EventWriter::onValueRemove(TagValue * tagValue)
 {
-	if (m->valueChangedConnectionsActive)
+	if (m->valueChangedConnectionsActive) {
 		tagValue->disconnect(this);
+		insertPoints(tagValue, m->compressors[tagValue].release());
+	}
+	m->compressors.remove(tagValue);
 	CUTEHMI_DEBUG("Source of values tagged '" << tagValue->name() << "' removed from event writer.");
 }
 
@@ -105,21 +133,26 @@ void EventWriter::onSchemaChanged()
 	m->dbCollective.setSchema(schema());
 }
 
-void EventWriter::insertEvent(TagValue * tagValue)
+void EventWriter::preloadTags()
 {
-	CUTEHMI_DEBUG("Requesting database handler to insert values into database.");
+	m->dbCollective.preloadTags(tagNames());
+}
 
-	if (schema())
-		m->dbCollective.insert(*tagValue);
-	else
-		CUTEHMI_CRITICAL("Schema is not set for '" << this << "' object.");
+void EventWriter::insertEvent(TagValue * tagValue)
+{
+	internal::EventCompressor & compressor = m->compressors[tagValue];
+	compressor.configure(tagValue->deadband(), tagValue->deadbandPercent(), tagValue->compressionDeviation());
+	insertPoints(tagValue, compressor.process(tagValue->value(), QDateTime::currentDateTimeUtc()));
 }
 
 void EventWriter::connectValueChangedSignals()
 {
+	// Compressors are reset, because values might have been lost if writer was broken.
+	m->compressors.clear();
 	for (TagValueContainer::const_iterator it = values().begin(); it != values().end(); ++it)
 		connectValueChangedSignal(*it);
 	m->valueChangedConnectionsActive = true;
+	scheduleFlush();
 }
 
 void EventWriter::disconnectValueChangedSignals()
@@ -127,6 +160,7 @@ void EventWriter::disconnectValueChangedSignals()
 	for (TagValueContainer::const_iterator it = values().begin(); it != values().end(); ++it)
 		(*it)->disconnect(this);
 	m->valueChangedConnectionsActive = false;
+	m->flushTimer.stop();
 }
 
 void EventWriter::confirmCollectiveFinished()
@@ -135,6 +169,42 @@ void EventWriter::confirmCollectiveFinished()
 		emit collectiveFinished();
 }
 
+void EventWriter::flushCompressors()
+{
+	QDateTime now = QDateTime::currentDateTimeUtc();
+	for (CompressorsContainer::iterator it = m->compressors.begin(); it != m->compressors.end(); ++it) {
+		QDateTime lastStoredTime = it.value().lastStoredTime();
+		if (lastStoredTime.isValid() && lastStoredTime.msecsTo(now) >= m->maxInterval)
+			insertPoints(it.key(), it.value().flush(now));
+	}
+	scheduleFlush();
+}
+
+void EventWriter::releaseCompressors()
+{
+	for (CompressorsContainer::iterator it = m->compressors.begin(); it != m->compressors.end(); ++it)
+		insertPoints(it.key(), it.value().release());
+}
+
+void EventWriter::scheduleFlush()
+{
+	m->flushTimer.stop();
+	if (m->maxInterval == 0)
+		return;
+
+	QDateTime earliest;
+	for (CompressorsContainer::const_iterator it = m->compressors.constBegin(); it != m->compressors.constEnd(); ++it) {
+		QDateTime lastStoredTime = it.value().lastStoredTime();
+		if (lastStoredTime.isValid() && (!earliest.isValid() || lastStoredTime < earliest))
+			earliest = lastStoredTime;
+	}
+
+	if (earliest.isValid())
+		m->flushTimer.start(static_cast<int>(qBound(qint64(0), QDateTime::currentDateTimeUtc().msecsTo(earliest.addMSecs(m->maxInterval)), qint64(m->maxInterval))));
+	else
+		m->flushTimer.start(m->maxInterval);
+}
+
 void EventWriter::configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus)
 {
 	QState * validatingSchema = createValidatingSchemaSate(parent,  assignStatus);
@@ -150,6 +220,22 @@ void EventWriter::connectValueChangedSignal(TagValue * value)
 	});
 }
 
+void EventWriter::insertPoints(const TagValue * tagValue, const internal::EventCompressor::PointsContainer & points)
+{
+	if (points.isEmpty())
+		return;
+
+	if (!schema()) {
+		CUTEHMI_CRITICAL("Schema is not set for '" << this << "' object.");
+		return;
+	}
+
+	CUTEHMI_DEBUG("Requesting database handler to insert values into database.");
+
+	for (auto && point : points)
+		m->dbCollective.insert(tagValue->name(), point.value, point.time);
+}
+
 }
 }
 
@@ -12,10 +12,15 @@ HistoryModel::HistoryModel(QObject * parent):
 	{},
 	{},
 	{},
-	{}})
+	{},
+	{},
+	{},
+	{},
+	false})
 {
 	connect(this, & HistoryModel::schemaChanged, this, & HistoryModel::onSchemaChanged);
 	connect(& m->dbCollective, & internal::HistoryCollective::selected, this, & HistoryModel::onSelected);
+	connect(& m->dbCollective, & internal::HistoryCollective::selectedNewer, this, & HistoryModel::onSelectedNewer);
 	connect(& m->dbCollective, & internal::HistoryCollective::busyChanged, this, & HistoryModel::confirmUpdateFinished);
 	connect(& m->dbCollective, & internal::HistoryCollective::errored, this, & HistoryModel::broke);
 	connect(& m->dbCollective, & internal::HistoryCollective::busyChanged, this, & HistoryModel::busyChanged);
@@ -131,7 +136,20 @@ int HistoryModel::rowCount(const QModelIndex & parent) const
 
 void HistoryModel::requestUpdate()
 {
-	m->dbCollective.select(tags(), from(), to());
+	startLatencyTimer();
+
+	// In push mode model is updated, when writers report new rows, so unless selection criteria have changed, it is enough to
+	// select rows newer than the most recent one. Rows are sorted in descending order, thus the most recent one comes first. Rows
+	// match selection criteria only once full selection has completed; until then incremental selection would supersede it.
+	if (push() && rowCount() > 0 && !m->selectPending && m->selectedTags == tags() && m->selectedFrom == from() && m->selectedTo == to())
+		m->dbCollective.selectNewer(tags(), m->columnValues.closeTime.first().toDateTime(), to());
+	else {
+		m->selectedTags = tags();
+		m->selectedFrom = from();
+		m->selectedTo = to();
+		m->selectPending = true;
+		m->dbCollective.select(tags(), from(), to());
+	}
 }
 
 void HistoryModel::confirmUpdateFinished()
@@ -140,6 +158,11 @@ void HistoryModel::confirmUpdateFinished()
 		emit updateFinished();
 }
 
+bool HistoryModel::acceptsNotification(const QString & payload) const
+{
+	return payload == internal::HistoryCollective::TABLE_STEM;
+}
+
 void HistoryModel::setBegin(const QDateTime & begin)
 {
 	if (m->begin != begin) {
@@ -166,7 +189,24 @@ void HistoryModel::onSelected(internal::HistoryCollective::ColumnValues columnVa
 	setBegin(minOpenTime);
 	setEnd(maxCloseTime);
 
+	m->selectPending = false;
 	internal::ModelMixin<HistoryModel>::onSelected(columnValues);
+	updateLatency();
+}
+
+void HistoryModel::onSelectedNewer(internal::HistoryCollective::ColumnValues columnValues)
+{
+	if (columnValues.length() > 0) {
+		beginInsertRows(QModelIndex(), 0, columnValues.length() - 1);
+		for (int i = 0; i < columnValues.length(); i++)
+			m->columnValues.insert(i, columnValues);
+		endInsertRows();
+
+		QDateTime newest = columnValues.closeTime.first().toDateTime();
+		if (newest > end())
+			setEnd(newest);
+	}
+	updateLatency();
 }
 
 }
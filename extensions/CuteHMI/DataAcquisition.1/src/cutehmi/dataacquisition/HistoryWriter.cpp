@@ -14,9 +14,11 @@ HistoryWriter::HistoryWriter(QObject * parent):
 {
 	adjustSamplingTimer();
 	connect(this, & AbstractWriter::schemaChanged, this, & HistoryWriter::onSchemaChanged);
+	connect(this, & HistoryWriter::schemaValidated, this, & HistoryWriter::preloadTags);
 	connect(this, & HistoryWriter::intervalChanged, this, & HistoryWriter::adjustSamplingTimer);
 	connect(this, & HistoryWriter::samplesChanged, this, & HistoryWriter::adjustSamplingTimer);
 	connect(& m->dbCollective, & internal::HistoryCollective::busyChanged, this, & HistoryWriter::confirmCollectiveFinished);
+	connect(& m->samplingEngine, & internal::SamplingEngine::candlesReady, this, & HistoryWriter::insertCandles);
 }
 
 int HistoryWriter::interval() const
@@ -51,56 +53,38 @@ void HistoryWriter::setSamples(int samples)
 
 void HistoryWriter::sampleValues()
 {
-	CUTEHMI_DEBUG("Sampling values (count: " << m->sampleCounter + 1 << ").");
-
-	for (TagValueContainer::const_iterator it = values().begin(); it != values().end(); ++it) {
-		QString tagName = (*it)->name();
-		switch ((*it)->value().type()) {
-			case QVariant::Int:
-				addSample<int>((*it)->value().toInt(), m->tuples[tagName]);
-				break;
-			case QVariant::Bool:
-				addSample<bool>((*it)->value().toBool(), m->tuples[tagName]);
-				break;
-			case QVariant::Double:
-				addSample<double>((*it)->value().toDouble(), m->tuples[tagName]);
-				break;
-			default:
-				CUTEHMI_CRITICAL("Unsupported type ('" << (*it)->value().typeName() << "') provided as a 'value' of 'TagValue' object.");
-		}
-	}
-
-	m->sampleCounter++;
-	if (m->sampleCounter >= samples()) {
-		insertValues();
-		clearData();
-	}
+	m->samplingEngine.sample();
 }
 
-void HistoryWriter::insertValues()
+void HistoryWriter::insertValues(const internal::HistoryCollective::TuplesContainer & tuples)
 {
 	CUTEHMI_DEBUG("Requesting database handler to insert values into database.");
 
 	if (schema()) {
 		emit insertValuesBegan();
-		m->dbCollective.insert(m->tuples);
+		m->dbCollective.insert(tuples);
 	} else
 		CUTEHMI_CRITICAL("Schema is not set for '" << this << "' object.");
 }
 
 void HistoryWriter::onValueAppend(TagValue * tagValue)
 {
-#ifndef CUTEHMI_DEBUG
-	Q_UNUSED(tagValue)
-#endif
+	int index = m->samplingEngine.appendSlot(tagValue->name());
+	m->samplingEngine.setValue(index, tagValue->value());
+	QObject::connect(tagValue, & TagValue::valueChanged, this, [tagValue, index, this]() {
+		m->samplingEngine.setValue(index, tagValue->value());
+	});
+	QObject::connect(tagValue, & TagValue::nameChanged, this, [tagValue, index, this]() {
+		m->samplingEngine.setName(index, tagValue->name());
+	});
 	CUTEHMI_DEBUG("Source of values tagged '" << tagValue->name() << "' appended to history writer.");
 }
 
 void HistoryWriter::onValueRemove(TagValue * tagValue)
 {
-#ifndef CUTEHMI_DEBUG
-	Q_UNUSED(tagValue)
-#endif
+	// Values can only be removed all at once (see AbstractWriter::clearValues()), thus all the slots can be cleared.
+	tagValue->disconnect(this);
+	m->samplingEngine.clearSlots();
 	CUTEHMI_DEBUG("Source of values tagged '" << tagValue->name() << "' removed from history writer.");
 }
 
@@ -109,6 +93,11 @@ void HistoryWriter::onSchemaChanged()
 	m->dbCollective.setSchema(schema());
 }
 
+void HistoryWriter::preloadTags()
+{
+	m->dbCollective.preloadTags(tagNames());
+}
+
 void HistoryWriter::initialize()
 {
 	clearData();
@@ -144,11 +133,16 @@ void HistoryWriter::configureStopping(QState * stopping, AssignStatusFunction as
 	assignStatus(*waitingForWorkers, tr("Waiting for database workers to finish"));
 	connect(waitingForWorkers, & QState::entered, this, & HistoryWriter::confirmCollectiveFinished);
 
+	QState * flushing = new QState(stopping);
+	assignStatus(*flushing, tr("Inserting remaining samples"));
+	connect(flushing, & QState::entered, this, & HistoryWriter::flushSamples);
+	flushing->addTransition(this, & HistoryWriter::samplesFlushed, waitingForWorkers);
+
 	QState * stoppingTimer = new QState(stopping);
 	stopping->setInitialState(stoppingTimer);
 	assignStatus(*stoppingTimer, tr("Stopping sampling timer"));
 	connect(stoppingTimer, & QState::entered, this, & HistoryWriter::stopSamplingTimer);
-	stoppingTimer->addTransition(this, & HistoryWriter::samplingTimerStopped, waitingForWorkers);
+	stoppingTimer->addTransition(this, & HistoryWriter::samplingTimerStopped, flushing);
 }
 
 void HistoryWriter::configureBroken(QState * broken, AssignStatusFunction assignStatus)
@@ -206,20 +200,42 @@ std::unique_ptr<QAbstractTransition> HistoryWriter::transitionToIdling() const
 void HistoryWriter::adjustSamplingTimer()
 {
 	m->samplingTimer.setInterval(interval());
+	m->samplingEngine.setInterval(interval());
+	m->samplingEngine.setSamples(samples());
 }
 
 void HistoryWriter::startSamplingTimer()
 {
 	m->samplingTimer.start();
+	m->samplingEngine.start();
 	emit samplingTimerStarted();
 }
 
 void HistoryWriter::stopSamplingTimer()
 {
 	m->samplingTimer.stop();
+	m->samplingEngine.stop();
 	emit samplingTimerStopped();
 }
 
+void HistoryWriter::insertCandles()
+{
+	// Candles are inserted only while sampling. Once sampling is stopped, remaining candles are taken by flushSamples() or they
+	// are discarded on reset.
+	if (!m->samplingTimer.isActive())
+		return;
+
+	for (auto && tuples : m->samplingEngine.takeCandles())
+		insertValues(tuples);
+}
+
+void HistoryWriter::flushSamples()
+{
+	for (auto && tuples : m->samplingEngine.flush())
+		insertValues(tuples);
+	emit samplesFlushed();
+}
+
 void HistoryWriter::confirmCollectiveFinished()
 {
 	if (!m->dbCollective.busy())
@@ -245,28 +261,7 @@ void HistoryWriter::configureStartingOrRepairing(QState * parent, AssignStatusFu
 
 void HistoryWriter::clearData()
 {
-	m->tuples.clear();
-	m->sampleCounter = 0;
-}
-
-template <typename T>
-void HistoryWriter::addSample(T value, internal::HistoryCollective::Tuple & tuple)
-{
-	if (tuple.count == 0) {
-		// Initialize candle.
-		tuple.open = value;
-		tuple.openTime = QDateTime::currentDateTimeUtc();
-		tuple.min = value;
-		tuple.max = value;
-	} else {
-		// Adjust min, max.
-		tuple.min = qMin(tuple.min.value<T>(), value);
-		tuple.max = qMax(tuple.max.value<T>(), value);
-	}
-
-	tuple.closeTime = QDateTime::currentDateTimeUtc();
-	tuple.close = value;
-	tuple.count++;
+	m->samplingEngine.reset();
 }
 
 }
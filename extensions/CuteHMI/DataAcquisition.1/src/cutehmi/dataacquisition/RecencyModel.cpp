@@ -1,11 +1,14 @@
 #include <cutehmi/dataacquisition/RecencyModel.hpp>
+#include <cutehmi/dataacquisition/internal/RecencyCache.hpp>
+
+#include <algorithm>
 
 namespace cutehmi {
 namespace dataacquisition {
 
 RecencyModel::RecencyModel(QObject * parent):
 	AbstractListModel(parent),
-	m(new Members{{}, {}, {}})
+	m(new Members{{}, {}, {}, {}})
 {
 	connect(this, & RecencyModel::schemaChanged, this, & RecencyModel::onSchemaChanged);
 	connect(& m->dbCollective, & internal::RecencyCollective::selected, this, & RecencyModel::onSelected);
@@ -68,7 +71,27 @@ int RecencyModel::rowCount(const QModelIndex & parent) const
 
 void RecencyModel::requestUpdate()
 {
-	m->dbCollective.select(tags());
+	startLatencyTimer();
+
+	m->cachedTuples = internal::RecencyCache::Instance().lookup(internal::RecencyCache::Key(schema()), tags());
+
+	if (tags().isEmpty()) {
+		m->dbCollective.select(tags());
+		return;
+	}
+
+	QStringList missingTags;
+	for (auto && tag : tags())
+		if (!m->cachedTuples.contains(tag))
+			missingTags.append(tag);
+
+	if (missingTags.isEmpty()) {
+		onSelected(internal::RecencyCollective::ColumnValues());
+		// Collective is not involved, so update has to be confirmed explicitly. Queued invocation lets the state machine enter the
+		// state first.
+		QMetaObject::invokeMethod(this, & RecencyModel::confirmUpdateFinished, Qt::QueuedConnection);
+	} else
+		m->dbCollective.select(missingTags);
 }
 
 void RecencyModel::confirmUpdateFinished()
@@ -77,6 +100,11 @@ void RecencyModel::confirmUpdateFinished()
 		emit updateFinished();
 }
 
+bool RecencyModel::acceptsNotification(const QString & payload) const
+{
+	return payload == internal::RecencyCollective::TABLE_STEM;
+}
+
 void RecencyModel::onSchemaChanged()
 {
 	m->dbCollective.setSchema(schema());
@@ -84,7 +112,61 @@ void RecencyModel::onSchemaChanged()
 
 void RecencyModel::onSelected(internal::RecencyCollective::ColumnValues columnValues)
 {
-	ModelMixin<RecencyModel>::onSelected(columnValues);
+	ModelMixin<RecencyModel>::onSelected(mergeCached(columnValues));
+	updateLatency();
+}
+
+void RecencyModel::AppendTuple(internal::RecencyCollective::ColumnValues & columnValues, const QString & tag, const internal::RecencyCollective::Tuple & tuple)
+{
+	columnValues.tagName.append(tag);
+	columnValues.value.append(tuple.value);
+	columnValues.time.append(tuple.time);
+}
+
+internal::RecencyCollective::ColumnValues RecencyModel::mergeCached(const internal::RecencyCollective::ColumnValues & dbValues) const
+{
+	if (m->cachedTuples.isEmpty() && tags().isEmpty())
+		return dbValues;
+
+	internal::RecencyCollective::ColumnValues result;
+
+	if (tags().isEmpty()) {
+		// All the tags have been selected from the database. Cached values override the ones from the database, unless the latter
+		// are more recent (e.g. written by another process).
+		internal::RecencyCollective::TuplesContainer remaining = m->cachedTuples;
+		for (int i = 0; i < dbValues.length(); i++) {
+			auto cached = remaining.find(dbValues.tagName.at(i));
+			if (cached != remaining.end()) {
+				internal::RecencyCollective::Tuple tuple = *cached;
+				remaining.erase(cached);
+				if (tuple.time >= dbValues.time.at(i).toDateTime()) {
+					AppendTuple(result, dbValues.tagName.at(i), tuple);
+					continue;
+				}
+			}
+			result.append(dbValues, i);
+		}
+
+		// Tags that have not yet reached the database are appended in a stable order.
+		QStringList remainingTags = remaining.keys();
+		std::sort(remainingTags.begin(), remainingTags.end());
+		for (auto && tag : remainingTags)
+			AppendTuple(result, tag, remaining.value(tag));
+	} else {
+		QHash<QString, int> dbRows;
+		for (int i = 0; i < dbValues.length(); i++)
+			dbRows.insert(dbValues.tagName.at(i), i);
+
+		for (auto && tag : tags()) {
+			auto cached = m->cachedTuples.constFind(tag);
+			if (cached != m->cachedTuples.constEnd())
+				AppendTuple(result, tag, *cached);
+			else if (dbRows.contains(tag))
+				result.append(dbValues, dbRows.value(tag));
+		}
+	}
+
+	return result;
 }
 
 }
@@ -1,9 +1,11 @@
 #include <cutehmi/dataacquisition/RecencyWriter.hpp>
+#include <cutehmi/dataacquisition/internal/RecencyCache.hpp>
 
 namespace cutehmi {
 namespace dataacquisition {
 
 constexpr int RecencyWriter::INITIAL_INTERVAL;
+constexpr int RecencyWriter::INITIAL_HEARTBEAT_INTERVAL;
 
 RecencyWriter::RecencyWriter(QObject * parent):
 	AbstractWriter(parent),
@@ -11,9 +13,15 @@ RecencyWriter::RecencyWriter(QObject * parent):
 {
 	m->updateTimer.setSingleShot(true);
 	connect(this, & AbstractWriter::schemaChanged, this, & RecencyWriter::onSchemaChanged);
+	connect(this, & RecencyWriter::schemaValidated, this, & RecencyWriter::preloadTags);
 	connect(& m->dbCollective, & internal::RecencyCollective::busyChanged, this, & RecencyWriter::confirmCollectiveFinished);
 }
 
+RecencyWriter::~RecencyWriter()
+{
+	withdrawPublished();
+}
+
 int RecencyWriter::interval() const
 {
 	return m->interval;
@@ -29,6 +37,21 @@ void RecencyWriter::setInterval(int interval)
 	}
 }
 
+int RecencyWriter::heartbeatInterval() const
+{
+	return m->heartbeatInterval;
+}
+
+void RecencyWriter::setHeartbeatInterval(int heartbeatInterval)
+{
+	CUTEHMI_ASSERT(heartbeatInterval >= 0, "Value of 'heartbeatInterval' property should be non-negative.");
+
+	if (m->heartbeatInterval != heartbeatInterval) {
+		m->heartbeatInterval = heartbeatInterval;
+		emit heartbeatIntervalChanged();
+	}
+}
+
 void RecencyWriter::configureStarting(QState * starting, AssignStatusFunction assignStatus)
 {
 	configureStartingOrRepairing(starting, assignStatus);
@@ -48,6 +71,8 @@ void RecencyWriter::configureStarted(QState * active, const QState * idling, con
 
 void RecencyWriter::configureStopping(QState * stopping, AssignStatusFunction assignStatus)
 {
+	connect(stopping, & QState::entered, this, & RecencyWriter::withdrawPublished);
+
 	QState * waitingForWorkers = new QState(stopping);
 	assignStatus(*waitingForWorkers, tr("Waiting for database workers to finish"));
 	connect(waitingForWorkers, & QState::entered, this, & RecencyWriter::confirmCollectiveFinished);
@@ -64,6 +89,7 @@ void RecencyWriter::configureBroken(QState * broken, AssignStatusFunction assign
 	Q_UNUSED(assignStatus)
 
 	connect(broken, & QState::entered, this, & RecencyWriter::stopUpdateTimer);
+	connect(broken, & QState::entered, this, & RecencyWriter::withdrawPublished);
 }
 
 void RecencyWriter::configureRepairing(QState * repairing, AssignStatusFunction assignStatus)
@@ -111,34 +137,56 @@ std::unique_ptr<QAbstractTransition> RecencyWriter::transitionToIdling() const
 
 void RecencyWriter::onValueAppend(TagValue * tagValue)
 {
-#ifndef CUTEHMI_DEBUG
-	Q_UNUSED(tagValue)
-#endif
+	QObject::connect(tagValue, & TagValue::valueChanged, this, [tagValue, this]() {
+		markDirty(tagValue);
+	});
+	markDirty(tagValue);
 	CUTEHMI_DEBUG("Source of values tagged '" << tagValue->name() << "' appended to recency writer.");
 }
 
 void RecencyWriter::onValueRemove(TagValue * tagValue)
 {
-#ifndef CUTEHMI_DEBUG
-	Q_UNUSED(tagValue)
-#endif
+	tagValue->disconnect(this);
+	m->dirtyValues.remove(tagValue);
+	m->dbCollective.withdraw({tagValue->name()});
 	CUTEHMI_DEBUG("Source of values tagged '" << tagValue->name() << "' removed from recency writer.");
 }
 
 void RecencyWriter::updateValues()
 {
 	internal::RecencyCollective::TuplesContainer tuples;
-	for (TagValueContainer::const_iterator it = values().begin(); it != values().end(); ++it)
-		tuples[(*it)->name()] = internal::RecencyCollective::Tuple{(*it)->value(), QDateTime::currentDateTimeUtc()};
+	if (!m->heartbeatTimer.isValid() || (m->heartbeatInterval > 0 && m->heartbeatTimer.hasExpired(m->heartbeatInterval))) {
+		QDateTime now = QDateTime::currentDateTimeUtc();
+		for (TagValueContainer::const_iterator it = values().begin(); it != values().end(); ++it)
+			tuples[(*it)->name()] = internal::RecencyCollective::Tuple{(*it)->value(), m->dirtyValues.value(*it, now)};
+		m->heartbeatTimer.start();
+	} else
+		for (DirtyValuesContainer::const_iterator it = m->dirtyValues.begin(); it != m->dirtyValues.end(); ++it)
+			tuples[it.key()->name()] = internal::RecencyCollective::Tuple{it.key()->value(), it.value()};
+	m->dirtyValues.clear();
+
+	if (tuples.isEmpty()) {
+		CUTEHMI_DEBUG("No values have changed since last update.");
+		// Collective is not involved, so its finish has to be confirmed explicitly. Queued invocation lets the state machine enter
+		// the state first.
+		QMetaObject::invokeMethod(this, & RecencyWriter::confirmCollectiveFinished, Qt::QueuedConnection);
+		return;
+	}
 
-	CUTEHMI_DEBUG("Requesting database handler to update values in the database.");
+	CUTEHMI_DEBUG("Requesting database handler to update " << tuples.count() << " values in the database.");
 
-	if (schema())
+	if (schema()) {
+		m->dbCollective.setCacheKey(internal::RecencyCache::Key(schema()));
 		m->dbCollective.update(tuples);
-	else
+	} else
 		CUTEHMI_CRITICAL("Schema is not set for '" << this << "' object.");
 }
 
+void RecencyWriter::markDirty(TagValue * tagValue)
+{
+	m->dirtyValues.insert(tagValue, QDateTime::currentDateTimeUtc());
+}
+
 void RecencyWriter::configureStartingOrRepairing(QState * parent, AssignStatusFunction assignStatus)
 {
 	QState * startingTimer = new QState(parent);
@@ -149,13 +197,24 @@ void RecencyWriter::configureStartingOrRepairing(QState * parent, AssignStatusFu
 
 	QState * waitingForDatabase = createWaitingForDatabaseConnectedSate(parent, assignStatus, validatingSchema);
 	parent->setInitialState(waitingForDatabase);
+
+	// Updates might have been lost, thus all values are rewritten after (re)start.
+	connect(parent, & QState::entered, this, [this]() {
+		m->heartbeatTimer.invalidate();
+	});
 }
 
 void RecencyWriter::onSchemaChanged()
 {
+	withdrawPublished();
 	m->dbCollective.setSchema(schema());
 }
 
+void RecencyWriter::preloadTags()
+{
+	m->dbCollective.preloadTags(tagNames());
+}
+
 void RecencyWriter::startUpdateTimer()
 {
 	m->updateTimer.start(interval());
@@ -174,6 +233,11 @@ void RecencyWriter::confirmCollectiveFinished()
 		emit collectiveFinished();
 }
 
+void RecencyWriter::withdrawPublished()
+{
+	m->dbCollective.setCacheKey(QString());
+}
+
 }
 }
 
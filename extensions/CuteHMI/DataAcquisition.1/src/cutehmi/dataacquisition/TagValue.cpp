@@ -3,6 +3,10 @@
 namespace cutehmi {
 namespace dataacquisition {
 
+constexpr qreal TagValue::INITIAL_DEADBAND;
+constexpr qreal TagValue::INITIAL_DEADBAND_PERCENT;
+constexpr qreal TagValue::INITIAL_COMPRESSION_DEVIATION;
+
 TagValue::TagValue(QObject * parent):
 	QObject(parent),
 	m(new Members)
@@ -44,6 +48,51 @@ QString TagValue::typeName() const
 	return m->value.typeName();
 }
 
+qreal TagValue::deadband() const
+{
+	return m->deadband;
+}
+
+void TagValue::setDeadband(qreal deadband)
+{
+	CUTEHMI_ASSERT(deadband >= 0.0, "Value of 'deadband' property should be non-negative.");
+
+	if (m->deadband != deadband) {
+		m->deadband = deadband;
+		emit deadbandChanged();
+	}
+}
+
+qreal TagValue::deadbandPercent() const
+{
+	return m->deadbandPercent;
+}
+
+void TagValue::setDeadbandPercent(qreal deadbandPercent)
+{
+	CUTEHMI_ASSERT(deadbandPercent >= 0.0, "Value of 'deadbandPercent' property should be non-negative.");
+
+	if (m->deadbandPercent != deadbandPercent) {
+		m->deadbandPercent = deadbandPercent;
+		emit deadbandPercentChanged();
+	}
+}
+
+qreal TagValue::compressionDeviation() const
+{
+	return m->compressionDeviation;
+}
+
+void TagValue::setCompressionDeviation(qreal compressionDeviation)
+{
+	CUTEHMI_ASSERT(compressionDeviation >= 0.0, "Value of 'compressionDeviation' property should be non-negative.");
+
+	if (m->compressionDeviation != compressionDeviation) {
+		m->compressionDeviation = compressionDeviation;
+		emit compressionDeviationChanged();
+	}
+}
+
 }
 }
 
@@ -0,0 +1,136 @@
+#include <cutehmi/dataacquisition/internal/BinaryCopy.hpp>
+
+#include <QSqlDriver>
+
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+#include <libpq-fe.h>
+#endif
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+constexpr qint64 BinaryCopy::POSTGRES_EPOCH_MSECS;
+
+bool BinaryCopy::IsAvailable(const QSqlDatabase & db)
+{
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+	if (db.driverName() != "QPSQL")
+		return false;
+
+	QVariant handle = db.driver()->handle();
+	return handle.isValid() && qstrcmp(handle.typeName(), "PGconn*") == 0 && *static_cast<PGconn * const *>(handle.data()) != nullptr;
+#else
+	Q_UNUSED(db)
+
+	return false;
+#endif
+}
+
+BinaryCopy::BinaryCopy():
+	m(new Members)
+{
+	// Header consists of signature, flags field and header extension area length.
+	static const char SIGNATURE[] = "PGCOPY\n\377\r\n";
+	m->stream.writeRawData(SIGNATURE, sizeof(SIGNATURE));	// Signature includes terminating null character.
+	m->stream << static_cast<qint32>(0) << static_cast<qint32>(0);
+}
+
+void BinaryCopy::beginRow(int fieldCount)
+{
+	m->stream << static_cast<qint16>(fieldCount);
+	m->rowCount++;
+}
+
+void BinaryCopy::append(bool value)
+{
+	appendField(1);
+	m->stream << static_cast<quint8>(value ? 1 : 0);
+}
+
+void BinaryCopy::append(int value)
+{
+	appendField(sizeof(qint32));
+	m->stream << static_cast<qint32>(value);
+}
+
+void BinaryCopy::append(double value)
+{
+	appendField(sizeof(double));
+	m->stream << value;
+}
+
+void BinaryCopy::append(const QDateTime & value)
+{
+	appendField(sizeof(qint64));
+	m->stream << static_cast<qint64>((value.toMSecsSinceEpoch() - POSTGRES_EPOCH_MSECS) * 1000);
+}
+
+int BinaryCopy::rowCount() const
+{
+	return m->rowCount;
+}
+
+QByteArray BinaryCopy::data() const
+{
+	QByteArray result = m->data;
+	result.append(static_cast<char>(0xFF)).append(static_cast<char>(0xFF));	// File trailer (16-bit -1).
+	return result;
+}
+
+QSqlError BinaryCopy::exec(QSqlDatabase & db, const QString & statement)
+{
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+	if (!IsAvailable(db))
+		return QSqlError(QObject::tr("Binary copy is not available through connection '%1'.").arg(db.connectionName()), QString(), QSqlError::ConnectionError);
+
+	PGconn * connection = *static_cast<PGconn * const *>(db.driver()->handle().data());
+
+	PGresult * result = PQexec(connection, statement.toUtf8().constData());
+	if (PQresultStatus(result) != PGRES_COPY_IN) {
+		QSqlError error(QObject::tr("Could not start binary copy."), QString::fromUtf8(PQerrorMessage(connection)), QSqlError::StatementError);
+		PQclear(result);
+		return error;
+	}
+	PQclear(result);
+
+	QByteArray data = this->data();
+	int putResult = PQputCopyData(connection, data.constData(), data.size());
+	int endResult = PQputCopyEnd(connection, putResult == 1 ? nullptr : "Could not send data.");
+
+	QSqlError error;
+	while ((result = PQgetResult(connection)) != nullptr) {
+		if (PQresultStatus(result) != PGRES_COMMAND_OK && !error.isValid())
+			error = QSqlError(QObject::tr("Binary copy failed."), QString::fromUtf8(PQresultErrorMessage(result)), QSqlError::StatementError);
+		PQclear(result);
+	}
+	if (!error.isValid() && (putResult != 1 || endResult != 1))
+		error = QSqlError(QObject::tr("Binary copy failed."), QString::fromUtf8(PQerrorMessage(connection)), QSqlError::StatementError);
+
+	return error;
+#else
+	Q_UNUSED(statement)
+
+	return QSqlError(QObject::tr("Binary copy is not available through connection '%1'.").arg(db.connectionName()), QString(), QSqlError::ConnectionError);
+#endif
+}
+
+void BinaryCopy::appendField(qint32 length)
+{
+	m->stream << length;
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
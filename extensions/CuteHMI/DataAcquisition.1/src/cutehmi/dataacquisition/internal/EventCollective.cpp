@@ -16,26 +16,40 @@ EventCollective::EventCollective()
 
 void EventCollective::insert(const TagValue & tag)
 {
-	switch (tag.value().type()) {
+	insert(tag.name(), tag.value(), QDateTime::currentDateTimeUtc());
+}
+
+void EventCollective::insert(const QString & tagName, const QVariant & value, const QDateTime & time)
+{
+	Tuple tuple = {value, time};
+
+	switch (value.type()) {
 		case QVariant::Int:
-			insertIntoTable<int>(tag);
+			insertIntoTable<int>(tagName, tuple);
 			break;
 		case QVariant::Bool:
-			insertIntoTable<bool>(tag);
+			insertIntoTable<bool>(tagName, tuple);
 			break;
 		case QVariant::Double:
-			insertIntoTable<double>(tag);
+			insertIntoTable<double>(tagName, tuple);
 			break;
 		default:
-			CUTEHMI_CRITICAL("Unsupported type ('" << tag.value().typeName() << "') provided as a 'value' of 'TagValue' object.");
+			CUTEHMI_CRITICAL("Unsupported type ('" << value.typeName() << "') provided as a 'value' of 'TagValue' object.");
 	}
 }
 
 void EventCollective::select(const QStringList & tags, const QDateTime & from, const QDateTime & to)
 {
 	QString schemaName = getSchemaName();
+	quint64 ticket = supersede();
+
+	worker([this, schemaName, tags, from, to, ticket](QSqlDatabase & db) {
+		// Selection could have been superseded while it was waiting in a queue.
+		if (discardIfSuperseded(ticket))
+			return;
+
+		CancellationScope cancellationScope(*this, db);
 
-	worker([this, schemaName, tags, from, to](QSqlDatabase & db) {
 		// Find min time.
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 14, 0))
 		QDateTime minTime = QDateTime::fromMSecsSinceEpoch(0, Qt::UTC).addYears(static_cast<qint32>(QDateTime::YearRange::Last) - 1970);
@@ -44,38 +58,55 @@ void EventCollective::select(const QStringList & tags, const QDateTime & from, c
 #endif
 		if (!tableMinTime<bool>(db, minTime, schemaName)
 				|| !tableMinTime<int>(db, minTime, schemaName)
-				|| !tableMinTime<double>(db, minTime, schemaName))
+				|| !tableMinTime<double>(db, minTime, schemaName)) {
+			discardIfSuperseded(ticket);
 			return;
+		}
 
 		// Find max time.
 		QDateTime maxTime = QDateTime::fromMSecsSinceEpoch(0, Qt::UTC);
 		if (!tableMaxTime<bool>(db, maxTime, schemaName)
 				|| !tableMaxTime<int>(db, maxTime, schemaName)
-				|| !tableMaxTime<double>(db, maxTime, schemaName))
+				|| !tableMaxTime<double>(db, maxTime, schemaName)) {
+			discardIfSuperseded(ticket);
+			return;
+		}
+
+		// Superseded selection is abandoned before running the most expensive queries.
+		if (discardIfSuperseded(ticket))
 			return;
 
 		// Actual results.
-		constexpr int BOOL = 0;
-		constexpr int INT = 1;
-		constexpr int DOUBLE = 2;
-		constexpr int SIZE = 3;
-		ColumnValues columnValues[SIZE];
-		if (tableSelect<bool>(db, columnValues[BOOL], schemaName, tags, from, to)
-				&& tableSelect<int>(db, columnValues[INT], schemaName, tags, from, to)
-				&& tableSelect<double>(db, columnValues[DOUBLE], schemaName, tags, from, to)) {
-			// Individual tables are sorted by time in descending order by database engine, but we need to merge them into single result.
-			ColumnValues mergedValues;
-			mergeColumnValues<ColumnValues, SIZE>(mergedValues, columnValues, [](const ColumnValues & a, int aIndex, const ColumnValues & b, int bIndex) -> bool {
-				return a.time.at(aIndex).toDateTime() < b.time.at(bIndex).toDateTime();
-			});
-
-			emit selected(std::move(mergedValues), minTime, maxTime);
+		ColumnValues mergedValues;
+		if (mergedSelect(db, mergedValues, schemaName, tags, from, to)) {
+			if (!discardIfSuperseded(ticket))
+				emit selected(std::move(mergedValues), minTime, maxTime);
 		} else
+			discardIfSuperseded(ticket);
+	})->work();
+}
+
+void EventCollective::selectNewer(const QStringList & tags, const QDateTime & after, const QDateTime & to)
+{
+	QString schemaName = getSchemaName();
+	quint64 ticket = supersede();
+
+	worker([this, schemaName, tags, after, to, ticket](QSqlDatabase & db) {
+		if (discardIfSuperseded(ticket))
 			return;
+
+		CancellationScope cancellationScope(*this, db);
+
+		ColumnValues mergedValues;
+		if (mergedSelect(db, mergedValues, schemaName, tags, QDateTime(), to, after)) {
+			if (!discardIfSuperseded(ticket))
+				emit selectedNewer(std::move(mergedValues));
+		} else
+			discardIfSuperseded(ticket);
 	})->work();
 }
 
-QString EventCollective::selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to)
+QString EventCollective::selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to, const QDateTime & after)
 {
 	if (driverName == "QPSQL") {
 		QStringList whereClauses;
@@ -83,6 +114,8 @@ QString EventCollective::selectQuery(const QString & driverName, const QString &
 			whereClauses.append("time >= :from");
 		if (to.isValid())
 			whereClauses.append("time <= :to");
+		if (after.isValid())
+			whereClauses.append("time > :after");
 		if (!tagIdtrings.isEmpty())
 			whereClauses.append(QString("%1.%2.tag_id IN (%3)").arg(schemaName, tableName, tagIdtrings.join(',')));
 		QString where;
@@ -95,6 +128,8 @@ QString EventCollective::selectQuery(const QString & driverName, const QString &
 			whereClauses.append("time >= :from");
 		if (to.isValid())
 			whereClauses.append("time <= :to");
+		if (after.isValid())
+			whereClauses.append("time > :after");
 		if (!tagIdtrings.isEmpty())
 			whereClauses.append(QString("[%1.%2].tag_id IN (%3)").arg(schemaName, tableName, tagIdtrings.join(',')));
 		QString where;
@@ -107,25 +142,26 @@ QString EventCollective::selectQuery(const QString & driverName, const QString &
 }
 
 template<typename T>
-bool EventCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to)
+bool EventCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after)
 {
 	QString tableName = TableNameTraits<T>::Affixed(TABLE_STEM);
 
 	QStringList tagIdStrings;
 	if (!tags.isEmpty()) {
-		for (auto && tag : tags)
-			tagIdStrings.append(QString::number(tagCache()->getId(tag, db)));
+		for (int tagId : tagCache()->getIds(tags, db))
+			tagIdStrings.append(QString::number(tagId));
 	}
 
 	QSqlQuery query(db);
 	query.setForwardOnly(true);
 	CUTEHMI_DEBUG("Reading '" << tableName << "' values...");
 
-	QString queryString = selectQuery(db.driverName(), schemaName, tableName, tagIdStrings, from, to);
+	QString queryString = selectQuery(db.driverName(), schemaName, tableName, tagIdStrings, from, to, after);
 	if (!queryString.isNull()) {
 		query.prepare(queryString);
 		query.bindValue(":from", from);
 		query.bindValue(":to", to);
+		query.bindValue(":after", after);
 		query.exec();
 
 		int nameIndex = query.record().indexOf("name");
@@ -146,6 +182,25 @@ bool EventCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValues
 	return false;
 }
 
+bool EventCollective::mergedSelect(QSqlDatabase & db, ColumnValues & mergedValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after)
+{
+	constexpr int BOOL = 0;
+	constexpr int INT = 1;
+	constexpr int DOUBLE = 2;
+	constexpr int SIZE = 3;
+	ColumnValues columnValues[SIZE];
+	if (!tableSelect<bool>(db, columnValues[BOOL], schemaName, tags, from, to, after)
+			|| !tableSelect<int>(db, columnValues[INT], schemaName, tags, from, to, after)
+			|| !tableSelect<double>(db, columnValues[DOUBLE], schemaName, tags, from, to, after))
+		return false;
+
+	// Individual tables are sorted by time in descending order by database engine, but we need to merge them into single result.
+	mergeColumnValues<ColumnValues, SIZE>(mergedValues, columnValues, [](const ColumnValues & a, int aIndex, const ColumnValues & b, int bIndex) -> bool {
+		return a.time.at(aIndex).toDateTime() < b.time.at(bIndex).toDateTime();
+	});
+	return true;
+}
+
 template<typename T>
 bool EventCollective::tableMinTime(QSqlDatabase & db, QDateTime & minTime, const QString & schemaName)
 {
@@ -229,11 +284,9 @@ bool EventCollective::tableMaxTime(QSqlDatabase & db, QDateTime & maxTime, const
 }
 
 template<typename T>
-void EventCollective::insertIntoTable(const TagValue & tag)
+void EventCollective::insertIntoTable(const QString & tagName, const Tuple & tuple)
 {
 	QString schemaName = getSchemaName();
-	QString tagName = tag.name();
-	Tuple tuple = {tag.value(), QDateTime::currentDateTimeUtc()};
 
 	worker([this, schemaName, tagName, tuple](QSqlDatabase & db) {
 		QString tableName = TableNameTraits<T>::Affixed(TABLE_STEM);
@@ -259,6 +312,9 @@ void EventCollective::insertIntoTable(const TagValue & tag)
 		query.exec();
 
 		pushError(query.lastError(), query.lastQuery());
+
+		if (!query.lastError().isValid())
+			notifyChanged(db, schemaName, TABLE_STEM);
 	})->work();
 }
 
@@ -0,0 +1,160 @@
+#include <cutehmi/dataacquisition/internal/EventCompressor.hpp>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+QVariant EventCompressor::Interpolate(const Point & before, const Point & after, const QDateTime & time)
+{
+	if (!after.value.isValid() || !IsNumeric(before.value) || !IsNumeric(after.value))
+		return before.value;
+
+	qint64 span = before.time.msecsTo(after.time);
+	if (span <= 0)
+		return before.value.toDouble();
+
+	qreal ratio = static_cast<qreal>(before.time.msecsTo(time)) / span;
+	ratio = std::min(std::max(ratio, 0.0), 1.0);
+	return before.value.toDouble() + ratio * (after.value.toDouble() - before.value.toDouble());
+}
+
+EventCompressor::EventCompressor():
+	m_deadband(0.0),
+	m_deadbandPercent(0.0),
+	m_deviation(0.0),
+	m_upperSlope(0.0),
+	m_lowerSlope(0.0)
+{
+}
+
+void EventCompressor::configure(qreal deadband, qreal deadbandPercent, qreal deviation)
+{
+	m_deadband = deadband;
+	m_deadbandPercent = deadbandPercent;
+	m_deviation = deviation;
+}
+
+EventCompressor::PointsContainer EventCompressor::process(const QVariant & value, const QDateTime & time)
+{
+	PointsContainer result;
+	m_latest = {value, time};
+
+	if (!m_stored.value.isValid() || !IsNumeric(value) || value.type() != m_stored.value.type() || time <= m_stored.time) {
+		if (m_held.value.isValid())
+			store(m_held, result);
+		store(m_latest, result);
+		return result;
+	}
+
+	// Once a point is held, values close to the stored one are no longer insignificant, as they can be far from the line.
+	if (!m_held.value.isValid() && qAbs(value.toDouble() - m_stored.value.toDouble()) <= effectiveDeadband())
+		return result;
+
+	if (m_deviation <= 0.0) {
+		store(m_latest, result);
+		return result;
+	}
+
+	if (!m_held.value.isValid()) {
+		hold(m_latest);
+		return result;
+	}
+
+	qreal dt = m_stored.time.msecsTo(time);
+	qreal slope = (value.toDouble() - m_stored.value.toDouble()) / dt;
+	qreal upperSlope = std::min(m_upperSlope, (value.toDouble() + m_deviation - m_stored.value.toDouble()) / dt);
+	qreal lowerSlope = std::max(m_lowerSlope, (value.toDouble() - m_deviation - m_stored.value.toDouble()) / dt);
+	// Line from stored point to the new one must stay within the corridor of points received so far, otherwise some of them would
+	// be reconstructed with an error exceeding compression deviation.
+	if (slope < m_lowerSlope || slope > m_upperSlope) {
+		// Door has been opened beyond the corridor, so held point becomes a pivot of the new one.
+		store(m_held, result);
+		hold(m_latest);
+	} else {
+		m_upperSlope = upperSlope;
+		m_lowerSlope = lowerSlope;
+		m_held = m_latest;
+	}
+
+	return result;
+}
+
+EventCompressor::PointsContainer EventCompressor::release()
+{
+	PointsContainer result;
+
+	if (m_held.value.isValid())
+		store(m_held, result);
+
+	if (m_latest.value.isValid() && m_latest.time > m_stored.time)
+		store(m_latest, result);
+
+	return result;
+}
+
+EventCompressor::PointsContainer EventCompressor::flush(const QDateTime & time)
+{
+	PointsContainer result = release();
+
+	if (m_latest.value.isValid() && time > m_stored.time)
+		store({m_latest.value, time}, result);
+
+	return result;
+}
+
+QDateTime EventCompressor::lastStoredTime() const
+{
+	return m_stored.time;
+}
+
+void EventCompressor::reset()
+{
+	m_stored = Point();
+	m_held = Point();
+	m_latest = Point();
+	m_upperSlope = 0.0;
+	m_lowerSlope = 0.0;
+}
+
+bool EventCompressor::IsNumeric(const QVariant & value)
+{
+	return value.type() == QVariant::Int || value.type() == QVariant::Double;
+}
+
+qreal EventCompressor::effectiveDeadband() const
+{
+	return std::max(m_deadband, m_deadbandPercent / 100.0 * qAbs(m_stored.value.toDouble()));
+}
+
+void EventCompressor::store(const Point & point, PointsContainer & points)
+{
+	points.append(point);
+	m_stored = point;
+	m_held = Point();
+}
+
+void EventCompressor::hold(const Point & point)
+{
+	m_held = point;
+
+	qreal dt = std::max(m_stored.time.msecsTo(point.time), qint64(1));
+	m_upperSlope = (point.value.toDouble() + m_deviation - m_stored.value.toDouble()) / dt;
+	m_lowerSlope = (point.value.toDouble() - m_deviation - m_stored.value.toDouble()) / dt;
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
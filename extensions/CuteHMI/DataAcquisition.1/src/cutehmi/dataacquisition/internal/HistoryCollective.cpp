@@ -1,5 +1,6 @@
 #include <cutehmi/dataacquisition/internal/HistoryCollective.hpp>
 #include <cutehmi/dataacquisition/internal/TableNameTraits.hpp>
+#include <cutehmi/dataacquisition/internal/BinaryCopy.hpp>
 
 #include "helpers.hpp"
 
@@ -22,17 +23,40 @@ void HistoryCollective::insert(const TuplesContainer & tuples)
 	QString schemaName = getSchemaName();
 
 	worker([this, intValues, boolValues, realValues, schemaName](QSqlDatabase & db) {
-		tableInsert<int>(db, schemaName, intValues);
-		tableInsert<bool>(db, schemaName, boolValues);
-		tableInsert<double>(db, schemaName, realValues);
+		// Missing tags are created before transaction begins, so that rollback can not invalidate ids stored in tag cache.
+		tagCache()->getIds(intValues.tagName + boolValues.tagName + realValues.tagName, db);
+
+		// Explicit transaction avoids journal commit per row, which is particularly costly with SQLite. Batch is inserted as a whole
+		// or not at all; PostgreSQL aborts the transaction on first failed statement anyway.
+		bool transaction = db.transaction();
+		bool inserted = tableInsert<int>(db, schemaName, intValues)
+				&& tableInsert<bool>(db, schemaName, boolValues)
+				&& tableInsert<double>(db, schemaName, realValues);
+		if (transaction) {
+			if (!inserted)
+				db.rollback();
+			else if (!db.commit()) {
+				pushError(db.lastError());
+				inserted = false;
+			}
+		}
+		if (inserted)
+			notifyChanged(db, schemaName, TABLE_STEM);
 	})->work();
 }
 
 void HistoryCollective::select(const QStringList & tags, const QDateTime & from, const QDateTime & to)
 {
 	QString schemaName = getSchemaName();
+	quint64 ticket = supersede();
+
+	worker([this, schemaName, tags, from, to, ticket](QSqlDatabase & db) {
+		// Selection could have been superseded while it was waiting in a queue.
+		if (discardIfSuperseded(ticket))
+			return;
+
+		CancellationScope cancellationScope(*this, db);
 
-	worker([this, schemaName, tags, from, to](QSqlDatabase & db) {
 		// Find min open time.
 #if (QT_VERSION >= QT_VERSION_CHECK(5, 14, 0))
 		QDateTime minOpenTime = QDateTime::fromMSecsSinceEpoch(0, Qt::UTC).addYears(static_cast<qint32>(QDateTime::YearRange::Last) - 1970);
@@ -41,34 +65,51 @@ void HistoryCollective::select(const QStringList & tags, const QDateTime & from,
 #endif
 		if (!tableMinOpenTime<bool>(db, minOpenTime, schemaName)
 				|| !tableMinOpenTime<int>(db, minOpenTime, schemaName)
-				|| !tableMinOpenTime<double>(db, minOpenTime, schemaName))
+				|| !tableMinOpenTime<double>(db, minOpenTime, schemaName)) {
+			discardIfSuperseded(ticket);
 			return;
+		}
 
 		// Find max close time.
 		QDateTime maxCloseTime = QDateTime::fromMSecsSinceEpoch(0, Qt::UTC);
 		if (!tableMaxCloseTime<bool>(db, maxCloseTime, schemaName)
 				|| !tableMaxCloseTime<int>(db, maxCloseTime, schemaName)
-				|| !tableMaxCloseTime<double>(db, maxCloseTime, schemaName))
+				|| !tableMaxCloseTime<double>(db, maxCloseTime, schemaName)) {
+			discardIfSuperseded(ticket);
+			return;
+		}
+
+		// Superseded selection is abandoned before running the most expensive queries.
+		if (discardIfSuperseded(ticket))
 			return;
 
 		// Actual results.
-		constexpr int BOOL = 0;
-		constexpr int INT = 1;
-		constexpr int DOUBLE = 2;
-		constexpr int SIZE = 3;
-		ColumnValues columnValues[SIZE];
-		if (tableSelect<bool>(db, columnValues[BOOL], schemaName, tags, from, to)
-				&& tableSelect<int>(db, columnValues[INT], schemaName, tags, from, to)
-				&& tableSelect<double>(db, columnValues[DOUBLE], schemaName, tags, from, to)) {
-			// Individual tables are sorted by close time in descending order by database engine, but we need to merge them into single result.
-			ColumnValues mergedValues;
-			mergeColumnValues<ColumnValues, SIZE>(mergedValues, columnValues, [](const ColumnValues & a, int aIndex, const ColumnValues & b, int bIndex) -> bool {
-				return a.closeTime.at(aIndex).toDateTime() < b.closeTime.at(bIndex).toDateTime();
-			});
-
-			emit selected(std::move(mergedValues), minOpenTime, maxCloseTime);
+		ColumnValues mergedValues;
+		if (mergedSelect(db, mergedValues, schemaName, tags, from, to)) {
+			if (!discardIfSuperseded(ticket))
+				emit selected(std::move(mergedValues), minOpenTime, maxCloseTime);
 		} else
+			discardIfSuperseded(ticket);
+	})->work();
+}
+
+void HistoryCollective::selectNewer(const QStringList & tags, const QDateTime & after, const QDateTime & to)
+{
+	QString schemaName = getSchemaName();
+	quint64 ticket = supersede();
+
+	worker([this, schemaName, tags, after, to, ticket](QSqlDatabase & db) {
+		if (discardIfSuperseded(ticket))
 			return;
+
+		CancellationScope cancellationScope(*this, db);
+
+		ColumnValues mergedValues;
+		if (mergedSelect(db, mergedValues, schemaName, tags, QDateTime(), to, after)) {
+			if (!discardIfSuperseded(ticket))
+				emit selectedNewer(std::move(mergedValues));
+		} else
+			discardIfSuperseded(ticket);
 	})->work();
 }
 
@@ -121,7 +162,7 @@ QString HistoryCollective::insertQuery(const QString & driverName, const QString
 	return QString();
 }
 
-QString HistoryCollective::selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to)
+QString HistoryCollective::selectQuery(const QString & driverName, const QString & schemaName, const QString & tableName, const QStringList & tagIdtrings, const QDateTime & from, const QDateTime & to, const QDateTime & after)
 {
 	if (driverName == "QPSQL") {
 		QStringList whereClauses;
@@ -129,6 +170,8 @@ QString HistoryCollective::selectQuery(const QString & driverName, const QString
 			whereClauses.append("open_time >= :from");
 		if (to.isValid())
 			whereClauses.append("close_time <= :to");
+		if (after.isValid())
+			whereClauses.append("close_time > :after");
 		if (!tagIdtrings.isEmpty())
 			whereClauses.append(QString("%1.%2.tag_id IN (%3)").arg(schemaName, tableName, tagIdtrings.join(',')));
 		QString where;
@@ -141,6 +184,8 @@ QString HistoryCollective::selectQuery(const QString & driverName, const QString
 			whereClauses.append("open_time >= :from");
 		if (to.isValid())
 			whereClauses.append("close_time <= :to");
+		if (after.isValid())
+			whereClauses.append("close_time > :after");
 		if (!tagIdtrings.isEmpty())
 			whereClauses.append(QString("[%1.%2].tag_id IN (%3)").arg(schemaName, tableName, tagIdtrings.join(',')));
 		QString where;
@@ -153,7 +198,7 @@ QString HistoryCollective::selectQuery(const QString & driverName, const QString
 }
 
 template<typename T>
-void HistoryCollective::tableInsert(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues)
+bool HistoryCollective::tableInsert(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues)
 {
 	QString tableName = TableNameTraits<T>::Affixed(TABLE_STEM);
 
@@ -161,8 +206,31 @@ void HistoryCollective::tableInsert(QSqlDatabase & db, const QString & schemaNam
 	query.setForwardOnly(true);
 	CUTEHMI_DEBUG("Storing '" << tableName << "' values...");
 	QVariantList tagIds;
-	for (QStringList::const_iterator tagName = columnValues.tagName.begin(); tagName != columnValues.tagName.end(); ++tagName)
-		tagIds.append(tagCache()->getId(*tagName, db));
+	for (int tagId : tagCache()->getIds(columnValues.tagName, db))
+		tagIds.append(tagId);
+
+	// QPSQL driver emulates batch execution with one INSERT statement per row, thus rows are streamed with binary COPY if possible.
+	if (BinaryCopy::IsAvailable(db)) {
+		if (tagIds.isEmpty())
+			return true;
+
+		BinaryCopy copy;
+		for (int i = 0; i < tagIds.count(); i++) {
+			copy.beginRow(8);
+			copy.append(tagIds.at(i).toInt());
+			copy.append(columnValues.open.at(i).value<T>());
+			copy.append(columnValues.close.at(i).value<T>());
+			copy.append(columnValues.min.at(i).value<T>());
+			copy.append(columnValues.max.at(i).value<T>());
+			copy.append(columnValues.openTime.at(i).toDateTime());
+			copy.append(columnValues.closeTime.at(i).toDateTime());
+			copy.append(columnValues.count.at(i).toInt());
+		}
+		QString statement = QString("COPY %1.%2(tag_id, open, close, min, max, open_time, close_time, count) FROM STDIN (FORMAT binary)").arg(schemaName, tableName);
+		QSqlError error = copy.exec(db, statement);
+		pushError(error, statement);
+		return !error.isValid();
+	}
 
 	query.prepare(insertQuery(db.driverName(), schemaName, tableName));
 	query.bindValue(":tagId", tagIds);
@@ -176,29 +244,33 @@ void HistoryCollective::tableInsert(QSqlDatabase & db, const QString & schemaNam
 	query.execBatch();
 
 	pushError(query.lastError(), query.lastQuery());
+	bool result = !query.lastError().isValid();
 	query.finish();
+
+	return result;
 }
 
 template<typename T>
-bool HistoryCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to)
+bool HistoryCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after)
 {
 	QString tableName = TableNameTraits<T>::Affixed(TABLE_STEM);
 
 	QStringList tagIdStrings;
 	if (!tags.isEmpty()) {
-		for (auto && tag : tags)
-			tagIdStrings.append(QString::number(tagCache()->getId(tag, db)));
+		for (int tagId : tagCache()->getIds(tags, db))
+			tagIdStrings.append(QString::number(tagId));
 	}
 
 	QSqlQuery query(db);
 	query.setForwardOnly(true);
 	CUTEHMI_DEBUG("Reading '" << tableName << "' values...");
 
-	QString queryString = selectQuery(db.driverName(), schemaName, tableName, tagIdStrings, from, to);
+	QString queryString = selectQuery(db.driverName(), schemaName, tableName, tagIdStrings, from, to, after);
 	if (!queryString.isNull()) {
 		query.prepare(queryString);
 		query.bindValue(":from", from);
 		query.bindValue(":to", to);
+		query.bindValue(":after", after);
 		query.exec();
 
 		int nameIndex = query.record().indexOf("name");
@@ -229,6 +301,25 @@ bool HistoryCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValu
 	return false;
 }
 
+bool HistoryCollective::mergedSelect(QSqlDatabase & db, ColumnValues & mergedValues, const QString & schemaName, const QStringList & tags, const QDateTime & from, const QDateTime & to, const QDateTime & after)
+{
+	constexpr int BOOL = 0;
+	constexpr int INT = 1;
+	constexpr int DOUBLE = 2;
+	constexpr int SIZE = 3;
+	ColumnValues columnValues[SIZE];
+	if (!tableSelect<bool>(db, columnValues[BOOL], schemaName, tags, from, to, after)
+			|| !tableSelect<int>(db, columnValues[INT], schemaName, tags, from, to, after)
+			|| !tableSelect<double>(db, columnValues[DOUBLE], schemaName, tags, from, to, after))
+		return false;
+
+	// Individual tables are sorted by close time in descending order by database engine, but we need to merge them into single result.
+	mergeColumnValues<ColumnValues, SIZE>(mergedValues, columnValues, [](const ColumnValues & a, int aIndex, const ColumnValues & b, int bIndex) -> bool {
+		return a.closeTime.at(aIndex).toDateTime() < b.closeTime.at(bIndex).toDateTime();
+	});
+	return true;
+}
+
 template<typename T>
 bool HistoryCollective::tableMinOpenTime(QSqlDatabase & db, QDateTime & minOpenTime, const QString & schemaName)
 {
@@ -0,0 +1,109 @@
+#include <cutehmi/dataacquisition/internal/RecencyCache.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+QString RecencyCache::Key(const Schema * schema)
+{
+	if (schema == nullptr)
+		return QString();
+
+	return schema->connectionName() + '/' + schema->name();
+}
+
+void RecencyCache::publish(const QString & key, const RecencyCollective::TuplesContainer & tuples, const void * owner)
+{
+	QWriteLocker locker(& m->lock);
+
+	RecencyCollective::TuplesContainer & entries = m->entries[key];
+	QHash<QString, QSet<const void *>> & owners = m->owners[key];
+	for (RecencyCollective::TuplesContainer::const_iterator it = tuples.begin(); it != tuples.end(); ++it) {
+		entries.insert(it.key(), it.value());
+		owners[it.key()].insert(owner);
+	}
+}
+
+void RecencyCache::withdraw(const QString & key, const QStringList & tags, const void * owner)
+{
+	QWriteLocker locker(& m->lock);
+
+	for (auto && tag : tags)
+		release(key, tag, owner);
+}
+
+void RecencyCache::withdraw(const QString & key, const void * owner)
+{
+	QWriteLocker locker(& m->lock);
+
+	OwnersContainer::const_iterator owners = m->owners.constFind(key);
+	if (owners == m->owners.constEnd())
+		return;
+
+	QStringList tags;
+	for (auto it = owners->constBegin(); it != owners->constEnd(); ++it)
+		if (it->contains(owner))
+			tags.append(it.key());
+	for (auto && tag : tags)
+		release(key, tag, owner);
+}
+
+RecencyCollective::TuplesContainer RecencyCache::lookup(const QString & key, const QStringList & tags) const
+{
+	QReadLocker locker(& m->lock);
+
+	EntriesContainer::const_iterator entries = m->entries.constFind(key);
+	if (entries == m->entries.constEnd())
+		return RecencyCollective::TuplesContainer();
+
+	if (tags.isEmpty())
+		return *entries;
+
+	RecencyCollective::TuplesContainer result;
+	for (auto && tag : tags) {
+		RecencyCollective::TuplesContainer::const_iterator entry = entries->constFind(tag);
+		if (entry != entries->constEnd())
+			result.insert(tag, *entry);
+	}
+	return result;
+}
+
+RecencyCache::RecencyCache():
+	m(new Members)
+{
+}
+
+void RecencyCache::release(const QString & key, const QString & tag, const void * owner)
+{
+	OwnersContainer::iterator owners = m->owners.find(key);
+	if (owners == m->owners.end())
+		return;
+
+	QHash<QString, QSet<const void *>>::iterator tagOwners = owners->find(tag);
+	if (tagOwners == owners->end() || !tagOwners->remove(owner) || !tagOwners->isEmpty())
+		return;
+
+	owners->erase(tagOwners);
+	EntriesContainer::iterator entries = m->entries.find(key);
+	entries->remove(tag);
+	if (owners->isEmpty()) {
+		m->owners.erase(owners);
+		m->entries.erase(entries);
+	}
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
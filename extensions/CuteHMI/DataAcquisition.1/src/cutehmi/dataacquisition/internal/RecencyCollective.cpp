@@ -1,4 +1,5 @@
 #include <cutehmi/dataacquisition/internal/RecencyCollective.hpp>
+#include <cutehmi/dataacquisition/internal/RecencyCache.hpp>
 #include <cutehmi/dataacquisition/internal/TableNameTraits.hpp>
 
 #include <QSqlField>
@@ -9,10 +10,16 @@ namespace internal {
 
 const char * RecencyCollective::TABLE_STEM = "recency";
 
-RecencyCollective::RecencyCollective()
+RecencyCollective::RecencyCollective():
+	m(new Members)
 {
 }
 
+RecencyCollective::~RecencyCollective()
+{
+	setCacheKey(QString());
+}
+
 void RecencyCollective::update(const TuplesContainer & tuples)
 {
 	ColumnValues intValues;
@@ -20,11 +27,35 @@ void RecencyCollective::update(const TuplesContainer & tuples)
 	ColumnValues realValues;
 	ToColumnValues(intValues, boolValues, realValues, tuples);
 	QString schemaName = getSchemaName();
+	QString cacheKey;
+	{
+		QMutexLocker locker(& m->cacheKeyMutex);
+		cacheKey = m->cacheKey;
+	}
 
-	worker([this, intValues, boolValues, realValues, schemaName](QSqlDatabase & db) {
-		tableUpdate<int>(db, schemaName, intValues);
-		tableUpdate<bool>(db, schemaName, boolValues);
-		tableUpdate<double>(db, schemaName, realValues);
+	worker([this, tuples, intValues, boolValues, realValues, schemaName, cacheKey](QSqlDatabase & db) {
+		// Missing tags are created before transaction begins, so that rollback can not invalidate ids stored in tag cache.
+		tagCache()->getIds(intValues.tagName + boolValues.tagName + realValues.tagName, db);
+
+		// Explicit transaction avoids journal commit per row, which is particularly costly with SQLite. Batch is updated as a whole
+		// or not at all; PostgreSQL aborts the transaction on first failed statement anyway.
+		bool transaction = db.transaction();
+		bool updated = tableUpdate<int>(db, schemaName, intValues)
+				&& tableUpdate<bool>(db, schemaName, boolValues)
+				&& tableUpdate<double>(db, schemaName, realValues);
+		if (transaction) {
+			if (!updated)
+				db.rollback();
+			else if (!db.commit()) {
+				pushError(db.lastError());
+				updated = false;
+			}
+		}
+		if (updated) {
+			// Values are published only after commit, so that readers of the cache never see values, which have been rolled back.
+			publish(cacheKey, tuples);
+			notifyChanged(db, schemaName, TABLE_STEM);
+		}
 	})->work();
 }
 
@@ -44,6 +75,25 @@ void RecencyCollective::select(const QStringList & tags)
 	})->work();
 }
 
+void RecencyCollective::setCacheKey(const QString & key)
+{
+	QMutexLocker locker(& m->cacheKeyMutex);
+
+	if (m->cacheKey != key) {
+		if (!m->cacheKey.isEmpty())
+			RecencyCache::Instance().withdraw(m->cacheKey, this);
+		m->cacheKey = key;
+	}
+}
+
+void RecencyCollective::withdraw(const QStringList & tags)
+{
+	QMutexLocker locker(& m->cacheKeyMutex);
+
+	if (!m->cacheKey.isEmpty())
+		RecencyCache::Instance().withdraw(m->cacheKey, tags, this);
+}
+
 void RecencyCollective::ToColumnValues(ColumnValues & intValues, ColumnValues & boolValues, ColumnValues & realValues, const TuplesContainer & tuples)
 {
 	for (TuplesContainer::const_iterator it = tuples.begin(); it != tuples.end(); ++it) {
@@ -99,7 +149,7 @@ QString RecencyCollective::selectQuery(const QString & driverName, const QString
 }
 
 template<typename T>
-void RecencyCollective::tableUpdate(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues)
+bool RecencyCollective::tableUpdate(QSqlDatabase & db, const QString & schemaName, const ColumnValues & columnValues)
 {
 	QString tableName = TableNameTraits<T>::Affixed(TABLE_STEM);
 
@@ -107,8 +157,8 @@ void RecencyCollective::tableUpdate(QSqlDatabase & db, const QString & schemaNam
 	query.setForwardOnly(true);
 	CUTEHMI_DEBUG("Storing '" << tableName << "' values...");
 	QVariantList tagIds;
-	for (QStringList::const_iterator tagName = columnValues.tagName.begin(); tagName != columnValues.tagName.end(); ++tagName)
-		tagIds.append(tagCache()->getId(*tagName, db));
+	for (int tagId : tagCache()->getIds(columnValues.tagName, db))
+		tagIds.append(tagId);
 
 	query.prepare(updateQuery(db.driverName(), schemaName, tableName));
 	query.bindValue(":tagId", tagIds);
@@ -117,6 +167,8 @@ void RecencyCollective::tableUpdate(QSqlDatabase & db, const QString & schemaNam
 	query.execBatch();
 
 	pushError(query.lastError(), query.lastQuery());
+
+	return !query.lastError().isValid();
 }
 
 template<typename T>
@@ -126,8 +178,8 @@ bool RecencyCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValu
 
 	QStringList tagIdStrings;
 	if (!tags.isEmpty()) {
-		for (auto && tag : tags)
-			tagIdStrings.append(QString::number(tagCache()->getId(tag, db)));
+		for (int tagId : tagCache()->getIds(tags, db))
+			tagIdStrings.append(QString::number(tagId));
 	}
 
 	QSqlQuery query(db);
@@ -157,6 +209,15 @@ bool RecencyCollective::tableSelect(QSqlDatabase & db, ColumnValues & columnValu
 	return false;
 }
 
+void RecencyCollective::publish(const QString & cacheKey, const TuplesContainer & tuples)
+{
+	QMutexLocker locker(& m->cacheKeyMutex);
+
+	// Key might have been changed or withdrawn while the worker was busy.
+	if (!cacheKey.isEmpty() && cacheKey == m->cacheKey)
+		RecencyCache::Instance().publish(cacheKey, tuples, this);
+}
+
 //<CuteHMI.DataAcquisition-1.workaround target="clang" cause="Bug-28280">
 RecencyCollective::ColumnValues::~ColumnValues()
 {
@@ -0,0 +1,298 @@
+#include <cutehmi/dataacquisition/internal/SamplingEngine.hpp>
+
+#include <QDateTime>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+constexpr std::size_t SamplingEngine::CAPACITY;
+constexpr int SamplingEngine::MIN_DRAIN_INTERVAL;
+
+SamplingEngine::SamplingEngine(QObject * parent):
+	QObject(parent),
+	m(new Members)
+{
+	m->drainTimer.setInterval(MIN_DRAIN_INTERVAL);
+	m->worker.moveToThread(& m->thread);
+	m->drainTimer.moveToThread(& m->thread);
+	connect(& m->drainTimer, & QTimer::timeout, & m->worker, [this]() {
+		drain();
+	});
+	m->thread.start();
+}
+
+SamplingEngine::~SamplingEngine()
+{
+	QMetaObject::invokeMethod(& m->drainTimer, & QTimer::stop, Qt::BlockingQueuedConnection);
+	m->thread.quit();
+	m->thread.wait();
+}
+
+void SamplingEngine::setSamples(int samples)
+{
+	m->samples.store(samples, std::memory_order_relaxed);
+}
+
+void SamplingEngine::setInterval(int interval)
+{
+	interval = std::max(interval, MIN_DRAIN_INTERVAL);
+	QMetaObject::invokeMethod(& m->drainTimer, [this, interval]() {
+		m->drainTimer.setInterval(interval);
+	});
+}
+
+int SamplingEngine::appendSlot(const QString & name)
+{
+	m->current.push_back(Sample());
+
+	QMutexLocker locker(& m->namesMutex);
+	m->names.append(name);
+	m->namesGeneration = m->generation;
+
+	return static_cast<int>(m->current.size()) - 1;
+}
+
+void SamplingEngine::setName(int index, const QString & name)
+{
+	QMutexLocker locker(& m->namesMutex);
+	m->names[index] = name;
+}
+
+void SamplingEngine::setValue(int index, const QVariant & value)
+{
+	Sample & sample = m->current[static_cast<std::size_t>(index)];
+	switch (value.type()) {
+		case QVariant::Int:
+			sample.type = INT;
+			sample.value = value.toInt();
+			break;
+		case QVariant::Bool:
+			sample.type = BOOL;
+			sample.value = value.toBool();
+			break;
+		case QVariant::Double:
+			sample.type = DOUBLE;
+			sample.value = value.toDouble();
+			break;
+		default:
+			sample.type = NONE;
+			CUTEHMI_CRITICAL("Unsupported type ('" << value.typeName() << "') provided as a 'value' of 'TagValue' object.");
+	}
+}
+
+void SamplingEngine::clearSlots()
+{
+	m->current.clear();
+	m->generation++;
+
+	QMutexLocker locker(& m->namesMutex);
+	m->names.clear();
+	m->namesGeneration = m->generation;
+}
+
+bool SamplingEngine::sample()
+{
+	std::size_t head = m->head.load(std::memory_order_relaxed);
+	if (head - m->tail.load(std::memory_order_acquire) >= CAPACITY) {
+		CUTEHMI_WARNING("Sampling buffer is full - sample has been dropped.");
+		return false;
+	}
+
+	Frame & frame = m->frames[head % CAPACITY];
+	frame.time = QDateTime::currentMSecsSinceEpoch();
+	frame.generation = m->generation;
+	frame.samples = m->current;	// Vector reuses its storage, so usually this is just a copy of memory block.
+	m->head.store(head + 1, std::memory_order_release);
+
+	return true;
+}
+
+void SamplingEngine::start()
+{
+	QMetaObject::invokeMethod(& m->drainTimer, QOverload<>::of(& QTimer::start));
+}
+
+void SamplingEngine::stop()
+{
+	QMetaObject::invokeMethod(& m->drainTimer, & QTimer::stop);
+}
+
+void SamplingEngine::reset()
+{
+	QMetaObject::invokeMethod(& m->worker, [this]() {
+		m->tail.store(m->head.load(std::memory_order_acquire), std::memory_order_release);
+		m->candles.clear();
+		m->sampleCounter = 0;
+
+		QMutexLocker locker(& m->closedCandlesMutex);
+		m->closedCandles.clear();
+	});
+}
+
+SamplingEngine::CandleSetsContainer SamplingEngine::takeCandles()
+{
+	QMutexLocker locker(& m->closedCandlesMutex);
+	CandleSetsContainer result;
+	result.swap(m->closedCandles);
+	return result;
+}
+
+SamplingEngine::CandleSetsContainer SamplingEngine::flush()
+{
+	QMetaObject::invokeMethod(& m->worker, [this]() {
+		drain();
+		if (m->sampleCounter > 0)
+			closeCandles(m->candlesGeneration);
+	}, Qt::BlockingQueuedConnection);
+
+	return takeCandles();
+}
+
+QVariant SamplingEngine::ToVariant(double value, Type type)
+{
+	switch (type) {
+		case INT:
+			return static_cast<int>(value);
+		case BOOL:
+			return value != 0.0;
+		case DOUBLE:
+			return value;
+		default:
+			return QVariant();
+	}
+}
+
+void SamplingEngine::drain()
+{
+	std::size_t tail = m->tail.load(std::memory_order_relaxed);
+	std::size_t head = m->head.load(std::memory_order_acquire);
+	for (; tail != head; ++tail) {
+		const Frame & frame = m->frames[tail % CAPACITY];
+
+		if (frame.generation != m->candlesGeneration) {
+			// Slots have been cleared, so indices of candles do not correspond to indices of samples anymore.
+			m->candles.clear();
+			m->sampleCounter = 0;
+			m->candlesGeneration = frame.generation;
+		}
+		if (m->candles.size() < frame.samples.size())
+			m->candles.resize(frame.samples.size());
+
+		for (std::size_t i = 0; i < frame.samples.size(); i++) {
+			const Sample & sample = frame.samples[i];
+			Candle & candle = m->candles[i];
+			if (sample.type == NONE)
+				continue;
+
+			// Candle can not mix values of different types, thus it is closed before it is reinitialized.
+			if (candle.count != 0 && candle.type != sample.type)
+				closeCandle(i, frame.generation);
+
+			if (candle.count == 0) {
+				// Initialize candle.
+				candle.type = sample.type;
+				candle.open = sample.value;
+				candle.openTime = frame.time;
+				candle.min = sample.value;
+				candle.max = sample.value;
+				candle.count = 0;
+			} else {
+				// Adjust min, max.
+				candle.min = std::min(candle.min, sample.value);
+				candle.max = std::max(candle.max, sample.value);
+			}
+			candle.close = sample.value;
+			candle.closeTime = frame.time;
+			candle.count++;
+		}
+
+		m->sampleCounter++;
+		if (m->sampleCounter >= m->samples.load(std::memory_order_relaxed))
+			closeCandles(frame.generation);
+	}
+	m->tail.store(tail, std::memory_order_release);
+}
+
+HistoryCollective::Tuple SamplingEngine::ToTuple(const Candle & candle)
+{
+	HistoryCollective::Tuple tuple;
+	tuple.open = ToVariant(candle.open, candle.type);
+	tuple.close = ToVariant(candle.close, candle.type);
+	tuple.min = ToVariant(candle.min, candle.type);
+	tuple.max = ToVariant(candle.max, candle.type);
+	tuple.openTime = QDateTime::fromMSecsSinceEpoch(candle.openTime, Qt::UTC);
+	tuple.closeTime = QDateTime::fromMSecsSinceEpoch(candle.closeTime, Qt::UTC);
+	tuple.count = candle.count;
+	return tuple;
+}
+
+void SamplingEngine::closeCandles(quint32 generation)
+{
+	HistoryCollective::TuplesContainer tuples;
+	{
+		QMutexLocker locker(& m->namesMutex);
+
+		if (m->namesGeneration == generation) {
+			tuples.reserve(static_cast<int>(m->candles.size()));
+			for (std::size_t i = 0; i < m->candles.size() && i < static_cast<std::size_t>(m->names.count()); i++)
+				if (m->candles[i].count != 0)
+					tuples.insert(m->names.at(static_cast<int>(i)), ToTuple(m->candles[i]));
+		}
+	}
+
+	for (auto && candle : m->candles)
+		candle.count = 0;
+	m->sampleCounter = 0;
+
+	publish(tuples);
+}
+
+void SamplingEngine::closeCandle(std::size_t index, quint32 generation)
+{
+	HistoryCollective::TuplesContainer tuples;
+	{
+		QMutexLocker locker(& m->namesMutex);
+
+		if (m->namesGeneration == generation && index < static_cast<std::size_t>(m->names.count()))
+			tuples.insert(m->names.at(static_cast<int>(index)), ToTuple(m->candles[index]));
+	}
+
+	m->candles[index].count = 0;
+
+	publish(tuples);
+}
+
+void SamplingEngine::publish(const HistoryCollective::TuplesContainer & tuples)
+{
+	if (tuples.isEmpty())
+		return;
+
+	bool notify;
+	{
+		QMutexLocker locker(& m->closedCandlesMutex);
+		// Signal is emitted only if candles have been taken since previous one, so that slow consumer is not flooded with signals.
+		notify = m->closedCandles.isEmpty();
+		m->closedCandles.append(tuples);
+	}
+
+	if (notify)
+		emit candlesReady();
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -1,5 +1,13 @@
 #include <cutehmi/dataacquisition/internal/TableCollective.hpp>
 
+#include <cutehmi/shareddatabase/Database.hpp>
+
+#include <QSqlDriver>
+
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+#include <libpq-fe.h>
+#endif
+
 namespace cutehmi {
 namespace dataacquisition {
 namespace internal {
@@ -10,6 +18,13 @@ TableCollective::TableCollective():
 	connect(this, & TableObject::schemaChanged, this, & TableCollective::onSchemaChanged);
 }
 
+void TableCollective::preloadTags(const QStringList & tags)
+{
+	worker([this, tags](QSqlDatabase & db) {
+		tagCache()->preload(tags, db);
+	})->work();
+}
+
 TagCache * TableCollective::tagCache() const
 {
 	CUTEHMI_ASSERT(m->tagCache.get(), "object must not be nullptr");
@@ -17,6 +32,80 @@ TagCache * TableCollective::tagCache() const
 	return m->tagCache.get();
 }
 
+quint64 TableCollective::supersede()
+{
+	quint64 ticket = ++m->ticket;
+
+	QMutexLocker locker(& m->cancellationMutex);
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+	if (m->pgCancel) {
+		// Cancel request is sent while holding the lock, so that it is never sent after query has left cancellation scope.
+		char errorBuffer[256];
+		if (!PQcancel(m->pgCancel, errorBuffer, sizeof(errorBuffer)))
+			CUTEHMI_DEBUG("Could not cancel query: " << errorBuffer);
+		return ticket;
+	}
+#endif
+	if (m->cancellableDriver)
+		m->cancellableDriver->cancelQuery();
+
+	return ticket;
+}
+
+bool TableCollective::discardIfSuperseded(quint64 ticket)
+{
+	if (ticket == m->ticket)
+		return false;
+
+	CUTEHMI_DEBUG("Discarding superseded selection.");
+	clearErrors();
+	return true;
+}
+
+void TableCollective::notifyChanged(QSqlDatabase & db, const QString & schemaName, const QString & tableStem)
+{
+	if (db.driverName() == "QPSQL") {
+		QSqlQuery query(db);
+		query.setForwardOnly(true);
+		query.prepare("SELECT pg_notify(:channel, :payload)");
+		query.bindValue(":channel", schemaName);
+		query.bindValue(":payload", tableStem);
+		query.exec();
+
+		pushError(query.lastError(), query.lastQuery());
+	} else
+		shareddatabase::Database::Notify(db.connectionName(), schemaName, tableStem);
+}
+
+TableCollective::CancellationScope::CancellationScope(TableCollective & collective, QSqlDatabase & db):
+	m_collective(collective)
+{
+	QMutexLocker locker(& m_collective.m->cancellationMutex);
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+	if (db.driverName() == "QPSQL") {
+		QVariant handle = db.driver()->handle();
+		if (handle.isValid() && qstrcmp(handle.typeName(), "PGconn*") == 0) {
+			m_collective.m->pgCancel = PQgetCancel(*static_cast<PGconn * const *>(handle.data()));
+			return;
+		}
+	}
+#endif
+	if (db.driver()->hasFeature(QSqlDriver::CancelQuery))
+		m_collective.m->cancellableDriver = db.driver();
+}
+
+TableCollective::CancellationScope::~CancellationScope()
+{
+	QMutexLocker locker(& m_collective.m->cancellationMutex);
+#ifdef CUTEHMI_DATAACQUISITION_LIBPQ
+	if (m_collective.m->pgCancel) {
+		PQfreeCancel(m_collective.m->pgCancel);
+		m_collective.m->pgCancel = nullptr;
+	}
+#endif
+	m_collective.m->cancellableDriver = nullptr;
+}
+
 void TableCollective::onSchemaChanged()
 {
 	m->tagCache.reset(new TagCache(schema()));
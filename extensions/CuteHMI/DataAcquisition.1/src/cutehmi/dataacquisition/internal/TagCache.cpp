@@ -2,11 +2,14 @@
 
 #include <QSqlRecord>
 #include <QSqlResult>
+#include <QSet>
 
 namespace cutehmi {
 namespace dataacquisition {
 namespace internal {
 
+constexpr int TagCache::INSERT_BATCH_SIZE;
+
 TagCache::TagCache(Schema * schema, QObject * parent):
 	TableObject(schema, parent),
 	m(new Members)
@@ -15,131 +18,180 @@ TagCache::TagCache(Schema * schema, QObject * parent):
 
 int TagCache::getId(const QString & name, QSqlDatabase & db)
 {
-	TagIdContainter::const_iterator tag;
-	TagIdContainter::const_iterator tagIdsEnd;
-	bool tagIdsEmpty;
-
-	// Access to m->tagIds is a critical section.
-	{
-		QReadLocker locker(& m->tagIdsLock);
-		tag = m->tagIds.constFind(name);
-		tagIdsEnd = m->tagIds.constEnd();
-		tagIdsEmpty = m->tagIds.empty();
+	SnapshotPtr tagIds = snapshot();
+	if (tagIds) {
+		TagIdContainter::const_iterator tag = tagIds->constFind(name);
+		if (tag != tagIds->constEnd())
+			return tag.value();
 	}
 
-	if (tag == tagIdsEnd) {
-		// If tag ids map is empty update it from database.
-		if (tagIdsEmpty) {
-			update(db);
-			{
-				QReadLocker locker(& m->tagIdsLock);
-				tag = m->tagIds.constFind(name);
-				tagIdsEnd = m->tagIds.constEnd();
-			}
-		}
+	return getIds(QStringList{name}, db).value(0, -1);
+}
 
-		// If tag wasn't found it probably does not exist in database, so insert it.
-		if (tag == tagIdsEnd) {
-			insert(name, db);
-			{
-				QReadLocker locker(& m->tagIdsLock);
-				tag = m->tagIds.constFind(name);
-				tagIdsEnd = m->tagIds.constEnd();
-			}
-
-			// If insert query fails, then some other thread might have inserted it.
-			if (tag == tagIdsEnd) {
-				update(db);
-				{
-					QReadLocker locker(& m->tagIdsLock);
-					tag = m->tagIds.constFind(name);
-				}
-			}
-		}
+QList<int> TagCache::getIds(const QStringList & names, QSqlDatabase & db)
+{
+	SnapshotPtr tagIds = snapshot();
+	QStringList missingNames = missing(names, tagIds);
+	if (!missingNames.isEmpty()) {
+		{
+			QMutexLocker locker(& m->updateMutex);
 
+			obtain(missingNames, db);
+		}
 		processErrors();
+
+		tagIds = snapshot();
 	}
 
-	return tag.value();
+	QList<int> result;
+	result.reserve(names.count());
+	for (auto && name : names)
+		result.append(tagIds ? tagIds->value(name, -1) : -1);
+	return result;
 }
 
-void TagCache::insert(const QString & name, QSqlDatabase & db)
+void TagCache::preload(const QStringList & names, QSqlDatabase & db)
 {
-	if (db.driverName() == "QPSQL") {
-		QSqlQuery query(db);
-		query.setForwardOnly(true);
-		CUTEHMI_DEBUG("Inserting '" << name << "' tag...");
-
-		query.prepare(QString("INSERT INTO %1.tag (name) VALUES (:name) RETURNING id").arg(schema()->name()));
-		query.bindValue(":name", name);
-		query.exec();
-		int idIndex = query.record().indexOf("id");
+	{
+		QMutexLocker locker(& m->updateMutex);
+
+		update(db);
+		obtain(missing(names, snapshot()), db);
+	}
+	processErrors();
+}
 
-		if (query.first()) {
-			QWriteLocker locker(& m->tagIdsLock);
-			m->tagIds[name] = query.value(idIndex).toInt();
+void TagCache::insert(const QStringList & names, QSqlDatabase & db)
+{
+	if (names.isEmpty())
+		return;
+
+	QString tagTable;
+	if (db.driverName() == "QPSQL")
+		tagTable = QString("%1.tag").arg(schema()->name());
+	else if (db.driverName() == "QSQLITE")
+		tagTable = QString("[%1.tag]").arg(schema()->name());
+	else {
+		emit errored(CUTEHMI_ERROR(tr("Driver '%1' is not supported.").arg(db.driverName())));
+		return;
+	}
+
+	SnapshotPtr current = snapshot();
+	std::shared_ptr<TagIdContainter> tagIds = current ? std::make_shared<TagIdContainter>(*current) : std::make_shared<TagIdContainter>();
+
+	QSqlQuery query(db);
+	query.setForwardOnly(true);
+	for (int offset = 0; offset < names.count(); offset += INSERT_BATCH_SIZE) {
+		QStringList batch = names.mid(offset, INSERT_BATCH_SIZE);
+		QStringList placeholders;
+		for (int i = 0; i < batch.count(); i++)
+			placeholders.append("(?)");
+		CUTEHMI_DEBUG("Inserting " << batch.count() << " tags...");
+
+		if (db.driverName() == "QPSQL") {
+			// Tags inserted concurrently by someone else are not returned and they have to be picked up by update().
+			query.prepare(QString("INSERT INTO %1 (name) VALUES %2 ON CONFLICT (name) DO NOTHING RETURNING id, name").arg(tagTable, placeholders.join(", ")));
+			for (auto && name : batch)
+				query.addBindValue(name);
+			query.exec();
+		} else {
+			query.prepare(QString("INSERT OR IGNORE INTO %1 (name) VALUES %2").arg(tagTable, placeholders.join(", ")));
+			for (auto && name : batch)
+				query.addBindValue(name);
+			query.exec();
+			pushError(query.lastError(), query.lastQuery());
+			query.finish();
+
+			QStringList inPlaceholders;
+			for (int i = 0; i < batch.count(); i++)
+				inPlaceholders.append("?");
+			query.prepare(QString("SELECT id, name FROM %1 WHERE name IN (%2)").arg(tagTable, inPlaceholders.join(", ")));
+			for (auto && name : batch)
+				query.addBindValue(name);
+			query.exec();
 		}
+
+		int idIndex = query.record().indexOf("id");
+		int nameIndex = query.record().indexOf("name");
+		while (query.next())
+			tagIds->insert(query.value(nameIndex).toString(), query.value(idIndex).toInt());
 		pushError(query.lastError(), query.lastQuery());
-	} else if (db.driverName() == "QSQLITE") {
-		QSqlQuery query(db);
-		query.setForwardOnly(true);
-		CUTEHMI_DEBUG("Inserting '" << name << "' tag...");
-
-		query.prepare(QString("INSERT INTO [%1.tag] (name) VALUES (:name);").arg(schema()->name()));
-		query.bindValue(":name", name);
-		query.exec();
 		query.finish();
+	}
 
+	publish(std::move(tagIds));
+}
 
-		query.prepare(QString("SELECT * FROM [%1.tag] WHERE name = :name").arg(schema()->name()));
-		query.bindValue(":name", name);
-		query.exec();
-		int idIndex = query.record().indexOf("id");
-		if (query.first()) {
-			QWriteLocker locker(& m->tagIdsLock);
-			m->tagIds[name] = query.value(idIndex).toInt();
-		}
-		pushError(query.lastError(), query.lastQuery());
-	} else
+void TagCache::update(QSqlDatabase & db)
+{
+	QString queryString;
+	if (db.driverName() == "QPSQL")
+		queryString = QString("SELECT id, name FROM %1.tag").arg(schema()->name());
+	else if (db.driverName() == "QSQLITE")
+		queryString = QString("SELECT id, name FROM [%1.tag]").arg(schema()->name());
+	else {
 		emit errored(CUTEHMI_ERROR(tr("Driver '%1' is not supported.").arg(db.driverName())));
+		return;
+	}
+
+	QSqlQuery query(db);
+	query.setForwardOnly(true);
+	CUTEHMI_DEBUG("Updating tag cache...");
+
+	query.exec(queryString);
+	int idIndex = query.record().indexOf("id");
+	int nameIndex = query.record().indexOf("name");
+	std::shared_ptr<TagIdContainter> tagIds = std::make_shared<TagIdContainter>();
+	while (query.next())
+		tagIds->insert(query.value(nameIndex).toString(), query.value(idIndex).toInt());
+	pushError(query.lastError(), query.lastQuery());
+
+	if (!query.lastError().isValid())
+		publish(std::move(tagIds));
 }
 
-void TagCache::update(QSqlDatabase & db)
+TagCache::SnapshotPtr TagCache::snapshot() const
 {
-	if (db.driverName() == "QPSQL") {
-		QSqlQuery query(db);
-		query.setForwardOnly(true);
-		CUTEHMI_DEBUG("Updating tag cache...");
+	return std::atomic_load(& m->snapshot);
+}
 
-		query.exec(QString("SELECT * FROM %1.tag").arg(schema()->name()));
-		int idIndex = query.record().indexOf("id");
-		int nameIndex = query.record().indexOf("name");
-		{
-			QWriteLocker locker(& m->tagIdsLock);
+void TagCache::publish(SnapshotPtr snapshot)
+{
+	std::atomic_store(& m->snapshot, std::move(snapshot));
+}
 
-			m->tagIds.clear();
-			while (query.next())
-				m->tagIds[query.value(nameIndex).toString()] = query.value(idIndex).toInt();
+QStringList TagCache::missing(const QStringList & names, const SnapshotPtr & snapshot) const
+{
+	QStringList result;
+	QSet<QString> seen;
+	for (auto && name : names)
+		if ((!snapshot || !snapshot->contains(name)) && !seen.contains(name)) {
+			seen.insert(name);
+			result.append(name);
 		}
-		pushError(query.lastError(), query.lastQuery());
-	} else if (db.driverName() == "QSQLITE") {
-		QSqlQuery query(db);
-		query.setForwardOnly(true);
-		CUTEHMI_DEBUG("Updating tag cache...");
+	return result;
+}
 
-		query.exec(QString("SELECT * FROM [%1.tag]").arg(schema()->name()));
-		int idIndex = query.record().indexOf("id");
-		int nameIndex = query.record().indexOf("name");
-		{
-			QWriteLocker locker(& m->tagIdsLock);
+void TagCache::obtain(const QStringList & names, QSqlDatabase & db)
+{
+	// Another thread might have obtained some of the tags, while this one was waiting for the lock.
+	QStringList missingNames = missing(names, snapshot());
+	if (missingNames.isEmpty())
+		return;
+
+	// Cache is loaded from the database before first insertion, because most tags usually exist already.
+	if (!snapshot()) {
+		update(db);
+		missingNames = missing(missingNames, snapshot());
+	}
 
-			m->tagIds.clear();
-			while (query.next())
-				m->tagIds[query.value(nameIndex).toString()] = query.value(idIndex).toInt();
-		}
-		pushError(query.lastError(), query.lastQuery());
-	} else
-		emit errored(CUTEHMI_ERROR(tr("Driver '%1' is not supported.").arg(db.driverName())));
+	if (!missingNames.isEmpty()) {
+		insert(missingNames, db);
+
+		// Tags, which could not be inserted, might have been inserted by someone else in the meantime.
+		if (!missing(missingNames, snapshot()).isEmpty())
+			update(db);
+	}
 }
 
 }
@@ -0,0 +1,516 @@
+#include <cutehmi/dataacquisition/EventModel.hpp>
+#include <cutehmi/dataacquisition/EventWriter.hpp>
+#include <cutehmi/dataacquisition/HistoryModel.hpp>
+#include <cutehmi/dataacquisition/HistoryWriter.hpp>
+#include <cutehmi/dataacquisition/RecencyWriter.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+#include <cutehmi/dataacquisition/TagValue.hpp>
+
+#include <cutehmi/shareddatabase/Database.hpp>
+#include <cutehmi/shareddatabase/NotificationListener.hpp>
+
+#include <cutehmi/services/Service.hpp>
+
+#include <cutehmi/test/bench.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QTemporaryDir>
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <memory>
+#include <vector>
+
+namespace cutehmi {
+namespace dataacquisition {
+
+/**
+ * Data acquisition benchmark. Benchmark measures ingest throughput and latency of the writers as well as select latency and
+ * memory footprint of the models.
+ *
+ * Ingest is measured end-to-end. Values of the tags are changed at a given rate and time is measured until writer reports, with
+ * a database notification, that the data has been committed. Ingest cases run against in-memory and file SQLite databases.
+ * Select cases run against file SQLite databases, which are populated directly with SQL.
+ *
+ * Benchmark is configured with environment variables:
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_TAGS - comma-separated list of tag counts (default "10,100").
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_RATES - comma-separated list of update rates [Hz] (default "10").
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_DURATION - duration of each ingest case [ms] (default 1000).
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_ROWS - comma-separated list of table sizes for select cases (default "1000,10000").
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_REPEAT - number of queries issued in each select case (default 5).
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_PG_HOST - if set, all the cases are also run against PostgreSQL server. Connection can be
+ *   further configured with @p CUTEHMI_DATAACQUISITION_BENCH_PG_PORT, @p CUTEHMI_DATAACQUISITION_BENCH_PG_NAME,
+ *   @p CUTEHMI_DATAACQUISITION_BENCH_PG_USER and @p CUTEHMI_DATAACQUISITION_BENCH_PG_PASSWORD variables.
+ * - @p CUTEHMI_DATAACQUISITION_BENCH_OUTPUT - path to a file, to which results are appended. If not set, results are printed
+ *   to standard output.
+ *
+ * Each case yields a single line of JSON (JSON Lines format).
+ */
+class bench_dataacquisition:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void ingest_data();
+
+		void ingest();
+
+		void select_data();
+
+		void select();
+
+	private:
+		static constexpr int TIMEOUT = 30000;
+
+		static constexpr int SELECT_TAGS = 10;
+
+		struct Environment
+		{
+			std::unique_ptr<shareddatabase::Database> database;
+			std::unique_ptr<services::Service> databaseService;
+			std::unique_ptr<Schema> schema;
+		};
+
+		static bool StartService(services::Service & service, QObject * serviceable);
+
+		static bool StopService(services::Service & service);
+
+		static qint64 Percentile(std::vector<qint64> samples, qreal percentile);
+
+		QStringList backends(bool includeMemory) const;
+
+		bool setUpEnvironment(Environment & environment, const QString & backend);
+
+		void tearDownEnvironment(Environment & environment);
+
+		bool populate(const Environment & environment, const QString & backend, const QString & model, int rows);
+
+		QTemporaryDir m_dir;
+		int m_counter = 0;
+};
+
+constexpr int bench_dataacquisition::TIMEOUT;
+constexpr int bench_dataacquisition::SELECT_TAGS;
+
+void bench_dataacquisition::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+void bench_dataacquisition::ingest_data()
+{
+	QTest::addColumn<QString>("backend");
+	QTest::addColumn<QString>("writer");
+	QTest::addColumn<int>("tags");
+	QTest::addColumn<int>("rate");
+
+	for (auto && backend : backends(true))
+		for (auto && writer : {"event", "history", "recency"})
+			for (int tags : test::intListEnv("CUTEHMI_DATAACQUISITION_BENCH_TAGS", {10, 100}))
+				for (int rate : test::intListEnv("CUTEHMI_DATAACQUISITION_BENCH_RATES", {10}))
+					QTest::newRow(QString("%1/%2/%3 tags/%4 Hz").arg(backend, writer).arg(tags).arg(rate).toLocal8Bit().constData()) << backend << QString(writer) << tags << rate;
+}
+
+void bench_dataacquisition::ingest()
+{
+	QFETCH(QString, backend);
+	QFETCH(QString, writer);
+	QFETCH(int, tags);
+	QFETCH(int, rate);
+
+	int duration = test::intEnv("CUTEHMI_DATAACQUISITION_BENCH_DURATION", 1000);
+	int tickInterval = std::max(1, 1000 / std::max(1, rate));
+
+	Environment environment;
+	QVERIFY(setUpEnvironment(environment, backend));
+
+	std::unique_ptr<AbstractWriter> abstractWriter;
+	if (writer == "event")
+		abstractWriter = std::make_unique<EventWriter>();
+	else if (writer == "history") {
+		std::unique_ptr<HistoryWriter> historyWriter = std::make_unique<HistoryWriter>();
+		historyWriter->setInterval(tickInterval);
+		historyWriter->setSamples(1);
+		abstractWriter = std::move(historyWriter);
+	} else {
+		std::unique_ptr<RecencyWriter> recencyWriter = std::make_unique<RecencyWriter>();
+		recencyWriter->setInterval(tickInterval);
+		abstractWriter = std::move(recencyWriter);
+	}
+	abstractWriter->setSchema(environment.schema.get());
+
+	std::vector<std::unique_ptr<TagValue>> tagValues;
+	for (int i = 0; i < tags; i++) {
+		tagValues.push_back(std::make_unique<TagValue>());
+		tagValues.back()->setName(QString("tag_%1").arg(i));
+		tagValues.back()->setValue(0.0);
+		abstractWriter->appendValue(tagValues.back().get());
+	}
+
+	// Each notification confirms that a batch of rows has been committed.
+	QElapsedTimer clock;
+	clock.start();
+	int ticks = 0;
+	std::deque<qint64> pendingTicks;
+	std::vector<qint64> latencies;
+	int notifications = 0;
+	qint64 lastNotification = 0;
+	shareddatabase::NotificationListener listener;
+	listener.setConnectionName(environment.database->connectionName());
+	listener.setChannel(environment.schema->name());
+	connect(& listener, & shareddatabase::NotificationListener::notified, this, [&](const QString & payload) {
+		// Initial writes, which happen before values start to change, are not accounted.
+		if (payload != writer || ticks == 0)
+			return;
+
+		notifications++;
+		lastNotification = clock.elapsed();
+		if (pendingTicks.empty())
+			return;
+
+		// Event writer commits a row per change, while other writers commit all pending changes at once.
+		latencies.push_back(lastNotification - pendingTicks.front());
+		if (writer == "event")
+			pendingTicks.pop_front();
+		else
+			pendingTicks.clear();
+	});
+
+	services::Service writerService;
+	QVERIFY(StartService(writerService, abstractWriter.get()));
+
+	QTimer tickTimer;
+	tickTimer.setTimerType(Qt::PreciseTimer);
+	connect(& tickTimer, & QTimer::timeout, this, [&]() {
+		ticks++;
+		qint64 now = clock.elapsed();
+		for (int i = 0; i < tags; i++) {
+			tagValues.at(i)->setValue(std::sin(ticks * 0.1 + i) * 100.0);
+			if (writer == "event")
+				pendingTicks.push_back(now);
+		}
+		if (writer != "event" && pendingTicks.empty())
+			pendingTicks.push_back(now);
+	});
+
+	qint64 tickStart = clock.elapsed();
+	tickTimer.start(tickInterval);
+	QTest::qWait(duration);
+	tickTimer.stop();
+
+	qint64 drainStart = clock.elapsed();
+	QVERIFY(StopService(writerService));
+	qint64 drain = clock.elapsed() - drainStart;
+	// Let the notifications dispatched from the database thread arrive.
+	QTest::qWait(200);
+
+	qint64 offered = writer == "event" ? static_cast<qint64>(ticks) * tags : ticks;
+	qint64 stored = writer == "event" ? notifications : static_cast<qint64>(notifications) * tags;
+	QJsonObject result;
+	result["benchmark"] = "ingest";
+	result["backend"] = backend;
+	result["writer"] = writer;
+	result["tags"] = tags;
+	result["rate_hz"] = rate;
+	result["duration_ms"] = duration;
+	result["ticks"] = ticks;
+	result["offered"] = offered;
+	result["commits"] = notifications;
+	result["rows"] = stored;
+	result["rows_per_s"] = lastNotification > tickStart ? stored * 1000.0 / (lastNotification - tickStart) : 0.0;
+	result["latency_p50_ms"] = Percentile(latencies, 0.5);
+	result["latency_p95_ms"] = Percentile(latencies, 0.95);
+	result["latency_max_ms"] = Percentile(latencies, 1.0);
+	result["drain_ms"] = drain;
+	test::report(result, "CUTEHMI_DATAACQUISITION_BENCH_OUTPUT");
+
+	writerService.setServiceable(QVariant());
+	abstractWriter.reset();
+	tearDownEnvironment(environment);
+}
+
+void bench_dataacquisition::select_data()
+{
+	QTest::addColumn<QString>("backend");
+	QTest::addColumn<QString>("model");
+	QTest::addColumn<int>("rows");
+
+	for (auto && backend : backends(false))
+		for (auto && model : {"event", "history"})
+			for (int rows : test::intListEnv("CUTEHMI_DATAACQUISITION_BENCH_ROWS", {1000, 10000}))
+				QTest::newRow(QString("%1/%2/%3 rows").arg(backend, model).arg(rows).toLocal8Bit().constData()) << backend << QString(model) << rows;
+}
+
+void bench_dataacquisition::select()
+{
+	QFETCH(QString, backend);
+	QFETCH(QString, model);
+	QFETCH(int, rows);
+
+	int repeat = test::intEnv("CUTEHMI_DATAACQUISITION_BENCH_REPEAT", 5);
+
+	Environment environment;
+	QVERIFY(setUpEnvironment(environment, backend));
+	QVERIFY(populate(environment, backend, model, rows));
+
+	QStringList tags;
+	for (int i = 0; i < SELECT_TAGS; i++)
+		tags.append(QString("tag_%1").arg(i));
+
+	std::unique_ptr<AbstractListModel> listModel;
+	if (model == "event") {
+		std::unique_ptr<EventModel> eventModel = std::make_unique<EventModel>();
+		eventModel->setTags(tags);
+		listModel = std::move(eventModel);
+	} else {
+		std::unique_ptr<HistoryModel> historyModel = std::make_unique<HistoryModel>();
+		historyModel->setTags(tags);
+		listModel = std::move(historyModel);
+	}
+	// Models are updated back to back.
+	listModel->setInterval(0);
+	listModel->setSchema(environment.schema.get());
+
+	std::vector<qint64> latencies;
+	int firstRowCount = -1;
+	qint64 memoryBefore = test::residentMemory();
+	qint64 memoryAfter = -1;
+	connect(listModel.get(), & AbstractListModel::busyChanged, this, [&]() {
+		if (listModel->busy())
+			return;
+
+		latencies.push_back(listModel->latency());
+		if (firstRowCount < 0) {
+			firstRowCount = listModel->rowCount();
+			memoryAfter = test::residentMemory();
+		}
+	});
+
+	QElapsedTimer clock;
+	clock.start();
+	services::Service modelService;
+	QVERIFY(StartService(modelService, listModel.get()));
+	QTRY_VERIFY_WITH_TIMEOUT(static_cast<int>(latencies.size()) >= repeat, TIMEOUT);
+	qint64 elapsed = clock.elapsed();
+	QVERIFY(StopService(modelService));
+
+	QJsonObject result;
+	result["benchmark"] = "select";
+	result["backend"] = backend;
+	result["model"] = model;
+	result["table_rows"] = rows;
+	result["model_rows"] = firstRowCount;
+	result["queries"] = static_cast<int>(latencies.size());
+	result["latency_p50_ms"] = Percentile(latencies, 0.5);
+	result["latency_p95_ms"] = Percentile(latencies, 0.95);
+	result["latency_max_ms"] = Percentile(latencies, 1.0);
+	result["elapsed_ms"] = elapsed;
+	result["memory_delta_kib"] = memoryBefore >= 0 && memoryAfter >= 0 ? (memoryAfter - memoryBefore) / 1024 : -1;
+	test::report(result, "CUTEHMI_DATAACQUISITION_BENCH_OUTPUT");
+
+	modelService.setServiceable(QVariant());
+	listModel.reset();
+	tearDownEnvironment(environment);
+}
+
+bool bench_dataacquisition::StartService(services::Service & service, QObject * serviceable)
+{
+	service.setServiceable(QVariant::fromValue(serviceable));
+	if (!QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT))
+		return false;
+
+	service.start();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->started()->active();
+	}, TIMEOUT);
+}
+
+bool bench_dataacquisition::StopService(services::Service & service)
+{
+	service.stop();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT);
+}
+
+qint64 bench_dataacquisition::Percentile(std::vector<qint64> samples, qreal percentile)
+{
+	if (samples.empty())
+		return -1;
+
+	std::sort(samples.begin(), samples.end());
+	std::size_t index = static_cast<std::size_t>(std::ceil(percentile * samples.size()));
+	return samples.at(std::min(std::max(index, std::size_t(1)), samples.size()) - 1);
+}
+
+QStringList bench_dataacquisition::backends(bool includeMemory) const
+{
+	QStringList result;
+	if (includeMemory)
+		result.append("sqlite-memory");
+	result.append("sqlite-file");
+	if (!qEnvironmentVariableIsEmpty("CUTEHMI_DATAACQUISITION_BENCH_PG_HOST"))
+		result.append("postgres");
+	return result;
+}
+
+bool bench_dataacquisition::setUpEnvironment(Environment & environment, const QString & backend)
+{
+	m_counter++;
+	QString connectionName = QString("bench_dataacquisition_%1").arg(m_counter);
+
+	environment.database = std::make_unique<shareddatabase::Database>();
+	environment.database->setConnectionName(connectionName);
+	if (backend == "postgres") {
+		environment.database->setType("QPSQL");
+		environment.database->setHost(qEnvironmentVariable("CUTEHMI_DATAACQUISITION_BENCH_PG_HOST"));
+		environment.database->setPort(test::intEnv("CUTEHMI_DATAACQUISITION_BENCH_PG_PORT", shareddatabase::Database::INITIAL_PORT));
+		environment.database->setName(qEnvironmentVariable("CUTEHMI_DATAACQUISITION_BENCH_PG_NAME", "postgres"));
+		environment.database->setUser(qEnvironmentVariable("CUTEHMI_DATAACQUISITION_BENCH_PG_USER", "postgres"));
+		environment.database->setPassword(qEnvironmentVariable("CUTEHMI_DATAACQUISITION_BENCH_PG_PASSWORD"));
+	} else {
+		environment.database->setType("QSQLITE");
+		environment.database->setName(backend == "sqlite-memory" ? QString(":memory:") : m_dir.filePath(connectionName + ".sqlite"));
+	}
+
+	environment.databaseService = std::make_unique<services::Service>();
+	if (!StartService(*environment.databaseService, environment.database.get()))
+		return false;
+
+	// PostgreSQL schemas outlive connections, so each case uses its own schema.
+	environment.schema = std::make_unique<Schema>();
+	environment.schema->setConnectionName(connectionName);
+	environment.schema->setName(backend == "postgres" ? QString("bench_%1_%2").arg(QCoreApplication::applicationPid()).arg(m_counter) : QString("bench"));
+	QSignalSpy createdSpy(environment.schema.get(), & Schema::created);
+	environment.schema->create();
+	if (!createdSpy.wait(TIMEOUT))
+		return false;
+
+	return createdSpy.at(0).at(0).toBool();
+}
+
+void bench_dataacquisition::tearDownEnvironment(Environment & environment)
+{
+	if (environment.database->type() == "QPSQL") {
+		QSignalSpy droppedSpy(environment.schema.get(), & Schema::dropped);
+		environment.schema->drop();
+		droppedSpy.wait(TIMEOUT);
+	}
+	environment.schema.reset();
+
+	StopService(*environment.databaseService);
+	environment.databaseService->setServiceable(QVariant());
+	environment.databaseService.reset();
+	environment.database.reset();
+}
+
+bool bench_dataacquisition::populate(const Environment & environment, const QString & backend, const QString & model, int rows)
+{
+	bool result = true;
+	QString populateConnectionName = environment.database->connectionName() + "_populate";
+	{
+		QSqlDatabase db = QSqlDatabase::addDatabase(environment.database->type(), populateConnectionName);
+		db.setHostName(environment.database->host());
+		db.setPort(environment.database->port());
+		db.setDatabaseName(environment.database->name());
+		db.setUserName(environment.database->user());
+		db.setPassword(environment.database->password());
+		if (!db.open()) {
+			qWarning() << db.lastError().text();
+			return false;
+		}
+
+		QString tagTable;
+		QString dataTable;
+		if (backend == "postgres") {
+			tagTable = QString("%1.tag").arg(environment.schema->name());
+			dataTable = QString("%1.%2_real").arg(environment.schema->name(), model);
+		} else {
+			tagTable = QString("[%1.tag]").arg(environment.schema->name());
+			dataTable = QString("[%1.%2_real]").arg(environment.schema->name(), model);
+		}
+
+		db.transaction();
+		QSqlQuery query(db);
+		QVariantList tagNames;
+		for (int i = 0; i < SELECT_TAGS; i++)
+			tagNames.append(QString("tag_%1").arg(i));
+		query.prepare(QString("INSERT INTO %1 (name) VALUES (?)").arg(tagTable));
+		query.addBindValue(tagNames);
+		result &= query.execBatch();
+
+		QVariantList tagIds;
+		result &= query.exec(QString("SELECT id FROM %1 ORDER BY id").arg(tagTable));
+		while (query.next())
+			tagIds.append(query.value(0));
+
+		// Rows are spread evenly over the tags, one second apart.
+		QDateTime start = QDateTime::currentDateTimeUtc().addSecs(-rows);
+		QVariantList tagIdColumn;
+		QVariantList valueColumn;
+		QVariantList timeColumn;
+		QVariantList closeTimeColumn;
+		QVariantList countColumn;
+		for (int i = 0; i < rows && !tagIds.isEmpty(); i++) {
+			tagIdColumn.append(tagIds.at(i % tagIds.count()));
+			valueColumn.append(std::sin(i * 0.01) * 100.0);
+			timeColumn.append(start.addSecs(i));
+			closeTimeColumn.append(start.addSecs(i + 1));
+			countColumn.append(10);
+		}
+
+		if (model == "event") {
+			query.prepare(QString("INSERT INTO %1 (tag_id, value, time) VALUES (?, ?, ?)").arg(dataTable));
+			query.addBindValue(tagIdColumn);
+			query.addBindValue(valueColumn);
+			query.addBindValue(timeColumn);
+		} else {
+			query.prepare(QString("INSERT INTO %1 (tag_id, open, close, min, max, open_time, close_time, count) VALUES (?, ?, ?, ?, ?, ?, ?, ?)").arg(dataTable));
+			query.addBindValue(tagIdColumn);
+			query.addBindValue(valueColumn);
+			query.addBindValue(valueColumn);
+			query.addBindValue(valueColumn);
+			query.addBindValue(valueColumn);
+			query.addBindValue(timeColumn);
+			query.addBindValue(closeTimeColumn);
+			query.addBindValue(countColumn);
+		}
+		result &= query.execBatch();
+		if (!result)
+			qWarning() << query.lastError().text();
+		result &= db.commit();
+		db.close();
+	}
+	QSqlDatabase::removeDatabase(populateConnectionName);
+
+	return result;
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::bench_dataacquisition)
+#include "bench_dataacquisition.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,89 @@
+#include <cutehmi/dataacquisition/internal/BinaryCopy.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+class test_BinaryCopy:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void empty();
+
+		void rows();
+
+		void unavailable();
+};
+
+void test_BinaryCopy::empty()
+{
+	BinaryCopy copy;
+
+	QCOMPARE(copy.rowCount(), 0);
+	QCOMPARE(copy.data(), QByteArray::fromHex(
+			"5047434f50590aff0d0a00"	// Signature.
+			"00000000"	// Flags field.
+			"00000000"	// Header extension area length.
+			"ffff"));	// Trailer.
+}
+
+void test_BinaryCopy::rows()
+{
+	BinaryCopy copy;
+
+	copy.beginRow(4);
+	copy.append(42);
+	copy.append(true);
+	copy.append(1.5);
+	copy.append(QDateTime(QDate(2000, 1, 1), QTime(0, 0, 1, 500), Qt::UTC));
+
+	copy.beginRow(2);
+	copy.append(-1);
+	copy.append(QDateTime(QDate(1999, 12, 31), QTime(23, 59, 59), Qt::UTC));
+
+	QCOMPARE(copy.rowCount(), 2);
+	QCOMPARE(copy.data(), QByteArray::fromHex(
+			"5047434f50590aff0d0a00" "00000000" "00000000"	// Header.
+			"0004"	// Field count.
+			"00000004" "0000002a"	// int4 42.
+			"00000001" "01"	// bool true.
+			"00000008" "3ff8000000000000"	// float8 1.5.
+			"00000008" "000000000016e360"	// timestamp 2000-01-01 00:00:01.5 (1500000 microseconds since PostgreSQL epoch).
+			"0002"	// Field count.
+			"00000004" "ffffffff"	// int4 -1.
+			"00000008" "fffffffffff0bdc0"	// timestamp 1999-12-31 23:59:59 (-1000000 microseconds since PostgreSQL epoch).
+			"ffff"));	// Trailer.
+}
+
+void test_BinaryCopy::unavailable()
+{
+	QSqlDatabase db;
+	QVERIFY(!BinaryCopy::IsAvailable(db));
+
+	BinaryCopy copy;
+	copy.beginRow(1);
+	copy.append(1);
+	QVERIFY(copy.exec(db, "COPY test FROM STDIN (FORMAT binary)").isValid());
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_BinaryCopy)
+#include "test_BinaryCopy.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,252 @@
+#include <cutehmi/dataacquisition/internal/EventCompressor.hpp>
+
+#include <QtTest/QtTest>
+#include <QRandomGenerator>
+
+#include <cmath>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+class test_EventCompressor:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void firstValue();
+
+		void deadband();
+
+		void deadbandPercent();
+
+		void ramp();
+
+		void corridorSlope();
+
+		void deviationBound();
+
+		void deadbandDeviationBound();
+
+		void typeChange();
+
+		void nonNumeric();
+
+	private:
+		static QDateTime Time(qint64 msecs);
+
+		static EventCompressor::PointsContainer Process(EventCompressor & compressor, const EventCompressor::PointsContainer & points);
+
+		static QVariant Reconstruct(const EventCompressor::PointsContainer & stored, const QDateTime & time);
+};
+
+void test_EventCompressor::firstValue()
+{
+	EventCompressor compressor;
+	compressor.configure(10.0, 0.0, 10.0);
+
+	EventCompressor::PointsContainer stored = compressor.process(5, Time(0));
+	QCOMPARE(stored.count(), 1);
+	QCOMPARE(stored.at(0).value, QVariant(5));
+	QCOMPARE(compressor.lastStoredTime(), Time(0));
+}
+
+void test_EventCompressor::deadband()
+{
+	EventCompressor compressor;
+	compressor.configure(1.0, 0.0, 0.0);
+
+	QCOMPARE(compressor.process(0.0, Time(0)).count(), 1);
+	QVERIFY(compressor.process(0.5, Time(10)).isEmpty());
+	QVERIFY(compressor.process(-1.0, Time(20)).isEmpty());
+
+	EventCompressor::PointsContainer stored = compressor.process(1.5, Time(30));
+	QCOMPARE(stored.count(), 1);
+	QCOMPARE(stored.at(0).value, QVariant(1.5));
+	QCOMPARE(stored.at(0).time, Time(30));
+
+	// Values filtered out by the deadband are released, so that last received value is not lost.
+	QVERIFY(compressor.process(2.0, Time(40)).isEmpty());
+	stored = compressor.release();
+	QCOMPARE(stored.count(), 1);
+	QCOMPARE(stored.at(0).value, QVariant(2.0));
+	QCOMPARE(stored.at(0).time, Time(40));
+}
+
+void test_EventCompressor::deadbandPercent()
+{
+	EventCompressor compressor;
+	compressor.configure(0.5, 10.0, 0.0);
+
+	QCOMPARE(compressor.process(100.0, Time(0)).count(), 1);
+	QVERIFY(compressor.process(109.0, Time(10)).isEmpty());
+	QCOMPARE(compressor.process(111.0, Time(20)).count(), 1);
+
+	// Absolute deadband takes precedence for small magnitudes.
+	QCOMPARE(compressor.process(1.0, Time(30)).count(), 1);
+	QVERIFY(compressor.process(1.4, Time(40)).isEmpty());
+}
+
+void test_EventCompressor::ramp()
+{
+	EventCompressor compressor;
+	compressor.configure(0.0, 0.0, 1.0);
+
+	EventCompressor::PointsContainer input;
+	for (int i = 0; i <= 100; i++)
+		input.append({static_cast<double>(i), Time(i * 10)});
+
+	EventCompressor::PointsContainer stored = Process(compressor, input);
+	QCOMPARE(stored.count(), 1);
+
+	stored.append(compressor.release());
+	QCOMPARE(stored.count(), 2);
+	QCOMPARE(stored.at(1).value, QVariant(100.0));
+	QCOMPARE(stored.at(1).time, Time(1000));
+}
+
+void test_EventCompressor::corridorSlope()
+{
+	EventCompressor compressor;
+	compressor.configure(0.0, 0.0, 1.0);
+
+	// Corridor narrowed by the second point is [0.095, 0.1], but slope from stored point to the third one is 0.145, so held point
+	// has to be stored; otherwise value at t=10 would be reconstructed as 1.45.
+	EventCompressor::PointsContainer input = {
+		{0.0, Time(0)},
+		{0.0, Time(10)},
+		{2.9, Time(20)}
+	};
+	EventCompressor::PointsContainer stored = Process(compressor, input);
+	QCOMPARE(stored.count(), 2);
+	QCOMPARE(stored.at(1).value, QVariant(0.0));
+	QCOMPARE(stored.at(1).time, Time(10));
+
+	stored.append(compressor.release());
+	QCOMPARE(stored.count(), 3);
+	QCOMPARE(stored.at(2).value, QVariant(2.9));
+	QCOMPARE(Reconstruct(stored, Time(10)).toDouble(), 0.0);
+}
+
+void test_EventCompressor::deviationBound()
+{
+	constexpr qreal DEVIATION = 0.25;
+
+	EventCompressor compressor;
+	compressor.configure(0.0, 0.0, DEVIATION);
+
+	EventCompressor::PointsContainer input;
+	for (int i = 0; i < 1000; i++)
+		input.append({3.0 * std::sin(i / 20.0) + std::sin(i / 3.0) * std::cos(i / 7.0), Time(i * 100)});
+
+	EventCompressor::PointsContainer stored = Process(compressor, input);
+	stored.append(compressor.release());
+	QVERIFY(stored.count() < input.count());
+
+	for (auto point : input)
+		QVERIFY2(qAbs(Reconstruct(stored, point.time).toDouble() - point.value.toDouble()) <= DEVIATION + 1e-9,
+				qPrintable(QString("Value at %1 exceeds compression deviation.").arg(point.time.toMSecsSinceEpoch())));
+}
+
+void test_EventCompressor::deadbandDeviationBound()
+{
+	constexpr qreal DEADBAND = 0.1;
+	constexpr qreal DEVIATION = 0.25;
+
+	QRandomGenerator generator(1);
+	for (int run = 0; run < 100; run++) {
+		EventCompressor compressor;
+		compressor.configure(DEADBAND, 0.0, DEVIATION);
+
+		EventCompressor::PointsContainer input;
+		qreal value = 0.0;
+		for (int i = 0; i < 300; i++) {
+			value += generator.generateDouble() - 0.5;
+			input.append({value, Time(i * 100)});
+		}
+
+		EventCompressor::PointsContainer stored = Process(compressor, input);
+		stored.append(compressor.release());
+
+		for (auto point : input)
+			QVERIFY(qAbs(Reconstruct(stored, point.time).toDouble() - point.value.toDouble()) <= DEADBAND + DEVIATION + 1e-9);
+	}
+}
+
+void test_EventCompressor::typeChange()
+{
+	EventCompressor compressor;
+	compressor.configure(0.0, 0.0, 1.0);
+
+	QCOMPARE(compressor.process(0, Time(0)).count(), 1);
+	QVERIFY(compressor.process(5, Time(10)).isEmpty());
+
+	// Held point is stored before the value of a different type.
+	EventCompressor::PointsContainer stored = compressor.process(5.5, Time(20));
+	QCOMPARE(stored.count(), 2);
+	QCOMPARE(stored.at(0).value, QVariant(5));
+	QCOMPARE(stored.at(1).value, QVariant(5.5));
+
+	stored = compressor.process(6, Time(30));
+	QCOMPARE(stored.count(), 1);
+	QCOMPARE(stored.at(0).value, QVariant(6));
+}
+
+void test_EventCompressor::nonNumeric()
+{
+	EventCompressor compressor;
+	compressor.configure(0.0, 0.0, 10.0);
+
+	QCOMPARE(compressor.process(true, Time(0)).count(), 1);
+	QCOMPARE(compressor.process(true, Time(10)).count(), 1);
+	QCOMPARE(compressor.process(false, Time(20)).count(), 1);
+
+	QCOMPARE(compressor.process(1, Time(30)).count(), 1);
+	QVERIFY(compressor.process(2, Time(40)).isEmpty());
+	EventCompressor::PointsContainer stored = compressor.process(QString("text"), Time(50));
+	QCOMPARE(stored.count(), 2);
+	QCOMPARE(stored.at(0).value, QVariant(2));
+	QCOMPARE(stored.at(1).value, QVariant(QString("text")));
+
+	QCOMPARE(EventCompressor::Interpolate(stored.at(1), {QString("other"), Time(60)}, Time(55)), QVariant(QString("text")));
+}
+
+QDateTime test_EventCompressor::Time(qint64 msecs)
+{
+	return QDateTime::fromMSecsSinceEpoch(msecs, Qt::UTC);
+}
+
+EventCompressor::PointsContainer test_EventCompressor::Process(EventCompressor & compressor, const EventCompressor::PointsContainer & points)
+{
+	EventCompressor::PointsContainer result;
+	for (auto point : points)
+		result.append(compressor.process(point.value, point.time));
+	return result;
+}
+
+QVariant test_EventCompressor::Reconstruct(const EventCompressor::PointsContainer & stored, const QDateTime & time)
+{
+	for (int i = stored.count() - 1; i >= 0; i--)
+		if (stored.at(i).time <= time)
+			return EventCompressor::Interpolate(stored.at(i), i + 1 < stored.count() ? stored.at(i + 1) : EventCompressor::Point(), time);
+	return QVariant();
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_EventCompressor)
+#include "test_EventCompressor.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
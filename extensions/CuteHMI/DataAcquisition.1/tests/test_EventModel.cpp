@@ -0,0 +1,233 @@
+#include <cutehmi/dataacquisition/EventModel.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+
+#include <cutehmi/shareddatabase/Database.hpp>
+
+#include <cutehmi/services/Service.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace cutehmi {
+namespace dataacquisition {
+
+class test_EventModel:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void init();
+
+		void cleanup();
+
+		void push();
+
+		void criteriaChange();
+
+	private:
+		static constexpr int TIMEOUT = 5000;
+
+		static bool StartService(services::Service & service, QObject * serviceable);
+
+		static bool StopService(services::Service & service);
+
+		bool insert(const QString & tag, const QDateTime & start, int rows);
+
+		QTemporaryDir m_dir;
+		int m_counter = 0;
+		std::unique_ptr<shareddatabase::Database> m_database;
+		std::unique_ptr<services::Service> m_databaseService;
+		std::unique_ptr<Schema> m_schema;
+};
+
+constexpr int test_EventModel::TIMEOUT;
+
+void test_EventModel::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+void test_EventModel::init()
+{
+	m_counter++;
+	QString connectionName = QString("test_EventModel_%1").arg(m_counter);
+
+	m_database = std::make_unique<shareddatabase::Database>();
+	m_database->setConnectionName(connectionName);
+	m_database->setType("QSQLITE");
+	m_database->setName(m_dir.filePath(connectionName + ".sqlite"));
+
+	m_databaseService = std::make_unique<services::Service>();
+	QVERIFY(StartService(*m_databaseService, m_database.get()));
+
+	m_schema = std::make_unique<Schema>();
+	m_schema->setConnectionName(connectionName);
+	m_schema->setName("test");
+	QSignalSpy createdSpy(m_schema.get(), & Schema::created);
+	m_schema->create();
+	QVERIFY(createdSpy.wait(TIMEOUT));
+	QVERIFY(createdSpy.at(0).at(0).toBool());
+}
+
+void test_EventModel::cleanup()
+{
+	m_schema.reset();
+
+	StopService(*m_databaseService);
+	m_databaseService->setServiceable(QVariant());
+	m_databaseService.reset();
+	m_database.reset();
+}
+
+void test_EventModel::push()
+{
+	QDateTime start = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch() - 60, Qt::UTC);
+	QVERIFY(insert("a", start, 3));
+
+	EventModel model;
+	model.setPush(true);
+	model.setInterval(0);
+	model.setTags({"a"});
+	model.setSchema(m_schema.get());
+
+	services::Service modelService;
+	QVERIFY(StartService(modelService, & model));
+	QTRY_COMPARE_WITH_TIMEOUT(model.rowCount(), 3, TIMEOUT);
+
+	// New rows are picked up, once writer reports them with a notification.
+	QVERIFY(insert("a", start.addSecs(10), 2));
+	shareddatabase::Database::Notify(m_database->connectionName(), m_schema->name(), "event");
+	QTRY_COMPARE_WITH_TIMEOUT(model.rowCount(), 5, TIMEOUT);
+	QCOMPARE(model.data(model.index(0), EventModel::TIME_ROLE).toDateTime(), start.addSecs(11));
+	QCOMPARE(model.end(), start.addSecs(11));
+
+	// Notifications from other tables are ignored.
+	QVERIFY(insert("a", start.addSecs(20), 1));
+	shareddatabase::Database::Notify(m_database->connectionName(), m_schema->name(), "history");
+	QTest::qWait(100);
+	QCOMPARE(model.rowCount(), 5);
+
+	QVERIFY(StopService(modelService));
+	modelService.setServiceable(QVariant());
+}
+
+void test_EventModel::criteriaChange()
+{
+	// Rows tagged 'b' are older than rows tagged 'a', so incremental selection can not fetch any of them.
+	QDateTime start = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch() - 60, Qt::UTC);
+	QVERIFY(insert("b", start, 2));
+	QVERIFY(insert("a", start.addSecs(10), 3));
+
+	EventModel model;
+	model.setPush(true);
+	model.setTags({"a"});
+	model.setSchema(m_schema.get());
+
+	model.requestUpdate();
+	QTRY_VERIFY_WITH_TIMEOUT(!model.busy() && model.rowCount() == 3, TIMEOUT);
+
+	// Update requested while full selection is pending must not supersede it with incremental selection.
+	model.setTags({"b"});
+	model.requestUpdate();
+	model.requestUpdate();
+	QTRY_VERIFY_WITH_TIMEOUT(!model.busy(), TIMEOUT);
+	QCOMPARE(model.rowCount(), 2);
+	for (int i = 0; i < model.rowCount(); i++)
+		QCOMPARE(model.data(model.index(i), EventModel::TAG_ROLE).toString(), QString("b"));
+	QCOMPARE(model.begin(), start);
+	QCOMPARE(model.end(), start.addSecs(1));
+}
+
+bool test_EventModel::StartService(services::Service & service, QObject * serviceable)
+{
+	service.setServiceable(QVariant::fromValue(serviceable));
+	if (!QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT))
+		return false;
+
+	service.start();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->started()->active();
+	}, TIMEOUT);
+}
+
+bool test_EventModel::StopService(services::Service & service)
+{
+	service.stop();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT);
+}
+
+bool test_EventModel::insert(const QString & tag, const QDateTime & start, int rows)
+{
+	bool result = true;
+	QString insertConnectionName = m_database->connectionName() + "_insert";
+	{
+		QSqlDatabase db = QSqlDatabase::addDatabase(m_database->type(), insertConnectionName);
+		db.setDatabaseName(m_database->name());
+		if (!db.open()) {
+			qWarning() << db.lastError().text();
+			return false;
+		}
+
+		QString tagTable = QString("[%1.tag]").arg(m_schema->name());
+		QString dataTable = QString("[%1.event_real]").arg(m_schema->name());
+
+		QSqlQuery query(db);
+		query.prepare(QString("SELECT id FROM %1 WHERE name = ?").arg(tagTable));
+		query.addBindValue(tag);
+		result &= query.exec();
+		if (!query.next()) {
+			query.prepare(QString("INSERT INTO %1 (name) VALUES (?)").arg(tagTable));
+			query.addBindValue(tag);
+			result &= query.exec();
+			query.prepare(QString("SELECT id FROM %1 WHERE name = ?").arg(tagTable));
+			query.addBindValue(tag);
+			result &= query.exec() && query.next();
+		}
+		QVariant tagId = query.value(0);
+
+		// Rows are one second apart.
+		for (int i = 0; i < rows; i++) {
+			query.prepare(QString("INSERT INTO %1 (tag_id, value, time) VALUES (?, ?, ?)").arg(dataTable));
+			query.addBindValue(tagId);
+			query.addBindValue(static_cast<double>(i));
+			query.addBindValue(start.addSecs(i));
+			result &= query.exec();
+		}
+		if (!result)
+			qWarning() << query.lastError().text();
+		db.close();
+	}
+	QSqlDatabase::removeDatabase(insertConnectionName);
+
+	return result;
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::test_EventModel)
+#include "test_EventModel.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,256 @@
+#include <cutehmi/dataacquisition/internal/HistoryCollective.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+
+#include <cutehmi/shareddatabase/Database.hpp>
+
+#include <cutehmi/services/Service.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+class test_HistoryCollective:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void init();
+
+		void cleanup();
+
+		void batch();
+
+		void rollback();
+
+	private:
+		static constexpr int TIMEOUT = 5000;
+
+		static HistoryCollective::Tuple MakeTuple(const QVariant & value, const QDateTime & openTime);
+
+		static bool StartService(services::Service & service, QObject * serviceable);
+
+		static bool StopService(services::Service & service);
+
+		bool insert(HistoryCollective & collective, const HistoryCollective::TuplesContainer & tuples);
+
+		bool exec(const QString & statement, QVariant * result = nullptr);
+
+		int rowCount(const QString & table);
+
+		QTemporaryDir m_dir;
+		int m_counter = 0;
+		std::unique_ptr<shareddatabase::Database> m_database;
+		std::unique_ptr<services::Service> m_databaseService;
+		std::unique_ptr<Schema> m_schema;
+};
+
+constexpr int test_HistoryCollective::TIMEOUT;
+
+void test_HistoryCollective::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+void test_HistoryCollective::init()
+{
+	m_counter++;
+	QString connectionName = QString("test_HistoryCollective_%1").arg(m_counter);
+
+	m_database = std::make_unique<shareddatabase::Database>();
+	m_database->setConnectionName(connectionName);
+	m_database->setType("QSQLITE");
+	m_database->setName(m_dir.filePath(connectionName + ".sqlite"));
+
+	m_databaseService = std::make_unique<services::Service>();
+	QVERIFY(StartService(*m_databaseService, m_database.get()));
+
+	m_schema = std::make_unique<Schema>();
+	m_schema->setConnectionName(connectionName);
+	m_schema->setName("test");
+	QSignalSpy createdSpy(m_schema.get(), & Schema::created);
+	m_schema->create();
+	QVERIFY(createdSpy.wait(TIMEOUT));
+	QVERIFY(createdSpy.at(0).at(0).toBool());
+}
+
+void test_HistoryCollective::cleanup()
+{
+	m_schema.reset();
+
+	StopService(*m_databaseService);
+	m_databaseService->setServiceable(QVariant());
+	m_databaseService.reset();
+	m_database.reset();
+}
+
+void test_HistoryCollective::batch()
+{
+	QDateTime openTime = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch() - 60, Qt::UTC);
+	HistoryCollective collective;
+	collective.setSchema(m_schema.get());
+	QSignalSpy erroredSpy(& collective, & HistoryCollective::errored);
+
+	// Tuples of all the types are written within a single batch.
+	HistoryCollective::TuplesContainer tuples;
+	tuples.insert("int1", MakeTuple(1, openTime));
+	tuples.insert("int2", MakeTuple(2, openTime));
+	tuples.insert("bool1", MakeTuple(true, openTime));
+	tuples.insert("real1", MakeTuple(1.5, openTime));
+	tuples.insert("real2", MakeTuple(2.5, openTime));
+	tuples.insert("real3", MakeTuple(3.5, openTime));
+	QVERIFY(insert(collective, tuples));
+	QCOMPARE(erroredSpy.count(), 0);
+	QCOMPARE(rowCount("history_int"), 2);
+	QCOMPARE(rowCount("history_bool"), 1);
+	QCOMPARE(rowCount("history_real"), 3);
+
+	QVariant close;
+	QVERIFY(exec("SELECT close FROM [test.history_real] INNER JOIN [test.tag] ON [test.tag].id = tag_id WHERE name = 'real2'", & close));
+	QCOMPARE(close.toDouble(), 2.5);
+
+	// Next batch appends rows.
+	tuples.clear();
+	tuples.insert("int1", MakeTuple(3, openTime.addSecs(1)));
+	tuples.insert("real1", MakeTuple(4.5, openTime.addSecs(1)));
+	QVERIFY(insert(collective, tuples));
+	QCOMPARE(erroredSpy.count(), 0);
+	QCOMPARE(rowCount("history_int"), 3);
+	QCOMPARE(rowCount("history_bool"), 1);
+	QCOMPARE(rowCount("history_real"), 4);
+}
+
+void test_HistoryCollective::rollback()
+{
+	QDateTime openTime = QDateTime::fromSecsSinceEpoch(QDateTime::currentSecsSinceEpoch() - 60, Qt::UTC);
+	HistoryCollective collective;
+	collective.setSchema(m_schema.get());
+	QSignalSpy erroredSpy(& collective, & HistoryCollective::errored);
+
+	// Missing table makes the last insert of a batch fail.
+	QVERIFY(exec("DROP TABLE [test.history_real]"));
+
+	HistoryCollective::TuplesContainer tuples;
+	tuples.insert("int1", MakeTuple(1, openTime));
+	tuples.insert("bool1", MakeTuple(false, openTime));
+	tuples.insert("real1", MakeTuple(1.5, openTime));
+	QVERIFY(insert(collective, tuples));
+	QCOMPARE(erroredSpy.count(), 1);
+
+	// Rows inserted before the failure are rolled back together with the batch.
+	QCOMPARE(rowCount("history_int"), 0);
+	QCOMPARE(rowCount("history_bool"), 0);
+
+	// Tags are created outside of the transaction, so they survive rollback.
+	QVariant tagCount;
+	QVERIFY(exec("SELECT COUNT(*) FROM [test.tag]", & tagCount));
+	QCOMPARE(tagCount.toInt(), 3);
+}
+
+HistoryCollective::Tuple test_HistoryCollective::MakeTuple(const QVariant & value, const QDateTime & openTime)
+{
+	HistoryCollective::Tuple result;
+	result.open = value;
+	result.close = value;
+	result.min = value;
+	result.max = value;
+	result.openTime = openTime;
+	result.closeTime = openTime.addMSecs(500);
+	result.count = 1;
+	return result;
+}
+
+bool test_HistoryCollective::StartService(services::Service & service, QObject * serviceable)
+{
+	service.setServiceable(QVariant::fromValue(serviceable));
+	if (!QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT))
+		return false;
+
+	service.start();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->started()->active();
+	}, TIMEOUT);
+}
+
+bool test_HistoryCollective::StopService(services::Service & service)
+{
+	service.stop();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT);
+}
+
+bool test_HistoryCollective::insert(HistoryCollective & collective, const HistoryCollective::TuplesContainer & tuples)
+{
+	// Collective becomes busy, once the worker starts and it stops being busy, when the worker is ready.
+	QSignalSpy busySpy(& collective, & HistoryCollective::busyChanged);
+	collective.insert(tuples);
+	return QTest::qWaitFor([& busySpy, & collective]() {
+		return busySpy.count() >= 2 && !collective.busy();
+	}, TIMEOUT);
+}
+
+bool test_HistoryCollective::exec(const QString & statement, QVariant * result)
+{
+	bool success;
+	QString execConnectionName = m_database->connectionName() + "_exec";
+	{
+		QSqlDatabase db = QSqlDatabase::addDatabase(m_database->type(), execConnectionName);
+		db.setDatabaseName(m_database->name());
+		if (!db.open()) {
+			qWarning() << db.lastError().text();
+			return false;
+		}
+
+		QSqlQuery query(db);
+		success = query.exec(statement);
+		if (!success)
+			qWarning() << query.lastError().text();
+		else if (result && query.next())
+			*result = query.value(0);
+		query.finish();
+		db.close();
+	}
+	QSqlDatabase::removeDatabase(execConnectionName);
+
+	return success;
+}
+
+int test_HistoryCollective::rowCount(const QString & table)
+{
+	QVariant result;
+	if (!exec(QString("SELECT COUNT(*) FROM [%1.%2]").arg(m_schema->name(), table), & result))
+		return -1;
+	return result.toInt();
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_HistoryCollective)
+#include "test_HistoryCollective.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,146 @@
+#include <cutehmi/dataacquisition/internal/RecencyCache.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+class test_RecencyCache:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void publishLookup();
+
+		void replace();
+
+		void withdrawTags();
+
+		void sharedKey();
+
+		void separateKeys();
+
+	private:
+		static RecencyCollective::TuplesContainer Tuples(const QStringList & tags, const QVariant & value);
+};
+
+void test_RecencyCache::publishLookup()
+{
+	RecencyCache & cache = RecencyCache::Instance();
+	int owner;
+
+	QVERIFY(cache.lookup("publishLookup", {}).isEmpty());
+
+	cache.publish("publishLookup", Tuples({"a", "b", "c"}, 1), & owner);
+	QCOMPARE(cache.lookup("publishLookup", {}).count(), 3);
+
+	RecencyCollective::TuplesContainer result = cache.lookup("publishLookup", {"a", "c", "d"});
+	QCOMPARE(result.count(), 2);
+	QVERIFY(result.contains("a"));
+	QVERIFY(result.contains("c"));
+	QCOMPARE(result.value("a").value, QVariant(1));
+
+	cache.withdraw("publishLookup", & owner);
+	QVERIFY(cache.lookup("publishLookup", {}).isEmpty());
+}
+
+void test_RecencyCache::replace()
+{
+	RecencyCache & cache = RecencyCache::Instance();
+	int owner;
+
+	cache.publish("replace", Tuples({"a"}, 1), & owner);
+	cache.publish("replace", Tuples({"a"}, 2), & owner);
+	QCOMPARE(cache.lookup("replace", {"a"}).value("a").value, QVariant(2));
+
+	// Single withdrawal suffices, regardless of how many times owner has published the entry.
+	cache.withdraw("replace", {"a"}, & owner);
+	QVERIFY(cache.lookup("replace", {}).isEmpty());
+}
+
+void test_RecencyCache::withdrawTags()
+{
+	RecencyCache & cache = RecencyCache::Instance();
+	int owner;
+	int stranger;
+
+	cache.publish("withdrawTags", Tuples({"a", "b"}, 1), & owner);
+
+	cache.withdraw("withdrawTags", {"a"}, & stranger);
+	QCOMPARE(cache.lookup("withdrawTags", {}).count(), 2);
+
+	cache.withdraw("withdrawTags", {"a", "x"}, & owner);
+	RecencyCollective::TuplesContainer result = cache.lookup("withdrawTags", {});
+	QCOMPARE(result.count(), 1);
+	QVERIFY(result.contains("b"));
+
+	cache.withdraw("withdrawTags", & owner);
+	QVERIFY(cache.lookup("withdrawTags", {}).isEmpty());
+}
+
+void test_RecencyCache::sharedKey()
+{
+	RecencyCache & cache = RecencyCache::Instance();
+	int first;
+	int second;
+
+	cache.publish("sharedKey", Tuples({"a", "b"}, 1), & first);
+	cache.publish("sharedKey", Tuples({"b", "c"}, 2), & second);
+	QCOMPARE(cache.lookup("sharedKey", {}).count(), 3);
+	QCOMPARE(cache.lookup("sharedKey", {"b"}).value("b").value, QVariant(2));
+
+	// Entries shared with the second owner must survive withdrawal of the first one.
+	cache.withdraw("sharedKey", & first);
+	RecencyCollective::TuplesContainer result = cache.lookup("sharedKey", {});
+	QCOMPARE(result.count(), 2);
+	QVERIFY(result.contains("b"));
+	QVERIFY(result.contains("c"));
+
+	cache.withdraw("sharedKey", & second);
+	QVERIFY(cache.lookup("sharedKey", {}).isEmpty());
+}
+
+void test_RecencyCache::separateKeys()
+{
+	RecencyCache & cache = RecencyCache::Instance();
+	int owner;
+
+	cache.publish("separateKeys/1", Tuples({"a"}, 1), & owner);
+	cache.publish("separateKeys/2", Tuples({"a"}, 2), & owner);
+
+	cache.withdraw("separateKeys/1", & owner);
+	QVERIFY(cache.lookup("separateKeys/1", {}).isEmpty());
+	QCOMPARE(cache.lookup("separateKeys/2", {"a"}).value("a").value, QVariant(2));
+
+	cache.withdraw("separateKeys/2", & owner);
+	QVERIFY(cache.lookup("separateKeys/2", {}).isEmpty());
+}
+
+RecencyCollective::TuplesContainer test_RecencyCache::Tuples(const QStringList & tags, const QVariant & value)
+{
+	RecencyCollective::TuplesContainer result;
+	QDateTime time = QDateTime::currentDateTimeUtc();
+	for (auto && tag : tags)
+		result.insert(tag, RecencyCollective::Tuple{value, time});
+	return result;
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_RecencyCache)
+#include "test_RecencyCache.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
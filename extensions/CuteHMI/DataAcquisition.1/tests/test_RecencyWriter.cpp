@@ -0,0 +1,272 @@
+#include <cutehmi/dataacquisition/RecencyWriter.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+#include <cutehmi/dataacquisition/TagValue.hpp>
+
+#include <cutehmi/shareddatabase/Database.hpp>
+#include <cutehmi/shareddatabase/NotificationListener.hpp>
+
+#include <cutehmi/services/Service.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QSqlError>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace cutehmi {
+namespace dataacquisition {
+
+class test_RecencyWriter:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void init();
+
+		void cleanup();
+
+		void dirtyValues();
+
+		void heartbeat();
+
+	private:
+		static constexpr int TIMEOUT = 5000;
+
+		static constexpr int INTERVAL = 20;
+
+		struct Record
+		{
+			QVariant value;
+			QDateTime time;
+		};
+
+		static bool StartService(services::Service & service, QObject * serviceable);
+
+		static bool StopService(services::Service & service);
+
+		Record record(const QString & tag);
+
+		QTemporaryDir m_dir;
+		int m_counter = 0;
+		std::unique_ptr<shareddatabase::Database> m_database;
+		std::unique_ptr<services::Service> m_databaseService;
+		std::unique_ptr<Schema> m_schema;
+};
+
+constexpr int test_RecencyWriter::TIMEOUT;
+constexpr int test_RecencyWriter::INTERVAL;
+
+void test_RecencyWriter::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+void test_RecencyWriter::init()
+{
+	m_counter++;
+	QString connectionName = QString("test_RecencyWriter_%1").arg(m_counter);
+
+	m_database = std::make_unique<shareddatabase::Database>();
+	m_database->setConnectionName(connectionName);
+	m_database->setType("QSQLITE");
+	m_database->setName(m_dir.filePath(connectionName + ".sqlite"));
+
+	m_databaseService = std::make_unique<services::Service>();
+	QVERIFY(StartService(*m_databaseService, m_database.get()));
+
+	m_schema = std::make_unique<Schema>();
+	m_schema->setConnectionName(connectionName);
+	m_schema->setName("test");
+	QSignalSpy createdSpy(m_schema.get(), & Schema::created);
+	m_schema->create();
+	QVERIFY(createdSpy.wait(TIMEOUT));
+	QVERIFY(createdSpy.at(0).at(0).toBool());
+}
+
+void test_RecencyWriter::cleanup()
+{
+	m_schema.reset();
+
+	StopService(*m_databaseService);
+	m_databaseService->setServiceable(QVariant());
+	m_databaseService.reset();
+	m_database.reset();
+}
+
+void test_RecencyWriter::dirtyValues()
+{
+	TagValue a;
+	a.setName("a");
+	a.setValue(1);
+	TagValue b;
+	b.setName("b");
+	b.setValue(2);
+
+	// Heartbeat rewrites values only once, when writer starts.
+	RecencyWriter writer;
+	writer.setInterval(INTERVAL);
+	writer.setHeartbeatInterval(0);
+	writer.appendValue(& a);
+	writer.appendValue(& b);
+	writer.setSchema(m_schema.get());
+
+	int updates = 0;
+	shareddatabase::NotificationListener listener;
+	listener.setConnectionName(m_database->connectionName());
+	listener.setChannel(m_schema->name());
+	connect(& listener, & shareddatabase::NotificationListener::notified, this, [& updates](const QString & payload) {
+		if (payload == "recency")
+			updates++;
+	});
+
+	services::Service writerService;
+	QVERIFY(StartService(writerService, & writer));
+	QTRY_COMPARE_WITH_TIMEOUT(updates, 1, TIMEOUT);
+	Record initialA = record("a");
+	Record initialB = record("b");
+	QCOMPARE(initialA.value.toInt(), 1);
+	QCOMPARE(initialB.value.toInt(), 2);
+
+	// Values, which have not changed, are not written.
+	QTest::qWait(10 * INTERVAL);
+	QCOMPARE(updates, 1);
+
+	// Changed value is written along with time of change, while clean value is left intact.
+	QDateTime before = QDateTime::currentDateTimeUtc();
+	a.setValue(10);
+	QDateTime after = QDateTime::currentDateTimeUtc();
+	QTRY_COMPARE_WITH_TIMEOUT(updates, 2, TIMEOUT);
+	Record changedA = record("a");
+	QCOMPARE(changedA.value.toInt(), 10);
+	QVERIFY(changedA.time >= before);
+	QVERIFY(changedA.time <= after);
+	Record cleanB = record("b");
+	QCOMPARE(cleanB.value.toInt(), 2);
+	QCOMPARE(cleanB.time, initialB.time);
+
+	// Multiple changes between updates result in a single write.
+	a.setValue(11);
+	a.setValue(12);
+	b.setValue(20);
+	QTRY_COMPARE_WITH_TIMEOUT(updates, 3, TIMEOUT);
+	QTest::qWait(10 * INTERVAL);
+	QCOMPARE(updates, 3);
+	QCOMPARE(record("a").value.toInt(), 12);
+	QCOMPARE(record("b").value.toInt(), 20);
+
+	// All the values are rewritten after restart.
+	QVERIFY(StopService(writerService));
+	QVERIFY(StartService(writerService, & writer));
+	QTRY_COMPARE_WITH_TIMEOUT(updates, 4, TIMEOUT);
+	QVERIFY(record("a").time > changedA.time);
+	QVERIFY(record("b").time > cleanB.time);
+
+	QVERIFY(StopService(writerService));
+	writerService.setServiceable(QVariant());
+}
+
+void test_RecencyWriter::heartbeat()
+{
+	constexpr int HEARTBEAT_INTERVAL = 10 * INTERVAL;
+
+	TagValue a;
+	a.setName("a");
+	a.setValue(1);
+
+	RecencyWriter writer;
+	writer.setInterval(INTERVAL);
+	writer.setHeartbeatInterval(HEARTBEAT_INTERVAL);
+	writer.appendValue(& a);
+	writer.setSchema(m_schema.get());
+
+	services::Service writerService;
+	QVERIFY(StartService(writerService, & writer));
+	QTRY_VERIFY_WITH_TIMEOUT(record("a").time.isValid(), TIMEOUT);
+	Record initial = record("a");
+
+	// Heartbeat stamps value, which has not changed, with current time.
+	QTRY_VERIFY_WITH_TIMEOUT(record("a").time > initial.time, TIMEOUT);
+	Record rewritten = record("a");
+	QCOMPARE(rewritten.value.toInt(), 1);
+	QVERIFY(rewritten.time >= initial.time.addMSecs(HEARTBEAT_INTERVAL));
+
+	// Next heartbeat follows.
+	QTRY_VERIFY_WITH_TIMEOUT(record("a").time > rewritten.time, TIMEOUT);
+	QVERIFY(record("a").time >= rewritten.time.addMSecs(HEARTBEAT_INTERVAL));
+
+	QVERIFY(StopService(writerService));
+	writerService.setServiceable(QVariant());
+}
+
+bool test_RecencyWriter::StartService(services::Service & service, QObject * serviceable)
+{
+	service.setServiceable(QVariant::fromValue(serviceable));
+	if (!QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT))
+		return false;
+
+	service.start();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->started()->active();
+	}, TIMEOUT);
+}
+
+bool test_RecencyWriter::StopService(services::Service & service)
+{
+	service.stop();
+	return QTest::qWaitFor([& service]() {
+		return service.states()->stopped()->active();
+	}, TIMEOUT);
+}
+
+test_RecencyWriter::Record test_RecencyWriter::record(const QString & tag)
+{
+	Record result;
+	QString recordConnectionName = m_database->connectionName() + "_record";
+	{
+		QSqlDatabase db = QSqlDatabase::addDatabase(m_database->type(), recordConnectionName);
+		db.setDatabaseName(m_database->name());
+		if (!db.open())
+			qWarning() << db.lastError().text();
+		else {
+			QSqlQuery query(db);
+			query.prepare(QString("SELECT value, time FROM [%1.recency_int] INNER JOIN [%1.tag] ON [%1.tag].id = tag_id WHERE name = ?").arg(m_schema->name()));
+			query.addBindValue(tag);
+			if (!query.exec())
+				qWarning() << query.lastError().text();
+			else if (query.next()) {
+				result.value = query.value(0);
+				result.time = query.value(1).toDateTime();
+			}
+			query.finish();
+			db.close();
+		}
+	}
+	QSqlDatabase::removeDatabase(recordConnectionName);
+
+	return result;
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::test_RecencyWriter)
+#include "test_RecencyWriter.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,184 @@
+#include <cutehmi/dataacquisition/internal/SamplingEngine.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+class test_SamplingEngine:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void candle();
+
+		void samplesPerCandle();
+
+		void typeChange();
+
+		void candlesReady();
+
+		void clearSlots();
+
+		void reset();
+};
+
+void test_SamplingEngine::candle()
+{
+	SamplingEngine engine;
+	engine.setSamples(3);
+	int a = engine.appendSlot("a");
+	int b = engine.appendSlot("b");
+
+	QList<int> aValues = {1, 5, 3};
+	QList<double> bValues = {0.5, -1.0, 2.0};
+	for (int i = 0; i < aValues.count(); i++) {
+		engine.setValue(a, aValues.at(i));
+		engine.setValue(b, bValues.at(i));
+		QVERIFY(engine.sample());
+	}
+
+	SamplingEngine::CandleSetsContainer candles = engine.flush();
+	QCOMPARE(candles.count(), 1);
+	QCOMPARE(candles.at(0).count(), 2);
+
+	HistoryCollective::Tuple aTuple = candles.at(0).value("a");
+	QCOMPARE(aTuple.open, QVariant(1));
+	QCOMPARE(aTuple.close, QVariant(3));
+	QCOMPARE(aTuple.min, QVariant(1));
+	QCOMPARE(aTuple.max, QVariant(5));
+	QCOMPARE(aTuple.count, 3);
+	QVERIFY(aTuple.openTime <= aTuple.closeTime);
+
+	HistoryCollective::Tuple bTuple = candles.at(0).value("b");
+	QCOMPARE(bTuple.open, QVariant(0.5));
+	QCOMPARE(bTuple.close, QVariant(2.0));
+	QCOMPARE(bTuple.min, QVariant(-1.0));
+	QCOMPARE(bTuple.max, QVariant(2.0));
+	QCOMPARE(bTuple.count, 3);
+
+	QVERIFY(engine.flush().isEmpty());
+}
+
+void test_SamplingEngine::samplesPerCandle()
+{
+	SamplingEngine engine;
+	engine.setSamples(2);
+	int a = engine.appendSlot("a");
+	engine.setValue(a, true);
+
+	for (int i = 0; i < 5; i++)
+		QVERIFY(engine.sample());
+
+	// Last candle is incomplete, but flush closes it anyway.
+	SamplingEngine::CandleSetsContainer candles = engine.flush();
+	QCOMPARE(candles.count(), 3);
+	QCOMPARE(candles.at(0).value("a").count, 2);
+	QCOMPARE(candles.at(1).value("a").count, 2);
+	QCOMPARE(candles.at(2).value("a").count, 1);
+	QCOMPARE(candles.at(2).value("a").close, QVariant(true));
+}
+
+void test_SamplingEngine::typeChange()
+{
+	SamplingEngine engine;
+	engine.setSamples(10);
+	int a = engine.appendSlot("a");
+
+	engine.setValue(a, 1);
+	QVERIFY(engine.sample());
+	engine.setValue(a, 2);
+	QVERIFY(engine.sample());
+	engine.setValue(a, 2.5);
+	QVERIFY(engine.sample());
+
+	// Integer candle is closed early, so that its samples are not lost.
+	SamplingEngine::CandleSetsContainer candles = engine.flush();
+	QCOMPARE(candles.count(), 2);
+	QCOMPARE(candles.at(0).value("a").open, QVariant(1));
+	QCOMPARE(candles.at(0).value("a").close, QVariant(2));
+	QCOMPARE(candles.at(0).value("a").count, 2);
+	QCOMPARE(candles.at(1).value("a").open, QVariant(2.5));
+	QCOMPARE(candles.at(1).value("a").count, 1);
+}
+
+void test_SamplingEngine::candlesReady()
+{
+	SamplingEngine engine;
+	engine.setSamples(2);
+	engine.setInterval(SamplingEngine::MIN_DRAIN_INTERVAL);
+	int a = engine.appendSlot("a");
+	engine.setValue(a, 7);
+
+	QObject receiver;
+	int notifications = 0;
+	connect(& engine, & SamplingEngine::candlesReady, & receiver, [& notifications]() {
+		notifications++;
+	});
+
+	engine.start();
+	QVERIFY(engine.sample());
+	QVERIFY(engine.sample());
+	QTRY_COMPARE(notifications, 1);
+	engine.stop();
+
+	SamplingEngine::CandleSetsContainer candles = engine.takeCandles();
+	QCOMPARE(candles.count(), 1);
+	QCOMPARE(candles.at(0).value("a").close, QVariant(7));
+	QVERIFY(engine.takeCandles().isEmpty());
+}
+
+void test_SamplingEngine::clearSlots()
+{
+	SamplingEngine engine;
+	engine.setSamples(10);
+	int a = engine.appendSlot("a");
+	engine.setValue(a, 1);
+	QVERIFY(engine.sample());
+
+	// Samples taken before slots have been cleared are discarded.
+	engine.clearSlots();
+	int b = engine.appendSlot("b");
+	engine.setValue(b, 2);
+	QVERIFY(engine.sample());
+
+	SamplingEngine::CandleSetsContainer candles = engine.flush();
+	QCOMPARE(candles.count(), 1);
+	QCOMPARE(candles.at(0).count(), 1);
+	QVERIFY(candles.at(0).contains("b"));
+	QCOMPARE(candles.at(0).value("b").count, 1);
+}
+
+void test_SamplingEngine::reset()
+{
+	SamplingEngine engine;
+	engine.setSamples(1);
+	int a = engine.appendSlot("a");
+	engine.setValue(a, 1);
+	QVERIFY(engine.sample());
+	QCOMPARE(engine.flush().count(), 1);
+
+	QVERIFY(engine.sample());
+	engine.reset();
+	QVERIFY(engine.flush().isEmpty());
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_SamplingEngine)
+#include "test_SamplingEngine.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,197 @@
+#include <cutehmi/dataacquisition/internal/TagCache.hpp>
+#include <cutehmi/dataacquisition/Schema.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace cutehmi {
+namespace dataacquisition {
+namespace internal {
+
+/**
+ * Tag cache test. Cache is operated from the main thread on its own SQLite connection.
+ */
+class test_TagCache:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void init();
+
+		void cleanup();
+
+		void hit();
+
+		void miss();
+
+		void batches();
+
+		void invalidation();
+
+	private:
+		int tagId(const QString & name);
+
+		QTemporaryDir m_dir;
+		int m_counter = 0;
+		QString m_connectionName;
+		std::unique_ptr<Schema> m_schema;
+};
+
+void test_TagCache::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+
+	m_schema = std::make_unique<Schema>();
+	m_schema->setName("test");
+}
+
+void test_TagCache::init()
+{
+	m_counter++;
+	m_connectionName = QString("test_TagCache_%1").arg(m_counter);
+
+	QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", m_connectionName);
+	db.setDatabaseName(m_dir.filePath(m_connectionName + ".sqlite"));
+	QVERIFY(db.open());
+	QSqlQuery query(db);
+	QVERIFY(query.exec("CREATE TABLE [test.tag] (id INTEGER PRIMARY KEY AUTOINCREMENT NOT NULL, name VARCHAR(255) NOT NULL UNIQUE)"));
+}
+
+void test_TagCache::cleanup()
+{
+	QSqlDatabase::database(m_connectionName, false).close();
+	QSqlDatabase::removeDatabase(m_connectionName);
+}
+
+void test_TagCache::hit()
+{
+	QSqlDatabase db = QSqlDatabase::database(m_connectionName);
+	TagCache cache(m_schema.get());
+
+	int id = cache.getId("a", db);
+	QVERIFY(id > 0);
+	QCOMPARE(tagId("a"), id);
+
+	// Cached tags are served without touching the database.
+	QSqlDatabase invalidDb;
+	QCOMPARE(cache.getId("a", invalidDb), id);
+	QCOMPARE(cache.getIds({"a", "a"}, invalidDb), QList<int>({id, id}));
+
+	// Cache does not notice changes made to the database by someone else.
+	QSqlQuery query(db);
+	QVERIFY(query.exec("UPDATE [test.tag] SET id = 100 WHERE name = 'a'"));
+	QCOMPARE(cache.getId("a", db), id);
+}
+
+void test_TagCache::miss()
+{
+	QSqlDatabase db = QSqlDatabase::database(m_connectionName);
+	QSqlQuery query(db);
+	QVERIFY(query.exec("INSERT INTO [test.tag] (name) VALUES ('existing')"));
+	int existingId = tagId("existing");
+	TagCache cache(m_schema.get());
+
+	// Tags, which exist in the database, are loaded along with the first miss.
+	QList<int> ids = cache.getIds({"new", "existing"}, db);
+	QCOMPARE(ids.count(), 2);
+	QCOMPARE(ids.at(0), tagId("new"));
+	QCOMPARE(ids.at(1), existingId);
+
+	// Tag inserted by someone else after cache has been loaded is picked up instead of being created again.
+	QVERIFY(query.exec("INSERT INTO [test.tag] (name) VALUES ('concurrent')"));
+	int concurrentId = tagId("concurrent");
+	QCOMPARE(cache.getId("concurrent", db), concurrentId);
+
+	QVERIFY(query.exec("SELECT COUNT(*) FROM [test.tag]"));
+	QVERIFY(query.next());
+	QCOMPARE(query.value(0).toInt(), 3);
+
+	// Missing tag, which can not be created, yields -1.
+	QSqlDatabase invalidDb;
+	QCOMPARE(cache.getId("unreachable", invalidDb), -1);
+	QCOMPARE(cache.getIds({"existing", "unreachable"}, invalidDb), QList<int>({existingId, -1}));
+}
+
+void test_TagCache::batches()
+{
+	QSqlDatabase db = QSqlDatabase::database(m_connectionName);
+	TagCache cache(m_schema.get());
+
+	// Names exceed a single batch and contain duplicates.
+	QStringList names;
+	for (int i = 0; i < TagCache::INSERT_BATCH_SIZE + 10; i++)
+		names.append(QString("tag_%1").arg(i));
+	names.append("tag_0");
+
+	QList<int> ids = cache.getIds(names, db);
+	QCOMPARE(ids.count(), names.count());
+	QCOMPARE(ids.last(), ids.first());
+	QCOMPARE(QSet<int>(ids.begin(), ids.end()).count(), TagCache::INSERT_BATCH_SIZE + 10);
+	QVERIFY(!ids.contains(-1));
+	QCOMPARE(ids.at(TagCache::INSERT_BATCH_SIZE), tagId(QString("tag_%1").arg(TagCache::INSERT_BATCH_SIZE)));
+
+	QSqlDatabase invalidDb;
+	QCOMPARE(cache.getIds(names, invalidDb), ids);
+}
+
+void test_TagCache::invalidation()
+{
+	QSqlDatabase db = QSqlDatabase::database(m_connectionName);
+	TagCache cache(m_schema.get());
+	int aId = cache.getId("a", db);
+	int bId = cache.getId("b", db);
+
+	// Preloading reloads cache from the database, so that stale entries are dropped.
+	QSqlQuery query(db);
+	QVERIFY(query.exec("DELETE FROM [test.tag] WHERE name = 'a'"));
+	QVERIFY(query.exec("UPDATE [test.tag] SET id = 100 WHERE name = 'b'"));
+	cache.preload({"c"}, db);
+
+	QSqlDatabase invalidDb;
+	QCOMPARE(cache.getId("a", invalidDb), -1);
+	QCOMPARE(cache.getId("b", invalidDb), 100);
+	QCOMPARE(cache.getId("c", invalidDb), tagId("c"));
+
+	// Dropped tag is created again.
+	int recreatedId = cache.getId("a", db);
+	QVERIFY(recreatedId > 0);
+	QVERIFY(recreatedId != aId);
+	QVERIFY(bId != 100);
+	QCOMPARE(tagId("a"), recreatedId);
+}
+
+int test_TagCache::tagId(const QString & name)
+{
+	QSqlQuery query(QSqlDatabase::database(m_connectionName));
+	query.prepare("SELECT id FROM [test.tag] WHERE name = ?");
+	query.addBindValue(name);
+	if (!query.exec() || !query.next())
+		return -1;
+	return query.value(0).toInt();
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::dataacquisition::internal::test_TagCache)
+#include "test_TagCache.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
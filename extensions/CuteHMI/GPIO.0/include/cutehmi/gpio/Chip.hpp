@@ -3,12 +3,14 @@
 
 #include "internal/common.hpp"
 #include "Line.hpp"
+#include "LineGroup.hpp"
 
 #include <gpiod.h>
 
 #include <QObject>
 #include <QQmlListProperty>
 #include <QVector>
+#include <QPointer>
 #include <QQmlEngine>
 
 namespace cutehmi {
@@ -20,6 +22,8 @@ class CUTEHMI_GPIO_API Chip:
 		Q_OBJECT
 		QML_NAMED_ELEMENT(Chip)
 
+		friend class test_LineGroup;
+
 	public:
 		Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
 		Q_PROPERTY(QString label READ label NOTIFY labelChanged)
@@ -37,6 +41,14 @@ class CUTEHMI_GPIO_API Chip:
 
 		const QQmlListProperty<Line> lines();
 
+		/**
+		 * Create line group. Line group allows to request lines and change their values at once. Line group is owned by the chip
+		 * and it is destroyed when the chip is closed.
+		 * @param offsets offsets of the lines. At most LineGroup::MAX_LINES lines can be grouped.
+		 * @return line group or @p nullptr if chip is not open or offsets are invalid.
+		 */
+		Q_INVOKABLE cutehmi::gpio::LineGroup * lineGroup(const QList<int> & offsets);
+
 	public slots:
 		void open();
 
@@ -52,6 +64,8 @@ class CUTEHMI_GPIO_API Chip:
 	private:
 		typedef QVector<Line *> LinesDataContainer;
 
+		typedef QVector<QPointer<LineGroup>> LineGroupsContainer;
+
 		static int LineCount(QQmlListProperty<Line> * property);
 
 		static Line * LineAt(QQmlListProperty<Line> * property, int index);
@@ -71,6 +85,7 @@ class CUTEHMI_GPIO_API Chip:
 			QString label;
 			LinesDataContainer linesData;
 			QQmlListProperty<Line> lines;
+			LineGroupsContainer lineGroups;
 
 			Members(Chip * p_parent):
 				chip(nullptr),
@@ -3,7 +3,7 @@
 
 #include "internal/common.hpp"
 #include "LineConfig.hpp"
-#include "internal/LineEventMonitorThread.hpp"
+#include "LineEventMonitor.hpp"
 
 #include <gpiod.h>
 
@@ -26,6 +26,7 @@ class CUTEHMI_GPIO_API Line:
 		Q_PROPERTY(cutehmi::gpio::LineConfig * config READ config WRITE setConfig NOTIFY configChanged)
 		Q_PROPERTY(bool used READ used NOTIFY usedChanged)
 		Q_PROPERTY(QString consumer READ consumer WRITE setConsumer NOTIFY consumerChanged)
+		Q_PROPERTY(qint64 eventTimestamp READ eventTimestamp NOTIFY eventTimestampChanged)
 
 		explicit Line(gpiod_line * line, QObject * parent = nullptr);
 
@@ -47,6 +48,13 @@ class CUTEHMI_GPIO_API Line:
 
 		bool used() const;
 
+		/**
+		 * Get timestamp of the most recent line event. Timestamp is taken by the kernel, when the edge is detected, so it is more
+		 * accurate than the time at which valueChanged() signal is received.
+		 * @return timestamp of the most recent line event in nanoseconds or 0 if no event has been received yet.
+		 */
+		qint64 eventTimestamp() const;
+
 	signals:
 		void valueChanged();
 
@@ -56,6 +64,8 @@ class CUTEHMI_GPIO_API Line:
 
 		void usedChanged();
 
+		void eventTimestampChanged();
+
 	private slots:
 		void requestLine();
 
@@ -63,9 +73,9 @@ class CUTEHMI_GPIO_API Line:
 
 		void requestValue();
 
-		void handleLineEvent(gpiod_line_event event);
-
 	private:
+		void handleLineEvents(const LineEventMonitor::EventBatch & events);
+
 		void readLineInfo();
 
 		struct Members
@@ -77,13 +87,14 @@ class CUTEHMI_GPIO_API Line:
 			gpiod_line_request_config requestConfig;
 			QByteArray consumer;
 			bool used;
-			internal::LineEventMonitorThread monitorThread;
+			qint64 eventTimestamp;
 
 			Members(gpiod_line * p_line):
 				line(p_line),
 				value(0),
 				config(nullptr),
-				used(false)
+				used(false),
+				eventTimestamp(0)
 			{
 			}
 		};
@@ -54,6 +54,12 @@ class CUTEHMI_GPIO_API LineConfig:
 
 		void setOpenSource(bool openSource);
 
+		/**
+		 * Get request flags.
+		 * @return flags, which can be passed to libgpiod line request.
+		 */
+		int requestFlags() const;
+
 	signals:
 		void directionChanged();
 
@@ -0,0 +1,107 @@
+#ifndef H_EXTENSIONS_CUTEHMI_GPIO_0_INCLUDE_CUTEHMI_GPIO_LINEEVENTMONITOR_HPP
+#define H_EXTENSIONS_CUTEHMI_GPIO_0_INCLUDE_CUTEHMI_GPIO_LINEEVENTMONITOR_HPP
+
+#include "internal/common.hpp"
+#include "internal/LineEventMonitorThread.hpp"
+
+#include <cutehmi/Singleton.hpp>
+
+#include <gpiod.h>
+
+#include <QObject>
+
+namespace cutehmi {
+namespace gpio {
+
+/**
+ * Line event monitor. Monitor is shared by all the lines. It uses a single thread, which waits on event file descriptors of all
+ * watched lines with one @p epoll instance. After each wakeup the thread reads up to @ref internal::LineEventMonitorThread::MAX_BATCH_SIZE
+ * "MAX_BATCH_SIZE" events from each ready descriptor and delivers them as a single batch. Events carry timestamps assigned by the
+ * kernel.
+ *
+ * Monitor works with file descriptors, so any descriptor, which yields events in the format of Linux GPIO character device (such
+ * as a pipe filled by a fake chip), can be watched.
+ */
+class CUTEHMI_GPIO_API LineEventMonitor:
+	public QObject,
+	public Singleton<LineEventMonitor>
+{
+	Q_OBJECT
+
+	friend class Singleton<LineEventMonitor>;
+
+	public:
+		typedef internal::LineEventMonitorThread::EventBatch EventBatch;
+
+		typedef internal::LineEventMonitorThread::BatchHandler BatchHandler;
+
+		/**
+		 * Watch line events.
+		 * @param line line, which has been requested for events.
+		 * @param receiver receiver object. Handler is called in the thread of the receiver. Receiver must not be destroyed before
+		 * unwatch() has been called.
+		 * @param handler batch handler.
+		 * @return @p true if line is being watched, @p false otherwise.
+		 */
+		bool watch(gpiod_line * line, QObject * receiver, BatchHandler handler);
+
+		/**
+		 * Watch file descriptor.
+		 * @param fd file descriptor, which yields line events.
+		 * @param receiver receiver object. Handler is called in the thread of the receiver. Receiver must not be destroyed before
+		 * unwatch() has been called.
+		 * @param handler batch handler.
+		 * @return @p true if file descriptor is being watched, @p false otherwise.
+		 */
+		bool watch(int fd, QObject * receiver, BatchHandler handler);
+
+		/**
+		 * Stop watching line events. Once this function returns monitor no longer reads from the file descriptor of the line, so it
+		 * is safe to release the line and to destroy the receiver. Batches, which have already been queued may still be delivered to
+		 * the receiver, unless it is destroyed.
+		 * @param line line.
+		 */
+		void unwatch(gpiod_line * line);
+
+		/**
+		 * Stop watching file descriptor.
+		 * @param fd file descriptor.
+		 */
+		void unwatch(int fd);
+
+		/**
+		 * Get number of watched file descriptors.
+		 * @return number of watched file descriptors.
+		 */
+		int watchedCount() const;
+
+	private:
+		LineEventMonitor();
+
+		~LineEventMonitor() override;
+
+		struct Members
+		{
+			internal::LineEventMonitorThread thread;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+extern template class cutehmi::Singleton<cutehmi::gpio::LineEventMonitor>;
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,166 @@
+#ifndef H_EXTENSIONS_CUTEHMI_GPIO_0_INCLUDE_CUTEHMI_GPIO_LINEGROUP_HPP
+#define H_EXTENSIONS_CUTEHMI_GPIO_0_INCLUDE_CUTEHMI_GPIO_LINEGROUP_HPP
+
+#include "internal/common.hpp"
+#include "LineConfig.hpp"
+
+#include <gpiod.h>
+
+#include <QObject>
+#include <QQmlEngine>
+#include <QList>
+
+namespace cutehmi {
+namespace gpio {
+
+class Chip;
+
+/**
+ * Line group. Group requests its lines at once with a single bulk request and reads or writes values of all the lines with a single
+ * call, so that values of output lines are changed atomically. Line groups are created with Chip::lineGroup() function.
+ *
+ * Changes of values made within the same event loop iteration are coalesced into one bulk write. Function flush() can be used to
+ * write pending values immediately.
+ */
+class CUTEHMI_GPIO_API LineGroup:
+	public QObject
+{
+		Q_OBJECT
+		QML_NAMED_ELEMENT(LineGroup)
+		QML_UNCREATABLE("LineGroup instance can not be created from QML")
+
+		friend class Chip;
+		friend class test_LineGroup;
+
+	public:
+		static constexpr int MAX_LINES = GPIOD_LINE_BULK_MAX_LINES;
+
+		Q_PROPERTY(QList<int> offsets READ offsets CONSTANT)
+		Q_PROPERTY(QList<int> values READ values WRITE setValues NOTIFY valuesChanged)
+		Q_PROPERTY(qint64 word READ word WRITE setWord NOTIFY valuesChanged)
+		Q_PROPERTY(cutehmi::gpio::LineConfig * config READ config WRITE setConfig NOTIFY configChanged)
+		Q_PROPERTY(QString consumer READ consumer WRITE setConsumer NOTIFY consumerChanged)
+		Q_PROPERTY(bool requested READ requested NOTIFY requestedChanged)
+
+		~LineGroup() override;
+
+		/**
+		 * Get offsets of the lines.
+		 * @return offsets of the lines in the order, in which they appear in the group.
+		 */
+		QList<int> offsets() const;
+
+		/**
+		 * Get values of the lines.
+		 * @return values of the lines in the order of offsets(). For output lines these are the values, which were most recently
+		 * set. For input lines values are updated by readValues() function.
+		 */
+		QList<int> values() const;
+
+		/**
+		 * Set values of the lines. Values are written with a single bulk call at the end of current event loop iteration.
+		 * @param values values of the lines in the order of offsets(). Non-zero values are treated as active.
+		 */
+		void setValues(const QList<int> & values);
+
+		/**
+		 * Get values of the lines as a word. Value of the first line is stored in the least significant bit.
+		 * @return values of the lines as a word.
+		 */
+		qint64 word() const;
+
+		/**
+		 * Set values of the lines from a word. Value of the first line is taken from the least significant bit.
+		 * @param word word.
+		 */
+		void setWord(qint64 word);
+
+		LineConfig * config() const;
+
+		void setConfig(LineConfig * config);
+
+		QString consumer() const;
+
+		void setConsumer(const QString & consumer);
+
+		bool requested() const;
+
+	public slots:
+		/**
+		 * Set value of a single line. Value is written along with other changes made within current event loop iteration.
+		 * @param index index of the line within the group.
+		 * @param value value.
+		 */
+		void setValue(int index, int value);
+
+		/**
+		 * Write pending values immediately.
+		 */
+		void flush();
+
+		/**
+		 * Read values of the lines with a single bulk call.
+		 */
+		void readValues();
+
+	signals:
+		void valuesChanged();
+
+		void configChanged();
+
+		void consumerChanged();
+
+		void requestedChanged();
+
+	private:
+		LineGroup(const QList<int> & offsets, const gpiod_line_bulk & bulk, QObject * parent = nullptr);
+
+		void requestLines();
+
+		void releaseLines();
+
+		void detach();
+
+		void scheduleFlush();
+
+		void setRequested(bool requested);
+
+		struct Members
+		{
+			QList<int> offsets;
+			gpiod_line_bulk bulk;
+			int values[MAX_LINES];
+			LineConfig * config;
+			QByteArray consumer;
+			bool requested;
+			bool flushPending;
+
+			Members(const QList<int> & p_offsets, const gpiod_line_bulk & p_bulk):
+				offsets(p_offsets),
+				bulk(p_bulk),
+				values(),
+				config(nullptr),
+				requested(false),
+				flushPending(false)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -6,35 +6,71 @@
 #include <gpiod.h>
 
 #include <QThread>
+#include <QMutex>
+#include <QHash>
+#include <QVector>
+
+#include <functional>
 
 namespace cutehmi {
 namespace gpio {
 namespace internal {
 
-// One thread per Linie isn't the most efficient approach, but let's stick to Donald Knuth's wisdom that "premature optimization is
-// the root of all evil".
+/**
+ * Line event monitor thread. Thread waits on multiple file descriptors with @p epoll and drains events from all descriptors that
+ * became ready within a single wakeup. Thread sleeps until an event arrives, so it does not wake up periodically.
+ */
 class CUTEHMI_GPIO_PRIVATE LineEventMonitorThread:
 	public QThread
 {
 	Q_OBJECT
 
 	public:
+		static constexpr int MAX_BATCH_SIZE = 16;	///< Maximal number of events read from a descriptor at once.
+
+		static constexpr int MAX_READY_DESCRIPTORS = 64;	///< Maximal number of ready descriptors handled within a wakeup.
+
+		typedef QVector<gpiod_line_event> EventBatch;
+
+		typedef std::function<void(const EventBatch & events)> BatchHandler;
+
 		LineEventMonitorThread(QObject * parent = nullptr);
 
-		void setLine(gpiod_line * line);
+		~LineEventMonitorThread() override;
 
-		void run() override;
+		bool watch(int fd, QObject * receiver, BatchHandler handler);
+
+		void unwatch(int fd);
 
-	signals:
-		void eventDetected(gpiod_line_event event);
+		int watchedCount() const;
+
+		/**
+		 * Stop the thread. Function blocks until thread finishes.
+		 */
+		void stop();
+
+	protected:
+		void run() override;
 
 	private:
-		static int Register_gpiod_line_event();
+		struct Watch
+		{
+			QObject * receiver;
+			BatchHandler handler;
+		};
+
+		typedef QHash<int, Watch> WatchesContainer;
+
+		void wakeUp();
+
+		void readEvents(int fd, bool hangup);
 
 		struct Members
 		{
-			gpiod_line * line = nullptr;
-			timespec timeout = {1, 0};
+			int epollFd = -1;
+			int wakeFd = -1;
+			mutable QMutex mutex;
+			WatchesContainer watches;
 		};
 
 		MPtr<Members> m;
@@ -44,9 +80,6 @@ class CUTEHMI_GPIO_PRIVATE LineEventMonitorThread:
 }
 }
 
-Q_DECLARE_METATYPE(gpiod_line_event)
-
-
 #endif
 
 //(c)C: Copyright © 2019-2020, Michał Policht <michal@policht.pl>. All rights reserved.
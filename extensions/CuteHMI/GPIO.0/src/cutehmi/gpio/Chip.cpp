@@ -38,6 +38,37 @@ const QQmlListProperty<Line> Chip::lines()
 	return m->lines;
 }
 
+LineGroup * Chip::lineGroup(const QList<int> & offsets)
+{
+	if (m->chip == nullptr) {
+		CUTEHMI_WARNING("Can not create line group, because chip is not open.");
+		return nullptr;
+	}
+
+	if (offsets.isEmpty() || offsets.count() > LineGroup::MAX_LINES) {
+		CUTEHMI_WARNING("Line group must contain from 1 to " << LineGroup::MAX_LINES << " lines.");
+		return nullptr;
+	}
+
+	gpiod_line_bulk bulk;
+	gpiod_line_bulk_init(& bulk);
+	for (auto && offset : offsets) {
+		gpiod_line * line = offset >= 0 ? gpiod_chip_get_line(m->chip, static_cast<unsigned int>(offset)) : nullptr;
+		if (line == nullptr) {
+			CUTEHMI_WARNING("Could not get line at offset '" << offset << "'.");
+			return nullptr;
+		}
+		gpiod_line_bulk_add(& bulk, line);
+	}
+
+	// Groups, which have been destroyed in the meantime, are pruned, so that the container does not grow with each created group.
+	m->lineGroups.removeAll(QPointer<LineGroup>());
+
+	LineGroup * group = new LineGroup(offsets, bulk, this);
+	m->lineGroups.append(group);
+	return group;
+}
+
 void Chip::open()
 {
 	close();
@@ -51,6 +82,12 @@ void Chip::open()
 void Chip::close()
 {
 	clearProperties();
+	for (auto && group : m->lineGroups)
+		if (group) {
+			group->detach();
+			group->deleteLater();
+		}
+	m->lineGroups.clear();
 	if (m->chip) {
 		gpiod_chip_close(m->chip);
 		m->chip = nullptr;
@@ -8,7 +8,6 @@ Line::Line(gpiod_line * line, QObject * parent):
 	m(new Members(line))
 {
 	readLineInfo();
-	connect(& m->monitorThread, & internal::LineEventMonitorThread::eventDetected, this, & Line::handleLineEvent);
 }
 
 Line::~Line()
@@ -72,6 +71,11 @@ bool Line::used() const
 	return m->used;
 }
 
+qint64 Line::eventTimestamp() const
+{
+	return m->eventTimestamp;
+}
+
 void Line::requestLine()
 {
 	CUTEHMI_ASSERT(m->config != nullptr, "config must not be nullptr");
@@ -109,24 +113,7 @@ void Line::requestLine()
 
 	// Configure flags.
 
-	m->requestConfig.flags = 0;
-
-	if (m->config->openDrain())
-		m->requestConfig.flags |= GPIOD_LINE_REQUEST_FLAG_OPEN_DRAIN;
-
-	if (m->config->openSource())
-		m->requestConfig.flags |= GPIOD_LINE_REQUEST_FLAG_OPEN_SOURCE;
-
-	switch (m->config->activeState()) {
-		case LineConfig::ACTIVE_STATE_LOW:
-			m->requestConfig.flags |= GPIOD_LINE_REQUEST_FLAG_ACTIVE_LOW;
-			break;
-		case LineConfig::ACTIVE_STATE_HIGH:
-			// High is default (i.e. flags = 0).
-			break;
-		default:
-			CUTEHMI_CRITICAL("Unrecognized active state code (" << m->config->activeState() << ").");
-	}
+	m->requestConfig.flags = m->config->requestFlags();
 
 
 	// Request line.
@@ -178,19 +165,20 @@ void Line::requestLine()
 	readLineInfo();
 
 
-	// Start monitoring thread for input direction.
+	// Watch events for input direction.
 
-	if (m->config->direction() == LineConfig::DIRECTION_INPUT) {
-		m->monitorThread.setLine(m->line);
-		m->monitorThread.start();
-	}
+	if (m->config->direction() == LineConfig::DIRECTION_INPUT)
+		if (!LineEventMonitor::Instance().watch(m->line, this, [this](const LineEventMonitor::EventBatch & events) {
+			handleLineEvents(events);
+		}))
+			CUTEHMI_WARNING("Could not watch events of line '" << m->name << "'.");
 }
 
 void Line::releaseLine()
 {
 	if (gpiod_line_is_requested(m->line)) {
-		m->monitorThread.requestInterruption();
-		m->monitorThread.wait();
+		// For lines, which have not been requested for events, file descriptor is -1, so this is a no-op.
+		LineEventMonitor::Instance().unwatch(m->line);
 
 		disconnect(this, & Line::valueChanged, this, & Line::requestValue);
 
@@ -205,17 +193,27 @@ void Line::requestValue()
 	gpiod_line_set_value(m->line, m->value);
 }
 
-void Line::handleLineEvent(gpiod_line_event event)
+void Line::handleLineEvents(const LineEventMonitor::EventBatch & events)
 {
-	switch (event.event_type) {
-		case GPIOD_LINE_EVENT_RISING_EDGE:
-			setValue(1);
-			break;
-		case GPIOD_LINE_EVENT_FALLING_EDGE:
-			setValue(0);
-			break;
-		default:
-			CUTEHMI_WARNING("Unrecognized line event type (" << event.event_type << ").");
+	// Apply events one by one, so that each edge is reported with valueChanged() signal. Timestamp is updated first, so that it
+	// corresponds to the value, when valueChanged() signal is emitted.
+	for (auto && event : events) {
+		qint64 eventTimestamp = static_cast<qint64>(event.ts.tv_sec) * Q_INT64_C(1000000000) + event.ts.tv_nsec;
+		if (m->eventTimestamp != eventTimestamp) {
+			m->eventTimestamp = eventTimestamp;
+			emit eventTimestampChanged();
+		}
+
+		switch (event.event_type) {
+			case GPIOD_LINE_EVENT_RISING_EDGE:
+				setValue(1);
+				break;
+			case GPIOD_LINE_EVENT_FALLING_EDGE:
+				setValue(0);
+				break;
+			default:
+				CUTEHMI_WARNING("Unrecognized line event type (" << event.event_type << ").");
+		}
 	}
 }
 
@@ -61,6 +61,30 @@ void LineConfig::setOpenSource(bool openSource)
 	}
 }
 
+int LineConfig::requestFlags() const
+{
+	int flags = 0;
+
+	if (openDrain())
+		flags |= GPIOD_LINE_REQUEST_FLAG_OPEN_DRAIN;
+
+	if (openSource())
+		flags |= GPIOD_LINE_REQUEST_FLAG_OPEN_SOURCE;
+
+	switch (activeState()) {
+		case LineConfig::ACTIVE_STATE_LOW:
+			flags |= GPIOD_LINE_REQUEST_FLAG_ACTIVE_LOW;
+			break;
+		case LineConfig::ACTIVE_STATE_HIGH:
+			// High is default (i.e. flags = 0).
+			break;
+		default:
+			CUTEHMI_CRITICAL("Unrecognized active state code (" << activeState() << ").");
+	}
+
+	return flags;
+}
+
 }
 }
 
@@ -0,0 +1,236 @@
+#include <cutehmi/gpio/LineGroup.hpp>
+
+namespace cutehmi {
+namespace gpio {
+
+constexpr int LineGroup::MAX_LINES;
+
+LineGroup::~LineGroup()
+{
+	releaseLines();
+}
+
+QList<int> LineGroup::offsets() const
+{
+	return m->offsets;
+}
+
+QList<int> LineGroup::values() const
+{
+	QList<int> result;
+	for (int i = 0; i < m->offsets.count(); i++)
+		result.append(m->values[i]);
+	return result;
+}
+
+void LineGroup::setValues(const QList<int> & values)
+{
+	if (values.count() != m->offsets.count())
+		CUTEHMI_WARNING("Number of values (" << values.count() << ") does not match number of lines (" << m->offsets.count() << ").");
+
+	bool changed = false;
+	for (int i = 0; i < m->offsets.count() && i < values.count(); i++) {
+		int value = values.at(i) ? 1 : 0;
+		if (m->values[i] != value) {
+			m->values[i] = value;
+			changed = true;
+		}
+	}
+
+	if (changed) {
+		scheduleFlush();
+		emit valuesChanged();
+	}
+}
+
+qint64 LineGroup::word() const
+{
+	quint64 result = 0;
+	for (int i = 0; i < m->offsets.count(); i++)
+		if (m->values[i])
+			result |= Q_UINT64_C(1) << i;
+	return static_cast<qint64>(result);
+}
+
+void LineGroup::setWord(qint64 word)
+{
+	QList<int> values;
+	for (int i = 0; i < m->offsets.count(); i++)
+		values.append((static_cast<quint64>(word) >> i) & 1);
+	setValues(values);
+}
+
+LineConfig * LineGroup::config() const
+{
+	return m->config;
+}
+
+void LineGroup::setConfig(LineConfig * config)
+{
+	if (m->config != config) {
+		m->config = config;
+		if (m->config)
+			requestLines();
+		else
+			releaseLines();
+		emit configChanged();
+	}
+}
+
+QString LineGroup::consumer() const
+{
+	return m->consumer;
+}
+
+void LineGroup::setConsumer(const QString & consumer)
+{
+	if (m->consumer != consumer) {
+		m->consumer = consumer.toUtf8();
+		if (m->config)
+			requestLines();
+		emit consumerChanged();
+	}
+}
+
+bool LineGroup::requested() const
+{
+	return m->requested;
+}
+
+void LineGroup::setValue(int index, int value)
+{
+	if (index < 0 || index >= m->offsets.count()) {
+		CUTEHMI_WARNING("Line index (" << index << ") out of range.");
+		return;
+	}
+
+	value = value ? 1 : 0;
+	if (m->values[index] != value) {
+		m->values[index] = value;
+		scheduleFlush();
+		emit valuesChanged();
+	}
+}
+
+void LineGroup::flush()
+{
+	m->flushPending = false;
+
+	if (!m->requested || m->config->direction() != LineConfig::DIRECTION_OUTPUT)
+		return;
+
+	if (gpiod_line_set_value_bulk(& m->bulk, m->values) != 0)
+		CUTEHMI_WARNING("Could not set values of line group.");
+}
+
+void LineGroup::readValues()
+{
+	if (!m->requested)
+		return;
+
+	int values[MAX_LINES];
+	if (gpiod_line_get_value_bulk(& m->bulk, values) != 0) {
+		CUTEHMI_WARNING("Could not read values of line group.");
+		return;
+	}
+
+	bool changed = false;
+	for (int i = 0; i < m->offsets.count(); i++)
+		if (m->values[i] != values[i]) {
+			m->values[i] = values[i];
+			changed = true;
+		}
+	if (changed)
+		emit valuesChanged();
+}
+
+LineGroup::LineGroup(const QList<int> & offsets, const gpiod_line_bulk & bulk, QObject * parent):
+	QObject(parent),
+	m(new Members(offsets, bulk))
+{
+}
+
+void LineGroup::requestLines()
+{
+	CUTEHMI_ASSERT(m->config != nullptr, "config must not be nullptr");
+
+	releaseLines();
+
+	if (gpiod_line_bulk_num_lines(& m->bulk) == 0) {
+		CUTEHMI_WARNING("Line group has been detached from its chip.");
+		return;
+	}
+
+	// Overcome weird behavior of libgpiod, which sets consumer to "?", if empty string is provided in the request.
+	if (m->consumer.isEmpty())
+		m->consumer = "Unnamed Consumer";
+
+	gpiod_line_request_config requestConfig;
+	requestConfig.consumer = m->consumer.data();
+	requestConfig.flags = m->config->requestFlags();
+	switch (m->config->direction()) {
+		case LineConfig::DIRECTION_OUTPUT:
+			requestConfig.request_type = GPIOD_LINE_REQUEST_DIRECTION_OUTPUT;
+			break;
+		case LineConfig::DIRECTION_INPUT:
+			requestConfig.request_type = GPIOD_LINE_REQUEST_DIRECTION_INPUT;
+			break;
+		default:
+			CUTEHMI_CRITICAL("Unrecognized line direction code (" << m->config->direction() << ").");
+			return;
+	}
+
+	// Current values are used as default values of output lines, so that values set before the request are not lost.
+	if (gpiod_line_request_bulk(& m->bulk, & requestConfig, m->values) != 0) {
+		CUTEHMI_WARNING("Could not request lines of line group.");
+		return;
+	}
+	setRequested(true);
+
+	if (m->config->direction() == LineConfig::DIRECTION_INPUT)
+		readValues();
+}
+
+void LineGroup::releaseLines()
+{
+	if (m->requested) {
+		gpiod_line_release_bulk(& m->bulk);
+		setRequested(false);
+	}
+}
+
+void LineGroup::detach()
+{
+	releaseLines();
+	gpiod_line_bulk_init(& m->bulk);
+}
+
+void LineGroup::scheduleFlush()
+{
+	if (!m->flushPending) {
+		m->flushPending = true;
+		QMetaObject::invokeMethod(this, & LineGroup::flush, Qt::QueuedConnection);
+	}
+}
+
+void LineGroup::setRequested(bool requested)
+{
+	if (m->requested != requested) {
+		m->requested = requested;
+		emit requestedChanged();
+	}
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -1,49 +1,167 @@
 #include <cutehmi/gpio/internal/LineEventMonitorThread.hpp>
 
+#include <QMutexLocker>
+
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
 namespace cutehmi {
 namespace gpio {
 namespace internal {
 
+constexpr int LineEventMonitorThread::MAX_BATCH_SIZE;
+constexpr int LineEventMonitorThread::MAX_READY_DESCRIPTORS;
+
 LineEventMonitorThread::LineEventMonitorThread(QObject * parent):
 	QThread(parent),
 	m(new Members)
 {
-	Register_gpiod_line_event();
+	m->epollFd = epoll_create1(EPOLL_CLOEXEC);
+	if (m->epollFd == -1)
+		CUTEHMI_CRITICAL("Could not create epoll instance: " << std::strerror(errno) << ".");
+
+	m->wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+	if (m->wakeFd == -1)
+		CUTEHMI_CRITICAL("Could not create event file descriptor: " << std::strerror(errno) << ".");
+	else if (m->epollFd != -1) {
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = m->wakeFd;
+		if (epoll_ctl(m->epollFd, EPOLL_CTL_ADD, m->wakeFd, & event) == -1)
+			CUTEHMI_CRITICAL("Could not add event file descriptor to epoll instance: " << std::strerror(errno) << ".");
+	}
+}
+
+LineEventMonitorThread::~LineEventMonitorThread()
+{
+	stop();
+
+	if (m->wakeFd != -1)
+		close(m->wakeFd);
+	if (m->epollFd != -1)
+		close(m->epollFd);
 }
 
-void LineEventMonitorThread::setLine(gpiod_line * line)
+bool LineEventMonitorThread::watch(int fd, QObject * receiver, BatchHandler handler)
 {
-	m->line = line;
+	if (m->epollFd == -1 || fd < 0)
+		return false;
+
+	{
+		QMutexLocker locker(& m->mutex);
+
+		epoll_event event{};
+		event.events = EPOLLIN;
+		event.data.fd = fd;
+		int operation = m->watches.contains(fd) ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+		if (epoll_ctl(m->epollFd, operation, fd, & event) == -1) {
+			CUTEHMI_WARNING("Could not watch file descriptor '" << fd << "': " << std::strerror(errno) << ".");
+			return false;
+		}
+		m->watches.insert(fd, Watch{receiver, handler});
+	}
+
+	if (!isRunning())
+		start();
+
+	return true;
+}
+
+void LineEventMonitorThread::unwatch(int fd)
+{
+	QMutexLocker locker(& m->mutex);
+
+	if (m->watches.remove(fd) > 0)
+		// Descriptor may have been already removed from epoll set, if an error occurred on it, so result is not verified.
+		epoll_ctl(m->epollFd, EPOLL_CTL_DEL, fd, nullptr);
+}
+
+int LineEventMonitorThread::watchedCount() const
+{
+	QMutexLocker locker(& m->mutex);
+
+	return m->watches.count();
+}
+
+void LineEventMonitorThread::stop()
+{
+	if (isRunning()) {
+		requestInterruption();
+		wakeUp();
+		wait();
+	}
 }
 
 void LineEventMonitorThread::run()
 {
-	while (1) {
-		if (QThread::currentThread()->isInterruptionRequested())
+	epoll_event readyEvents[MAX_READY_DESCRIPTORS];
+
+	while (!isInterruptionRequested()) {
+		int readyCount = epoll_wait(m->epollFd, readyEvents, MAX_READY_DESCRIPTORS, -1);
+		if (readyCount == -1) {
+			if (errno == EINTR)
+				continue;
+			CUTEHMI_CRITICAL("An error occurred while waiting for line events: " << std::strerror(errno) << ".");
 			break;
-		int waitResult = gpiod_line_event_wait(m->line, & m->timeout);
-		if (waitResult == 1) {
-			gpiod_line_event event;
-			if (gpiod_line_event_read(m->line, & event) == 0)
-				emit eventDetected(event);
-			else
-				CUTEHMI_WARNING("An error occurred while reading line event.");
-		} else if (waitResult == -1)
-			CUTEHMI_WARNING("An error occurred while waiting for line event.");
+		}
+
+		for (int i = 0; i < readyCount; i++) {
+			if (readyEvents[i].data.fd == m->wakeFd) {
+				eventfd_t value;
+				eventfd_read(m->wakeFd, & value);
+			} else
+				readEvents(readyEvents[i].data.fd, readyEvents[i].events & (EPOLLHUP | EPOLLERR));
+		}
 	}
 }
 
-int LineEventMonitorThread::Register_gpiod_line_event()
+void LineEventMonitorThread::wakeUp()
+{
+	if (m->wakeFd != -1)
+		eventfd_write(m->wakeFd, 1);
+}
+
+void LineEventMonitorThread::readEvents(int fd, bool hangup)
 {
-	static int id = qRegisterMetaType<gpiod_line_event>();
-	return id;
+	QMutexLocker locker(& m->mutex);
+
+	// Descriptor could have been unwatched after epoll_wait() has returned.
+	WatchesContainer::const_iterator watch = m->watches.constFind(fd);
+	if (watch == m->watches.constEnd())
+		return;
+
+	// Epoll is level-triggered, so if there are more than MAX_BATCH_SIZE events pending, descriptor will be reported as ready again.
+	gpiod_line_event events[MAX_BATCH_SIZE];
+	int count = gpiod_line_event_read_fd_multiple(fd, events, MAX_BATCH_SIZE);
+	if (count > 0) {
+		// Receiver is guaranteed to exist, because it has to unwatch the descriptor before it is destroyed and unwatch() is
+		// serialized with this function by the mutex. Queued batches are discarded by Qt, if receiver is destroyed afterwards.
+		EventBatch batch;
+		batch.reserve(count);
+		for (int i = 0; i < count; i++)
+			batch.append(events[i]);
+		BatchHandler handler = watch->handler;
+		QMetaObject::invokeMethod(watch->receiver, [handler, batch]() {
+			handler(batch);
+		}, Qt::QueuedConnection);
+	} else if (count == -1 || hangup) {
+		// Remove descriptor from epoll set to prevent busy looping on a broken descriptor. Watch is erased as well, so that it does
+		// not outlive the descriptor, which may be closed and its number reused.
+		CUTEHMI_WARNING("An error occurred while reading events from file descriptor '" << fd << "'. Descriptor won't be monitored anymore.");
+		epoll_ctl(m->epollFd, EPOLL_CTL_DEL, fd, nullptr);
+		m->watches.erase(watch);
+	}
 }
 
 }
 }
 }
 
-//(c)C: Copyright © 2019-2020, Michał Policht <michal@policht.pl>, Yuri Chornoivan <yurchor@ukr.net>. All rights reserved.
+//(c)C: Copyright © 2019-2020, Michał Policht <michal@policht.pl>. All rights reserved.
 //(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
 //(c)C: This file is a part of CuteHMI.
 //(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
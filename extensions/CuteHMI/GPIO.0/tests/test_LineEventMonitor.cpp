@@ -0,0 +1,183 @@
+#include <cutehmi/gpio/LineEventMonitor.hpp>
+
+#include <QtTest/QtTest>
+
+#include <linux/gpio.h>
+#include <unistd.h>
+
+namespace cutehmi {
+namespace gpio {
+
+/**
+ * Line event monitor test. Instead of GPIO chip, test uses pipes filled with events in the format of Linux GPIO character device.
+ */
+class test_LineEventMonitor:
+	public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void init();
+
+		void cleanup();
+
+		void batch();
+
+		void drain();
+
+		void multipleDescriptors();
+
+		void unwatch();
+
+		void hangup();
+
+	private:
+		static constexpr int PIPE_COUNT = 8;
+
+		static void Write(int fd, quint64 timestamp, quint32 id, int count = 1);
+
+		int m_pipes[PIPE_COUNT][2];
+
+		// Receiver must outlive watches, so it is kept until descriptors are unwatched in cleanup().
+		QObject m_receiver;
+};
+
+constexpr int test_LineEventMonitor::PIPE_COUNT;
+
+void test_LineEventMonitor::init()
+{
+	for (int i = 0; i < PIPE_COUNT; i++)
+		QCOMPARE(pipe(m_pipes[i]), 0);
+}
+
+void test_LineEventMonitor::cleanup()
+{
+	for (int i = 0; i < PIPE_COUNT; i++) {
+		LineEventMonitor::Instance().unwatch(m_pipes[i][0]);
+		close(m_pipes[i][0]);
+		if (m_pipes[i][1] != -1)
+			close(m_pipes[i][1]);
+	}
+	// Discard batches, which have been queued for handlers of finished test function.
+	QCoreApplication::removePostedEvents(& m_receiver);
+	QCOMPARE(LineEventMonitor::Instance().watchedCount(), 0);
+}
+
+void test_LineEventMonitor::batch()
+{
+	LineEventMonitor::EventBatch received;
+	int batches = 0;
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[0][0], & m_receiver, [& received, & batches](const LineEventMonitor::EventBatch & events) {
+		received.append(events);
+		batches++;
+	}));
+	QCOMPARE(LineEventMonitor::Instance().watchedCount(), 1);
+
+	gpioevent_data data[3] = {
+		{Q_UINT64_C(1000000001), GPIOEVENT_EVENT_RISING_EDGE},
+		{Q_UINT64_C(2000000002), GPIOEVENT_EVENT_FALLING_EDGE},
+		{Q_UINT64_C(3000000003), GPIOEVENT_EVENT_RISING_EDGE}
+	};
+	QCOMPARE(write(m_pipes[0][1], data, sizeof(data)), static_cast<ssize_t>(sizeof(data)));
+
+	QTRY_COMPARE(received.count(), 3);
+	QCOMPARE(batches, 1);
+	QCOMPARE(received.at(0).event_type, static_cast<int>(GPIOD_LINE_EVENT_RISING_EDGE));
+	QCOMPARE(static_cast<int>(received.at(0).ts.tv_sec), 1);
+	QCOMPARE(static_cast<int>(received.at(0).ts.tv_nsec), 1);
+	QCOMPARE(received.at(1).event_type, static_cast<int>(GPIOD_LINE_EVENT_FALLING_EDGE));
+	QCOMPARE(static_cast<int>(received.at(1).ts.tv_sec), 2);
+	QCOMPARE(static_cast<int>(received.at(1).ts.tv_nsec), 2);
+	QCOMPARE(received.at(2).event_type, static_cast<int>(GPIOD_LINE_EVENT_RISING_EDGE));
+	QCOMPARE(static_cast<int>(received.at(2).ts.tv_sec), 3);
+	QCOMPARE(static_cast<int>(received.at(2).ts.tv_nsec), 3);
+}
+
+void test_LineEventMonitor::drain()
+{
+	int received = 0;
+	int batches = 0;
+	int count = 2 * LineEventMonitor::MAX_BATCH_SIZE + 1;
+	Write(m_pipes[0][1], 0, GPIOEVENT_EVENT_RISING_EDGE, count);
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[0][0], & m_receiver, [& received, & batches](const LineEventMonitor::EventBatch & events) {
+		QVERIFY(events.count() <= LineEventMonitor::MAX_BATCH_SIZE);
+		received += events.count();
+		batches++;
+	}));
+
+	QTRY_COMPARE(received, count);
+	QCOMPARE(batches, 3);
+}
+
+void test_LineEventMonitor::multipleDescriptors()
+{
+	QVector<int> received(PIPE_COUNT);
+	for (int i = 0; i < PIPE_COUNT; i++)
+		QVERIFY(LineEventMonitor::Instance().watch(m_pipes[i][0], & m_receiver, [& received, i](const LineEventMonitor::EventBatch & events) {
+			received[i] += events.count();
+		}));
+	QCOMPARE(LineEventMonitor::Instance().watchedCount(), PIPE_COUNT);
+
+	for (int i = 0; i < PIPE_COUNT; i++)
+		Write(m_pipes[i][1], static_cast<quint64>(i), GPIOEVENT_EVENT_FALLING_EDGE, i + 1);
+
+	for (int i = 0; i < PIPE_COUNT; i++)
+		QTRY_COMPARE(received.at(i), i + 1);
+}
+
+void test_LineEventMonitor::unwatch()
+{
+	int received = 0;
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[0][0], & m_receiver, [& received](const LineEventMonitor::EventBatch & events) {
+		received += events.count();
+	}));
+	LineEventMonitor::Instance().unwatch(m_pipes[0][0]);
+	QCOMPARE(LineEventMonitor::Instance().watchedCount(), 0);
+
+	Write(m_pipes[0][1], 0, GPIOEVENT_EVENT_RISING_EDGE);
+	QTest::qWait(100);
+	QCOMPARE(received, 0);
+}
+
+void test_LineEventMonitor::hangup()
+{
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[0][0], & m_receiver, [](const LineEventMonitor::EventBatch &) {}));
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[1][0], & m_receiver, [](const LineEventMonitor::EventBatch &) {}));
+	QCOMPARE(LineEventMonitor::Instance().watchedCount(), 2);
+
+	// Descriptor, on which an error has occurred, is no longer watched.
+	close(m_pipes[0][1]);
+	m_pipes[0][1] = -1;
+	QTRY_COMPARE(LineEventMonitor::Instance().watchedCount(), 1);
+
+	// Other descriptors are not affected.
+	int received = 0;
+	QVERIFY(LineEventMonitor::Instance().watch(m_pipes[1][0], & m_receiver, [& received](const LineEventMonitor::EventBatch & events) {
+		received += events.count();
+	}));
+	Write(m_pipes[1][1], 0, GPIOEVENT_EVENT_RISING_EDGE);
+	QTRY_COMPARE(received, 1);
+}
+
+void test_LineEventMonitor::Write(int fd, quint64 timestamp, quint32 id, int count)
+{
+	QVector<gpioevent_data> data(count, gpioevent_data{timestamp, id});
+	QCOMPARE(write(fd, data.constData(), sizeof(gpioevent_data) * static_cast<std::size_t>(count)), static_cast<ssize_t>(sizeof(gpioevent_data) * static_cast<std::size_t>(count)));
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::gpio::test_LineEventMonitor)
+#include "test_LineEventMonitor.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,186 @@
+#include <cutehmi/gpio/Chip.hpp>
+#include <cutehmi/gpio/LineGroup.hpp>
+
+#include <QtTest/QtTest>
+
+#include <memory>
+
+namespace cutehmi {
+namespace gpio {
+
+/**
+ * Line group test. Instead of lines of a GPIO chip, test uses a bulk of fake lines, which are never requested.
+ */
+class test_LineGroup:
+	public QObject
+{
+	Q_OBJECT
+
+	private slots:
+		void word();
+
+		void setValues();
+
+		void coalescing();
+
+		void detach();
+
+	private:
+		class MetaCallCounter:
+			public QObject
+		{
+			public:
+				int count = 0;
+
+			protected:
+				bool eventFilter(QObject * watched, QEvent * event) override
+				{
+					if (event->type() == QEvent::MetaCall)
+						count++;
+					return QObject::eventFilter(watched, event);
+				}
+		};
+
+		LineGroup * createGroup(int lineCount, QObject * parent = nullptr);
+
+		// Fake lines are distinct addresses, which are never dereferenced, because fake lines are never requested.
+		char m_fakeLines[LineGroup::MAX_LINES];
+};
+
+void test_LineGroup::word()
+{
+	std::unique_ptr<LineGroup> group(createGroup(4));
+	QCOMPARE(group->offsets(), QList<int>({0, 1, 2, 3}));
+	QCOMPARE(group->word(), Q_INT64_C(0));
+
+	// Value of the first line is stored in the least significant bit.
+	group->setWord(Q_INT64_C(0b1010));
+	QCOMPARE(group->values(), QList<int>({0, 1, 0, 1}));
+	QCOMPARE(group->word(), Q_INT64_C(0b1010));
+
+	// Bits, which do not correspond to any line, are ignored.
+	group->setWord(Q_INT64_C(0b110011));
+	QCOMPARE(group->values(), QList<int>({1, 1, 0, 0}));
+	QCOMPARE(group->word(), Q_INT64_C(0b0011));
+
+	group->setValue(3, 1);
+	QCOMPARE(group->word(), Q_INT64_C(0b1011));
+
+	std::unique_ptr<LineGroup> wideGroup(createGroup(LineGroup::MAX_LINES));
+	wideGroup->setValue(LineGroup::MAX_LINES - 1, 1);
+	QCOMPARE(static_cast<quint64>(wideGroup->word()), Q_UINT64_C(1) << (LineGroup::MAX_LINES - 1));
+}
+
+void test_LineGroup::setValues()
+{
+	std::unique_ptr<LineGroup> group(createGroup(3));
+	QSignalSpy valuesSpy(group.get(), & LineGroup::valuesChanged);
+
+	// Non-zero values are treated as active.
+	group->setValues({5, 0, -1});
+	QCOMPARE(group->values(), QList<int>({1, 0, 1}));
+	QCOMPARE(valuesSpy.count(), 1);
+
+	// Setting the same values does not emit a signal.
+	group->setValues({1, 0, 1});
+	group->setValue(0, 1);
+	QCOMPARE(valuesSpy.count(), 1);
+
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Number of values \\(2\\) does not match number of lines \\(3\\)"));
+	group->setValues({0, 1});
+	QCOMPARE(group->values(), QList<int>({0, 1, 1}));
+	QCOMPARE(valuesSpy.count(), 2);
+
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Line index \\(3\\) out of range"));
+	group->setValue(3, 1);
+	QCOMPARE(valuesSpy.count(), 2);
+}
+
+void test_LineGroup::coalescing()
+{
+	std::unique_ptr<LineGroup> group(createGroup(4));
+	MetaCallCounter counter;
+	group->installEventFilter(& counter);
+
+	// Changes made within the same event loop iteration are written with a single flush.
+	group->setValue(0, 1);
+	group->setValue(1, 1);
+	group->setValues({1, 1, 1, 0});
+	group->setWord(Q_INT64_C(0b1111));
+	QVERIFY(group->m->flushPending);
+	QCoreApplication::sendPostedEvents(group.get(), QEvent::MetaCall);
+	QCOMPARE(counter.count, 1);
+	QVERIFY(!group->m->flushPending);
+
+	// Unchanged values do not schedule a flush.
+	group->setWord(Q_INT64_C(0b1111));
+	QVERIFY(!group->m->flushPending);
+
+	// Flush can be done immediately, in which case queued flush has nothing to write.
+	group->setValue(0, 0);
+	group->flush();
+	QVERIFY(!group->m->flushPending);
+	QCoreApplication::sendPostedEvents(group.get(), QEvent::MetaCall);
+	QCOMPARE(counter.count, 2);
+
+	// Next change schedules a new flush.
+	group->setValue(0, 1);
+	QVERIFY(group->m->flushPending);
+	QCoreApplication::sendPostedEvents(group.get(), QEvent::MetaCall);
+	QCOMPARE(counter.count, 3);
+}
+
+void test_LineGroup::detach()
+{
+	Chip chip;
+	QPointer<LineGroup> group = createGroup(2, & chip);
+	QPointer<LineGroup> destroyedGroup = createGroup(2, & chip);
+	chip.m->lineGroups.append(group);
+	chip.m->lineGroups.append(destroyedGroup);
+	delete destroyedGroup;
+
+	chip.close();
+	QVERIFY(chip.m->lineGroups.isEmpty());
+	QVERIFY(!group.isNull());
+	QCOMPARE(gpiod_line_bulk_num_lines(& group->m->bulk), 0u);
+	QVERIFY(!group->requested());
+
+	// Detached group can not request lines.
+	LineConfig config;
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Line group has been detached from its chip"));
+	group->setConfig(& config);
+	QVERIFY(!group->requested());
+
+	// Group is destroyed, once the control returns to the event loop.
+	QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+	QVERIFY(group.isNull());
+}
+
+LineGroup * test_LineGroup::createGroup(int lineCount, QObject * parent)
+{
+	QList<int> offsets;
+	gpiod_line_bulk bulk;
+	gpiod_line_bulk_init(& bulk);
+	for (int i = 0; i < lineCount; i++) {
+		offsets.append(i);
+		gpiod_line_bulk_add(& bulk, reinterpret_cast<gpiod_line *>(& m_fakeLines[i]));
+	}
+	return new LineGroup(offsets, bulk, parent);
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::gpio::test_LineGroup)
+#include "test_LineGroup.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -85,6 +85,7 @@ Item {
 
 				onClicked: {
 					lockItem.passwordInput.reset()
+					pendingSecret.reset()
 					root.state = root.initialState
 					rejected()
 				}
@@ -108,6 +109,8 @@ Item {
 
 				text: qsTr("Next")
 
+				enabled: !lockItem.gatekeeper.busy
+
 				onClicked: lockItem.passwordInput.accept()
 			}
 		}
@@ -128,6 +131,28 @@ Item {
 		value: lockItemPlaceholder
 	}
 
+	QtObject {
+		id: pendingSecret
+
+		property var secret: null
+
+		property bool confirmed: false
+
+		function reset() {
+			secret = null
+			confirmed = false
+		}
+
+		// Secret is applied once it has been made and the password has been retyped correctly, whichever comes last.
+		function apply() {
+			if (secret !== null && confirmed) {
+				root.lockItem.secret = secret
+				reset()
+				passwordChangedDialog.open()
+			}
+		}
+	}
+
 	Connections {
 		target: lockItem.passwordInput
 
@@ -135,24 +160,42 @@ Item {
 
 		function onAccepted() {
 			if (root.state === "OLD_PASSWORD") {
-				if (root.lockItem.gatekeeper.authenticate())
-					root.state = "NEW_PASSWORD"
+				if (!root.lockItem.gatekeeper.busy)
+					root.lockItem.gatekeeper.authenticateAsync()
 			} else if (root.state === "NEW_PASSWORD") {
 				newPassword = root.lockItem.passwordInput.text
-				if (newPassword !== "")
-					root.lockItem.secret = root.lockItem.gatekeeper.makeSecret(newPassword)
 				root.lockItem.passwordInput.reset()
-				root.state = "RETYPE_PASSWORD"
+				// Input is rejected, while gatekeeper is busy, so that wizard does not advance without a secret being made.
+				if (newPassword !== "" && !root.lockItem.gatekeeper.busy) {
+					pendingSecret.reset()
+					root.lockItem.gatekeeper.makeSecretAsync(newPassword)
+					root.state = "RETYPE_PASSWORD"
+				}
 			} else if (root.state === "RETYPE_PASSWORD") {
-				if (newPassword === root.lockItem.passwordInput.text)
-					passwordChangedDialog.open()
-				else
+				if (newPassword === root.lockItem.passwordInput.text) {
+					pendingSecret.confirmed = true
+					pendingSecret.apply()
+				} else
 					passwordMismatchDialog.open()
 				root.lockItem.passwordInput.reset()
 			}
 		}
 	}
 
+	Connections {
+		target: root.lockItem.gatekeeper
+
+		function onAuthenticated(result) {
+			if (result && root.state === "OLD_PASSWORD")
+				root.state = "NEW_PASSWORD"
+		}
+
+		function onSecretMade(secret) {
+			pendingSecret.secret = secret
+			pendingSecret.apply()
+		}
+	}
+
 	Dialog {
 		id: passwordChangedDialog
 
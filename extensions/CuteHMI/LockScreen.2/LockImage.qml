@@ -75,7 +75,16 @@ LockItem {
 		target: root.passwordInput
 
 		function onAccepted() {
-			if (!root.gatekeeper.authenticate())
+			if (!root.gatekeeper.busy)
+				root.gatekeeper.authenticateAsync()
+		}
+	}
+
+	Connections {
+		target: root.gatekeeper
+
+		function onAuthenticated(result) {
+			if (!result)
 				root.wrongPasswordAnimation.restart()
 		}
 	}
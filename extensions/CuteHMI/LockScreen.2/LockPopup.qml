@@ -20,7 +20,16 @@ Popup {
 		target: root.lockItem.passwordInput
 
 		function onAccepted() {
-			if (root.lockItem.gatekeeper.authenticate())
+			if (!root.lockItem.gatekeeper.busy)
+				root.lockItem.gatekeeper.authenticateAsync()
+		}
+	}
+
+	Connections {
+		target: root.lockItem.gatekeeper
+
+		function onAuthenticated(result) {
+			if (result)
 				root.close()
 		}
 	}
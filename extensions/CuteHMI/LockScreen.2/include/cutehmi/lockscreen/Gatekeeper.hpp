@@ -6,6 +6,9 @@
 #include <cutehmi/Singleton.hpp>
 
 #include <QQmlEngine>
+#include <QThread>
+
+#include <functional>
 
 namespace cutehmi {
 namespace lockscreen {
@@ -30,8 +33,12 @@ class CUTEHMI_LOCKSCREEN_API Gatekeeper:
 
 		Q_PROPERTY(QByteArray secret READ secret WRITE setSecret NOTIFY secretChanged)
 
+		Q_PROPERTY(bool busy READ busy NOTIFY busyChanged)
+
 		explicit Gatekeeper(QObject * parent = nullptr);
 
+		~Gatekeeper() override;
+
 		int hashesLow() const;
 
 		void setHashesLow(int low);
@@ -48,10 +55,31 @@ class CUTEHMI_LOCKSCREEN_API Gatekeeper:
 
 		void setSecret(const QByteArray & secret);
 
+		/**
+		 * Check whether asynchronous operation is in progress.
+		 * @return @p true if asynchronous authentication or making of a secret is in progress, @p false otherwise.
+		 */
+		bool busy() const;
+
 		Q_INVOKABLE virtual bool authenticate() const;
 
+		/**
+		 * Authenticate asynchronously. Unlike authenticate() this function does not block the caller. Hashes are computed in a worker
+		 * thread and the result is announced with authenticated() signal. Password, secret and numbers of hashes are captured at the
+		 * time of the call. Call is ignored if previous asynchronous operation is still in progress.
+		 */
+		Q_INVOKABLE virtual void authenticateAsync();
+
 		Q_INVOKABLE virtual QByteArray makeSecret(const QString & password);
 
+		/**
+		 * Make secret asynchronously. Unlike makeSecret() this function does not block the caller. Hashes are computed in a worker
+		 * thread, just like in case of authenticateAsync(), and the result is announced with secretMade() signal. Call is ignored if
+		 * previous asynchronous operation is still in progress.
+		 * @param password password.
+		 */
+		Q_INVOKABLE virtual void makeSecretAsync(const QString & password);
+
 	signals:
 		void hashesLowChanged();
 
@@ -61,17 +89,62 @@ class CUTEHMI_LOCKSCREEN_API Gatekeeper:
 
 		void secretChanged();
 
+		void busyChanged();
+
+		/**
+		 * Authentication finished. This signal is emitted when authentication requested with authenticateAsync() finishes.
+		 * @param result result of authentication.
+		 */
+		void authenticated(bool result);
+
+		/**
+		 * Secret has been made. This signal is emitted when making of a secret requested with makeSecretAsync() finishes.
+		 * @param secret secret.
+		 */
+		void secretMade(const QByteArray & secret);
+
 	protected:
 		static QByteArray Hash(const QString & string);
 
+		/**
+		 * Verify password. Function produces the same chain of hashes as repeated calls to Hash() function, but hashes are computed
+		 * on preallocated buffers without string conversions. Computation is aborted if interruption of current thread has been
+		 * requested.
+		 * @param password password.
+		 * @param secret secret.
+		 * @param hashesLow lower bound of number of hashes.
+		 * @param hashesHigh upper bound of number of hashes.
+		 * @return @p true if chain of hashes of @a password reaches @a secret within given bounds, @p false otherwise.
+		 */
+		static bool Verify(const QString & password, const QByteArray & secret, int hashesLow, int hashesHigh);
+
+		/**
+		 * Derive secret. Computation is aborted if interruption of current thread has been requested.
+		 * @param password password.
+		 * @param hashes number of hashes.
+		 * @return result of hashing @a password @a hashes times or empty array if computation has been aborted.
+		 */
+		static QByteArray Derive(const QString & password, int hashes);
+
 		int pickNumberOfHashes() const;
 
 	private:
+		void startWorker(std::function<void()> work, void (Gatekeeper::*finish)());
+
+		void finishAuthentication();
+
+		void finishMakingSecret();
+
+		void releaseWorker();
+
 		struct Members {
 			int hashesMin;
 			int hashesMax;
 			QString password;
 			QByteArray secret;
+			QThread * worker = nullptr;
+			bool result = false;
+			QByteArray madeSecret;
 		};
 		MPtr<Members> m;
 };
@@ -8,6 +8,81 @@
 namespace cutehmi {
 namespace lockscreen {
 
+namespace {
+
+/**
+ * Chain of SHA3-512 hashes. To stay compatible with secrets produced by Gatekeeper::Hash(), each hash is computed from hexadecimal
+ * representation of the previous one. Representation is kept in a fixed buffer, so iterations do not involve string conversions.
+ */
+class HashChain
+{
+	public:
+		static constexpr int DIGEST_SIZE = 64;
+
+		static constexpr int HEX_SIZE = 2 * DIGEST_SIZE;
+
+		explicit HashChain(const QString & password):
+			m_hash(QCryptographicHash::Sha3_512)
+		{
+			QByteArray utf8 = password.toUtf8();
+			step(utf8.constData(), utf8.size());
+		}
+
+		void next()
+		{
+			step(m_hex, HEX_SIZE);
+		}
+
+		bool equals(const QByteArray & secret) const
+		{
+			if (secret.size() != HEX_SIZE)
+				return false;
+
+			// Compare whole buffers to avoid leaking position of the first difference.
+			unsigned char difference = 0;
+			for (int i = 0; i < HEX_SIZE; i++)
+				difference |= static_cast<unsigned char>(secret.at(i) ^ m_hex[i]);
+			return difference == 0;
+		}
+
+		QByteArray toByteArray() const
+		{
+			return QByteArray(m_hex, HEX_SIZE);
+		}
+
+	private:
+		void step(const char * data, int size)
+		{
+			static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+			m_hash.reset();
+#if (QT_VERSION >= QT_VERSION_CHECK(6, 3, 0))
+			m_hash.addData(QByteArrayView(data, size));
+			QByteArrayView digest = m_hash.resultView();
+#else
+			// Qt 5 does not provide a view on the digest, so result() allocates a new buffer after each reset().
+			m_hash.addData(data, size);
+			QByteArray digest = m_hash.result();
+#endif
+			for (int i = 0; i < DIGEST_SIZE; i++) {
+				unsigned char byte = static_cast<unsigned char>(digest.at(i));
+				m_hex[2 * i] = HEX_DIGITS[byte >> 4];
+				m_hex[2 * i + 1] = HEX_DIGITS[byte & 0x0F];
+			}
+		}
+
+		QCryptographicHash m_hash;
+		char m_hex[HEX_SIZE];
+};
+
+constexpr int HashChain::DIGEST_SIZE;
+constexpr int HashChain::HEX_SIZE;
+
+// Interruption is checked periodically to keep the cost of the check negligible.
+constexpr int INTERRUPTION_CHECK_INTERVAL = 256;
+
+}
+
 constexpr int Gatekeeper::INITIAL_HASHES_MIN;
 constexpr int Gatekeeper::INITIAL_HASHES_MAX;
 
@@ -21,6 +96,15 @@ Gatekeeper::Gatekeeper(QObject * parent):
 {
 }
 
+Gatekeeper::~Gatekeeper()
+{
+	if (m->worker) {
+		m->worker->requestInterruption();
+		m->worker->wait();
+		delete m->worker;
+	}
+}
+
 int Gatekeeper::hashesLow() const
 {
 	return m->hashesMin;
@@ -83,34 +167,58 @@ void Gatekeeper::setSecret(const QByteArray & secret)
 	}
 }
 
+bool Gatekeeper::busy() const
+{
+	return m->worker != nullptr;
+}
+
 bool Gatekeeper::authenticate() const
 {
 	if (secret().isEmpty())
 		return true;
 
-	QByteArray hash = Hash(password());
+	return Verify(password(), secret(), m->hashesMin, m->hashesMax);
+}
 
-	for (int i = 1; i < m->hashesMin; ++i) {
-		hash = Hash(hash);
+void Gatekeeper::authenticateAsync()
+{
+	if (busy()) {
+		CUTEHMI_WARNING("Authentication is already in progress.");
+		return;
 	}
 
-	for (int i = m->hashesMin; i <= m->hashesMax; ++i) {
-		if (hash == secret())
-			return true;
-		hash = Hash(hash);
+	if (secret().isEmpty()) {
+		emit authenticated(true);
+		return;
 	}
 
-	return false;
+	QString password = m->password;
+	QByteArray secret = m->secret;
+	int hashesLow = m->hashesMin;
+	int hashesHigh = m->hashesMax;
+	bool * result = & m->result;
+	startWorker([password, secret, hashesLow, hashesHigh, result]() {
+		*result = Verify(password, secret, hashesLow, hashesHigh);
+	}, & Gatekeeper::finishAuthentication);
 }
 
 QByteArray Gatekeeper::makeSecret(const QString & password)
 {
-	QByteArray hash = Hash(password);
+	return Derive(password, pickNumberOfHashes());
+}
 
-	for (int i = 1; i < pickNumberOfHashes(); ++i)
-		hash = Hash(hash);
+void Gatekeeper::makeSecretAsync(const QString & password)
+{
+	if (busy()) {
+		CUTEHMI_WARNING("Can not make secret, while another operation is in progress.");
+		return;
+	}
 
-	return hash;
+	int hashes = pickNumberOfHashes();
+	QByteArray * secret = & m->madeSecret;
+	startWorker([password, hashes, secret]() {
+		*secret = Derive(password, hashes);
+	}, & Gatekeeper::finishMakingSecret);
 }
 
 QByteArray Gatekeeper::Hash(const QString & string)
@@ -118,11 +226,76 @@ QByteArray Gatekeeper::Hash(const QString & string)
 	return QCryptographicHash::hash(string.toUtf8(), QCryptographicHash::Sha3_512).toHex();
 }
 
+bool Gatekeeper::Verify(const QString & password, const QByteArray & secret, int hashesLow, int hashesHigh)
+{
+	HashChain chain(password);
+
+	for (int i = 1; i < hashesLow; ++i) {
+		if (i % INTERRUPTION_CHECK_INTERVAL == 0 && QThread::currentThread()->isInterruptionRequested())
+			return false;
+		chain.next();
+	}
+
+	for (int i = hashesLow; i <= hashesHigh; ++i) {
+		if (chain.equals(secret))
+			return true;
+		if (i % INTERRUPTION_CHECK_INTERVAL == 0 && QThread::currentThread()->isInterruptionRequested())
+			return false;
+		chain.next();
+	}
+
+	return false;
+}
+
+QByteArray Gatekeeper::Derive(const QString & password, int hashes)
+{
+	HashChain chain(password);
+
+	for (int i = 1; i < hashes; ++i) {
+		if (i % INTERRUPTION_CHECK_INTERVAL == 0 && QThread::currentThread()->isInterruptionRequested())
+			return QByteArray();
+		chain.next();
+	}
+
+	return chain.toByteArray();
+}
+
 int Gatekeeper::pickNumberOfHashes() const
 {
 	return static_cast<int>(QRandomGenerator::global()->bounded(static_cast<unsigned int>(hashesLow()), static_cast<unsigned int>(hashesHigh()) + 1));
 }
 
+void Gatekeeper::startWorker(std::function<void()> work, void (Gatekeeper::*finish)())
+{
+	m->worker = QThread::create(work);
+	// Signal finished() is emitted from the worker thread, so it is delivered to gatekeeper through queued connection.
+	connect(m->worker, & QThread::finished, this, finish);
+	m->worker->start();
+	emit busyChanged();
+}
+
+void Gatekeeper::finishAuthentication()
+{
+	bool result = m->result;
+	releaseWorker();
+	emit authenticated(result);
+}
+
+void Gatekeeper::finishMakingSecret()
+{
+	QByteArray secret = m->madeSecret;
+	m->madeSecret.clear();
+	releaseWorker();
+	emit secretMade(secret);
+}
+
+void Gatekeeper::releaseWorker()
+{
+	m->worker->deleteLater();
+	m->worker = nullptr;
+	emit busyChanged();
+}
+
 }
 }
 
@@ -0,0 +1,129 @@
+#include <cutehmi/lockscreen/Gatekeeper.hpp>
+
+#include <cutehmi/test/bench.hpp>
+
+#include <QtTest/QtTest>
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+namespace cutehmi {
+namespace lockscreen {
+
+/**
+ * Benchmark of Gatekeeper key derivation. Benchmark measures time needed to compute a chain of hashes with string conversions in
+ * each iteration (Gatekeeper::Hash()) and on raw buffers (Gatekeeper::Derive()). Based on the latter it suggests @p hashesLow and
+ * @p hashesHigh, which fit within given latency budget on the machine, on which benchmark is run. Note that authentication takes at
+ * most @p hashesHigh hashes.
+ *
+ * Benchmark is configured with environment variables:
+ * - @p CUTEHMI_LOCKSCREEN_BENCH_HASHES - number of hashes to compute (default 10000).
+ * - @p CUTEHMI_LOCKSCREEN_BENCH_BUDGET_MS - latency budget of authentication in milliseconds (default 250).
+ * - @p CUTEHMI_LOCKSCREEN_BENCH_OUTPUT - path to a file, to which results are appended. If not set, results are printed to
+ *   standard output.
+ *
+ * Each case yields a single line of JSON (JSON Lines format).
+ */
+class bench_Gatekeeper:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void derivation_data();
+
+		void derivation();
+
+		void budget();
+
+	private:
+		class BenchGatekeeper:
+			public Gatekeeper
+		{
+			public:
+				using Gatekeeper::Hash;
+
+				using Gatekeeper::Derive;
+		};
+
+		static int PositiveIntEnv(const char * name, int defaultValue);
+
+		static qint64 MeasureDerivation(const QString & engine, const QString & password, int hashes);
+};
+
+void bench_Gatekeeper::derivation_data()
+{
+	QTest::addColumn<QString>("engine");
+
+	QTest::newRow("string") << QString("string");
+	QTest::newRow("raw") << QString("raw");
+}
+
+void bench_Gatekeeper::derivation()
+{
+	QFETCH(QString, engine);
+
+	int hashes = PositiveIntEnv("CUTEHMI_LOCKSCREEN_BENCH_HASHES", 10000);
+	qint64 time = MeasureDerivation(engine, "password", hashes);
+
+	QJsonObject result;
+	result.insert("engine", engine);
+	result.insert("hashes", hashes);
+	result.insert("timeMs", time / 1e6);
+	result.insert("hashNs", static_cast<double>(time) / hashes);
+	test::report(result, "CUTEHMI_LOCKSCREEN_BENCH_OUTPUT");
+}
+
+void bench_Gatekeeper::budget()
+{
+	int hashes = PositiveIntEnv("CUTEHMI_LOCKSCREEN_BENCH_HASHES", 10000);
+	int budget = PositiveIntEnv("CUTEHMI_LOCKSCREEN_BENCH_BUDGET_MS", 250);
+	double hashNs = static_cast<double>(MeasureDerivation("raw", "password", hashes)) / hashes;
+	QVERIFY(hashNs > 0.0);
+
+	// Keep the same proportion between bounds as initial values do.
+	int hashesHigh = qMax(1, static_cast<int>(budget * 1e6 / hashNs));
+	int hashesLow = qMax(1, static_cast<int>(static_cast<qint64>(hashesHigh) * Gatekeeper::INITIAL_HASHES_MIN / Gatekeeper::INITIAL_HASHES_MAX));
+
+	QJsonObject result;
+	result.insert("budgetMs", budget);
+	result.insert("hashNs", hashNs);
+	result.insert("hashesLow", hashesLow);
+	result.insert("hashesHigh", hashesHigh);
+	test::report(result, "CUTEHMI_LOCKSCREEN_BENCH_OUTPUT");
+}
+
+int bench_Gatekeeper::PositiveIntEnv(const char * name, int defaultValue)
+{
+	int result = test::intEnv(name, defaultValue);
+	return result > 0 ? result : defaultValue;
+}
+
+qint64 bench_Gatekeeper::MeasureDerivation(const QString & engine, const QString & password, int hashes)
+{
+	QElapsedTimer timer;
+	timer.start();
+	if (engine == "string") {
+		QByteArray hash = BenchGatekeeper::Hash(password);
+		for (int i = 1; i < hashes; ++i)
+			hash = BenchGatekeeper::Hash(hash);
+	} else
+		BenchGatekeeper::Derive(password, hashes);
+	return timer.nsecsElapsed();
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::lockscreen::bench_Gatekeeper)
+#include "bench_Gatekeeper.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
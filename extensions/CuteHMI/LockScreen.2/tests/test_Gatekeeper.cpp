@@ -19,6 +19,12 @@ class test_Gatekeeper:
 
 		void authenticate();
 
+		void derive();
+
+		void authenticateAsync();
+
+		void makeSecretAsync();
+
 	private:
 		std::unique_ptr<Gatekeeper> m_gatekeeper;
 };
@@ -69,6 +75,90 @@ void test_Gatekeeper::authenticate()
 	QVERIFY(!m_gatekeeper->authenticate());
 }
 
+void test_Gatekeeper::derive()
+{
+	// Secrets must be compatible with the ones made by hashing strings.
+	QString password = cutehmi::test::rand<QString>();
+	int hashes = cutehmi::test::rand<int>(1, 100);
+
+	QByteArray hash = Gatekeeper::Hash(password);
+	for (int i = 1; i < hashes; ++i)
+		hash = Gatekeeper::Hash(hash);
+
+	QCOMPARE(Gatekeeper::Derive(password, hashes), hash);
+}
+
+void test_Gatekeeper::authenticateAsync()
+{
+	int low = cutehmi::test::rand<int>(1000, 10000);
+	int high = cutehmi::test::rand<int>(low, 10000);
+
+	m_gatekeeper->setHashesLow(low);
+	m_gatekeeper->setHashesHigh(high);
+
+	QString password = cutehmi::test::rand<QString>();
+	m_gatekeeper->setSecret(m_gatekeeper->makeSecret(password));
+
+	QSignalSpy authenticatedSpy(m_gatekeeper.get(), & Gatekeeper::authenticated);
+
+	m_gatekeeper->setPassword(password);
+	m_gatekeeper->authenticateAsync();
+	QVERIFY(m_gatekeeper->busy());
+	QVERIFY(authenticatedSpy.wait());
+	QVERIFY(!m_gatekeeper->busy());
+	QCOMPARE(authenticatedSpy.count(), 1);
+	QCOMPARE(authenticatedSpy.takeFirst().at(0).toBool(), true);
+
+	// Get rid of improbable, but possible collision.
+	do {
+		password = cutehmi::test::rand<QString>();
+	} while (m_gatekeeper->makeSecret(password) == m_gatekeeper->secret());
+	m_gatekeeper->setPassword(password);
+	m_gatekeeper->authenticateAsync();
+	QVERIFY(authenticatedSpy.wait());
+	QCOMPARE(authenticatedSpy.takeFirst().at(0).toBool(), false);
+
+	// Destroying gatekeeper should interrupt the worker.
+	std::unique_ptr<Gatekeeper> gatekeeper = std::make_unique<Gatekeeper>();
+	gatekeeper->setHashesLow(1000000);
+	gatekeeper->setHashesHigh(1000000);
+	gatekeeper->setSecret(m_gatekeeper->secret());
+	gatekeeper->authenticateAsync();
+	QVERIFY(gatekeeper->busy());
+	gatekeeper.reset();
+}
+
+void test_Gatekeeper::makeSecretAsync()
+{
+	int low = cutehmi::test::rand<int>(1000, 10000);
+	int high = cutehmi::test::rand<int>(low, 10000);
+
+	m_gatekeeper->setHashesLow(low);
+	m_gatekeeper->setHashesHigh(high);
+
+	QSignalSpy secretMadeSpy(m_gatekeeper.get(), & Gatekeeper::secretMade);
+
+	QString password = cutehmi::test::rand<QString>();
+	m_gatekeeper->makeSecretAsync(password);
+	QVERIFY(m_gatekeeper->busy());
+	QVERIFY(secretMadeSpy.wait());
+	QVERIFY(!m_gatekeeper->busy());
+	QCOMPARE(secretMadeSpy.count(), 1);
+
+	// Secret made asynchronously must authenticate the password.
+	m_gatekeeper->setSecret(secretMadeSpy.takeFirst().at(0).toByteArray());
+	m_gatekeeper->setPassword(password);
+	QVERIFY(m_gatekeeper->authenticate());
+
+	// Destroying gatekeeper should interrupt the worker.
+	std::unique_ptr<Gatekeeper> gatekeeper = std::make_unique<Gatekeeper>();
+	gatekeeper->setHashesLow(1000000);
+	gatekeeper->setHashesHigh(1000000);
+	gatekeeper->makeSecretAsync(password);
+	QVERIFY(gatekeeper->busy());
+	gatekeeper.reset();
+}
+
 }
 }
 
@@ -8,6 +8,7 @@
 #include <QQmlEngine>
 #include <QQueue>
 #include <QTimer>
+#include <QElapsedTimer>
 
 namespace cutehmi {
 namespace modbus {
@@ -70,6 +71,26 @@ class CUTEHMI_MODBUS_API AbstractClient:
 		 */
 		Q_PROPERTY(int timeout READ timeout WRITE setTimeout NOTIFY timeoutChanged STORED false)
 
+		/**
+		 * Smoothed round-trip time [ms]. Value is an exponentially weighted moving average of measured times between sending a
+		 * request and receiving a response. Value is 0 until first response arrives or if client does not measure round-trip times.
+		 * Value is reset when client connects or disconnects.
+		 */
+		Q_PROPERTY(int roundTripTime READ roundTripTime NOTIFY roundTripTimeChanged)
+
+		/**
+		 * Whether slave is responding. Client considers slave not responding after several consecutive requests have timed out.
+		 * Client may then limit requests sent to the slave. Slave is considered responding again when client connects or
+		 * disconnects. Requests, which have timed out, do not make client broken.
+		 */
+		Q_PROPERTY(bool responding READ responding NOTIFY respondingChanged)
+
+		/**
+		 * Capture file. If set, requests and replies exchanged with the slave are recorded to the file, so that they can be replayed
+		 * later with ReplayClient. Existing file is truncated. Empty string stops capturing.
+		 */
+		Q_PROPERTY(QString captureFile READ captureFile WRITE setCaptureFile NOTIFY captureFileChanged)
+
 		int pollingInterval() const;
 
 		void setPollingInterval(int interval);
@@ -86,6 +107,14 @@ class CUTEHMI_MODBUS_API AbstractClient:
 
 		virtual void setTimeout(int timeout) = 0;
 
+		int roundTripTime() const;
+
+		bool responding() const;
+
+		QString captureFile() const;
+
+		void setCaptureFile(const QString & captureFile);
+
 		void configureStarting(QState * starting, AssignStatusFunction assignStatus) override;
 
 		void configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus) override;
@@ -117,6 +146,12 @@ class CUTEHMI_MODBUS_API AbstractClient:
 
 		void timeoutChanged();
 
+		void roundTripTimeChanged();
+
+		void respondingChanged();
+
+		void captureFileChanged();
+
 	protected:
 		AbstractClient(QObject * parent = nullptr);
 
@@ -131,9 +166,15 @@ class CUTEHMI_MODBUS_API AbstractClient:
 
 		void pollingTask();
 
+		void setRoundTripTime(int roundTripTime);
+
+		void setResponding(bool responding);
+
 	protected:
 		Q_SIGNAL void requestAccepted(QJsonObject request);
 
+		Q_SIGNAL void captureRequested(QString fileName);
+
 		Q_SIGNAL void pollingRequested();
 
 		Q_SIGNAL void pollingFinished();
@@ -154,7 +195,11 @@ class CUTEHMI_MODBUS_API AbstractClient:
 			int pollingTaskInterval;
 			int requestInterval;
 			qint64 lastProcessRequestTimestamp;
+			int roundTripTime;
+			bool responding;
+			QString captureFile;
 			QTimer requestDequeueTimer;
+			QElapsedTimer pollingCycleTimer;
 			RequestQueueContainer requestQueue;
 
 			Members(AbstractDevice * device):
@@ -162,7 +207,9 @@ class CUTEHMI_MODBUS_API AbstractClient:
 				pollingInterval(INITIAL_POLLING_INTERVAL),
 				pollingTaskInterval(INITIAL_POLLING_TASK_INTERVAL),
 				requestInterval(INITIAL_REQUEST_INTERVAL),
-				lastProcessRequestTimestamp(0)
+				lastProcessRequestTimestamp(0),
+				roundTripTime(0),
+				responding(true)
 			{
 			}
 		};
@@ -8,6 +8,7 @@
 #include "internal/InputRegister.hpp"
 #include "DiscreteInput.hpp"
 #include "Coil.hpp"
+#include "DeviceStatistics.hpp"
 
 #include <cutehmi/InplaceError.hpp>
 #include <cutehmi/services/Serviceable.hpp>
@@ -218,6 +219,11 @@ class CUTEHMI_MODBUS_API AbstractDevice:
 
 		Q_PROPERTY(int maxRequests READ maxRequests WRITE setMaxRequests NOTIFY maxRequestsChanged)
 
+		/**
+		 * Performance counters of the device.
+		 */
+		Q_PROPERTY(cutehmi::modbus::DeviceStatistics * statistics READ statistics CONSTANT)
+
 		State state() const;
 
 		/**
@@ -262,6 +268,8 @@ class CUTEHMI_MODBUS_API AbstractDevice:
 
 		void setMaxRequests(int maxRequests);
 
+		DeviceStatistics * statistics() const;
+
 		Coil * coilAt(quint16 address);
 
 		DiscreteInput * discreteInputAt(quint16 address);
@@ -660,6 +668,8 @@ class CUTEHMI_MODBUS_API AbstractDevice:
 
 		static void ValidateObjectArrayKey(const QJsonObject & json, const QString & key, const QString & path = "", std::function<void(const QJsonObject & json, const QString & path)> filter = nullptr);
 
+		static void ValidateSpanKey(const QJsonObject & json);
+
 		static void ValidateReadFileRecordSubresponsesKey(const QJsonObject & json, const QString & path = "");
 
 		static void ValidateWriteFileRecordSubresponsesKey(const QJsonObject & json, const QString & path = "");
@@ -686,8 +696,9 @@ class CUTEHMI_MODBUS_API AbstractDevice:
 			DiscreteInputDataContainer discreteInputs;
 			CoilDataContainer coils;
 			PendingRequestsContainer pendingRequests;
+			DeviceStatistics * statistics;
 
-			Members():
+			Members(AbstractDevice * p_device):
 				state(INITIAL_STATE),
 				ready(INITIAL_READY),
 				maxReadCoils(INITIAL_MAX_READ_COILS),
@@ -698,7 +709,8 @@ class CUTEHMI_MODBUS_API AbstractDevice:
 				maxWriteHoldingRegisters(INITIAL_MAX_WRITE_HOLDING_REGISTERS),
 				maxReadInputRegisters(INITIAL_MAX_READ_INPUT_REGISTERS),
 				maxWriteInputRegisters(INITIAL_MAX_WRITE_INPUT_REGISTERS),
-				maxRequests(INITIAL_MAX_REQUESTS)
+				maxRequests(INITIAL_MAX_REQUESTS),
+				statistics(new DeviceStatistics(p_device))
 			{
 			}
 		};
@@ -0,0 +1,281 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_DEVICESTATISTICS_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_DEVICESTATISTICS_HPP
+
+#include "internal/common.hpp"
+
+#include <QObject>
+#include <QJsonObject>
+#include <QHash>
+#include <QTimer>
+#include <QQmlEngine>
+
+#include <array>
+
+namespace cutehmi {
+namespace modbus {
+
+/**
+ * Device statistics. Performance counters of a Modbus device.
+ *
+ * Statistics are collected by the device, which owns the object. Each request and reply is counted globally and per function
+ * code. Round-trip times (time between issuing a request and handling its reply, including time spent in the queues) are collected
+ * in a histogram with fixed buckets, from which percentiles are estimated. Amount of bytes on the wire is estimated from the
+ * request and reply contents and covers protocol data units only, which means that transport specific framing (MBAP header, slave
+ * address, CRC) is not counted.
+ *
+ * To avoid flooding QML bindings, properties are not notified on each change. Instead @ref updated() signal is emitted at most
+ * once per @ref UPDATE_INTERVAL.
+ *
+ * Statistics can be periodically dumped to a file in OpenMetrics text format (see @ref metricsFile and @ref metricsInterval), so
+ * that they can be picked up by node exporter's textfile collector or a similar tool.
+ */
+class CUTEHMI_MODBUS_API DeviceStatistics:
+	public QObject
+{
+		Q_OBJECT
+		QML_NAMED_ELEMENT(DeviceStatistics)
+		QML_UNCREATABLE("DeviceStatistics can be accessed through AbstractDevice only")
+
+	public:
+		static constexpr int UPDATE_INTERVAL = 500;
+
+		static constexpr int INITIAL_METRICS_INTERVAL = 15000;
+
+		/**
+		 * Upper bounds of round-trip time histogram buckets [ms]. Last, implicit bucket holds all the remaining samples.
+		 */
+		static constexpr std::array<int, 14> ROUND_TRIP_TIME_BUCKETS = {{1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 30000}};
+
+		Q_PROPERTY(int requests READ requests NOTIFY updated)
+
+		Q_PROPERTY(int replies READ replies NOTIFY updated)
+
+		Q_PROPERTY(int errors READ errors NOTIFY updated)
+
+		Q_PROPERTY(int timeouts READ timeouts NOTIFY updated)
+
+		/**
+		 * Number of pending requests.
+		 */
+		Q_PROPERTY(int queueDepth READ queueDepth NOTIFY updated)
+
+		Q_PROPERTY(int maxQueueDepth READ maxQueueDepth NOTIFY updated)
+
+		/**
+		 * Median of round-trip time [ms].
+		 */
+		Q_PROPERTY(int roundTripTimeP50 READ roundTripTimeP50 NOTIFY updated)
+
+		/**
+		 * 95th percentile of round-trip time [ms].
+		 */
+		Q_PROPERTY(int roundTripTimeP95 READ roundTripTimeP95 NOTIFY updated)
+
+		/**
+		 * 99th percentile of round-trip time [ms].
+		 */
+		Q_PROPERTY(int roundTripTimeP99 READ roundTripTimeP99 NOTIFY updated)
+
+		Q_PROPERTY(qint64 bytesSent READ bytesSent NOTIFY updated)
+
+		Q_PROPERTY(qint64 bytesReceived READ bytesReceived NOTIFY updated)
+
+		/**
+		 * Duration of last complete polling cycle [ms].
+		 */
+		Q_PROPERTY(int pollingCycleDuration READ pollingCycleDuration NOTIFY updated)
+
+		Q_PROPERTY(int maxPollingCycleDuration READ maxPollingCycleDuration NOTIFY updated)
+
+		/**
+		 * Path to a file, to which statistics are dumped in OpenMetrics text format. If empty, statistics are not dumped.
+		 */
+		Q_PROPERTY(QString metricsFile READ metricsFile WRITE setMetricsFile NOTIFY metricsFileChanged)
+
+		/**
+		 * Interval between consecutive dumps of statistics [ms].
+		 */
+		Q_PROPERTY(int metricsInterval READ metricsInterval WRITE setMetricsInterval NOTIFY metricsIntervalChanged)
+
+		explicit DeviceStatistics(QObject * parent = nullptr);
+
+		int requests() const;
+
+		int replies() const;
+
+		int errors() const;
+
+		int timeouts() const;
+
+		int queueDepth() const;
+
+		int maxQueueDepth() const;
+
+		int roundTripTimeP50() const;
+
+		int roundTripTimeP95() const;
+
+		int roundTripTimeP99() const;
+
+		qint64 bytesSent() const;
+
+		qint64 bytesReceived() const;
+
+		int pollingCycleDuration() const;
+
+		int maxPollingCycleDuration() const;
+
+		QString metricsFile() const;
+
+		void setMetricsFile(const QString & metricsFile);
+
+		int metricsInterval() const;
+
+		void setMetricsInterval(int metricsInterval);
+
+		/**
+		 * Get number of requests issued with particular function code.
+		 * @param function function code (cutehmi::modbus::AbstractDevice::Function).
+		 * @return number of requests.
+		 */
+		Q_INVOKABLE int requestCount(int function) const;
+
+		/**
+		 * Get number of replies to requests with particular function code.
+		 * @param function function code (cutehmi::modbus::AbstractDevice::Function).
+		 * @return number of replies, including failed ones.
+		 */
+		Q_INVOKABLE int replyCount(int function) const;
+
+		/**
+		 * Get number of failed requests with particular function code.
+		 * @param function function code (cutehmi::modbus::AbstractDevice::Function).
+		 * @return number of failed requests, including timeouts.
+		 */
+		Q_INVOKABLE int errorCount(int function) const;
+
+		/**
+		 * Get number of timed out requests with particular function code.
+		 * @param function function code (cutehmi::modbus::AbstractDevice::Function).
+		 * @return number of timed out requests.
+		 */
+		Q_INVOKABLE int timeoutCount(int function) const;
+
+		/**
+		 * Estimate round-trip time percentile.
+		 * @param percentile percentile in range (0.0, 1.0].
+		 * @return estimated round-trip time [ms], which is not exceeded by @a percentile of samples. Estimation is done by linear
+		 * interpolation within a histogram bucket. If no samples have been collected, 0 is returned.
+		 */
+		Q_INVOKABLE int roundTripTimePercentile(qreal percentile) const;
+
+		/**
+		 * Format statistics as OpenMetrics text.
+		 * @return statistics in OpenMetrics text format.
+		 */
+		Q_INVOKABLE QString toOpenMetrics() const;
+
+		/**
+		 * Record request.
+		 * @param request request object.
+		 */
+		void recordRequest(const QJsonObject & request);
+
+		/**
+		 * Record reply.
+		 * @param request request object.
+		 * @param reply reply object. Reply is expected to contain @p elapsed key.
+		 */
+		void recordReply(const QJsonObject & request, const QJsonObject & reply);
+
+		/**
+		 * Record queue depth.
+		 * @param queueDepth current number of pending requests.
+		 */
+		void recordQueueDepth(int queueDepth);
+
+		/**
+		 * Record polling cycle.
+		 * @param duration duration of complete polling cycle [ms].
+		 */
+		void recordPollingCycle(int duration);
+
+	public slots:
+		/**
+		 * Reset statistics. All counters are set to zero.
+		 */
+		void reset();
+
+		/**
+		 * Write statistics to @ref metricsFile.
+		 * @return @p true on success, @p false otherwise.
+		 */
+		bool writeMetrics();
+
+	signals:
+		void updated();
+
+		void metricsFileChanged();
+
+		void metricsIntervalChanged();
+
+	private:
+		struct FunctionCounters
+		{
+			int requests = 0;
+			int replies = 0;
+			int errors = 0;
+			int timeouts = 0;
+		};
+
+		typedef QHash<int, FunctionCounters> FunctionCountersContainer;
+
+		typedef std::array<qint64, ROUND_TRIP_TIME_BUCKETS.size() + 1> RoundTripTimeHistogram;
+
+		static int RequestPduSize(int function, const QJsonObject & payload);
+
+		static int ReplyPduSize(int function, const QJsonObject & payload, const QJsonObject & reply);
+
+		static QString FunctionLabel(int function);
+
+		void scheduleUpdate();
+
+		struct Members
+		{
+			int requests = 0;
+			int replies = 0;
+			int errors = 0;
+			int timeouts = 0;
+			int queueDepth = 0;
+			int maxQueueDepth = 0;
+			qint64 bytesSent = 0;
+			qint64 bytesReceived = 0;
+			int pollingCycleDuration = 0;
+			int maxPollingCycleDuration = 0;
+			FunctionCountersContainer functionCounters;
+			RoundTripTimeHistogram roundTripTimeHistogram{};
+			qint64 roundTripTimeSum = 0;
+			int maxRoundTripTime = 0;
+			QString metricsFile;
+			QTimer updateTimer;
+			QTimer metricsTimer;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
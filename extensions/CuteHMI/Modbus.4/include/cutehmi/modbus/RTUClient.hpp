@@ -29,6 +29,8 @@ class CUTEHMI_MODBUS_API RTUClient:
 		static constexpr QSerialPort::StopBits INITIAL_STOP_BITS = internal::RTUClientConfig::INITIAL_STOP_BITS;
 		static constexpr int INITIAL_SLAVE_ADDRESS = internal::RTUClientConfig::INITIAL_SLAVE_ADDRESS;
 		static constexpr int INITIAL_TIMEOUT = internal::RTUClientConfig::INITIAL_TIMEOUT;
+		static constexpr bool INITIAL_ADAPTIVE_TIMEOUT = internal::RTUClientConfig::INITIAL_ADAPTIVE_TIMEOUT;
+		static constexpr int INITIAL_NUMBER_OF_RETRIES = internal::RTUClientConfig::INITIAL_NUMBER_OF_RETRIES;
 
 		Q_PROPERTY(QString port READ port WRITE setPort NOTIFY portChanged)
 		Q_PROPERTY(QSerialPort::Parity parity READ parity WRITE setParity NOTIFY parityChanged)
@@ -37,6 +39,18 @@ class CUTEHMI_MODBUS_API RTUClient:
 		Q_PROPERTY(QSerialPort::StopBits stopBits READ stopBits WRITE setStopBits NOTIFY stopBitsChanged)
 		Q_PROPERTY(int slaveAddress READ slaveAddress WRITE setSlaveAddress NOTIFY slaveAddressChanged)
 
+		/**
+		 * Adaptive timeout. If enabled, response timeout is derived from measured round-trip times and @ref timeout serves as its
+		 * upper bound.
+		 */
+		Q_PROPERTY(bool adaptiveTimeout READ adaptiveTimeout WRITE setAdaptiveTimeout NOTIFY adaptiveTimeoutChanged)
+
+		/**
+		 * Number of times a request is repeated if it times out. Requests sent to a slave, which is not @ref responding are not
+		 * repeated.
+		 */
+		Q_PROPERTY(int numberOfRetries READ numberOfRetries WRITE setNumberOfRetries NOTIFY numberOfRetriesChanged)
+
 		RTUClient(QObject * parent = nullptr);
 
 		~RTUClient() override;
@@ -69,6 +83,14 @@ class CUTEHMI_MODBUS_API RTUClient:
 
 		void setTimeout(int timeout) override;
 
+		bool adaptiveTimeout() const;
+
+		void setAdaptiveTimeout(bool adaptiveTimeout);
+
+		int numberOfRetries() const;
+
+		void setNumberOfRetries(int numberOfRetries);
+
 	public slots:
 		void open() override;
 
@@ -87,14 +109,21 @@ class CUTEHMI_MODBUS_API RTUClient:
 
 		void slaveAddressChanged();
 
+		void adaptiveTimeoutChanged();
+
+		void numberOfRetriesChanged();
+
 	private:
 		struct Members {
 			internal::RTUClientConfig config;
 			internal::QtRTUClientBackend backend;
 			QThread thread;
 
-			Members():
-				backend(& config)
+			Members(internal::QtRTUClientBackend::CoilDataContainer * coilData,
+					internal::QtRTUClientBackend::DiscreteInputDataContainer * discreteInputData,
+					internal::QtRTUClientBackend::HoldingRegisterDataContainer * holdingRegisterData,
+					internal::QtRTUClientBackend::InputRegisterDataContainer * inputRegisterData):
+				backend(& config, coilData, discreteInputData, holdingRegisterData, inputRegisterData)
 			{
 			}
 		};
@@ -0,0 +1,107 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_REPLAYCLIENT_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_REPLAYCLIENT_HPP
+
+#include "internal/common.hpp"
+#include "internal/ReplayClientConfig.hpp"
+#include "internal/ReplayClientBackend.hpp"
+#include "AbstractClient.hpp"
+
+#include <QThread>
+#include <QQmlEngine>
+
+namespace cutehmi {
+namespace modbus {
+
+/**
+ * Replay client. Replay client serves replies recorded by another client (see @ref AbstractClient::captureFile).
+ *
+ * Each request is matched against recorded requests by function code and payload and recorded reply is served. If the same request
+ * has been recorded multiple times, replies are served in recorded order and when they are exhausted, sequence starts over. Requests,
+ * which have not been recorded, fail.
+ *
+ * Replies are delayed by recorded round-trip times multiplied by @ref timeScale. If @ref timeScale is 0, replies are served as
+ * fast as possible. This allows to benchmark and profile client, register controllers and QML bindings against traffic recorded in
+ * production without access to a real device.
+ *
+ * Recorded intervals between requests are not reproduced. Requests are issued by the application (polling, register controllers)
+ * and their timing is exactly what is being measured, so replay can only stand in for the device and mimic how long it took to
+ * respond.
+ */
+class CUTEHMI_MODBUS_API ReplayClient:
+	public cutehmi::modbus::AbstractClient
+{
+		Q_OBJECT
+		QML_NAMED_ELEMENT(ReplayClient)
+
+	public:
+		static constexpr qreal INITIAL_TIME_SCALE = internal::ReplayClientConfig::INITIAL_TIME_SCALE;
+
+		/**
+		 * Capture file to replay. File is loaded, when client is opened.
+		 */
+		Q_PROPERTY(QString file READ file WRITE setFile NOTIFY fileChanged)
+
+		/**
+		 * Ratio of replay time to recorded time, by which replies are delayed. If 0, replies are served as fast as possible.
+		 */
+		Q_PROPERTY(qreal timeScale READ timeScale WRITE setTimeScale NOTIFY timeScaleChanged)
+
+		ReplayClient(QObject * parent = nullptr);
+
+		~ReplayClient() override;
+
+		QString file() const;
+
+		void setFile(const QString & file);
+
+		qreal timeScale() const;
+
+		void setTimeScale(qreal timeScale);
+
+		int timeout() const override;
+
+		void setTimeout(int timeout) override;
+
+	public slots:
+		void open() override;
+
+		void close() override;
+
+	signals:
+		void fileChanged();
+
+		void timeScaleChanged();
+
+	private:
+		struct Members {
+			internal::ReplayClientConfig config;
+			internal::ReplayClientBackend backend;
+			QThread thread;
+
+			Members(internal::ReplayClientBackend::CoilDataContainer * coilData,
+					internal::ReplayClientBackend::DiscreteInputDataContainer * discreteInputData,
+					internal::ReplayClientBackend::HoldingRegisterDataContainer * holdingRegisterData,
+					internal::ReplayClientBackend::InputRegisterDataContainer * inputRegisterData):
+				backend(& config, coilData, discreteInputData, holdingRegisterData, inputRegisterData)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,196 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_SIMULATORCLIENT_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_SIMULATORCLIENT_HPP
+
+#include "internal/common.hpp"
+#include "internal/SimulatorClientConfig.hpp"
+#include "internal/SimulatorClientBackend.hpp"
+#include "AbstractClient.hpp"
+
+#include <QThread>
+#include <QJsonArray>
+#include <QQmlEngine>
+
+namespace cutehmi {
+namespace modbus {
+
+/**
+ * Simulator client. Simulator client connects to a simulated Modbus slave (server), which runs on a virtual clock.
+ *
+ * Contrary to DummyClient, simulator does not block its thread to emulate latency. Instead each request advances virtual clock
+ * by simulated latency, which is drawn from normal distribution (see @ref latency and @ref latencyDeviation). Requests may also be
+ * lost with given probability (see @ref lossProbability), in which case they time out. Pseudo-random number generator is seeded
+ * with @ref seed each time client is opened, so that for the same sequence of requests simulation is reproducible.
+ *
+ * By default replies are delivered immediately (@ref timeScale equal to 0), which together with @ref pollingInterval set to 0
+ * allows to stress controllers and data acquisition pipelines with thousands of registers at the maximal rate the application can
+ * handle. Setting @ref timeScale to 1.0 delays replies by simulated latencies, which approximates real device timing. With
+ * non-zero @ref timeScale virtual clock also follows wall clock, so that dynamics progress between requests.
+ *
+ * Simulator never blocks, thus all simulator clients share single worker thread.
+ *
+ * Register values can be animated with @ref dynamics script. Script is an array of objects, each of which describes a range of
+ * registers. Following keys are recognized:
+ *	- @p register - type of register (@p "coil", @p "discreteInput", @p "holdingRegister" or @p "inputRegister").
+ *	- @p address - address of the first register.
+ *	- @p count - number of consecutive registers (defaults to 1).
+ *	- @p type - type of dynamics (@p "constant", @p "ramp", @p "sine", @p "square" or @p "noise"; defaults to @p "constant").
+ *	- @p value - value of @p "constant" dynamics.
+ *	- @p low, @p high - range of values for remaining dynamics.
+ *	- @p period - period of dynamics in virtual milliseconds (defaults to 1000).
+ *	- @p phase - phase shift in virtual milliseconds (defaults to 0).
+ *	- @p duty - duty cycle of @p "square" dynamics (defaults to 0.5).
+ *	- @p noise - amplitude of uniform noise added to the value (defaults to 0).
+ *
+ * Registers without dynamics behave as plain memory, that can be written and read back. Like DummyClient, simulator allows to
+ * write to discrete inputs and input registers.
+ */
+class CUTEHMI_MODBUS_API SimulatorClient:
+	public cutehmi::modbus::AbstractClient
+{
+		Q_OBJECT
+		QML_NAMED_ELEMENT(SimulatorClient)
+
+	public:
+		static constexpr int INITIAL_LATENCY = internal::SimulatorClientConfig::INITIAL_LATENCY;
+		static constexpr int INITIAL_LATENCY_DEVIATION = internal::SimulatorClientConfig::INITIAL_LATENCY_DEVIATION;
+		static constexpr qreal INITIAL_LOSS_PROBABILITY = internal::SimulatorClientConfig::INITIAL_LOSS_PROBABILITY;
+		static constexpr qreal INITIAL_TIME_SCALE = internal::SimulatorClientConfig::INITIAL_TIME_SCALE;
+		static constexpr int INITIAL_SEED = static_cast<int>(internal::SimulatorClientConfig::INITIAL_SEED);
+
+		/**
+		 * Mean latency of simulated slave [ms].
+		 */
+		Q_PROPERTY(int latency READ latency WRITE setLatency NOTIFY latencyChanged)
+
+		/**
+		 * Standard deviation of latency [ms].
+		 */
+		Q_PROPERTY(int latencyDeviation READ latencyDeviation WRITE setLatencyDeviation NOTIFY latencyDeviationChanged)
+
+		/**
+		 * Probability, that request is lost.
+		 */
+		Q_PROPERTY(qreal lossProbability READ lossProbability WRITE setLossProbability NOTIFY lossProbabilityChanged)
+
+		/**
+		 * Ratio of wall clock time to virtual time, by which replies are delayed. If 0, replies are delivered immediately.
+		 */
+		Q_PROPERTY(qreal timeScale READ timeScale WRITE setTimeScale NOTIFY timeScaleChanged)
+
+		/**
+		 * Seed of pseudo-random number generator.
+		 */
+		Q_PROPERTY(int seed READ seed WRITE setSeed NOTIFY seedChanged)
+
+		/**
+		 * Dynamics script. Script is applied, when client is opened.
+		 */
+		Q_PROPERTY(QJsonArray dynamics READ dynamics WRITE setDynamics NOTIFY dynamicsChanged)
+
+		/**
+		 * Virtual time [ms]. Virtual time elapsed since client has been opened. Virtual time is updated with each request.
+		 */
+		Q_PROPERTY(qint64 virtualTime READ virtualTime NOTIFY virtualTimeChanged)
+
+		SimulatorClient(QObject * parent = nullptr);
+
+		~SimulatorClient() override;
+
+		int latency() const;
+
+		void setLatency(int latency);
+
+		int latencyDeviation() const;
+
+		void setLatencyDeviation(int latencyDeviation);
+
+		qreal lossProbability() const;
+
+		void setLossProbability(qreal lossProbability);
+
+		qreal timeScale() const;
+
+		void setTimeScale(qreal timeScale);
+
+		int seed() const;
+
+		void setSeed(int seed);
+
+		QJsonArray dynamics() const;
+
+		void setDynamics(const QJsonArray & dynamics);
+
+		qint64 virtualTime() const;
+
+		int timeout() const override;
+
+		void setTimeout(int timeout) override;
+
+	public slots:
+		void open() override;
+
+		void close() override;
+
+	signals:
+		void latencyChanged();
+
+		void latencyDeviationChanged();
+
+		void lossProbabilityChanged();
+
+		void timeScaleChanged();
+
+		void seedChanged();
+
+		void dynamicsChanged();
+
+		void virtualTimeChanged();
+
+	private slots:
+		void setVirtualTime(qint64 virtualTime);
+
+	private:
+		/**
+		 * Acquire shared worker thread. Thread is started by the first call.
+		 * @return shared worker thread.
+		 */
+		static QThread * AcquireThread();
+
+		/**
+		 * Release shared worker thread. Thread is stopped, when it is released by the last client.
+		 */
+		static void ReleaseThread();
+
+		struct Members {
+			internal::SimulatorClientConfig config;
+			internal::SimulatorClientBackend backend;
+			qint64 virtualTime;
+
+			Members(internal::SimulatorClientBackend::CoilDataContainer * coilData,
+					internal::SimulatorClientBackend::DiscreteInputDataContainer * discreteInputData,
+					internal::SimulatorClientBackend::HoldingRegisterDataContainer * holdingRegisterData,
+					internal::SimulatorClientBackend::InputRegisterDataContainer * inputRegisterData):
+				backend(& config, coilData, discreteInputData, holdingRegisterData, inputRegisterData),
+				virtualTime(0)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
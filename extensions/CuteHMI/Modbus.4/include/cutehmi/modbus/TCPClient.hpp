@@ -26,11 +26,25 @@ class CUTEHMI_MODBUS_API TCPClient:
 		static constexpr int INITIAL_PORT = internal::TCPClientConfig::INITIAL_PORT;
 		static constexpr int INITIAL_SLAVE_ADDRESS = internal::TCPClientConfig::INITIAL_SLAVE_ADDRESS;
 		static constexpr int INITIAL_TIMEOUT = internal::TCPClientConfig::INITIAL_TIMEOUT;
+		static constexpr bool INITIAL_ADAPTIVE_TIMEOUT = internal::TCPClientConfig::INITIAL_ADAPTIVE_TIMEOUT;
+		static constexpr int INITIAL_NUMBER_OF_RETRIES = internal::TCPClientConfig::INITIAL_NUMBER_OF_RETRIES;
 
 		Q_PROPERTY(QString host READ host WRITE setHost NOTIFY hostChanged)
 		Q_PROPERTY(int port READ port WRITE setPort NOTIFY portChanged)
 		Q_PROPERTY(int slaveAddress READ slaveAddress WRITE setSlaveAddress NOTIFY slaveAddressChanged)
 
+		/**
+		 * Adaptive timeout. If enabled, response timeout is derived from measured round-trip times and @ref timeout serves as its
+		 * upper bound.
+		 */
+		Q_PROPERTY(bool adaptiveTimeout READ adaptiveTimeout WRITE setAdaptiveTimeout NOTIFY adaptiveTimeoutChanged)
+
+		/**
+		 * Number of times a request is repeated if it times out. Requests sent to a slave, which is not @ref responding are not
+		 * repeated.
+		 */
+		Q_PROPERTY(int numberOfRetries READ numberOfRetries WRITE setNumberOfRetries NOTIFY numberOfRetriesChanged)
+
 		TCPClient(QObject * parent = nullptr);
 
 		~TCPClient() override;
@@ -51,6 +65,14 @@ class CUTEHMI_MODBUS_API TCPClient:
 
 		void setTimeout(int timeout) override;
 
+		bool adaptiveTimeout() const;
+
+		void setAdaptiveTimeout(bool adaptiveTimeout);
+
+		int numberOfRetries() const;
+
+		void setNumberOfRetries(int numberOfRetries);
+
 	public slots:
 		void open() override;
 
@@ -63,14 +85,21 @@ class CUTEHMI_MODBUS_API TCPClient:
 
 		void slaveAddressChanged();
 
+		void adaptiveTimeoutChanged();
+
+		void numberOfRetriesChanged();
+
 	private:
 		struct Members {
 			internal::TCPClientConfig config;
 			internal::QtTCPClientBackend backend;
 			QThread thread;
 
-			Members():
-				backend(& config)
+			Members(internal::QtTCPClientBackend::CoilDataContainer * coilData,
+					internal::QtTCPClientBackend::DiscreteInputDataContainer * discreteInputData,
+					internal::QtTCPClientBackend::HoldingRegisterDataContainer * holdingRegisterData,
+					internal::QtTCPClientBackend::InputRegisterDataContainer * inputRegisterData):
+				backend(& config, coilData, discreteInputData, holdingRegisterData, inputRegisterData)
 			{
 			}
 		};
@@ -19,14 +19,73 @@ namespace internal {
 /**
  * Abstract client backend. By design backend lives in separate thread, thus communication with backend instances are allowed only
  * through signals & slots mechanism or thread-safe functions.
+ *
+ * If client backend is given pointers to device data containers, it may store values of read registers directly in these
+ * containers (data containers and registers are thread-safe). In such case reply does not carry @p values array, but only a @p span
+ * object with @p address and @p amount keys, which describes a range of registers that have been updated.
  */
 class CUTEHMI_MODBUS_PRIVATE AbstractClientBackend:
 	public AbstractDeviceBackend
 {
 		Q_OBJECT
 
+	public:
+		typedef typename RegisterTraits<Coil>::Container CoilDataContainer;
+		typedef typename RegisterTraits<DiscreteInput>::Container DiscreteInputDataContainer;
+		typedef typename RegisterTraits<HoldingRegister>::Container HoldingRegisterDataContainer;
+		typedef typename RegisterTraits<InputRegister>::Container InputRegisterDataContainer;
+
 	protected:
 		explicit AbstractClientBackend(QObject * parent = nullptr);
+
+		/**
+		 * Constructor.
+		 * @param coilData coil data container of the device. Can be @p nullptr.
+		 * @param discreteInputData discrete input data container of the device. Can be @p nullptr.
+		 * @param holdingRegisterData holding register data container of the device. Can be @p nullptr.
+		 * @param inputRegisterData input register data container of the device. Can be @p nullptr.
+		 * @param parent parent object.
+		 */
+		AbstractClientBackend(CoilDataContainer * coilData,
+				DiscreteInputDataContainer * discreteInputData,
+				HoldingRegisterDataContainer * holdingRegisterData,
+				InputRegisterDataContainer * inputRegisterData,
+				QObject * parent = nullptr);
+
+		CoilDataContainer * coilData() const;
+
+		DiscreteInputDataContainer * discreteInputData() const;
+
+		HoldingRegisterDataContainer * holdingRegisterData() const;
+
+		InputRegisterDataContainer * inputRegisterData() const;
+
+		/**
+		 * Insert span descriptor into the reply.
+		 * @param reply reply object.
+		 * @param address starting address of the registers, which have been stored in device data container.
+		 * @param amount amount of the registers, which have been stored in device data container.
+		 */
+		static void InsertSpan(QJsonObject & reply, quint16 address, int amount);
+
+		/**
+		 * Complete captured reply. If reply contains @p span object, values of the registers described by the span are taken from
+		 * device data container and they are put into @p values array, which replaces the span.
+		 * @param function function code of the request.
+		 * @param reply reply object, which is going to be recorded.
+		 */
+		void completeCapturedReply(AbstractDevice::Function function, QJsonObject & reply) const override;
+
+	private:
+		struct Members
+		{
+			CoilDataContainer * coilData;
+			DiscreteInputDataContainer * discreteInputData;
+			HoldingRegisterDataContainer * holdingRegisterData;
+			InputRegisterDataContainer * inputRegisterData;
+		};
+
+		MPtr<Members> m;
 };
 
 }
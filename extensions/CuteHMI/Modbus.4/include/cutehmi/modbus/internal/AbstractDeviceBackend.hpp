@@ -3,6 +3,7 @@
 
 #include "common.hpp"
 #include "RegisterTraits.hpp"
+#include "TrafficCapture.hpp"
 
 #include <cutehmi/InplaceError.hpp>
 #include <cutehmi/modbus/AbstractClient.hpp>
@@ -19,6 +20,9 @@ namespace internal {
 /**
  * Abstract device backend. By design backend lives in separate thread, thus communication with backend instances are allowed only
  * through signals & slots mechanism or thread-safe functions.
+ *
+ * Backend can capture requests and replies to a file (see setCaptureFile()). Format of the file is described in TrafficCapture
+ * class documentation.
  */
 class CUTEHMI_MODBUS_PRIVATE AbstractDeviceBackend:
 	public QObject
@@ -28,6 +32,12 @@ class CUTEHMI_MODBUS_PRIVATE AbstractDeviceBackend:
 	public slots:
 		virtual void processRequest(QJsonObject request);
 
+		/**
+		 * Set capture file. Requests and replies are recorded to the file until capture file is changed again.
+		 * @param fileName name of the capture file. Existing file is truncated. Empty string stops capturing.
+		 */
+		void setCaptureFile(QString fileName);
+
 	signals:
 		void replied(QUuid requestId, QJsonObject reply);
 
@@ -42,6 +52,21 @@ class CUTEHMI_MODBUS_PRIVATE AbstractDeviceBackend:
 	protected:
 		explicit AbstractDeviceBackend(QObject * parent = nullptr);
 
+		/**
+		 * Record request to capture file, if capture is active. This function is called by processRequest().
+		 * @param request request object.
+		 */
+		void captureRequest(const QJsonObject & request);
+
+		/**
+		 * Complete captured reply. This function is called before reply is recorded to capture file. Backends that do not carry all
+		 * the data within the reply object should reimplement this function to put missing data into the reply, so that it can be
+		 * replayed. Default implementation does nothing.
+		 * @param function function code of the request.
+		 * @param reply reply object, which is going to be recorded.
+		 */
+		virtual void completeCapturedReply(AbstractDevice::Function function, QJsonObject & reply) const;
+
 		virtual bool proceedRequest(QUuid requestId) = 0;
 
 		virtual void readCoils(QUuid requestId, quint16 startAddress, quint16 endAddress);
@@ -93,10 +118,20 @@ class CUTEHMI_MODBUS_PRIVATE AbstractDeviceBackend:
 
 		virtual void close() = 0;
 
+	private slots:
+		void captureReply(QUuid requestId, QJsonObject reply);
+
 	private:
 		void replyIllegalFunction(QUuid requestId);
 
 		const char * humanFunctionName(AbstractDevice::Function) const;
+
+		struct Members
+		{
+			TrafficCapture capture;
+		};
+
+		MPtr<Members> m;
 };
 
 }
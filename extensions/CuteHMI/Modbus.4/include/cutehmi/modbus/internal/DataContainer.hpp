@@ -95,18 +95,33 @@ class DataContainer
 		 *
 		 * @see at().
 		 *
-		 * @remark Even tho' this function inserts a value, key iterators remain valid after a call to this function.
+		 * @remark Even though this function inserts a value, key iterators remain valid after a call to this function.
 		 *
 		 * @threadsafe
 		 */
 		T * value(std::size_t i);
 
+		/**
+		 * Apply function to values within given range. Values that do not exist will be default-constructed and inserted into
+		 * the container. Contrary to calling value() for each index, lock is acquired only once for the whole range.
+		 * @param first index of the first value.
+		 * @param count number of values.
+		 * @param f function to be applied. Function is called with value pointer as an argument and it is called in order of
+		 * increasing indices. Function must not access the container.
+		 *
+		 * @remark Even though this function may insert values, key iterators remain valid after a call to this function.
+		 *
+		 * @threadsafe
+		 */
+		template <typename F>
+		void forEachValue(std::size_t first, std::size_t count, F f);
+
 		/**
 		 * Insert value.
 		 * @param i index.
 		 * @param value value to be inserted.
 		 *
-		 * @remark Even tho' this function inserts a value, key iterators remain valid after a call to this function.
+		 * @remark Even though this function inserts a value, key iterators remain valid after a call to this function.
 		 *
 		 * @threadsafe
 		 */
@@ -240,6 +255,37 @@ T * DataContainer<T, N>::value(std::size_t i)
 	return result;
 }
 
+template <typename T, std::size_t N>
+template <typename F>
+void DataContainer<T, N>::forEachValue(std::size_t first, std::size_t count, F f)
+{
+	Q_ASSERT_X(first + count <= N, __func__, "range exceeds container size");
+
+	typename InternalContainer::iterator begin = m_array.begin() + first;
+	typename InternalContainer::iterator end = begin + count;
+
+	{
+		QReadLocker readLocker(& m_lock);
+
+		if (std::find(begin, end, nullptr) == end) {
+			std::for_each(begin, end, f);
+			return;
+		}
+	}
+
+	QWriteLocker writeLocker(& m_lock);
+
+	// Some values have to be created. In a meanwhile they may have been created from another thread, so lookups are serialized by
+	// write locker.
+	for (std::size_t i = first; i < first + count; i++) {
+		if (m_array.at(i) == nullptr) {
+			m_array[i] = new T;
+			insertKey(i);
+		}
+		f(m_array[i]);
+	}
+}
+
 template <typename T, std::size_t N>
 void DataContainer<T, N>::insert(std::size_t i, T * value)
 {
@@ -4,20 +4,46 @@
 #include "common.hpp"
 #include "Config.hpp"
 #include "AbstractClientBackend.hpp"
+#include "RoundTripEstimator.hpp"
 
 #include <memory>
 
 #include <QModbusClient>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QList>
 
 namespace cutehmi {
 namespace modbus {
 namespace internal {
 
+/**
+ * Client backend based on Qt Serial Bus.
+ *
+ * Backend measures round-trip time of each request and, if adaptive timeout is enabled, uses timeout derived from measured
+ * round-trip times (see RoundTripEstimator) instead of the fixed one, which then becomes an upper bound. After
+ * @ref UNRESPONSIVE_TIMEOUTS consecutive timeouts slave is considered not responding. Requests to a slave, which is not responding,
+ * are rejected immediately without touching the bus, except probe requests, which are let through in exponentially growing
+ * intervals (starting from fixed timeout and capped at @ref MAX_PROBE_INTERVAL). Probe requests are not retried. First successful
+ * response marks slave as responding again. Responsiveness and round-trip time estimates are reset whenever client connects or
+ * closes connection.
+ *
+ * Qt Serial Bus does not tell when a request is actually written to the device. If Qt client sends requests one at a time (see
+ * queuesRequests()), request is assumed to be sent once reply to the preceding request has finished, so that time spent in Qt
+ * client queue does not count as round-trip time. Otherwise request is assumed to be sent immediately.
+ */
 class CUTEHMI_MODBUS_PRIVATE QtClientBackend:
 	public AbstractClientBackend
 {
 		Q_OBJECT
 
+	public:
+		static constexpr int MIN_ADAPTIVE_TIMEOUT = 20;
+
+		static constexpr int UNRESPONSIVE_TIMEOUTS = 3;
+
+		static constexpr int MAX_PROBE_INTERVAL = 60000;
+
 	public slots:
 		void ensureClosed();
 
@@ -26,11 +52,38 @@ class CUTEHMI_MODBUS_PRIVATE QtClientBackend:
 
 		void closed();
 
+		/**
+		 * Round-trip time measured. This signal is emitted each time a response from the slave arrives.
+		 * @param smoothedRoundTripTime smoothed round-trip time [ms].
+		 * @param timeout timeout [ms], which is going to be used for the subsequent requests.
+		 */
+		void roundTripTimeMeasured(int smoothedRoundTripTime, int timeout);
+
+		void respondingChanged(bool responding);
+
 	protected:
-		explicit QtClientBackend(std::unique_ptr<QModbusClient> qClient, QObject * parent = nullptr);
+		QtClientBackend(std::unique_ptr<QModbusClient> qClient,
+				CoilDataContainer * coilData,
+				DiscreteInputDataContainer * discreteInputData,
+				HoldingRegisterDataContainer * holdingRegisterData,
+				InputRegisterDataContainer * inputRegisterData,
+				QObject * parent = nullptr);
 
 		virtual int slaveAddress() const = 0;
 
+		virtual int timeout() const = 0;
+
+		virtual bool adaptiveTimeout() const = 0;
+
+		virtual int numberOfRetries() const = 0;
+
+		/**
+		 * Whether Qt client sends requests one at a time. Requests, which are issued while another one is in progress, are
+		 * then kept in Qt client queue.
+		 * @return @p true if Qt client sends requests one at a time, @p false if requests are sent immediately.
+		 */
+		virtual bool queuesRequests() const = 0;
+
 		virtual void configureConnection() = 0;
 
 		QModbusClient * qClient() const;
@@ -92,6 +145,51 @@ class CUTEHMI_MODBUS_PRIVATE QtClientBackend:
 
 		void prepareErrorReply(const QModbusReply & modbusReply, QJsonObject & reply);
 
+		/**
+		 * Apply timeout and number of retries to Qt client before sending a request.
+		 */
+		void applyTimeout();
+
+		/**
+		 * Track reply. Measures round-trip time of the request and updates round-trip time estimator and slave responsiveness
+		 * according to the outcome of the request.
+		 * @param modbusReply reply to be tracked. Reply must not be finished.
+		 */
+		void trackReply(QModbusReply * modbusReply);
+
+		/**
+		 * Untrack reply. If Qt client queues requests, round-trip time measurement of the next pending request is started.
+		 * @param modbusReply reply to be untracked. Reply must be tracked.
+		 * @return round-trip time [ms] of the request or -1 if time has not been measured.
+		 */
+		int untrackReply(QModbusReply * modbusReply);
+
+		/**
+		 * Reset responsiveness. Slave is considered responding again, probing is stopped and round-trip time estimates are
+		 * discarded.
+		 */
+		void resetResponsiveness();
+
+		void handleRoundTrip(int roundTripTime);
+
+		void handleTimeout();
+
+		/**
+		 * Prepare reply from the values of read data unit. If data container for given register type is available, values are
+		 * stored in it directly and span descriptor is inserted into the reply. Otherwise values are inserted into the reply as
+		 * @p values array.
+		 * @param unit data unit obtained as a result of read request.
+		 * @param reply reply object.
+		 */
+		void prepareReadReply(const QModbusDataUnit & unit, QJsonObject & reply);
+
+		/**
+		 * Store values of data unit in corresponding device data container.
+		 * @param unit data unit.
+		 * @return @p true if values have been stored, @p false if there is no data container for register type of the @a unit.
+		 */
+		bool storeDataUnit(const QModbusDataUnit & unit);
+
 		/**
 		 * Write byte (octet) into destination byte array.
 		 * @param byte byte to be stored.
@@ -120,9 +218,29 @@ class CUTEHMI_MODBUS_PRIVATE QtClientBackend:
 		 */
 		uint pullWord(const uchar *& source);
 
+		typedef QList<QModbusReply *> PendingRepliesContainer;
+
+		typedef QHash<QModbusReply *, QElapsedTimer> RoundTripTimersContainer;
+
 		struct Members
 		{
 			QModbusClient * qClient;
+			RoundTripEstimator roundTripEstimator;
+			PendingRepliesContainer pendingReplies;
+			RoundTripTimersContainer roundTripTimers;
+			int consecutiveTimeouts;
+			bool responding;
+			int probeInterval;
+			QElapsedTimer probeTimer;
+
+			Members(QModbusClient * p_qClient):
+				qClient(p_qClient),
+				roundTripEstimator(MIN_ADAPTIVE_TIMEOUT, p_qClient->timeout()),
+				consecutiveTimeouts(0),
+				responding(true),
+				probeInterval(0)
+			{
+			}
 		};
 
 		MPtr<Members> m;
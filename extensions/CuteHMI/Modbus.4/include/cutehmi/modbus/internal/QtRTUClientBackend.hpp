@@ -17,11 +17,24 @@ class CUTEHMI_MODBUS_PRIVATE QtRTUClientBackend:
 		Q_OBJECT
 
 	public:
-		QtRTUClientBackend(RTUClientConfig * config, QObject * parent = nullptr);
+		QtRTUClientBackend(RTUClientConfig * config,
+				CoilDataContainer * coilData = nullptr,
+				DiscreteInputDataContainer * discreteInputData = nullptr,
+				HoldingRegisterDataContainer * holdingRegisterData = nullptr,
+				InputRegisterDataContainer * inputRegisterData = nullptr,
+				QObject * parent = nullptr);
 
 	protected:
 		int slaveAddress() const override;
 
+		int timeout() const override;
+
+		bool adaptiveTimeout() const override;
+
+		int numberOfRetries() const override;
+
+		bool queuesRequests() const override;
+
 		void configureConnection() override;
 
 	private:
@@ -19,11 +19,24 @@ class CUTEHMI_MODBUS_PRIVATE QtTCPClientBackend:
 		Q_OBJECT
 
 	public:
-		QtTCPClientBackend(TCPClientConfig * config, QObject * parent = nullptr);
+		QtTCPClientBackend(TCPClientConfig * config,
+				CoilDataContainer * coilData = nullptr,
+				DiscreteInputDataContainer * discreteInputData = nullptr,
+				HoldingRegisterDataContainer * holdingRegisterData = nullptr,
+				InputRegisterDataContainer * inputRegisterData = nullptr,
+				QObject * parent = nullptr);
 
 	protected:
 		int slaveAddress() const override;
 
+		int timeout() const override;
+
+		bool adaptiveTimeout() const override;
+
+		int numberOfRetries() const override;
+
+		bool queuesRequests() const override;
+
 		void configureConnection() override;
 
 	private:
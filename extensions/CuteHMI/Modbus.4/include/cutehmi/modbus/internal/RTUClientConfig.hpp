@@ -28,6 +28,8 @@ class CUTEHMI_MODBUS_PRIVATE RTUClientConfig:
 		static constexpr QSerialPort::StopBits INITIAL_STOP_BITS = QSerialPort::OneStop;
 		static constexpr int INITIAL_SLAVE_ADDRESS = MIN_SLAVE_ADDRESS;
 		static constexpr int INITIAL_TIMEOUT = 1000;
+		static constexpr bool INITIAL_ADAPTIVE_TIMEOUT = false;
+		static constexpr int INITIAL_NUMBER_OF_RETRIES = 3;
 
 		explicit RTUClientConfig(QObject * parent = nullptr);
 
@@ -59,6 +61,14 @@ class CUTEHMI_MODBUS_PRIVATE RTUClientConfig:
 
 		void setTimeout(int timeout);
 
+		bool adaptiveTimeout() const;
+
+		void setAdaptiveTimeout(bool adaptiveTimeout);
+
+		int numberOfRetries() const;
+
+		void setNumberOfRetries(int numberOfRetries);
+
 	private:
 		struct Members
 		{
@@ -69,6 +79,8 @@ class CUTEHMI_MODBUS_PRIVATE RTUClientConfig:
 			QSerialPort::StopBits stopBits = INITIAL_STOP_BITS;
 			int slaveAddress = INITIAL_SLAVE_ADDRESS;
 			int timeout = INITIAL_TIMEOUT;
+			bool adaptiveTimeout = INITIAL_ADAPTIVE_TIMEOUT;
+			int numberOfRetries = INITIAL_NUMBER_OF_RETRIES;
 			mutable QReadWriteLock lock;
 		};
 
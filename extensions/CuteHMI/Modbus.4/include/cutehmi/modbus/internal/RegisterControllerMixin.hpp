@@ -6,6 +6,8 @@
 #include "RegisterControllerTraits.hpp"
 #include "../AbstractDevice.hpp"
 
+#include <cutehmi/trace.hpp>
+
 #include <QBasicTimer>
 #include <QJsonObject>
 
@@ -45,6 +47,8 @@ RegisterControllerMixin<DERIVED>::RegisterControllerMixin()
 template <typename DERIVED>
 void RegisterControllerMixin<DERIVED>::setValue(ValueType value)
 {
+	CUTEHMI_TRACE_SCOPE(TRACE_CONTROLLERS, "RegisterControllerMixin::setValue");
+
 	derived().m->requestedValue = value;
 
 	if (derived().device() == nullptr)
@@ -103,6 +107,8 @@ void RegisterControllerMixin<DERIVED>::timerEvent(QTimerEvent * event)
 template<typename DERIVED>
 void RegisterControllerMixin<DERIVED>::onRequestCompleted(QJsonObject request, QJsonObject reply)
 {
+	CUTEHMI_TRACE_SCOPE(TRACE_CONTROLLERS, "RegisterControllerMixin::onRequestCompleted");
+
 	AbstractDevice::Function function = static_cast<AbstractDevice::Function>(request.value("function").toInt());
 	QUuid requestId = QUuid::fromString(request.value("id").toString());
 	bool success = reply.value("success").toBool();
@@ -0,0 +1,118 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_REPLAYCLIENTBACKEND_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_REPLAYCLIENTBACKEND_HPP
+
+#include "common.hpp"
+#include "AbstractClientBackend.hpp"
+#include "ReplayClientConfig.hpp"
+
+#include <QHash>
+#include <QVector>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+/**
+ * Replay client backend. Backend serves replies recorded in a capture file (see TrafficCapture).
+ *
+ * Incoming request is matched against recorded requests by function code and payload. Recorded replies to matching requests are
+ * served in recorded order and when they are exhausted, sequence starts over. Requests, which have no match in the capture file,
+ * are replied with an error. Replies are delayed by recorded round-trip time (difference between timestamps of reply and request
+ * records) multiplied by time scale. Timestamps of request records are not used to schedule anything, because requests are issued
+ * by the client.
+ */
+class CUTEHMI_MODBUS_PRIVATE ReplayClientBackend:
+	public AbstractClientBackend
+{
+		Q_OBJECT
+
+	public:
+		ReplayClientBackend(ReplayClientConfig * config,
+				CoilDataContainer * coilData = nullptr,
+				DiscreteInputDataContainer * discreteInputData = nullptr,
+				HoldingRegisterDataContainer * holdingRegisterData = nullptr,
+				InputRegisterDataContainer * inputRegisterData = nullptr,
+				QObject * parent = nullptr);
+
+	public slots:
+		void processRequest(QJsonObject request) override;
+
+		void ensureClosed();
+
+	signals:
+		void opened();
+
+		void closed();
+
+	protected:
+		bool proceedRequest(QUuid requestId) override;
+
+	protected slots:
+		void open() override;
+
+		void close() override;
+
+	private:
+		struct Exchange
+		{
+			QJsonObject reply;
+			qint64 roundTripTime;	///< Round-trip time in microseconds.
+		};
+
+		struct ExchangeSequence
+		{
+			QVector<Exchange> exchanges;
+			int next = 0;
+		};
+
+		typedef QHash<QByteArray, ExchangeSequence> ExchangesContainer;
+
+		static QByteArray Key(int function, const QJsonObject & payload);
+
+		void setState(AbstractClient::State state);
+
+		bool load();
+
+		/**
+		 * Store values carried by the reply in device data container. If values have been stored, @p values array is replaced by
+		 * @p span object.
+		 * @param function function code of the request.
+		 * @param payload request payload.
+		 * @param reply reply object.
+		 */
+		void storeValues(AbstractDevice::Function function, const QJsonObject & payload, QJsonObject & reply);
+
+		void deliver(QUuid requestId, const QJsonObject & reply, qint64 roundTripTime);
+
+		struct Members
+		{
+			ReplayClientConfig * config;
+			AbstractClient::State state;
+			ExchangesContainer exchanges;
+
+			Members(ReplayClientConfig * p_config):
+				config(p_config),
+				state(AbstractDevice::CLOSED)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,112 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_ROUNDTRIPESTIMATOR_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_ROUNDTRIPESTIMATOR_HPP
+
+#include "common.hpp"
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+/**
+ * Round-trip time estimator. Estimator keeps smoothed round-trip time and its variation, from which it derives response timeout.
+ * Computations follow retransmission timer algorithm from RFC 6298 - smoothed round-trip time and round-trip time variation are
+ * exponentially weighted moving averages with gains of 1/8 and 1/4 respectively, while timeout is calculated as smoothed round-trip
+ * time plus four times the variation. Each timeout doubles the timeout (exponential back-off) until next valid sample arrives.
+ * Timeout is always kept within [@ref minTimeout(), @ref maxTimeout()] range.
+ */
+class CUTEHMI_MODBUS_PRIVATE RoundTripEstimator
+{
+	public:
+		static constexpr int CLOCK_GRANULARITY = 1;
+
+		/**
+		 * Constructor.
+		 * @param minTimeout lower bound of timeout [ms].
+		 * @param maxTimeout upper bound of timeout [ms]. Until first sample is taken timeout equals to this value.
+		 */
+		RoundTripEstimator(int minTimeout, int maxTimeout);
+
+		int minTimeout() const;
+
+		void setMinTimeout(int minTimeout);
+
+		int maxTimeout() const;
+
+		void setMaxTimeout(int maxTimeout);
+
+		/**
+		 * Check whether any sample has been taken.
+		 * @return @p true if estimator has taken at least one sample, @p false otherwise.
+		 */
+		bool hasSamples() const;
+
+		/**
+		 * Get smoothed round-trip time.
+		 * @return smoothed round-trip time [ms] or 0 if no samples have been taken.
+		 */
+		int smoothedRoundTripTime() const;
+
+		/**
+		 * Get round-trip time variation.
+		 * @return round-trip time variation [ms] or 0 if no samples have been taken.
+		 */
+		int roundTripTimeVariation() const;
+
+		/**
+		 * Get timeout.
+		 * @return timeout [ms] derived from measured round-trip times, including back-off.
+		 */
+		int timeout() const;
+
+		/**
+		 * Take round-trip time sample. Taking a sample cancels back-off.
+		 * @param roundTripTime measured round-trip time [ms].
+		 */
+		void sample(int roundTripTime);
+
+		/**
+		 * Back off. Doubles the timeout. Should be called when request times out.
+		 */
+		void backOff();
+
+		/**
+		 * Reset estimator. Discards all samples and back-off.
+		 */
+		void reset();
+
+	private:
+		struct Members
+		{
+			int minTimeout;
+			int maxTimeout;
+			bool hasSamples = false;
+			double smoothedRoundTripTime = 0.0;
+			double roundTripTimeVariation = 0.0;
+			int backOffShift = 0;
+
+			Members(int p_minTimeout, int p_maxTimeout):
+				minTimeout(p_minTimeout),
+				maxTimeout(p_maxTimeout)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,172 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_SIMULATORCLIENTBACKEND_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_SIMULATORCLIENTBACKEND_HPP
+
+#include "common.hpp"
+#include "AbstractClientBackend.hpp"
+#include "SimulatorClientConfig.hpp"
+
+#include <QHash>
+#include <QElapsedTimer>
+
+#include <random>
+#include <array>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+/**
+ * Simulator client backend. Backend simulates Modbus slave, which runs on a virtual clock.
+ *
+ * If time scale is 0, virtual clock advances only by simulated latencies and timeouts of the requests, so simulation does not
+ * depend on the wall clock and, given the same seed and sequence of requests, it yields the same results. Replies are then emitted
+ * immediately. Otherwise replies are delayed by simulated latency multiplied by time scale and virtual clock is not allowed to
+ * fall behind wall clock time elapsed since opening divided by time scale.
+ *
+ * Slave memory is sparse - only registers that have been written are stored. Registers, for which dynamics has been defined, are
+ * computed from virtual time upon read.
+ */
+class CUTEHMI_MODBUS_PRIVATE SimulatorClientBackend:
+	public AbstractClientBackend
+{
+		Q_OBJECT
+
+	public:
+		SimulatorClientBackend(SimulatorClientConfig * config,
+				CoilDataContainer * coilData = nullptr,
+				DiscreteInputDataContainer * discreteInputData = nullptr,
+				HoldingRegisterDataContainer * holdingRegisterData = nullptr,
+				InputRegisterDataContainer * inputRegisterData = nullptr,
+				QObject * parent = nullptr);
+
+	public slots:
+		void ensureClosed();
+
+	signals:
+		void opened();
+
+		void closed();
+
+		void virtualTimeChanged(qint64 virtualTime);
+
+	protected:
+		bool proceedRequest(QUuid requestId) override;
+
+		void readCoils(QUuid requestId, quint16 startAddress, quint16 endAddress) override;
+
+		void writeCoil(QUuid requestId, quint16 address, bool value) override;
+
+		void writeMultipleCoils(QUuid requestId, quint16 startAddress, const QVector<quint16> & values) override;
+
+		void readDiscreteInputs(QUuid requestId, quint16 startAddress, quint16 endAddress) override;
+
+		void writeDiscreteInput(QUuid requestId, quint16 address, bool value) override;
+
+		void writeMultipleDiscreteInputs(QUuid requestId, quint16 startAddress, const QVector<quint16> & values) override;
+
+		void readHoldingRegisters(QUuid requestId, quint16 startAddress, quint16 endAddress) override;
+
+		void writeHoldingRegister(QUuid requestId, quint16 address, quint16 value) override;
+
+		void writeMultipleHoldingRegisters(QUuid requestId, quint16 startAddress, const QVector<quint16> & values) override;
+
+		void readInputRegisters(QUuid requestId, quint16 startAddress, quint16 endAddress) override;
+
+		void writeInputRegister(QUuid requestId, quint16 address, quint16 value) override;
+
+		void writeMultipleInputRegisters(QUuid requestId, quint16 startAddress, const QVector<quint16> & values) override;
+
+	protected slots:
+		void open() override;
+
+		void close() override;
+
+	private:
+		enum RegisterType {
+			COIL,
+			DISCRETE_INPUT,
+			HOLDING_REGISTER,
+			INPUT_REGISTER,
+			REGISTER_TYPE_COUNT
+		};
+
+		struct Dynamics
+		{
+			enum Type {
+				CONSTANT,
+				RAMP,
+				SINE,
+				SQUARE,
+				NOISE
+			};
+
+			Type type = CONSTANT;
+			qreal low = 0.0;
+			qreal high = 0.0;
+			qreal period = 1000.0;
+			qreal phase = 0.0;
+			qreal duty = 0.5;
+			qreal noise = 0.0;
+		};
+
+		typedef QHash<quint16, quint16> MemoryContainer;
+
+		typedef QHash<quint16, Dynamics> DynamicsContainer;
+
+		void setState(AbstractClient::State state);
+
+		void parseDynamics();
+
+		quint16 value(RegisterType type, quint16 address);
+
+		void read(QUuid requestId, RegisterType type, quint16 startAddress, quint16 endAddress);
+
+		void write(QUuid requestId, RegisterType type, quint16 startAddress, const QVector<quint16> & values);
+
+		/**
+		 * Deliver reply. Reply is emitted immediately or after a delay, depending on time scale.
+		 * @param requestId request id.
+		 * @param reply reply object.
+		 * @param latency simulated latency [ms].
+		 */
+		void deliver(QUuid requestId, const QJsonObject & reply, int latency);
+
+		struct Members
+		{
+			SimulatorClientConfig * config;
+			AbstractClient::State state;
+			qint64 virtualTime;
+			QElapsedTimer wallClock;
+			int requestLatency;
+			std::mt19937 generator;
+			std::array<MemoryContainer, REGISTER_TYPE_COUNT> memory;
+			std::array<DynamicsContainer, REGISTER_TYPE_COUNT> dynamics;
+
+			Members(SimulatorClientConfig * p_config):
+				config(p_config),
+				state(AbstractDevice::CLOSED),
+				virtualTime(0),
+				requestLatency(0)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
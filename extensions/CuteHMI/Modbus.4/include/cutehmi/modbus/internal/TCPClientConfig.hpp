@@ -23,6 +23,8 @@ class CUTEHMI_MODBUS_PRIVATE TCPClientConfig:
 		static constexpr int INITIAL_PORT = 502;
 		static constexpr int INITIAL_SLAVE_ADDRESS = MIN_SLAVE_ADDRESS;
 		static constexpr int INITIAL_TIMEOUT = 1000;
+		static constexpr bool INITIAL_ADAPTIVE_TIMEOUT = false;
+		static constexpr int INITIAL_NUMBER_OF_RETRIES = 3;
 
 		explicit TCPClientConfig(QObject * parent = nullptr);
 
@@ -42,6 +44,14 @@ class CUTEHMI_MODBUS_PRIVATE TCPClientConfig:
 
 		void setTimeout(int timeout);
 
+		bool adaptiveTimeout() const;
+
+		void setAdaptiveTimeout(bool adaptiveTimeout);
+
+		int numberOfRetries() const;
+
+		void setNumberOfRetries(int numberOfRetries);
+
 	private:
 		struct Members
 		{
@@ -49,6 +59,8 @@ class CUTEHMI_MODBUS_PRIVATE TCPClientConfig:
 			int	port = INITIAL_PORT;
 			int slaveAddress = INITIAL_SLAVE_ADDRESS;
 			int timeout = INITIAL_TIMEOUT;
+			bool adaptiveTimeout = INITIAL_ADAPTIVE_TIMEOUT;
+			int numberOfRetries = INITIAL_NUMBER_OF_RETRIES;
 			mutable QReadWriteLock lock;
 		};
 
@@ -0,0 +1,122 @@
+#ifndef H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_TRAFFICCAPTURE_HPP
+#define H_EXTENSIONS_CUTEHMI_MODBUS_4_INCLUDE_CUTEHMI_MODBUS_INTERNAL_TRAFFICCAPTURE_HPP
+
+#include "common.hpp"
+
+#include <QFile>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QJsonObject>
+#include <QHash>
+#include <QUuid>
+#include <QVector>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+/**
+ * Traffic capture. Records requests and replies exchanged with a device backend to a binary file.
+ *
+ * File starts with a header, which consists of magic number (@ref MAGIC), format version (@ref VERSION) and capture start time in
+ * milliseconds since epoch. Header is followed by records. Each record consists of record kind, timestamp in microseconds since
+ * capture start and request id (16 octets). Request records then carry function code and request payload, while reply records
+ * carry reply object. Function code takes 16 bits, because extended function codes of AbstractDevice do not fit into a single
+ * octet. Payloads and replies are encoded in CBOR. All numbers are stored in big-endian byte order.
+ *
+ * @note captured objects are not raw Modbus PDUs, but request payloads and replies as exchanged between device and its backend,
+ * because framing of Modbus messages is handled by Qt Serial Bus module and it is not accessible to the backend.
+ */
+class CUTEHMI_MODBUS_PRIVATE TrafficCapture
+{
+	public:
+		static constexpr quint32 MAGIC = 0x43484D43;	// "CHMC".
+
+		static constexpr quint16 VERSION = 1;
+
+		enum Kind : quint8 {
+			REQUEST = 1,
+			REPLY = 2
+		};
+
+		struct Record
+		{
+			Kind kind;
+			qint64 timestamp;	///< Timestamp in microseconds since capture start.
+			QUuid id;
+			int function;	///< Function code (request records only).
+			QJsonObject object;	///< Request payload or reply object.
+		};
+
+		typedef QVector<Record> RecordsContainer;
+
+		/**
+		 * Load capture file.
+		 * @param fileName name of the file.
+		 * @param records container to which records are appended.
+		 * @return @p true on success, @p false otherwise. On failure @a records may contain records, which have been read before
+		 * failure occurred.
+		 */
+		static bool Load(const QString & fileName, RecordsContainer & records);
+
+		TrafficCapture();
+
+		~TrafficCapture();
+
+		/**
+		 * Open capture file. Existing file is truncated. If another file is opened, it is closed first.
+		 * @param fileName name of the file.
+		 * @return @p true on success, @p false otherwise.
+		 */
+		bool open(const QString & fileName);
+
+		void close();
+
+		bool isOpen() const;
+
+		QString fileName() const;
+
+		void recordRequest(QUuid id, int function, const QJsonObject & payload);
+
+		void recordReply(QUuid id, const QJsonObject & reply);
+
+		/**
+		 * Get function code of a recorded request.
+		 * @param id request id.
+		 * @return function code of the request, which has been recorded with recordRequest() or AbstractDevice::FUNCTION_INVALID,
+		 * if such request has not been recorded.
+		 */
+		int function(QUuid id) const;
+
+	private:
+		typedef QHash<QUuid, int> PendingFunctionsContainer;
+
+		void writeHeader(Kind kind, QUuid id);
+
+		struct Members
+		{
+			QFile file;
+			QDataStream stream;
+			QElapsedTimer timer;
+			PendingFunctionsContainer pendingFunctions;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
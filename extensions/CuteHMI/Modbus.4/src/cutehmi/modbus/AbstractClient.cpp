@@ -55,6 +55,30 @@ void AbstractClient::setRequestInterval(int interval)
 	}
 }
 
+int AbstractClient::roundTripTime() const
+{
+	return m->roundTripTime;
+}
+
+bool AbstractClient::responding() const
+{
+	return m->responding;
+}
+
+QString AbstractClient::captureFile() const
+{
+	return m->captureFile;
+}
+
+void AbstractClient::setCaptureFile(const QString & captureFile)
+{
+	if (m->captureFile != captureFile) {
+		m->captureFile = captureFile;
+		emit captureRequested(captureFile);
+		emit captureFileChanged();
+	}
+}
+
 void AbstractClient::configureStarting(QState * starting, AssignStatusFunction assignStatus)
 {
 	QState * connecting = new QState(starting);
@@ -187,17 +211,42 @@ void AbstractClient::onStateChanged()
 		setReady(true);
 	else
 		setReady(false);
+
+	// Measurements from previous connection do not apply to the new one.
+	if (state() == AbstractDevice::OPENING || state() == AbstractDevice::CLOSED) {
+		setRoundTripTime(0);
+		setResponding(true);
+	}
 }
 
 void AbstractClient::poll()
 {
+	m->pollingCycleTimer.start();
 	m->pollingIterator.reset();
 }
 
 void AbstractClient::pollingTask()
 {
-	if (!m->pollingIterator.runNext())
+	if (!m->pollingIterator.runNext()) {
+		statistics()->recordPollingCycle(static_cast<int>(m->pollingCycleTimer.elapsed()));
 		emit pollingFinished();
+	}
+}
+
+void AbstractClient::setRoundTripTime(int roundTripTime)
+{
+	if (m->roundTripTime != roundTripTime) {
+		m->roundTripTime = roundTripTime;
+		emit roundTripTimeChanged();
+	}
+}
+
+void AbstractClient::setResponding(bool responding)
+{
+	if (m->responding != responding) {
+		m->responding = responding;
+		emit respondingChanged();
+	}
 }
 
 void AbstractClient::dequeueRequest()
@@ -2,8 +2,11 @@
 
 #include <cutehmi/modbus/Exception.hpp>
 
+#include <cutehmi/trace.hpp>
+
 #include <QJsonArray>
 #include <QDateTime>
+#include <QModbusDevice>
 
 namespace cutehmi {
 namespace modbus {
@@ -168,6 +171,11 @@ void AbstractDevice::setMaxRequests(int maxRequests)
 	}
 }
 
+DeviceStatistics * AbstractDevice::statistics() const
+{
+	return m->statistics;
+}
+
 Coil * AbstractDevice::coilAt(quint16 address)
 {
 	return coilData().value(address);
@@ -378,6 +386,8 @@ void AbstractDevice::requestWriteFileRecord(QJsonArray subrequests, QUuid * requ
 
 void AbstractDevice::request(Function function, QJsonObject payload, QUuid * requestId)
 {
+	CUTEHMI_TRACE_SCOPE(TRACE_MODBUS, "AbstractDevice::request");
+
 	QJsonObject request;
 
 	if (requestId != nullptr) {
@@ -396,6 +406,8 @@ void AbstractDevice::request(Function function, QJsonObject payload, QUuid * req
 	CUTEHMI_DEBUG("Received request '" << request << "'.");
 
 	m->pendingRequests.push_back(request);
+	m->statistics->recordRequest(request);
+	m->statistics->recordQueueDepth(static_cast<int>(m->pendingRequests.size()));
 	if (m->pendingRequests.size() > static_cast<std::size_t>(maxRequests())) {
 		QJsonObject reply;
 		reply.insert("success", false);
@@ -413,7 +425,7 @@ void AbstractDevice::request(Function function, QJsonObject payload, QUuid * req
 
 AbstractDevice::AbstractDevice(QObject * parent):
 	QObject(parent),
-	m(new Members)
+	m(new Members(this))
 {
 	connect(this, & AbstractDevice::errored, this, & AbstractDevice::handleError);
 }
@@ -480,6 +492,7 @@ QJsonObject AbstractDevice::takePendingRequest(QUuid requestId)
 		if (QUuid::fromString(it->value("id").toString()) == requestId) {
 			QJsonObject result = *it;
 			m->pendingRequests.erase(it);
+			m->statistics->recordQueueDepth(static_cast<int>(m->pendingRequests.size()));
 			return result;
 		}
 	return QJsonObject();
@@ -487,6 +500,8 @@ QJsonObject AbstractDevice::takePendingRequest(QUuid requestId)
 
 void AbstractDevice::handleReply(QUuid requestId, QJsonObject reply)
 {
+	CUTEHMI_TRACE_SCOPE(TRACE_MODBUS, "AbstractDevice::handleReply");
+
 	QJsonObject request = takePendingRequest(requestId);
 	if (request.isEmpty()) {
 		CUTEHMI_CRITICAL("Could not find a record in pending requests for the request '" << requestId << "'.");
@@ -499,6 +514,8 @@ void AbstractDevice::handleReply(QUuid requestId, QJsonObject reply)
 
 	reply.insert("elapsed", elapsedTime);
 
+	m->statistics->recordReply(request, reply);
+
 	if (validateReply(request, reply)) {
 		if (!reply.value("success").toBool()) {
 			QString errorString = tr("Request '%1' has failed.").arg(requestId.toString());
@@ -506,7 +523,11 @@ void AbstractDevice::handleReply(QUuid requestId, QJsonObject reply)
 				errorString += " ";
 				errorString += reply.value("error").toString();
 			}
-			emit errored(CUTEHMI_ERROR(errorString));
+			// Request, which has timed out, does not make device broken. Clients deal with slaves, which are not responding.
+			if (reply.value("errorCode").toInt() == QModbusDevice::TimeoutError)
+				CUTEHMI_WARNING(errorString);
+			else
+				emit errored(CUTEHMI_ERROR(errorString));
 		} else {
 			Function function = static_cast<Function>(request.value("function").toInt());
 			switch (function) {
@@ -825,6 +846,16 @@ void AbstractDevice::ValidateObjectArrayKey(const QJsonObject & json, const QStr
 	}
 }
 
+void AbstractDevice::ValidateSpanKey(const QJsonObject & json)
+{
+	if (!json.value("span").isObject())
+		throw Exception(QString("Value of 'span' is not an object."));
+
+	QJsonObject span = json.value("span").toObject();
+	ValidateNumberKey(span, "address", "span");
+	ValidateNumberKey(span, "amount", "span");
+}
+
 void AbstractDevice::ValidateReadFileRecordSubresponsesKey(const QJsonObject & json, const QString & path)
 {
 	ValidateNumberKey(json, "byteCount", path);
@@ -966,6 +997,8 @@ bool AbstractDevice::validateReply(const QJsonObject & request, const QJsonObjec
 				ValidateBoolKey(reply, "success");
 				if (reply.contains("values"))
 					ValidateBoolArrayKey(reply, "values");
+				else if (reply.contains("span"))
+					ValidateSpanKey(reply);
 				break;
 			case FUNCTION_WRITE_COIL:
 				ValidateBoolKey(reply, "success");
@@ -977,6 +1010,8 @@ bool AbstractDevice::validateReply(const QJsonObject & request, const QJsonObjec
 				ValidateBoolKey(reply, "success");
 				if (reply.contains("values"))
 					ValidateBoolArrayKey(reply, "values");
+				else if (reply.contains("span"))
+					ValidateSpanKey(reply);
 				break;
 			case FUNCTION_WRITE_DISCRETE_INPUT:
 				ValidateBoolKey(reply, "success");
@@ -988,6 +1023,8 @@ bool AbstractDevice::validateReply(const QJsonObject & request, const QJsonObjec
 				ValidateBoolKey(reply, "success");
 				if (reply.contains("values"))
 					ValidateNumberArrayKey(reply, "values");
+				else if (reply.contains("span"))
+					ValidateSpanKey(reply);
 				break;
 			case FUNCTION_WRITE_HOLDING_REGISTER:
 				ValidateBoolKey(reply, "success");
@@ -999,6 +1036,8 @@ bool AbstractDevice::validateReply(const QJsonObject & request, const QJsonObjec
 				ValidateBoolKey(reply, "success");
 				if (reply.contains("values"))
 					ValidateNumberArrayKey(reply, "values");
+				else if (reply.contains("span"))
+					ValidateSpanKey(reply);
 				break;
 			case FUNCTION_WRITE_INPUT_REGISTER:
 				ValidateBoolKey(reply, "success");
@@ -1070,6 +1109,8 @@ bool AbstractDevice::validateReply(const QJsonObject & request, const QJsonObjec
 				ValidateBoolKey(reply, "success");
 				if (reply.contains("values"))
 					ValidateNumberArrayKey(reply, "values");
+				else if (reply.contains("span"))
+					ValidateSpanKey(reply);
 				break;
 			case FUNCTION_READ_FIFO_QUEUE:
 				ValidateBoolKey(reply, "success");
@@ -0,0 +1,442 @@
+#include <cutehmi/modbus/DeviceStatistics.hpp>
+#include <cutehmi/modbus/AbstractDevice.hpp>
+
+#include <QMetaEnum>
+#include <QModbusDevice>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QJsonArray>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace modbus {
+
+constexpr int DeviceStatistics::UPDATE_INTERVAL;
+constexpr int DeviceStatistics::INITIAL_METRICS_INTERVAL;
+constexpr std::array<int, 14> DeviceStatistics::ROUND_TRIP_TIME_BUCKETS;
+
+DeviceStatistics::DeviceStatistics(QObject * parent):
+	QObject(parent),
+	m(new Members)
+{
+	m->updateTimer.setSingleShot(true);
+	m->updateTimer.setInterval(UPDATE_INTERVAL);
+	connect(& m->updateTimer, & QTimer::timeout, this, & DeviceStatistics::updated);
+
+	m->metricsTimer.setInterval(INITIAL_METRICS_INTERVAL);
+	connect(& m->metricsTimer, & QTimer::timeout, this, & DeviceStatistics::writeMetrics);
+}
+
+int DeviceStatistics::requests() const
+{
+	return m->requests;
+}
+
+int DeviceStatistics::replies() const
+{
+	return m->replies;
+}
+
+int DeviceStatistics::errors() const
+{
+	return m->errors;
+}
+
+int DeviceStatistics::timeouts() const
+{
+	return m->timeouts;
+}
+
+int DeviceStatistics::queueDepth() const
+{
+	return m->queueDepth;
+}
+
+int DeviceStatistics::maxQueueDepth() const
+{
+	return m->maxQueueDepth;
+}
+
+int DeviceStatistics::roundTripTimeP50() const
+{
+	return roundTripTimePercentile(0.50);
+}
+
+int DeviceStatistics::roundTripTimeP95() const
+{
+	return roundTripTimePercentile(0.95);
+}
+
+int DeviceStatistics::roundTripTimeP99() const
+{
+	return roundTripTimePercentile(0.99);
+}
+
+qint64 DeviceStatistics::bytesSent() const
+{
+	return m->bytesSent;
+}
+
+qint64 DeviceStatistics::bytesReceived() const
+{
+	return m->bytesReceived;
+}
+
+int DeviceStatistics::pollingCycleDuration() const
+{
+	return m->pollingCycleDuration;
+}
+
+int DeviceStatistics::maxPollingCycleDuration() const
+{
+	return m->maxPollingCycleDuration;
+}
+
+QString DeviceStatistics::metricsFile() const
+{
+	return m->metricsFile;
+}
+
+void DeviceStatistics::setMetricsFile(const QString & metricsFile)
+{
+	if (m->metricsFile != metricsFile) {
+		m->metricsFile = metricsFile;
+		if (m->metricsFile.isEmpty())
+			m->metricsTimer.stop();
+		else
+			m->metricsTimer.start();
+		emit metricsFileChanged();
+	}
+}
+
+int DeviceStatistics::metricsInterval() const
+{
+	return m->metricsTimer.interval();
+}
+
+void DeviceStatistics::setMetricsInterval(int metricsInterval)
+{
+	if (m->metricsTimer.interval() != metricsInterval) {
+		m->metricsTimer.setInterval(metricsInterval);
+		emit metricsIntervalChanged();
+	}
+}
+
+int DeviceStatistics::requestCount(int function) const
+{
+	return m->functionCounters.value(function).requests;
+}
+
+int DeviceStatistics::replyCount(int function) const
+{
+	return m->functionCounters.value(function).replies;
+}
+
+int DeviceStatistics::errorCount(int function) const
+{
+	return m->functionCounters.value(function).errors;
+}
+
+int DeviceStatistics::timeoutCount(int function) const
+{
+	return m->functionCounters.value(function).timeouts;
+}
+
+int DeviceStatistics::roundTripTimePercentile(qreal percentile) const
+{
+	qint64 count = 0;
+	for (auto bucketCount : m->roundTripTimeHistogram)
+		count += bucketCount;
+	if (count == 0)
+		return 0;
+
+	qreal rank = percentile * count;
+	qint64 cumulative = 0;
+	for (std::size_t bucket = 0; bucket < ROUND_TRIP_TIME_BUCKETS.size(); bucket++) {
+		qint64 bucketCount = m->roundTripTimeHistogram[bucket];
+		if (bucketCount > 0 && cumulative + bucketCount >= rank) {
+			int lower = bucket == 0 ? 0 : ROUND_TRIP_TIME_BUCKETS[bucket - 1];
+			int upper = std::min(ROUND_TRIP_TIME_BUCKETS[bucket], m->maxRoundTripTime);
+			return qRound(lower + (upper - lower) * (rank - cumulative) / bucketCount);
+		}
+		cumulative += bucketCount;
+	}
+	// Percentile falls into the last bucket, which has no upper bound.
+	return m->maxRoundTripTime;
+}
+
+QString DeviceStatistics::toOpenMetrics() const
+{
+	QString result;
+	QTextStream stream(& result);
+
+	QString deviceLabel;
+	if (parent() && !parent()->objectName().isEmpty())
+		deviceLabel = QString("device=\"%1\"").arg(parent()->objectName().replace('\\', "\\\\").replace('"', "\\\""));
+	auto labels = [& deviceLabel](const QString & other = QString()) {
+		QStringList list;
+		if (!deviceLabel.isEmpty())
+			list.append(deviceLabel);
+		if (!other.isEmpty())
+			list.append(other);
+		return list.isEmpty() ? QString() : "{" + list.join(',') + "}";
+	};
+
+	QList<int> functions = m->functionCounters.keys();
+	std::sort(functions.begin(), functions.end());
+
+	auto writeFunctionCounter = [& stream, & functions, & labels, this](const char * name, const char * help, int FunctionCounters::* counter) {
+		stream << "# TYPE " << name << " counter\n";
+		stream << "# HELP " << name << " " << help << "\n";
+		for (auto function : functions)
+			stream << name << "_total" << labels(QString("function=\"%1\"").arg(FunctionLabel(function))) << " " << m->functionCounters.value(function).*counter << "\n";
+	};
+	writeFunctionCounter("cutehmi_modbus_requests", "Requests issued.", & FunctionCounters::requests);
+	writeFunctionCounter("cutehmi_modbus_replies", "Replies handled.", & FunctionCounters::replies);
+	writeFunctionCounter("cutehmi_modbus_errors", "Failed requests.", & FunctionCounters::errors);
+	writeFunctionCounter("cutehmi_modbus_timeouts", "Timed out requests.", & FunctionCounters::timeouts);
+
+	stream << "# TYPE cutehmi_modbus_queue_depth gauge\n";
+	stream << "# HELP cutehmi_modbus_queue_depth Pending requests.\n";
+	stream << "cutehmi_modbus_queue_depth" << labels() << " " << m->queueDepth << "\n";
+
+	stream << "# TYPE cutehmi_modbus_bytes counter\n";
+	stream << "# UNIT cutehmi_modbus_bytes bytes\n";
+	stream << "# HELP cutehmi_modbus_bytes Estimated size of protocol data units.\n";
+	stream << "cutehmi_modbus_bytes_total" << labels("direction=\"sent\"") << " " << m->bytesSent << "\n";
+	stream << "cutehmi_modbus_bytes_total" << labels("direction=\"received\"") << " " << m->bytesReceived << "\n";
+
+	stream << "# TYPE cutehmi_modbus_round_trip_time_seconds histogram\n";
+	stream << "# UNIT cutehmi_modbus_round_trip_time_seconds seconds\n";
+	stream << "# HELP cutehmi_modbus_round_trip_time_seconds Time between issuing a request and handling its reply.\n";
+	qint64 cumulative = 0;
+	for (std::size_t bucket = 0; bucket < ROUND_TRIP_TIME_BUCKETS.size(); bucket++) {
+		cumulative += m->roundTripTimeHistogram[bucket];
+		stream << "cutehmi_modbus_round_trip_time_seconds_bucket" << labels(QString("le=\"%1\"").arg(ROUND_TRIP_TIME_BUCKETS[bucket] / 1000.0)) << " " << cumulative << "\n";
+	}
+	cumulative += m->roundTripTimeHistogram.back();
+	stream << "cutehmi_modbus_round_trip_time_seconds_bucket" << labels("le=\"+Inf\"") << " " << cumulative << "\n";
+	stream << "cutehmi_modbus_round_trip_time_seconds_sum" << labels() << " " << m->roundTripTimeSum / 1000.0 << "\n";
+	stream << "cutehmi_modbus_round_trip_time_seconds_count" << labels() << " " << cumulative << "\n";
+
+	stream << "# TYPE cutehmi_modbus_polling_cycle_duration_seconds gauge\n";
+	stream << "# UNIT cutehmi_modbus_polling_cycle_duration_seconds seconds\n";
+	stream << "# HELP cutehmi_modbus_polling_cycle_duration_seconds Duration of last complete polling cycle.\n";
+	stream << "cutehmi_modbus_polling_cycle_duration_seconds" << labels() << " " << m->pollingCycleDuration / 1000.0 << "\n";
+
+	stream << "# EOF\n";
+
+	stream.flush();
+	return result;
+}
+
+void DeviceStatistics::recordRequest(const QJsonObject & request)
+{
+	int function = request.value("function").toInt();
+
+	m->requests++;
+	m->functionCounters[function].requests++;
+	m->bytesSent += RequestPduSize(function, request.value("payload").toObject());
+
+	scheduleUpdate();
+}
+
+void DeviceStatistics::recordReply(const QJsonObject & request, const QJsonObject & reply)
+{
+	int function = request.value("function").toInt();
+	FunctionCounters & counters = m->functionCounters[function];
+
+	m->replies++;
+	counters.replies++;
+
+	if (reply.value("success").toBool())
+		m->bytesReceived += ReplyPduSize(function, request.value("payload").toObject(), reply);
+	else {
+		m->errors++;
+		counters.errors++;
+		if (reply.value("errorCode").toInt() == QModbusDevice::TimeoutError) {
+			m->timeouts++;
+			counters.timeouts++;
+		}
+		// Exception response consists of function code and exception code.
+		if (reply.contains("protocolErrorCode"))
+			m->bytesReceived += 2;
+	}
+
+	int roundTripTime = std::max(0, reply.value("elapsed").toInt());
+	auto bucket = std::lower_bound(ROUND_TRIP_TIME_BUCKETS.begin(), ROUND_TRIP_TIME_BUCKETS.end(), roundTripTime);
+	m->roundTripTimeHistogram[static_cast<std::size_t>(bucket - ROUND_TRIP_TIME_BUCKETS.begin())]++;
+	m->roundTripTimeSum += roundTripTime;
+	m->maxRoundTripTime = std::max(m->maxRoundTripTime, roundTripTime);
+
+	scheduleUpdate();
+}
+
+void DeviceStatistics::recordQueueDepth(int queueDepth)
+{
+	m->queueDepth = queueDepth;
+	m->maxQueueDepth = std::max(m->maxQueueDepth, queueDepth);
+
+	scheduleUpdate();
+}
+
+void DeviceStatistics::recordPollingCycle(int duration)
+{
+	m->pollingCycleDuration = duration;
+	m->maxPollingCycleDuration = std::max(m->maxPollingCycleDuration, duration);
+
+	scheduleUpdate();
+}
+
+void DeviceStatistics::reset()
+{
+	m->requests = 0;
+	m->replies = 0;
+	m->errors = 0;
+	m->timeouts = 0;
+	m->maxQueueDepth = m->queueDepth;
+	m->bytesSent = 0;
+	m->bytesReceived = 0;
+	m->pollingCycleDuration = 0;
+	m->maxPollingCycleDuration = 0;
+	m->functionCounters.clear();
+	m->roundTripTimeHistogram.fill(0);
+	m->roundTripTimeSum = 0;
+	m->maxRoundTripTime = 0;
+
+	m->updateTimer.stop();
+	emit updated();
+}
+
+bool DeviceStatistics::writeMetrics()
+{
+	if (m->metricsFile.isEmpty())
+		return false;
+
+	// QSaveFile replaces target file atomically, so that readers never see partially written metrics.
+	QSaveFile file(m->metricsFile);
+	if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+		CUTEHMI_WARNING("Could not open file '" << m->metricsFile << "' to write metrics: " << file.errorString());
+		return false;
+	}
+	file.write(toOpenMetrics().toUtf8());
+	if (!file.commit()) {
+		CUTEHMI_WARNING("Could not write metrics to file '" << m->metricsFile << "': " << file.errorString());
+		return false;
+	}
+	return true;
+}
+
+int DeviceStatistics::RequestPduSize(int function, const QJsonObject & payload)
+{
+	// Sizes include function code octet.
+	switch (function) {
+		case AbstractDevice::FUNCTION_READ_COILS:
+		case AbstractDevice::FUNCTION_READ_DISCRETE_INPUTS:
+		case AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS:
+		case AbstractDevice::FUNCTION_READ_INPUT_REGISTERS:
+		case AbstractDevice::FUNCTION_WRITE_COIL:
+		case AbstractDevice::FUNCTION_WRITE_HOLDING_REGISTER:
+		case AbstractDevice::FUNCTION_DIAGNOSTICS:
+			return 5;
+		case AbstractDevice::FUNCTION_WRITE_MULTIPLE_COILS:
+			return 6 + (payload.value("values").toArray().size() + 7) / 8;
+		case AbstractDevice::FUNCTION_WRITE_MULTIPLE_HOLDING_REGISTERS:
+			return 6 + 2 * payload.value("values").toArray().size();
+		case AbstractDevice::FUNCTION_READ_EXCEPTION_STATUS:
+		case AbstractDevice::FUNCTION_FETCH_COMM_EVENT_COUNTER:
+		case AbstractDevice::FUNCTION_FETCH_COMM_EVENT_LOG:
+		case AbstractDevice::FUNCTION_REPORT_SLAVE_ID:
+			return 1;
+		case AbstractDevice::FUNCTION_READ_FILE_RECORD:
+			return 2 + 7 * payload.value("subrequests").toArray().size();
+		case AbstractDevice::FUNCTION_WRITE_FILE_RECORD: {
+			int size = 2;
+			QJsonArray subrequests = payload.value("subrequests").toArray();
+			for (auto subrequest = subrequests.begin(); subrequest != subrequests.end(); ++subrequest)
+				size += 7 + 2 * subrequest->toObject().value("values").toArray().size();
+			return size;
+		}
+		case AbstractDevice::FUNCTION_MASK_WRITE_HOLDING_REGISTER:
+			return 7;
+		case AbstractDevice::FUNCTION_READ_WRITE_MULTIPLE_HOLDING_REGISTERS:
+			return 10 + 2 * payload.value("values").toArray().size();
+		case AbstractDevice::FUNCTION_READ_FIFO_QUEUE:
+			return 3;
+		default:
+			// Functions, which are not part of Modbus protocol, are not sent over the wire.
+			return 0;
+	}
+}
+
+int DeviceStatistics::ReplyPduSize(int function, const QJsonObject & payload, const QJsonObject & reply)
+{
+	// Sizes include function code octet.
+	switch (function) {
+		case AbstractDevice::FUNCTION_READ_COILS:
+		case AbstractDevice::FUNCTION_READ_DISCRETE_INPUTS:
+			return 2 + (payload.value("amount").toInt() + 7) / 8;
+		case AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS:
+		case AbstractDevice::FUNCTION_READ_INPUT_REGISTERS:
+		case AbstractDevice::FUNCTION_READ_WRITE_MULTIPLE_HOLDING_REGISTERS:
+			return 2 + 2 * payload.value("amount").toInt();
+		case AbstractDevice::FUNCTION_WRITE_COIL:
+		case AbstractDevice::FUNCTION_WRITE_HOLDING_REGISTER:
+		case AbstractDevice::FUNCTION_WRITE_MULTIPLE_COILS:
+		case AbstractDevice::FUNCTION_WRITE_MULTIPLE_HOLDING_REGISTERS:
+		case AbstractDevice::FUNCTION_DIAGNOSTICS:
+		case AbstractDevice::FUNCTION_FETCH_COMM_EVENT_COUNTER:
+			return 5;
+		case AbstractDevice::FUNCTION_READ_EXCEPTION_STATUS:
+			return 2;
+		case AbstractDevice::FUNCTION_FETCH_COMM_EVENT_LOG:
+		case AbstractDevice::FUNCTION_REPORT_SLAVE_ID:
+			return 2 + reply.value("byteCount").toInt();
+		case AbstractDevice::FUNCTION_READ_FILE_RECORD: {
+			int size = 2;
+			QJsonArray subrequests = payload.value("subrequests").toArray();
+			for (auto subrequest = subrequests.begin(); subrequest != subrequests.end(); ++subrequest)
+				size += 2 + 2 * subrequest->toObject().value("amount").toInt();
+			return size;
+		}
+		case AbstractDevice::FUNCTION_WRITE_FILE_RECORD:
+			// Response is an echo of the request.
+			return RequestPduSize(function, payload);
+		case AbstractDevice::FUNCTION_MASK_WRITE_HOLDING_REGISTER:
+			return 7;
+		case AbstractDevice::FUNCTION_READ_FIFO_QUEUE:
+			return 3 + reply.value("byteCount").toInt();
+		default:
+			return 0;
+	}
+}
+
+QString DeviceStatistics::FunctionLabel(int function)
+{
+	const char * key = QMetaEnum::fromType<AbstractDevice::Function>().valueToKey(function);
+	if (key == nullptr)
+		return QString::number(function);
+
+	return QString(key).remove("FUNCTION_").toLower();
+}
+
+void DeviceStatistics::scheduleUpdate()
+{
+	if (!m->updateTimer.isActive())
+		m->updateTimer.start();
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -21,6 +21,8 @@ DummyClient::DummyClient(QObject * parent):
 
 	connect(this, & DummyClient::requestAccepted, & m->backend, & internal::DummyClientBackend::processRequest);
 
+	connect(this, & DummyClient::captureRequested, & m->backend, & internal::DummyClientBackend::setCaptureFile);
+
 	connect(& m->backend, & internal::DummyClientBackend::replied, this, & DummyClient::handleReply);
 
 	connect(& m->backend, & internal::DummyClientBackend::stateChanged, this, & DummyClient::setState);
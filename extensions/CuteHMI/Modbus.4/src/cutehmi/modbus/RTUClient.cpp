@@ -11,10 +11,13 @@ constexpr QSerialPort::BaudRate RTUClient::INITIAL_BAUD_RATE;
 constexpr QSerialPort::DataBits RTUClient::INITIAL_DATA_BITS;
 constexpr QSerialPort::StopBits RTUClient::INITIAL_STOP_BITS;
 constexpr int RTUClient::INITIAL_SLAVE_ADDRESS;
+constexpr int RTUClient::INITIAL_TIMEOUT;
+constexpr bool RTUClient::INITIAL_ADAPTIVE_TIMEOUT;
+constexpr int RTUClient::INITIAL_NUMBER_OF_RETRIES;
 
 RTUClient::RTUClient(QObject * parent):
 	AbstractClient(parent),
-	m(new Members)
+	m(new Members(& coilData(), & discreteInputData(), & holdingRegisterData(), & inputRegisterData()))
 {
 	m->backend.moveToThread(& m->thread);
 
@@ -22,6 +25,8 @@ RTUClient::RTUClient(QObject * parent):
 
 	connect(this, & RTUClient::requestAccepted, & m->backend, & internal::QtClientBackend::processRequest);
 
+	connect(this, & RTUClient::captureRequested, & m->backend, & internal::QtClientBackend::setCaptureFile);
+
 	connect(& m->backend, & internal::QtClientBackend::replied, this, & RTUClient::handleReply);
 
 	connect(& m->backend, & internal::QtClientBackend::stateChanged, this, & RTUClient::setState);
@@ -33,6 +38,9 @@ RTUClient::RTUClient(QObject * parent):
 	connect(& m->backend, & internal::QtClientBackend::errored, this, & AbstractDevice::errored);
 	connect(& m->backend, & internal::QtClientBackend::closed, this, & RTUClient::broke);
 
+	connect(& m->backend, & internal::QtClientBackend::roundTripTimeMeasured, this, & RTUClient::setRoundTripTime);
+	connect(& m->backend, & internal::QtClientBackend::respondingChanged, this, & RTUClient::setResponding);
+
 	m->thread.start();
 }
 
@@ -133,6 +141,32 @@ void RTUClient::setTimeout(int timeout)
 	}
 }
 
+bool RTUClient::adaptiveTimeout() const
+{
+	return m->config.adaptiveTimeout();
+}
+
+void RTUClient::setAdaptiveTimeout(bool adaptiveTimeout)
+{
+	if (m->config.adaptiveTimeout() != adaptiveTimeout) {
+		m->config.setAdaptiveTimeout(adaptiveTimeout);
+		emit adaptiveTimeoutChanged();
+	}
+}
+
+int RTUClient::numberOfRetries() const
+{
+	return m->config.numberOfRetries();
+}
+
+void RTUClient::setNumberOfRetries(int numberOfRetries)
+{
+	if (m->config.numberOfRetries() != numberOfRetries) {
+		m->config.setNumberOfRetries(numberOfRetries);
+		emit numberOfRetriesChanged();
+	}
+}
+
 void RTUClient::open()
 {
 	emit m->backend.openRequested();
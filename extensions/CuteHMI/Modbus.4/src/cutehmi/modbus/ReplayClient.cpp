@@ -0,0 +1,101 @@
+#include <cutehmi/modbus/ReplayClient.hpp>
+
+namespace cutehmi {
+namespace modbus {
+
+constexpr qreal ReplayClient::INITIAL_TIME_SCALE;
+
+ReplayClient::ReplayClient(QObject * parent):
+	AbstractClient(parent),
+	m(new Members(& coilData(), & discreteInputData(), & holdingRegisterData(), & inputRegisterData()))
+{
+	m->backend.moveToThread(& m->thread);
+
+	connect(& m->thread, & QThread::finished, & m->backend, & internal::ReplayClientBackend::ensureClosed);
+
+	connect(this, & ReplayClient::requestAccepted, & m->backend, & internal::ReplayClientBackend::processRequest);
+
+	connect(this, & ReplayClient::captureRequested, & m->backend, & internal::ReplayClientBackend::setCaptureFile);
+
+	connect(& m->backend, & internal::ReplayClientBackend::replied, this, & ReplayClient::handleReply);
+
+	connect(& m->backend, & internal::ReplayClientBackend::stateChanged, this, & ReplayClient::setState);
+
+	connect(& m->backend, & internal::ReplayClientBackend::closed, this, & ReplayClient::stopped);
+
+	connect(& m->backend, & internal::ReplayClientBackend::opened, this, & ReplayClient::started);
+
+	connect(& m->backend, & internal::ReplayClientBackend::errored, this, & AbstractDevice::errored);
+	connect(& m->backend, & internal::ReplayClientBackend::closed, this, & ReplayClient::broke);
+
+	m->thread.start();
+}
+
+ReplayClient::~ReplayClient()
+{
+	m->thread.quit();
+	m->thread.wait();
+}
+
+QString ReplayClient::file() const
+{
+	return m->config.file();
+}
+
+void ReplayClient::setFile(const QString & file)
+{
+	if (m->config.file() != file) {
+		m->config.setFile(file);
+		emit fileChanged();
+	}
+}
+
+qreal ReplayClient::timeScale() const
+{
+	return m->config.timeScale();
+}
+
+void ReplayClient::setTimeScale(qreal timeScale)
+{
+	if (m->config.timeScale() != timeScale) {
+		m->config.setTimeScale(timeScale);
+		emit timeScaleChanged();
+	}
+}
+
+int ReplayClient::timeout() const
+{
+	return m->config.timeout();
+}
+
+void ReplayClient::setTimeout(int timeout)
+{
+	if (m->config.timeout() != timeout) {
+		m->config.setTimeout(timeout);
+		emit timeoutChanged();
+	}
+}
+
+void ReplayClient::open()
+{
+	emit m->backend.openRequested();
+}
+
+void ReplayClient::close()
+{
+	emit m->backend.closeRequested();
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,213 @@
+#include <cutehmi/modbus/SimulatorClient.hpp>
+
+#include <QMutex>
+
+namespace cutehmi {
+namespace modbus {
+
+namespace {
+
+struct SharedThread
+{
+	QMutex mutex;
+	QThread * thread = nullptr;
+	int references = 0;
+};
+
+SharedThread sharedThread;
+
+}
+
+constexpr int SimulatorClient::INITIAL_LATENCY;
+constexpr int SimulatorClient::INITIAL_LATENCY_DEVIATION;
+constexpr qreal SimulatorClient::INITIAL_LOSS_PROBABILITY;
+constexpr qreal SimulatorClient::INITIAL_TIME_SCALE;
+constexpr int SimulatorClient::INITIAL_SEED;
+
+SimulatorClient::SimulatorClient(QObject * parent):
+	AbstractClient(parent),
+	m(new Members(& coilData(), & discreteInputData(), & holdingRegisterData(), & inputRegisterData()))
+{
+	m->backend.moveToThread(AcquireThread());
+
+	connect(this, & SimulatorClient::requestAccepted, & m->backend, & internal::SimulatorClientBackend::processRequest);
+
+	connect(this, & SimulatorClient::captureRequested, & m->backend, & internal::SimulatorClientBackend::setCaptureFile);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::replied, this, & SimulatorClient::handleReply);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::stateChanged, this, & SimulatorClient::setState);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::closed, this, & SimulatorClient::stopped);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::opened, this, & SimulatorClient::started);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::errored, this, & SimulatorClient::broke);
+	connect(& m->backend, & internal::SimulatorClientBackend::closed, this, & SimulatorClient::broke);
+
+	connect(& m->backend, & internal::SimulatorClientBackend::virtualTimeChanged, this, & SimulatorClient::setVirtualTime);
+}
+
+SimulatorClient::~SimulatorClient()
+{
+	// Shared thread keeps running, so backend is closed and pulled back to the thread of the client, where it is destroyed.
+	QThread * clientThread = thread();
+	QMetaObject::invokeMethod(& m->backend, [this, clientThread]() {
+		m->backend.ensureClosed();
+		m->backend.moveToThread(clientThread);
+	}, Qt::BlockingQueuedConnection);
+
+	ReleaseThread();
+}
+
+int SimulatorClient::latency() const
+{
+	return m->config.latency();
+}
+
+void SimulatorClient::setLatency(int latency)
+{
+	if (m->config.latency() != latency) {
+		m->config.setLatency(latency);
+		emit latencyChanged();
+	}
+}
+
+int SimulatorClient::latencyDeviation() const
+{
+	return m->config.latencyDeviation();
+}
+
+void SimulatorClient::setLatencyDeviation(int latencyDeviation)
+{
+	if (m->config.latencyDeviation() != latencyDeviation) {
+		m->config.setLatencyDeviation(latencyDeviation);
+		emit latencyDeviationChanged();
+	}
+}
+
+qreal SimulatorClient::lossProbability() const
+{
+	return m->config.lossProbability();
+}
+
+void SimulatorClient::setLossProbability(qreal lossProbability)
+{
+	if (m->config.lossProbability() != lossProbability) {
+		m->config.setLossProbability(lossProbability);
+		emit lossProbabilityChanged();
+	}
+}
+
+qreal SimulatorClient::timeScale() const
+{
+	return m->config.timeScale();
+}
+
+void SimulatorClient::setTimeScale(qreal timeScale)
+{
+	if (m->config.timeScale() != timeScale) {
+		m->config.setTimeScale(timeScale);
+		emit timeScaleChanged();
+	}
+}
+
+int SimulatorClient::seed() const
+{
+	return static_cast<int>(m->config.seed());
+}
+
+void SimulatorClient::setSeed(int seed)
+{
+	if (m->config.seed() != static_cast<quint32>(seed)) {
+		m->config.setSeed(static_cast<quint32>(seed));
+		emit seedChanged();
+	}
+}
+
+QJsonArray SimulatorClient::dynamics() const
+{
+	return m->config.dynamics();
+}
+
+void SimulatorClient::setDynamics(const QJsonArray & dynamics)
+{
+	if (m->config.dynamics() != dynamics) {
+		m->config.setDynamics(dynamics);
+		emit dynamicsChanged();
+	}
+}
+
+qint64 SimulatorClient::virtualTime() const
+{
+	return m->virtualTime;
+}
+
+int SimulatorClient::timeout() const
+{
+	return m->config.timeout();
+}
+
+void SimulatorClient::setTimeout(int timeout)
+{
+	if (m->config.timeout() != timeout) {
+		m->config.setTimeout(timeout);
+		emit timeoutChanged();
+	}
+}
+
+void SimulatorClient::open()
+{
+	emit m->backend.openRequested();
+}
+
+void SimulatorClient::close()
+{
+	emit m->backend.closeRequested();
+}
+
+void SimulatorClient::setVirtualTime(qint64 virtualTime)
+{
+	if (m->virtualTime != virtualTime) {
+		m->virtualTime = virtualTime;
+		emit virtualTimeChanged();
+	}
+}
+
+QThread * SimulatorClient::AcquireThread()
+{
+	QMutexLocker locker(& sharedThread.mutex);
+
+	if (sharedThread.references++ == 0) {
+		sharedThread.thread = new QThread;
+		sharedThread.thread->setObjectName("SimulatorClient");
+		sharedThread.thread->start();
+	}
+	return sharedThread.thread;
+}
+
+void SimulatorClient::ReleaseThread()
+{
+	QMutexLocker locker(& sharedThread.mutex);
+
+	if (--sharedThread.references == 0) {
+		sharedThread.thread->quit();
+		sharedThread.thread->wait();
+		delete sharedThread.thread;
+		sharedThread.thread = nullptr;
+	}
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
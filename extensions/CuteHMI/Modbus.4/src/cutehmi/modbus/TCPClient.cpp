@@ -8,10 +8,13 @@ constexpr int TCPClient::MAX_SLAVE_ADDRESS;
 const char * TCPClient::INITIAL_HOST = internal::TCPClientConfig::INITIAL_HOST;
 constexpr int TCPClient::INITIAL_PORT;
 constexpr int TCPClient::INITIAL_SLAVE_ADDRESS;
+constexpr int TCPClient::INITIAL_TIMEOUT;
+constexpr bool TCPClient::INITIAL_ADAPTIVE_TIMEOUT;
+constexpr int TCPClient::INITIAL_NUMBER_OF_RETRIES;
 
 TCPClient::TCPClient(QObject * parent):
 	AbstractClient(parent),
-	m(new Members)
+	m(new Members(& coilData(), & discreteInputData(), & holdingRegisterData(), & inputRegisterData()))
 {
 	m->backend.moveToThread(& m->thread);
 
@@ -19,6 +22,8 @@ TCPClient::TCPClient(QObject * parent):
 
 	connect(this, & TCPClient::requestAccepted, & m->backend, & internal::QtClientBackend::processRequest);
 
+	connect(this, & TCPClient::captureRequested, & m->backend, & internal::QtClientBackend::setCaptureFile);
+
 	connect(& m->backend, & internal::QtClientBackend::replied, this, & TCPClient::handleReply);
 
 	connect(& m->backend, & internal::QtClientBackend::stateChanged, this, & TCPClient::setState);
@@ -30,6 +35,9 @@ TCPClient::TCPClient(QObject * parent):
 	connect(& m->backend, & internal::QtClientBackend::errored, this, & AbstractDevice::errored);
 	connect(& m->backend, & internal::QtClientBackend::closed, this, & TCPClient::broke);
 
+	connect(& m->backend, & internal::QtClientBackend::roundTripTimeMeasured, this, & TCPClient::setRoundTripTime);
+	connect(& m->backend, & internal::QtClientBackend::respondingChanged, this, & TCPClient::setResponding);
+
 	m->thread.start();
 }
 
@@ -91,6 +99,32 @@ void TCPClient::setTimeout(int timeout)
 	}
 }
 
+bool TCPClient::adaptiveTimeout() const
+{
+	return m->config.adaptiveTimeout();
+}
+
+void TCPClient::setAdaptiveTimeout(bool adaptiveTimeout)
+{
+	if (m->config.adaptiveTimeout() != adaptiveTimeout) {
+		m->config.setAdaptiveTimeout(adaptiveTimeout);
+		emit adaptiveTimeoutChanged();
+	}
+}
+
+int TCPClient::numberOfRetries() const
+{
+	return m->config.numberOfRetries();
+}
+
+void TCPClient::setNumberOfRetries(int numberOfRetries)
+{
+	if (m->config.numberOfRetries() != numberOfRetries) {
+		m->config.setNumberOfRetries(numberOfRetries);
+		emit numberOfRetriesChanged();
+	}
+}
+
 void TCPClient::open()
 {
 	emit m->backend.openRequested();
@@ -1,12 +1,95 @@
 #include <cutehmi/modbus/internal/AbstractClientBackend.hpp>
 
+#include <QJsonArray>
+
 namespace cutehmi {
 namespace modbus {
 namespace internal {
 
 AbstractClientBackend::AbstractClientBackend(QObject * parent):
-	AbstractDeviceBackend(parent)
+	AbstractClientBackend(nullptr, nullptr, nullptr, nullptr, parent)
+{
+}
+
+AbstractClientBackend::AbstractClientBackend(CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
+	AbstractDeviceBackend(parent),
+	m(new Members{coilData, discreteInputData, holdingRegisterData, inputRegisterData})
+{
+}
+
+AbstractClientBackend::CoilDataContainer * AbstractClientBackend::coilData() const
+{
+	return m->coilData;
+}
+
+AbstractClientBackend::DiscreteInputDataContainer * AbstractClientBackend::discreteInputData() const
 {
+	return m->discreteInputData;
+}
+
+AbstractClientBackend::HoldingRegisterDataContainer * AbstractClientBackend::holdingRegisterData() const
+{
+	return m->holdingRegisterData;
+}
+
+AbstractClientBackend::InputRegisterDataContainer * AbstractClientBackend::inputRegisterData() const
+{
+	return m->inputRegisterData;
+}
+
+void AbstractClientBackend::InsertSpan(QJsonObject & reply, quint16 address, int amount)
+{
+	QJsonObject span;
+	span.insert("address", static_cast<double>(address));
+	span.insert("amount", amount);
+	reply.insert("span", span);
+}
+
+void AbstractClientBackend::completeCapturedReply(AbstractDevice::Function function, QJsonObject & reply) const
+{
+	if (!reply.contains("span"))
+		return;
+
+	QJsonObject span = reply.value("span").toObject();
+	std::size_t address = static_cast<quint16>(span.value("address").toDouble());
+	std::size_t end = address + static_cast<std::size_t>(span.value("amount").toInt());
+	QJsonArray values;
+	switch (function) {
+		case AbstractDevice::FUNCTION_READ_COILS:
+			for (; address < end; address++) {
+				const Coil * coil = static_cast<const CoilDataContainer *>(m->coilData)->at(address);
+				values.append(coil ? coil->value() : false);
+			}
+			break;
+		case AbstractDevice::FUNCTION_READ_DISCRETE_INPUTS:
+			for (; address < end; address++) {
+				const DiscreteInput * discreteInput = static_cast<const DiscreteInputDataContainer *>(m->discreteInputData)->at(address);
+				values.append(discreteInput ? discreteInput->value() : false);
+			}
+			break;
+		case AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS:
+		case AbstractDevice::FUNCTION_READ_WRITE_MULTIPLE_HOLDING_REGISTERS:
+			for (; address < end; address++) {
+				const HoldingRegister * holdingRegister = static_cast<const HoldingRegisterDataContainer *>(m->holdingRegisterData)->at(address);
+				values.append(static_cast<double>(holdingRegister ? holdingRegister->value() : 0));
+			}
+			break;
+		case AbstractDevice::FUNCTION_READ_INPUT_REGISTERS:
+			for (; address < end; address++) {
+				const InputRegister * inputRegister = static_cast<const InputRegisterDataContainer *>(m->inputRegisterData)->at(address);
+				values.append(static_cast<double>(inputRegister ? inputRegister->value() : 0));
+			}
+			break;
+		default:
+			CUTEHMI_WARNING("Can not complete reply with span for function code '" << function << "'.");
+			return;
+	}
+	reply.remove("span");
+	reply.insert("values", values);
 }
 
 }
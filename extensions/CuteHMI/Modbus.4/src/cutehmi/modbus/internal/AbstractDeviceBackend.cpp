@@ -8,6 +8,8 @@ namespace internal {
 
 void AbstractDeviceBackend::processRequest(QJsonObject request)
 {
+	captureRequest(request);
+
 	QUuid requestId = QUuid::fromString(request.value("id").toString());
 
 	AbstractDevice::Function function = static_cast<AbstractDevice::Function>(request.value("function").toInt());
@@ -162,11 +164,39 @@ void AbstractDeviceBackend::processRequest(QJsonObject request)
 		CUTEHMI_DEBUG("Device is not ready to process " << humanFunctionName(function) << " request '" << request << "'. ");
 }
 
+void AbstractDeviceBackend::setCaptureFile(QString fileName)
+{
+	if (fileName.isEmpty()) {
+		if (m->capture.isOpen())
+			CUTEHMI_DEBUG("Traffic capture to file '" << m->capture.fileName() << "' stopped.");
+		m->capture.close();
+	} else if (m->capture.open(fileName))
+		CUTEHMI_DEBUG("Capturing traffic to file '" << fileName << "'.");
+	else
+		emit errored(CUTEHMI_ERROR(tr("Could not open capture file '%1'.").arg(fileName)));
+}
+
 AbstractDeviceBackend::AbstractDeviceBackend(QObject * parent):
-	QObject(parent)
+	QObject(parent),
+	m(new Members)
 {
 	connect(this, & AbstractDeviceBackend::openRequested, this, & AbstractDeviceBackend::open);
 	connect(this, & AbstractDeviceBackend::closeRequested, this, & AbstractDeviceBackend::close);
+
+	// Direct connection, so that reply is recorded before the signal leaves backend thread.
+	connect(this, & AbstractDeviceBackend::replied, this, & AbstractDeviceBackend::captureReply, Qt::DirectConnection);
+}
+
+void AbstractDeviceBackend::captureRequest(const QJsonObject & request)
+{
+	if (m->capture.isOpen())
+		m->capture.recordRequest(QUuid::fromString(request.value("id").toString()), request.value("function").toInt(), request.value("payload").toObject());
+}
+
+void AbstractDeviceBackend::completeCapturedReply(AbstractDevice::Function function, QJsonObject & reply) const
+{
+	Q_UNUSED(function)
+	Q_UNUSED(reply)
 }
 
 void AbstractDeviceBackend::readCoils(QUuid requestId, quint16 startAddress, quint16 endAddress)
@@ -335,6 +365,15 @@ void AbstractDeviceBackend::readFIFOQueue(QUuid requestId, quint16 address)
 	replyIllegalFunction(requestId);
 }
 
+void AbstractDeviceBackend::captureReply(QUuid requestId, QJsonObject reply)
+{
+	if (!m->capture.isOpen())
+		return;
+
+	completeCapturedReply(static_cast<AbstractDevice::Function>(m->capture.function(requestId)), reply);
+	m->capture.recordReply(requestId, reply);
+}
+
 void AbstractDeviceBackend::replyIllegalFunction(QUuid requestId)
 {
 	QJsonObject reply;
@@ -40,6 +40,7 @@ bool DummyClientBackend::proceedRequest(QUuid requestId)
 
 		reply.insert("success", false);
 		reply.insert("error", "Timed out.");
+		reply.insert("errorCode", QModbusDevice::TimeoutError);
 
 		emit replied(requestId, reply);
 
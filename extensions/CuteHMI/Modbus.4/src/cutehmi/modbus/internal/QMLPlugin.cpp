@@ -51,11 +51,21 @@ class AbstractClient: public cutehmi::modbus::AbstractClient {};
  */
 class AbstractServer: public cutehmi::modbus::AbstractServer {};
 
+/**
+ * Exposes cutehmi::modbus::DeviceStatistics to QML.
+ */
+class DeviceStatistics: public cutehmi::modbus::DeviceStatistics {};
+
 /**
  * Exposes cutehmi::modbus::DummyClient to QML.
  */
 class DummyClient: public cutehmi::modbus::DummyClient {};
 
+/**
+ * Exposes cutehmi::modbus::SimulatorClient to QML.
+ */
+class SimulatorClient: public cutehmi::modbus::SimulatorClient {};
+
 /**
  * Exposes cutehmi::modbus::TCPClient to QML.
  */
@@ -76,6 +86,11 @@ class RTUClient: public cutehmi::modbus::RTUClient {};
  */
 class RTUServer: public cutehmi::modbus::RTUServer {};
 
+/**
+ * Exposes cutehmi::modbus::ReplayClient to QML.
+ */
+class ReplayClient: public cutehmi::modbus::ReplayClient {};
+
 }
 }
 
@@ -4,19 +4,32 @@
 
 #include <QThread>
 #include <QJsonArray>
+#include <QElapsedTimer>
+
+#include <limits>
 
 namespace cutehmi {
 namespace modbus {
 namespace internal {
 
+constexpr int QtClientBackend::MIN_ADAPTIVE_TIMEOUT;
+constexpr int QtClientBackend::UNRESPONSIVE_TIMEOUTS;
+constexpr int QtClientBackend::MAX_PROBE_INTERVAL;
+
 void QtClientBackend::ensureClosed()
 {
 	if (m->qClient->state() != QModbusDevice::UnconnectedState && m->qClient->state() != QModbusDevice::ClosingState)
 		disconnect();
+	resetResponsiveness();
 }
 
-QtClientBackend::QtClientBackend(std::unique_ptr<QModbusClient> qClient, QObject * parent):
-	AbstractClientBackend(parent),
+QtClientBackend::QtClientBackend(std::unique_ptr<QModbusClient> qClient,
+		CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
+	AbstractClientBackend(coilData, discreteInputData, holdingRegisterData, inputRegisterData, parent),
 	m(new Members{qClient.release()})
 {
 	m->qClient->setParent(this);
@@ -42,6 +55,25 @@ bool QtClientBackend::proceedRequest(QUuid requestId)
 
 		return false;
 	}
+
+	if (!m->responding) {
+		if (m->probeTimer.isValid() && !m->probeTimer.hasExpired(m->probeInterval)) {
+			QJsonObject reply;
+
+			reply.insert("success", false);
+			reply.insert("error", "Slave is not responding.");
+			reply.insert("errorCode", QModbusDevice::TimeoutError);
+
+			emit replied(requestId, reply);
+
+			return false;
+		}
+		// Let the request through as a probe.
+		m->probeTimer.start();
+	}
+
+	applyTimeout();
+
 	return true;
 }
 
@@ -98,6 +130,7 @@ void QtClientBackend::readExceptionStatus(QUuid requestId)
 	QModbusRequest request(QModbusPdu::ReadExceptionStatus);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -135,6 +168,7 @@ void QtClientBackend::diagnostics(QUuid requestId, AbstractDevice::DiagnosticsSu
 	QModbusRequest request(QModbusPdu::Diagnostics, requestArray);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -168,6 +202,7 @@ void QtClientBackend::fetchCommEventCounter(QUuid requestId)
 	QModbusRequest request(QModbusPdu::GetCommEventCounter);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -201,6 +236,7 @@ void QtClientBackend::fetchCommEventLog(QUuid requestId)
 	QModbusRequest request(QModbusPdu::GetCommEventLog);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -241,6 +277,7 @@ void QtClientBackend::reportSlaveId(QUuid requestId)
 	QModbusRequest request(QModbusPdu::ReportServerId);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -295,6 +332,7 @@ void QtClientBackend::readFileRecord(QUuid requestId, quint8 byteCount, QJsonArr
 	QModbusRequest request(QModbusPdu::ReadFileRecord, requestArray);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -366,6 +404,7 @@ void QtClientBackend::writeFileRecord(QUuid requestId, quint8 byteCount, QJsonAr
 	QModbusRequest request(QModbusPdu::WriteFileRecord, requestArray);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -429,6 +468,7 @@ void QtClientBackend::maskWriteHoldingRegister(QUuid requestId, quint16 address,
 	QModbusRequest request(QModbusPdu::MaskWriteRegister, requestArray);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -465,14 +505,11 @@ void QtClientBackend::readWriteMultipleHoldingRegisters(QUuid requestId, quint16
 
 	QModbusReply * modbusReply = m->qClient->sendReadWriteRequest(readUnit, writeUnit, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
-				auto modbusValues = modbusReply->result().values();
-				QJsonArray values;
-				for (auto modbusValue = modbusValues.begin(); modbusValue != modbusValues.end(); ++modbusValue)
-					values.append(static_cast<double>(*modbusValue));
-				reply.insert("values", values);
+				prepareReadReply(modbusReply->result(), reply);
 				reply.insert("success", true);
 			} else
 				prepareErrorReply(*modbusReply, reply);
@@ -497,6 +534,7 @@ void QtClientBackend::readFIFOQueue(QUuid requestId, quint16 address)
 	QModbusRequest request(QModbusPdu::ReadFifoQueue, requestArray);
 	QModbusReply * modbusReply = m->qClient->sendRawRequest(request, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
@@ -574,6 +612,8 @@ void QtClientBackend::onStateChanged(QModbusDevice::State state)
 
 	switch (state) {
 		case QModbusDevice::ConnectingState:
+			// Slave may have been restarted or replaced while client was disconnected.
+			resetResponsiveness();
 			emit stateChanged(AbstractDevice::OPENING);
 			break;
 		case QModbusDevice::ConnectedState:
@@ -601,6 +641,7 @@ void QtClientBackend::writeDataUnit(QUuid requestId, const QModbusDataUnit & uni
 {
 	QModbusReply * modbusReply = m->qClient->sendWriteRequest(unit, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError)
@@ -623,14 +664,11 @@ void QtClientBackend::readDataUnitInt(QUuid requestId, const QModbusDataUnit & u
 {
 	QModbusReply * modbusReply = m->qClient->sendReadRequest(unit, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
-				auto modbusValues = modbusReply->result().values();
-				QJsonArray values;
-				for (auto modbusValue = modbusValues.begin(); modbusValue != modbusValues.end(); ++modbusValue)
-					values.append(static_cast<double>(*modbusValue));
-				reply.insert("values", values);
+				prepareReadReply(modbusReply->result(), reply);
 				reply.insert("success", true);
 			} else
 				prepareErrorReply(*modbusReply, reply);
@@ -650,14 +688,11 @@ void QtClientBackend::readDataUnitBool(QUuid requestId, const QModbusDataUnit &
 {
 	QModbusReply * modbusReply = m->qClient->sendReadRequest(unit, slaveAddress());
 	if (!modbusReply->isFinished()) {
+		trackReply(modbusReply);
 		connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply, requestId]() {
 			QJsonObject reply;
 			if (modbusReply->error() == QModbusDevice::NoError) {
-				auto modbusValues = modbusReply->result().values();
-				QJsonArray values;
-				for (auto modbusValue = modbusValues.begin(); modbusValue != modbusValues.end(); ++modbusValue)
-					values.append(static_cast<bool>(*modbusValue));
-				reply.insert("values", values);
+				prepareReadReply(modbusReply->result(), reply);
 				reply.insert("success", true);
 			} else
 				prepareErrorReply(*modbusReply, reply);
@@ -682,6 +717,175 @@ void QtClientBackend::prepareErrorReply(const QModbusReply & modbusReply, QJsonO
 	reply.insert("success", false);
 }
 
+void QtClientBackend::applyTimeout()
+{
+	m->roundTripEstimator.setMaxTimeout(timeout());
+	m->qClient->setTimeout(adaptiveTimeout() ? m->roundTripEstimator.timeout() : timeout());
+	// Requests sent to a slave, which is not responding are probes and they are not retried.
+	m->qClient->setNumberOfRetries(m->responding ? numberOfRetries() : 0);
+}
+
+void QtClientBackend::trackReply(QModbusReply * modbusReply)
+{
+	// If Qt client sends requests one at a time, request is assumed to be sent once reply to the preceding request has finished.
+	if (!queuesRequests() || m->pendingReplies.isEmpty())
+		m->roundTripTimers[modbusReply].start();
+	m->pendingReplies.append(modbusReply);
+
+	// Connection is made before connection of any request specific handler, so the estimator gets updated before reply is emitted.
+	connect(modbusReply, & QModbusReply::finished, this, [this, modbusReply]() {
+		// Replies to requests issued before responsiveness has been reset are not taken into account.
+		if (!m->pendingReplies.contains(modbusReply))
+			return;
+
+		int roundTripTime = untrackReply(modbusReply);
+		switch (modbusReply->error()) {
+			case QModbusDevice::NoError:
+			case QModbusDevice::ProtocolError:
+				// Exception response is still a response from the slave.
+				if (roundTripTime >= 0)
+					handleRoundTrip(roundTripTime);
+				break;
+			case QModbusDevice::TimeoutError:
+				handleTimeout();
+				break;
+			default:
+				break;
+		}
+	});
+}
+
+int QtClientBackend::untrackReply(QModbusReply * modbusReply)
+{
+	m->pendingReplies.removeOne(modbusReply);
+	QElapsedTimer roundTripTimer = m->roundTripTimers.take(modbusReply);
+	if (queuesRequests() && !m->pendingReplies.isEmpty())
+		m->roundTripTimers[m->pendingReplies.first()].start();
+
+	return roundTripTimer.isValid() ? static_cast<int>(roundTripTimer.elapsed()) : -1;
+}
+
+void QtClientBackend::resetResponsiveness()
+{
+	m->pendingReplies.clear();
+	m->roundTripTimers.clear();
+	m->roundTripEstimator.reset();
+	m->consecutiveTimeouts = 0;
+	m->probeInterval = 0;
+	m->probeTimer.invalidate();
+	if (!m->responding) {
+		m->responding = true;
+		emit respondingChanged(true);
+	}
+}
+
+void QtClientBackend::handleRoundTrip(int roundTripTime)
+{
+	// Note: if Qt client retried the request, measured time includes retries. This overestimates round-trip time, which is safe.
+	m->roundTripEstimator.sample(roundTripTime);
+	m->consecutiveTimeouts = 0;
+
+	if (!m->responding) {
+		CUTEHMI_DEBUG("Slave " << slaveAddress() << " is responding again.");
+		m->responding = true;
+		m->probeTimer.invalidate();
+		emit respondingChanged(true);
+	}
+
+	emit roundTripTimeMeasured(m->roundTripEstimator.smoothedRoundTripTime(), m->roundTripEstimator.timeout());
+}
+
+void QtClientBackend::handleTimeout()
+{
+	m->roundTripEstimator.backOff();
+	m->consecutiveTimeouts++;
+
+	if (m->responding) {
+		if (m->consecutiveTimeouts >= UNRESPONSIVE_TIMEOUTS) {
+			CUTEHMI_WARNING("Slave " << slaveAddress() << " has not responded to " << m->consecutiveTimeouts << " consecutive requests. Further requests will be limited to probes.");
+			m->responding = false;
+			m->probeInterval = qMin(timeout(), MAX_PROBE_INTERVAL);
+			m->probeTimer.start();
+			emit respondingChanged(false);
+		}
+	} else
+		m->probeInterval = qMin(m->probeInterval * 2, MAX_PROBE_INTERVAL);
+}
+
+void QtClientBackend::prepareReadReply(const QModbusDataUnit & unit, QJsonObject & reply)
+{
+	if (storeDataUnit(unit)) {
+		//<CuteHMI.Modbus-9.workaround target="Qt" cause="design">
+		// QModbusDataUnit::valueCount() uses `uint` as return type. It should be safe however to cast it to `int`, because of
+		// @ref cutehmi-modbus-AbstractDevice-query_limits.
+		InsertSpan(reply, static_cast<quint16>(unit.startAddress()), static_cast<int>(unit.valueCount()));
+		//</CuteHMI.Modbus-9.workaround>
+		return;
+	}
+
+	auto modbusValues = unit.values();
+	QJsonArray values;
+	if (unit.registerType() == QModbusDataUnit::Coils || unit.registerType() == QModbusDataUnit::DiscreteInputs)
+		for (auto modbusValue = modbusValues.begin(); modbusValue != modbusValues.end(); ++modbusValue)
+			values.append(static_cast<bool>(*modbusValue));
+	else
+		for (auto modbusValue = modbusValues.begin(); modbusValue != modbusValues.end(); ++modbusValue)
+			values.append(static_cast<double>(*modbusValue));
+	reply.insert("values", values);
+}
+
+bool QtClientBackend::storeDataUnit(const QModbusDataUnit & unit)
+{
+	//<CuteHMI.Modbus-6.unsolved target="Qt" cause="design">
+	// QModbusDataUnit::startAddress() returns `int` value. On systems, where `int` is 16 bit wide it will fail to cover whole
+	// Modbus address range (0 - 65535).
+	static_assert(std::numeric_limits<quint16>::max() <= static_cast<quint16>(std::numeric_limits<int>::max()), "can not safely use startAddress() function on this system");
+	std::size_t startAddress = static_cast<quint16>(unit.startAddress());
+	//</CuteHMI.Modbus-6.unsolved>
+
+	// Note: `uint` returned by valueCount() is guaranteed to be at least 16 bit wide.
+	std::size_t count = unit.valueCount();
+
+	// Values are stored in the same order as they appear in the data unit, so a running index is sufficient.
+	//<CuteHMI.Modbus-3.workaround target="Qt" cause="design">
+	// QModbusDataUnit::value() function accepts `int` type as its `index` parameter. It should be however safe to cast index to
+	// `int` here, even if `int` is 16 bit wide, because of @ref cutehmi-modbus-AbstractDevice-query_limits.
+	int index = 0;
+	switch (unit.registerType()) {
+		case QModbusDataUnit::Coils:
+			if (coilData() == nullptr)
+				return false;
+			coilData()->forEachValue(startAddress, count, [& unit, & index](Coil * coil) {
+				coil->setValue(static_cast<bool>(unit.value(index++)));
+			});
+			return true;
+		case QModbusDataUnit::DiscreteInputs:
+			if (discreteInputData() == nullptr)
+				return false;
+			discreteInputData()->forEachValue(startAddress, count, [& unit, & index](DiscreteInput * discreteInput) {
+				discreteInput->setValue(static_cast<bool>(unit.value(index++)));
+			});
+			return true;
+		case QModbusDataUnit::HoldingRegisters:
+			if (holdingRegisterData() == nullptr)
+				return false;
+			holdingRegisterData()->forEachValue(startAddress, count, [& unit, & index](HoldingRegister * holdingRegister) {
+				holdingRegister->setValue(unit.value(index++));
+			});
+			return true;
+		case QModbusDataUnit::InputRegisters:
+			if (inputRegisterData() == nullptr)
+				return false;
+			inputRegisterData()->forEachValue(startAddress, count, [& unit, & index](InputRegister * inputRegister) {
+				inputRegister->setValue(unit.value(index++));
+			});
+			return true;
+		default:
+			return false;
+	}
+	//</CuteHMI.Modbus-3.workaround>
+}
+
 void QtClientBackend::pushByte(uchar byte, uchar *& destination)
 {
 	*destination = byte;
@@ -10,9 +10,14 @@ namespace cutehmi {
 namespace modbus {
 namespace internal {
 
-QtRTUClientBackend::QtRTUClientBackend(RTUClientConfig * config, QObject * parent):
+QtRTUClientBackend::QtRTUClientBackend(RTUClientConfig * config,
+		CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
 	//<CuteHMI.Workarounds.Qt5Compatibility-2.workaround target="Qt" cause="Qt5">
-	QtClientBackend(std::make_unique<workarounds::qt5compatibility::QModbusRtuSerialClient>(), parent),
+	QtClientBackend(std::make_unique<workarounds::qt5compatibility::QModbusRtuSerialClient>(), coilData, discreteInputData, holdingRegisterData, inputRegisterData, parent),
 	//</CuteHMI.Workarounds.Qt5Compatibility-2.workaround>
 	m(new Members(config))
 {
@@ -23,9 +28,31 @@ int QtRTUClientBackend::slaveAddress() const
 	return m->config->slaveAddress();
 }
 
+int QtRTUClientBackend::timeout() const
+{
+	return m->config->timeout();
+}
+
+bool QtRTUClientBackend::adaptiveTimeout() const
+{
+	return m->config->adaptiveTimeout();
+}
+
+int QtRTUClientBackend::numberOfRetries() const
+{
+	return m->config->numberOfRetries();
+}
+
+bool QtRTUClientBackend::queuesRequests() const
+{
+	// Qt RTU master keeps requests in a queue and sends next one after reply to the previous one has finished.
+	return true;
+}
+
 void QtRTUClientBackend::configureConnection()
 {
 	qClient()->setTimeout(m->config->timeout());
+	qClient()->setNumberOfRetries(m->config->numberOfRetries());
 	qClient()->setConnectionParameter(QModbusDevice::SerialPortNameParameter, m->config->port());
 	qClient()->setConnectionParameter(QModbusDevice::SerialParityParameter, m->config->parity());
 	qClient()->setConnectionParameter(QModbusDevice::SerialBaudRateParameter, m->config->baudRate());
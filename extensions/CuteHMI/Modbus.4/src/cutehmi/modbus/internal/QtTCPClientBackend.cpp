@@ -6,8 +6,13 @@ namespace cutehmi {
 namespace modbus {
 namespace internal {
 
-QtTCPClientBackend::QtTCPClientBackend(TCPClientConfig * config, QObject * parent):
-	QtClientBackend(std::make_unique<QModbusTcpClient>(), parent),
+QtTCPClientBackend::QtTCPClientBackend(TCPClientConfig * config,
+		CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
+	QtClientBackend(std::make_unique<QModbusTcpClient>(), coilData, discreteInputData, holdingRegisterData, inputRegisterData, parent),
 	m(new Members(config))
 {
 }
@@ -17,9 +22,30 @@ int QtTCPClientBackend::slaveAddress() const
 	return m->config->slaveAddress();
 }
 
+int QtTCPClientBackend::timeout() const
+{
+	return m->config->timeout();
+}
+
+bool QtTCPClientBackend::adaptiveTimeout() const
+{
+	return m->config->adaptiveTimeout();
+}
+
+int QtTCPClientBackend::numberOfRetries() const
+{
+	return m->config->numberOfRetries();
+}
+
+bool QtTCPClientBackend::queuesRequests() const
+{
+	return false;
+}
+
 void QtTCPClientBackend::configureConnection()
 {
 	qClient()->setTimeout(m->config->timeout());
+	qClient()->setNumberOfRetries(m->config->numberOfRetries());
 	qClient()->setConnectionParameter(QModbusDevice::NetworkAddressParameter, m->config->host());
 	qClient()->setConnectionParameter(QModbusDevice::NetworkPortParameter, m->config->port());
 
@@ -12,6 +12,9 @@ constexpr QSerialPort::BaudRate RTUClientConfig::INITIAL_BAUD_RATE;
 constexpr QSerialPort::DataBits RTUClientConfig::INITIAL_DATA_BITS;
 constexpr QSerialPort::StopBits RTUClientConfig::INITIAL_STOP_BITS;
 constexpr int RTUClientConfig::INITIAL_SLAVE_ADDRESS;
+constexpr int RTUClientConfig::INITIAL_TIMEOUT;
+constexpr bool RTUClientConfig::INITIAL_ADAPTIVE_TIMEOUT;
+constexpr int RTUClientConfig::INITIAL_NUMBER_OF_RETRIES;
 
 RTUClientConfig::RTUClientConfig(QObject * parent):
 	Config(parent),
@@ -131,6 +134,38 @@ void RTUClientConfig::setTimeout(int timeout)
 	emit configChanged();
 }
 
+bool RTUClientConfig::adaptiveTimeout() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->adaptiveTimeout;
+}
+
+void RTUClientConfig::setAdaptiveTimeout(bool adaptiveTimeout)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->adaptiveTimeout = adaptiveTimeout;
+
+	emit configChanged();
+}
+
+int RTUClientConfig::numberOfRetries() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->numberOfRetries;
+}
+
+void RTUClientConfig::setNumberOfRetries(int numberOfRetries)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->numberOfRetries = numberOfRetries;
+
+	emit configChanged();
+}
+
 }
 }
 }
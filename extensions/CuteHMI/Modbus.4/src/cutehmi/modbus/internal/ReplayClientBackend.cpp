@@ -0,0 +1,216 @@
+#include <cutehmi/modbus/internal/ReplayClientBackend.hpp>
+#include <cutehmi/modbus/internal/TrafficCapture.hpp>
+
+#include <QTimer>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+ReplayClientBackend::ReplayClientBackend(ReplayClientConfig * config,
+		CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
+	AbstractClientBackend(coilData, discreteInputData, holdingRegisterData, inputRegisterData, parent),
+	m(new Members(config))
+{
+}
+
+void ReplayClientBackend::processRequest(QJsonObject request)
+{
+	captureRequest(request);
+
+	QUuid requestId = QUuid::fromString(request.value("id").toString());
+	if (!proceedRequest(requestId))
+		return;
+
+	AbstractDevice::Function function = static_cast<AbstractDevice::Function>(request.value("function").toInt());
+	QJsonObject payload = request.value("payload").toObject();
+	auto sequence = m->exchanges.find(Key(function, payload));
+	if (sequence == m->exchanges.end()) {
+		QJsonObject reply;
+
+		reply.insert("success", false);
+		reply.insert("error", "No recorded reply.");
+
+		CUTEHMI_DEBUG("No recorded reply to request '" << request << "'.");
+		emit replied(requestId, reply);
+
+		return;
+	}
+
+	const Exchange & exchange = sequence->exchanges.at(sequence->next);
+	sequence->next = (sequence->next + 1) % sequence->exchanges.count();
+
+	QJsonObject reply = exchange.reply;
+	storeValues(function, payload, reply);
+	deliver(requestId, reply, exchange.roundTripTime);
+}
+
+void ReplayClientBackend::ensureClosed()
+{
+	if (m->state != AbstractDevice::CLOSED && m->state != AbstractDevice::CLOSING)
+		close();
+}
+
+bool ReplayClientBackend::proceedRequest(QUuid requestId)
+{
+	if (m->state != AbstractDevice::OPENED) {
+		QJsonObject reply;
+
+		reply.insert("success", false);
+		reply.insert("error", "Client not connected.");
+
+		emit replied(requestId, reply);
+
+		return false;
+	}
+
+	return true;
+}
+
+void ReplayClientBackend::open()
+{
+	setState(AbstractClient::OPENING);
+
+	if (!load()) {
+		emit errored(CUTEHMI_ERROR(tr("Could not load capture file '%1'.").arg(m->config->file())));
+		setState(AbstractClient::CLOSED);
+		emit closed();
+		return;
+	}
+
+	setState(AbstractClient::OPENED);
+	emit opened();
+	CUTEHMI_DEBUG("Replaying traffic from file '" << m->config->file() << "'.");
+}
+
+void ReplayClientBackend::close()
+{
+	setState(AbstractClient::CLOSING);
+	m->exchanges.clear();
+	setState(AbstractClient::CLOSED);
+	emit closed();
+	CUTEHMI_DEBUG("Replay stopped.");
+}
+
+QByteArray ReplayClientBackend::Key(int function, const QJsonObject & payload)
+{
+	// Keys of JSON object are sorted, so compact JSON representation is canonical.
+	return QByteArray::number(function) + QJsonDocument(payload).toJson(QJsonDocument::Compact);
+}
+
+void ReplayClientBackend::setState(AbstractClient::State state)
+{
+	if (m->state != state) {
+		m->state = state;
+		emit stateChanged(state);
+	}
+}
+
+bool ReplayClientBackend::load()
+{
+	typedef QHash<QUuid, TrafficCapture::Record> PendingRequestsContainer;
+
+	m->exchanges.clear();
+
+	TrafficCapture::RecordsContainer records;
+	if (!TrafficCapture::Load(m->config->file(), records))
+		return false;
+
+	PendingRequestsContainer pendingRequests;
+	for (auto record = records.begin(); record != records.end(); ++record) {
+		if (record->kind == TrafficCapture::REQUEST)
+			pendingRequests.insert(record->id, *record);
+		else {
+			auto request = pendingRequests.find(record->id);
+			if (request == pendingRequests.end())
+				continue;
+			m->exchanges[Key(request->function, request->object)].exchanges.append({record->object, record->timestamp - request->timestamp});
+			pendingRequests.erase(request);
+		}
+	}
+
+	CUTEHMI_DEBUG("Loaded " << records.count() << " records from capture file '" << m->config->file() << "' (" << m->exchanges.count() << " distinct requests).");
+
+	return true;
+}
+
+void ReplayClientBackend::storeValues(AbstractDevice::Function function, const QJsonObject & payload, QJsonObject & reply)
+{
+	if (!reply.contains("values"))
+		return;
+
+	QJsonArray values = reply.value("values").toArray();
+	std::size_t startAddress = static_cast<quint16>(payload.value(function == AbstractDevice::FUNCTION_READ_WRITE_MULTIPLE_HOLDING_REGISTERS ? "readAddress" : "address").toDouble());
+	// Size of values array is limited by @ref cutehmi-modbus-AbstractDevice-query_limits.
+	std::size_t count = std::min(static_cast<std::size_t>(values.count()), CoilDataContainer::ADDRESS_SPACE - startAddress);
+	int index = 0;
+	switch (function) {
+		case AbstractDevice::FUNCTION_READ_COILS:
+			if (coilData() == nullptr)
+				return;
+			coilData()->forEachValue(startAddress, count, [& values, & index](Coil * coil) {
+				coil->setValue(values.at(index++).toBool());
+			});
+			break;
+		case AbstractDevice::FUNCTION_READ_DISCRETE_INPUTS:
+			if (discreteInputData() == nullptr)
+				return;
+			discreteInputData()->forEachValue(startAddress, count, [& values, & index](DiscreteInput * discreteInput) {
+				discreteInput->setValue(values.at(index++).toBool());
+			});
+			break;
+		case AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS:
+		case AbstractDevice::FUNCTION_READ_WRITE_MULTIPLE_HOLDING_REGISTERS:
+			if (holdingRegisterData() == nullptr)
+				return;
+			holdingRegisterData()->forEachValue(startAddress, count, [& values, & index](HoldingRegister * holdingRegister) {
+				holdingRegister->setValue(static_cast<quint16>(values.at(index++).toDouble()));
+			});
+			break;
+		case AbstractDevice::FUNCTION_READ_INPUT_REGISTERS:
+			if (inputRegisterData() == nullptr)
+				return;
+			inputRegisterData()->forEachValue(startAddress, count, [& values, & index](InputRegister * inputRegister) {
+				inputRegister->setValue(static_cast<quint16>(values.at(index++).toDouble()));
+			});
+			break;
+		default:
+			return;
+	}
+	reply.remove("values");
+	InsertSpan(reply, static_cast<quint16>(startAddress), static_cast<int>(count));
+}
+
+void ReplayClientBackend::deliver(QUuid requestId, const QJsonObject & reply, qint64 roundTripTime)
+{
+	qreal timeScale = m->config->timeScale();
+	if (timeScale <= 0.0)
+		emit replied(requestId, reply);
+	else
+		QTimer::singleShot(qRound(roundTripTime / 1000.0 * timeScale), this, [this, requestId, reply]() {
+			emit replied(requestId, reply);
+		});
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,111 @@
+#include <cutehmi/modbus/internal/RoundTripEstimator.hpp>
+
+#include <QtMath>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+constexpr int RoundTripEstimator::CLOCK_GRANULARITY;
+
+RoundTripEstimator::RoundTripEstimator(int minTimeout, int maxTimeout):
+	m(new Members(minTimeout, maxTimeout))
+{
+}
+
+int RoundTripEstimator::minTimeout() const
+{
+	return m->minTimeout;
+}
+
+void RoundTripEstimator::setMinTimeout(int minTimeout)
+{
+	m->minTimeout = minTimeout;
+}
+
+int RoundTripEstimator::maxTimeout() const
+{
+	return m->maxTimeout;
+}
+
+void RoundTripEstimator::setMaxTimeout(int maxTimeout)
+{
+	m->maxTimeout = maxTimeout;
+}
+
+bool RoundTripEstimator::hasSamples() const
+{
+	return m->hasSamples;
+}
+
+int RoundTripEstimator::smoothedRoundTripTime() const
+{
+	return qCeil(m->smoothedRoundTripTime);
+}
+
+int RoundTripEstimator::roundTripTimeVariation() const
+{
+	return qCeil(m->roundTripTimeVariation);
+}
+
+int RoundTripEstimator::timeout() const
+{
+	if (!m->hasSamples)
+		return m->maxTimeout;
+
+	qint64 timeout = qCeil(m->smoothedRoundTripTime + std::max(static_cast<double>(CLOCK_GRANULARITY), 4.0 * m->roundTripTimeVariation));
+	timeout <<= m->backOffShift;
+
+	// Upper bound takes precedence over lower bound, so that misconfigured bounds never exceed the configured timeout.
+	return static_cast<int>(std::min(std::max(timeout, static_cast<qint64>(m->minTimeout)), static_cast<qint64>(m->maxTimeout)));
+}
+
+void RoundTripEstimator::sample(int roundTripTime)
+{
+	static constexpr double ALPHA = 1.0 / 8.0;
+	static constexpr double BETA = 1.0 / 4.0;
+
+	if (m->hasSamples) {
+		m->roundTripTimeVariation = (1.0 - BETA) * m->roundTripTimeVariation + BETA * qAbs(m->smoothedRoundTripTime - roundTripTime);
+		m->smoothedRoundTripTime = (1.0 - ALPHA) * m->smoothedRoundTripTime + ALPHA * roundTripTime;
+	} else {
+		m->smoothedRoundTripTime = roundTripTime;
+		m->roundTripTimeVariation = roundTripTime / 2.0;
+		m->hasSamples = true;
+	}
+	m->backOffShift = 0;
+}
+
+void RoundTripEstimator::backOff()
+{
+	// Shift is limited, so that timeout can not overflow. Timeout is clamped to maximal timeout anyways.
+	static constexpr int MAX_BACK_OFF_SHIFT = 16;
+
+	if (m->backOffShift < MAX_BACK_OFF_SHIFT)
+		m->backOffShift++;
+}
+
+void RoundTripEstimator::reset()
+{
+	m->hasSamples = false;
+	m->smoothedRoundTripTime = 0.0;
+	m->roundTripTimeVariation = 0.0;
+	m->backOffShift = 0;
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,364 @@
+#include <cutehmi/modbus/internal/SimulatorClientBackend.hpp>
+#include <cutehmi/modbus/internal/functions.hpp>
+
+#include <QTimer>
+#include <QJsonArray>
+#include <QModbusDevice>
+#include <QtMath>
+
+#include <algorithm>
+#include <limits>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+SimulatorClientBackend::SimulatorClientBackend(SimulatorClientConfig * config,
+		CoilDataContainer * coilData,
+		DiscreteInputDataContainer * discreteInputData,
+		HoldingRegisterDataContainer * holdingRegisterData,
+		InputRegisterDataContainer * inputRegisterData,
+		QObject * parent):
+	AbstractClientBackend(coilData, discreteInputData, holdingRegisterData, inputRegisterData, parent),
+	m(new Members(config))
+{
+}
+
+void SimulatorClientBackend::ensureClosed()
+{
+	if (m->state != AbstractDevice::CLOSED && m->state != AbstractDevice::CLOSING)
+		close();
+}
+
+bool SimulatorClientBackend::proceedRequest(QUuid requestId)
+{
+	if (m->state != AbstractDevice::OPENED) {
+		QJsonObject reply;
+
+		reply.insert("success", false);
+		reply.insert("error", "Client not connected.");
+
+		emit replied(requestId, reply);
+
+		return false;
+	}
+
+	// Requests arrive at the slave not earlier than they have been issued.
+	qreal timeScale = m->config->timeScale();
+	if (timeScale > 0.0)
+		m->virtualTime = std::max(m->virtualTime, qRound64(m->wallClock.elapsed() / timeScale));
+
+	int timeout = m->config->timeout();
+	int latency = m->config->latency();
+	int latencyDeviation = m->config->latencyDeviation();
+	if (latencyDeviation > 0)
+		latency = std::max(0, qRound(std::normal_distribution<qreal>(latency, latencyDeviation)(m->generator)));
+
+	bool lost = std::bernoulli_distribution(qBound(0.0, m->config->lossProbability(), 1.0))(m->generator);
+	if (lost || latency > timeout) {
+		m->virtualTime += timeout;
+		emit virtualTimeChanged(m->virtualTime);
+
+		QJsonObject reply;
+
+		reply.insert("success", false);
+		reply.insert("error", "Timed out.");
+		reply.insert("errorCode", QModbusDevice::TimeoutError);
+
+		deliver(requestId, reply, timeout);
+
+		return false;
+	}
+
+	// Slave processes the request at the moment, when the request reaches it.
+	m->virtualTime += latency;
+	m->requestLatency = latency;
+	emit virtualTimeChanged(m->virtualTime);
+
+	return true;
+}
+
+void SimulatorClientBackend::readCoils(QUuid requestId, quint16 startAddress, quint16 endAddress)
+{
+	read(requestId, COIL, startAddress, endAddress);
+}
+
+void SimulatorClientBackend::writeCoil(QUuid requestId, quint16 address, bool value)
+{
+	write(requestId, COIL, address, QVector<quint16>{value});
+}
+
+void SimulatorClientBackend::writeMultipleCoils(QUuid requestId, quint16 startAddress, const QVector<quint16> & values)
+{
+	write(requestId, COIL, startAddress, values);
+}
+
+void SimulatorClientBackend::readDiscreteInputs(QUuid requestId, quint16 startAddress, quint16 endAddress)
+{
+	read(requestId, DISCRETE_INPUT, startAddress, endAddress);
+}
+
+void SimulatorClientBackend::writeDiscreteInput(QUuid requestId, quint16 address, bool value)
+{
+	write(requestId, DISCRETE_INPUT, address, QVector<quint16>{value});
+}
+
+void SimulatorClientBackend::writeMultipleDiscreteInputs(QUuid requestId, quint16 startAddress, const QVector<quint16> & values)
+{
+	write(requestId, DISCRETE_INPUT, startAddress, values);
+}
+
+void SimulatorClientBackend::readHoldingRegisters(QUuid requestId, quint16 startAddress, quint16 endAddress)
+{
+	read(requestId, HOLDING_REGISTER, startAddress, endAddress);
+}
+
+void SimulatorClientBackend::writeHoldingRegister(QUuid requestId, quint16 address, quint16 value)
+{
+	write(requestId, HOLDING_REGISTER, address, QVector<quint16>{value});
+}
+
+void SimulatorClientBackend::writeMultipleHoldingRegisters(QUuid requestId, quint16 startAddress, const QVector<quint16> & values)
+{
+	write(requestId, HOLDING_REGISTER, startAddress, values);
+}
+
+void SimulatorClientBackend::readInputRegisters(QUuid requestId, quint16 startAddress, quint16 endAddress)
+{
+	read(requestId, INPUT_REGISTER, startAddress, endAddress);
+}
+
+void SimulatorClientBackend::writeInputRegister(QUuid requestId, quint16 address, quint16 value)
+{
+	write(requestId, INPUT_REGISTER, address, QVector<quint16>{value});
+}
+
+void SimulatorClientBackend::writeMultipleInputRegisters(QUuid requestId, quint16 startAddress, const QVector<quint16> & values)
+{
+	write(requestId, INPUT_REGISTER, startAddress, values);
+}
+
+void SimulatorClientBackend::open()
+{
+	setState(AbstractClient::OPENING);
+
+	m->generator.seed(m->config->seed());
+	m->virtualTime = 0;
+	m->wallClock.start();
+	emit virtualTimeChanged(m->virtualTime);
+	parseDynamics();
+
+	setState(AbstractClient::OPENED);
+	emit opened();
+	CUTEHMI_DEBUG("Simulated connection established.");
+}
+
+void SimulatorClientBackend::close()
+{
+	setState(AbstractClient::CLOSING);
+	setState(AbstractClient::CLOSED);
+	emit closed();
+	CUTEHMI_DEBUG("Simulated connection closed.");
+}
+
+void SimulatorClientBackend::setState(AbstractClient::State state)
+{
+	if (m->state != state) {
+		m->state = state;
+		emit stateChanged(state);
+	}
+}
+
+void SimulatorClientBackend::parseDynamics()
+{
+	static const QHash<QString, RegisterType> REGISTER_TYPES = {
+		{"coil", COIL},
+		{"discreteInput", DISCRETE_INPUT},
+		{"holdingRegister", HOLDING_REGISTER},
+		{"inputRegister", INPUT_REGISTER}
+	};
+
+	static const QHash<QString, Dynamics::Type> DYNAMICS_TYPES = {
+		{"constant", Dynamics::CONSTANT},
+		{"ramp", Dynamics::RAMP},
+		{"sine", Dynamics::SINE},
+		{"square", Dynamics::SQUARE},
+		{"noise", Dynamics::NOISE}
+	};
+
+	for (auto && dynamics : m->dynamics)
+		dynamics.clear();
+
+	QJsonArray script = m->config->dynamics();
+	for (auto entry = script.begin(); entry != script.end(); ++entry) {
+		QJsonObject object = entry->toObject();
+
+		auto registerType = REGISTER_TYPES.find(object.value("register").toString());
+		if (registerType == REGISTER_TYPES.end()) {
+			CUTEHMI_WARNING("Ignoring dynamics entry with unrecognized register type '" << object.value("register").toString() << "'.");
+			continue;
+		}
+		auto dynamicsType = DYNAMICS_TYPES.find(object.value("type").toString("constant"));
+		if (dynamicsType == DYNAMICS_TYPES.end()) {
+			CUTEHMI_WARNING("Ignoring dynamics entry with unrecognized type '" << object.value("type").toString() << "'.");
+			continue;
+		}
+
+		Dynamics dynamics;
+		dynamics.type = *dynamicsType;
+		if (dynamics.type == Dynamics::CONSTANT) {
+			dynamics.low = object.value("value").toDouble();
+			dynamics.high = dynamics.low;
+		} else {
+			dynamics.low = object.value("low").toDouble(dynamics.low);
+			dynamics.high = object.value("high").toDouble(dynamics.high);
+		}
+		dynamics.period = std::max(1.0, object.value("period").toDouble(dynamics.period));
+		dynamics.phase = object.value("phase").toDouble(dynamics.phase);
+		dynamics.duty = qBound(0.0, object.value("duty").toDouble(dynamics.duty), 1.0);
+		dynamics.noise = object.value("noise").toDouble(dynamics.noise);
+
+		int address = object.value("address").toInt();
+		int count = object.value("count").toInt(1);
+		for (int i = 0; i < count && address + i <= std::numeric_limits<quint16>::max(); i++)
+			m->dynamics[*registerType].insert(static_cast<quint16>(address + i), dynamics);
+	}
+}
+
+quint16 SimulatorClientBackend::value(RegisterType type, quint16 address)
+{
+	auto dynamics = m->dynamics[type].constFind(address);
+	if (dynamics == m->dynamics[type].constEnd())
+		return m->memory[type].value(address, 0);
+
+	qreal time = m->virtualTime + dynamics->phase;
+	qreal cycle = std::fmod(time, dynamics->period) / dynamics->period;
+	qreal result;
+	switch (dynamics->type) {
+		case Dynamics::RAMP:
+			result = dynamics->low + (dynamics->high - dynamics->low) * cycle;
+			break;
+		case Dynamics::SINE:
+			result = (dynamics->low + dynamics->high) / 2.0 + (dynamics->high - dynamics->low) / 2.0 * qSin(2.0 * M_PI * cycle);
+			break;
+		case Dynamics::SQUARE:
+			result = cycle < dynamics->duty ? dynamics->high : dynamics->low;
+			break;
+		case Dynamics::NOISE:
+			result = std::uniform_real_distribution<qreal>(dynamics->low, dynamics->high)(m->generator);
+			break;
+		default:
+			result = dynamics->low;
+	}
+	if (dynamics->noise > 0.0)
+		result += std::uniform_real_distribution<qreal>(-dynamics->noise, dynamics->noise)(m->generator);
+
+	if (type == COIL || type == DISCRETE_INPUT)
+		return result >= 0.5 ? 1 : 0;
+
+	// Negative values are stored in two's complement, so that INT16 encoding can be used with register controllers.
+	qint64 integer = qRound64(result);
+	if (integer < 0)
+		return int16ToUint16(static_cast<qint16>(std::max(integer, static_cast<qint64>(std::numeric_limits<qint16>::min()))));
+	return static_cast<quint16>(std::min(integer, static_cast<qint64>(std::numeric_limits<quint16>::max())));
+}
+
+void SimulatorClientBackend::read(QUuid requestId, RegisterType type, quint16 startAddress, quint16 endAddress)
+{
+	QJsonObject reply;
+
+	std::size_t count = static_cast<std::size_t>(endAddress - startAddress) + 1;
+	quint16 address = startAddress;
+	bool stored = true;
+	switch (type) {
+		case COIL:
+			if (coilData() != nullptr)
+				coilData()->forEachValue(startAddress, count, [this, & address](Coil * coil) {
+					coil->setValue(static_cast<bool>(value(COIL, address++)));
+				});
+			else
+				stored = false;
+			break;
+		case DISCRETE_INPUT:
+			if (discreteInputData() != nullptr)
+				discreteInputData()->forEachValue(startAddress, count, [this, & address](DiscreteInput * discreteInput) {
+					discreteInput->setValue(static_cast<bool>(value(DISCRETE_INPUT, address++)));
+				});
+			else
+				stored = false;
+			break;
+		case HOLDING_REGISTER:
+			if (holdingRegisterData() != nullptr)
+				holdingRegisterData()->forEachValue(startAddress, count, [this, & address](HoldingRegister * holdingRegister) {
+					holdingRegister->setValue(value(HOLDING_REGISTER, address++));
+				});
+			else
+				stored = false;
+			break;
+		case INPUT_REGISTER:
+			if (inputRegisterData() != nullptr)
+				inputRegisterData()->forEachValue(startAddress, count, [this, & address](InputRegister * inputRegister) {
+					inputRegister->setValue(value(INPUT_REGISTER, address++));
+				});
+			else
+				stored = false;
+			break;
+		default:
+			stored = false;
+	}
+
+	if (stored)
+		InsertSpan(reply, startAddress, static_cast<int>(count));
+	else {
+		QJsonArray values;
+		for (std::size_t i = 0; i < count; i++, address++)
+			if (type == COIL || type == DISCRETE_INPUT)
+				values.append(static_cast<bool>(value(type, address)));
+			else
+				values.append(static_cast<double>(value(type, address)));
+		reply.insert("values", values);
+	}
+	reply.insert("success", true);
+
+	deliver(requestId, reply, m->requestLatency);
+}
+
+void SimulatorClientBackend::write(QUuid requestId, RegisterType type, quint16 startAddress, const QVector<quint16> & values)
+{
+	QJsonObject reply;
+
+	// Size of @a values vector is limited by @ref cutehmi-modbus-AbstractDevice-query_limits.
+	quint16 address = startAddress;
+	for (auto value = values.begin(); value != values.end(); ++value, ++address)
+		m->memory[type].insert(address, (type == COIL || type == DISCRETE_INPUT) ? (*value ? 1 : 0) : *value);
+
+	reply.insert("success", true);
+
+	deliver(requestId, reply, m->requestLatency);
+}
+
+void SimulatorClientBackend::deliver(QUuid requestId, const QJsonObject & reply, int latency)
+{
+	qreal timeScale = m->config->timeScale();
+	if (timeScale <= 0.0)
+		emit replied(requestId, reply);
+	else
+		QTimer::singleShot(qRound(latency * timeScale), this, [this, requestId, reply]() {
+			emit replied(requestId, reply);
+		});
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
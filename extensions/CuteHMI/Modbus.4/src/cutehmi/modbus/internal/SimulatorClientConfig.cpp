@@ -0,0 +1,145 @@
+#include <cutehmi/modbus/internal/SimulatorClientConfig.hpp>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+constexpr int SimulatorClientConfig::INITIAL_LATENCY;
+constexpr int SimulatorClientConfig::INITIAL_LATENCY_DEVIATION;
+constexpr qreal SimulatorClientConfig::INITIAL_LOSS_PROBABILITY;
+constexpr int SimulatorClientConfig::INITIAL_TIMEOUT;
+constexpr qreal SimulatorClientConfig::INITIAL_TIME_SCALE;
+constexpr quint32 SimulatorClientConfig::INITIAL_SEED;
+
+SimulatorClientConfig::SimulatorClientConfig(QObject * parent):
+	Config(parent),
+	m(new Members)
+{
+}
+
+int SimulatorClientConfig::latency() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->latency;
+}
+
+void SimulatorClientConfig::setLatency(int latency)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->latency = latency;
+
+	emit configChanged();
+}
+
+int SimulatorClientConfig::latencyDeviation() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->latencyDeviation;
+}
+
+void SimulatorClientConfig::setLatencyDeviation(int latencyDeviation)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->latencyDeviation = latencyDeviation;
+
+	emit configChanged();
+}
+
+qreal SimulatorClientConfig::lossProbability() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->lossProbability;
+}
+
+void SimulatorClientConfig::setLossProbability(qreal lossProbability)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->lossProbability = lossProbability;
+
+	emit configChanged();
+}
+
+int SimulatorClientConfig::timeout() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->timeout;
+}
+
+void SimulatorClientConfig::setTimeout(int timeout)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->timeout = timeout;
+
+	emit configChanged();
+}
+
+qreal SimulatorClientConfig::timeScale() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->timeScale;
+}
+
+void SimulatorClientConfig::setTimeScale(qreal timeScale)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->timeScale = timeScale;
+
+	emit configChanged();
+}
+
+quint32 SimulatorClientConfig::seed() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->seed;
+}
+
+void SimulatorClientConfig::setSeed(quint32 seed)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->seed = seed;
+
+	emit configChanged();
+}
+
+QJsonArray SimulatorClientConfig::dynamics() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->dynamics;
+}
+
+void SimulatorClientConfig::setDynamics(const QJsonArray & dynamics)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->dynamics = dynamics;
+
+	emit configChanged();
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
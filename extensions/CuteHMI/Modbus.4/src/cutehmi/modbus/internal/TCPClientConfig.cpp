@@ -9,6 +9,9 @@ constexpr int TCPClientConfig::MAX_SLAVE_ADDRESS;
 const char * TCPClientConfig::INITIAL_HOST = "localhost";
 constexpr int TCPClientConfig::INITIAL_PORT;
 constexpr int TCPClientConfig::INITIAL_SLAVE_ADDRESS;
+constexpr int TCPClientConfig::INITIAL_TIMEOUT;
+constexpr bool TCPClientConfig::INITIAL_ADAPTIVE_TIMEOUT;
+constexpr int TCPClientConfig::INITIAL_NUMBER_OF_RETRIES;
 
 TCPClientConfig::TCPClientConfig(QObject * parent):
 	Config(parent),
@@ -80,6 +83,38 @@ void TCPClientConfig::setTimeout(int timeout)
 	emit configChanged();
 }
 
+bool TCPClientConfig::adaptiveTimeout() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->adaptiveTimeout;
+}
+
+void TCPClientConfig::setAdaptiveTimeout(bool adaptiveTimeout)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->adaptiveTimeout = adaptiveTimeout;
+
+	emit configChanged();
+}
+
+int TCPClientConfig::numberOfRetries() const
+{
+	QReadLocker locker(& m->lock);
+
+	return m->numberOfRetries;
+}
+
+void TCPClientConfig::setNumberOfRetries(int numberOfRetries)
+{
+	QWriteLocker locker(& m->lock);
+
+	m->numberOfRetries = numberOfRetries;
+
+	emit configChanged();
+}
+
 }
 }
 }
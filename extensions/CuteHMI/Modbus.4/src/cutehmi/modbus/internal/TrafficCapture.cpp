@@ -0,0 +1,164 @@
+#include <cutehmi/modbus/internal/TrafficCapture.hpp>
+#include <cutehmi/modbus/AbstractDevice.hpp>
+
+#include <QCborValue>
+#include <QDateTime>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+constexpr quint32 TrafficCapture::MAGIC;
+constexpr quint16 TrafficCapture::VERSION;
+
+bool TrafficCapture::Load(const QString & fileName, RecordsContainer & records)
+{
+	QFile file(fileName);
+	if (!file.open(QIODevice::ReadOnly)) {
+		CUTEHMI_WARNING("Could not open capture file '" << fileName << "': " << file.errorString() << ".");
+		return false;
+	}
+
+	QDataStream stream(& file);
+	stream.setVersion(QDataStream::Qt_5_12);
+
+	quint32 magic;
+	quint16 version;
+	qint64 startTime;
+	stream >> magic >> version >> startTime;
+	if (stream.status() != QDataStream::Ok || magic != MAGIC) {
+		CUTEHMI_WARNING("File '" << fileName << "' is not a capture file.");
+		return false;
+	}
+	if (version > VERSION) {
+		CUTEHMI_WARNING("Unsupported version " << version << " of capture file '" << fileName << "'.");
+		return false;
+	}
+
+	while (!stream.atEnd()) {
+		Record record;
+		quint8 kind;
+		char id[16];
+		QByteArray object;
+
+		stream >> kind >> record.timestamp;
+		if (stream.readRawData(id, sizeof(id)) != sizeof(id))
+			stream.setStatus(QDataStream::ReadPastEnd);
+		record.kind = static_cast<Kind>(kind);
+		record.id = QUuid::fromRfc4122(QByteArray::fromRawData(id, sizeof(id)));
+		record.function = AbstractDevice::FUNCTION_INVALID;
+		if (record.kind == REQUEST) {
+			quint16 function;
+			stream >> function;
+			record.function = function;
+		}
+		stream >> object;
+
+		if (stream.status() != QDataStream::Ok) {
+			// Capture could have been interrupted in the middle of a record, thus truncated last record is not an error.
+			CUTEHMI_WARNING("Capture file '" << fileName << "' is truncated.");
+			return true;
+		}
+		if (record.kind != REQUEST && record.kind != REPLY) {
+			CUTEHMI_WARNING("Unrecognized record in capture file '" << fileName << "'.");
+			return false;
+		}
+		record.object = QCborValue::fromCbor(object).toJsonValue().toObject();
+		records.append(record);
+	}
+
+	return true;
+}
+
+TrafficCapture::TrafficCapture():
+	m(new Members)
+{
+	m->stream.setVersion(QDataStream::Qt_5_12);
+}
+
+TrafficCapture::~TrafficCapture()
+{
+	close();
+}
+
+bool TrafficCapture::open(const QString & fileName)
+{
+	close();
+
+	m->file.setFileName(fileName);
+	if (!m->file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		CUTEHMI_WARNING("Could not open capture file '" << fileName << "': " << m->file.errorString() << ".");
+		return false;
+	}
+	m->stream.setDevice(& m->file);
+	m->stream << MAGIC << VERSION << QDateTime::currentMSecsSinceEpoch();
+	m->timer.start();
+
+	return true;
+}
+
+void TrafficCapture::close()
+{
+	if (m->file.isOpen()) {
+		m->stream.setDevice(nullptr);
+		m->file.close();
+	}
+	m->pendingFunctions.clear();
+}
+
+bool TrafficCapture::isOpen() const
+{
+	return m->file.isOpen();
+}
+
+QString TrafficCapture::fileName() const
+{
+	return m->file.fileName();
+}
+
+void TrafficCapture::recordRequest(QUuid id, int function, const QJsonObject & payload)
+{
+	if (!isOpen())
+		return;
+
+	writeHeader(REQUEST, id);
+	m->stream << static_cast<quint16>(function) << QCborValue::fromJsonValue(payload).toCbor();
+	m->pendingFunctions.insert(id, function);
+}
+
+void TrafficCapture::recordReply(QUuid id, const QJsonObject & reply)
+{
+	if (!isOpen())
+		return;
+
+	writeHeader(REPLY, id);
+	m->stream << QCborValue::fromJsonValue(reply).toCbor();
+	m->pendingFunctions.remove(id);
+}
+
+int TrafficCapture::function(QUuid id) const
+{
+	return m->pendingFunctions.value(id, AbstractDevice::FUNCTION_INVALID);
+}
+
+void TrafficCapture::writeHeader(Kind kind, QUuid id)
+{
+	m->stream << static_cast<quint8>(kind) << m->timer.nsecsElapsed() / 1000;
+	QByteArray rawId = id.toRfc4122();
+	m->stream.writeRawData(rawId.constData(), rawId.size());
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,177 @@
+#include <cutehmi/modbus/internal/DataContainer.hpp>
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+#include <atomic>
+#include <memory>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+class test_DataContainer:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void value();
+
+		void forEachValue();
+
+		void forEachValueBounds();
+
+		void forEachValueConcurrent();
+
+	private:
+		static constexpr std::size_t SIZE = 16;
+
+		struct Value
+		{
+			std::atomic<int> visits{0};
+		};
+
+		typedef DataContainer<Value, SIZE> Container;
+
+		static QList<std::size_t> Keys(const Container & container);
+};
+
+constexpr std::size_t test_DataContainer::SIZE;
+
+void test_DataContainer::value()
+{
+	Container container;
+	QVERIFY(container.at(3) == nullptr);
+
+	Value * value = container.value(3);
+	QVERIFY(value != nullptr);
+	QCOMPARE(container.at(3), value);
+	QCOMPARE(container.value(3), value);
+	QCOMPARE(Keys(container), QList<std::size_t>({3}));
+
+	container.free();
+	QVERIFY(container.at(3) == nullptr);
+	QVERIFY(Keys(container).isEmpty());
+}
+
+void test_DataContainer::forEachValue()
+{
+	Container container;
+	Value * existing = container.value(3);
+	existing->visits = 10;
+
+	// Missing values are created, while existing ones are retained.
+	QList<Value *> visited;
+	container.forEachValue(2, 4, [& visited](Value * value) {
+		visited.append(value);
+		value->visits++;
+	});
+	QCOMPARE(visited.count(), 4);
+	for (int i = 0; i < visited.count(); i++)
+		QCOMPARE(visited.at(i), container.at(2 + static_cast<std::size_t>(i)));
+	QCOMPARE(container.at(3), existing);
+	QCOMPARE(existing->visits.load(), 11);
+	QCOMPARE(container.at(2)->visits.load(), 1);
+	QVERIFY(container.at(1) == nullptr);
+	QVERIFY(container.at(6) == nullptr);
+
+	// Keys of created values are recorded once.
+	QList<std::size_t> keys = Keys(container);
+	std::sort(keys.begin(), keys.end());
+	QCOMPARE(keys, QList<std::size_t>({2, 3, 4, 5}));
+
+	// When all the values exist, they are visited in the same order without creating new ones.
+	QList<Value *> revisited;
+	container.forEachValue(2, 4, [& revisited](Value * value) {
+		revisited.append(value);
+		value->visits++;
+	});
+	QCOMPARE(revisited, visited);
+	QCOMPARE(container.at(2)->visits.load(), 2);
+	QCOMPARE(Keys(container).size(), 4);
+
+	container.free();
+}
+
+void test_DataContainer::forEachValueBounds()
+{
+	Container container;
+	int calls = 0;
+
+	container.forEachValue(0, 0, [& calls](Value *) {
+		calls++;
+	});
+	QCOMPARE(calls, 0);
+	QVERIFY(Keys(container).isEmpty());
+
+	container.forEachValue(SIZE - 2, 2, [& calls](Value *) {
+		calls++;
+	});
+	QCOMPARE(calls, 2);
+	QVERIFY(container.at(SIZE - 1) != nullptr);
+	QVERIFY(container.at(SIZE - 3) == nullptr);
+
+	container.free();
+}
+
+void test_DataContainer::forEachValueConcurrent()
+{
+	static constexpr int ITERATIONS = 1000;
+
+	Container container;
+	auto visitAll = [& container]() {
+		for (int i = 0; i < ITERATIONS; i++) {
+			// Ranges overlap and shift on each iteration, so that threads race to create values.
+			std::size_t first = static_cast<std::size_t>(i) % (SIZE / 2);
+			container.forEachValue(first, SIZE / 2, [](Value * value) {
+				value->visits++;
+			});
+			if (i % 100 == 0)
+				container.free();
+		}
+		container.forEachValue(0, SIZE, [](Value * value) {
+			value->visits++;
+		});
+	};
+
+	std::unique_ptr<QThread> thread(QThread::create(visitAll));
+	thread->start();
+	visitAll();
+	QVERIFY(thread->wait(10000));
+
+	// Each value has been created only once.
+	QList<std::size_t> keys = Keys(container);
+	QCOMPARE(keys.size(), static_cast<int>(SIZE));
+	std::sort(keys.begin(), keys.end());
+	for (std::size_t i = 0; i < SIZE; i++)
+		QCOMPARE(keys.at(static_cast<int>(i)), i);
+
+	container.free();
+}
+
+QList<std::size_t> test_DataContainer::Keys(const Container & container)
+{
+	QList<std::size_t> result;
+	for (auto && key : container.keys())
+		result.append(key);
+	return result;
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::internal::test_DataContainer)
+#include "test_DataContainer.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
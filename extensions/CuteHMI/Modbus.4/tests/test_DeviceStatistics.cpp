@@ -0,0 +1,228 @@
+#include <cutehmi/modbus/DeviceStatistics.hpp>
+#include <cutehmi/modbus/AbstractDevice.hpp>
+
+#include <QtTest/QtTest>
+#include <QModbusDevice>
+
+namespace cutehmi {
+namespace modbus {
+
+class test_DeviceStatistics:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void percentiles();
+
+		void lastBucket();
+
+		void counters();
+
+		void openMetrics();
+
+		void deviceLabel();
+
+	private:
+		static QJsonObject ReadHoldingRegistersRequest(int amount);
+
+		static QJsonObject WriteCoilRequest();
+
+		static QJsonObject Reply(bool success, int elapsed);
+};
+
+void test_DeviceStatistics::percentiles()
+{
+	DeviceStatistics statistics;
+	QCOMPARE(statistics.roundTripTimePercentile(0.5), 0);
+
+	// Samples fall into buckets (0, 1], (2, 5], (20, 50] and (100, 200].
+	QJsonObject request = ReadHoldingRegistersRequest(1);
+	for (int i = 0; i < 4; i++)
+		statistics.recordReply(request, Reply(true, 1));
+	for (int i = 0; i < 4; i++)
+		statistics.recordReply(request, Reply(true, 4));
+	statistics.recordReply(request, Reply(true, 30));
+	statistics.recordReply(request, Reply(true, 150));
+
+	// Percentiles are interpolated linearly within a bucket.
+	QCOMPARE(statistics.roundTripTimePercentile(0.4), 1);
+	QCOMPARE(statistics.roundTripTimeP50(), 3);
+
+	// Upper bound of a bucket is clamped to the longest round-trip time.
+	QCOMPARE(statistics.roundTripTimeP95(), 125);
+	QCOMPARE(statistics.roundTripTimeP99(), 145);
+	QCOMPARE(statistics.roundTripTimePercentile(1.0), 150);
+
+	statistics.reset();
+	QCOMPARE(statistics.roundTripTimeP50(), 0);
+}
+
+void test_DeviceStatistics::lastBucket()
+{
+	DeviceStatistics statistics;
+	QJsonObject request = ReadHoldingRegistersRequest(1);
+
+	// Last bucket has no upper bound, so longest round-trip time is returned.
+	statistics.recordReply(request, Reply(true, 10));
+	statistics.recordReply(request, Reply(true, 40000));
+	QCOMPARE(statistics.roundTripTimePercentile(0.5), 10);
+	QCOMPARE(statistics.roundTripTimePercentile(0.9), 40000);
+	QCOMPARE(statistics.roundTripTimeP99(), 40000);
+}
+
+void test_DeviceStatistics::counters()
+{
+	DeviceStatistics statistics;
+	QJsonObject readRequest = ReadHoldingRegistersRequest(2);
+	QJsonObject writeRequest = WriteCoilRequest();
+	QJsonObject timeoutReply = Reply(false, 1500);
+	timeoutReply.insert("errorCode", QModbusDevice::TimeoutError);
+
+	statistics.recordRequest(readRequest);
+	statistics.recordReply(readRequest, Reply(true, 4));
+	statistics.recordRequest(writeRequest);
+	statistics.recordReply(writeRequest, timeoutReply);
+	statistics.recordQueueDepth(2);
+	statistics.recordQueueDepth(1);
+	statistics.recordPollingCycle(250);
+
+	QCOMPARE(statistics.requests(), 2);
+	QCOMPARE(statistics.replies(), 2);
+	QCOMPARE(statistics.errors(), 1);
+	QCOMPARE(statistics.timeouts(), 1);
+	QCOMPARE(statistics.requestCount(AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS), 1);
+	QCOMPARE(statistics.errorCount(AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS), 0);
+	QCOMPARE(statistics.timeoutCount(AbstractDevice::FUNCTION_WRITE_COIL), 1);
+	QCOMPARE(statistics.queueDepth(), 1);
+	QCOMPARE(statistics.maxQueueDepth(), 2);
+	QCOMPARE(statistics.pollingCycleDuration(), 250);
+
+	// Read request and write coil request take 5 bytes each. Reply to read request carries byte count and 2 registers.
+	QCOMPARE(statistics.bytesSent(), Q_INT64_C(10));
+	QCOMPARE(statistics.bytesReceived(), Q_INT64_C(6));
+
+	// Maximal queue depth is reset to current queue depth.
+	statistics.reset();
+	QCOMPARE(statistics.requests(), 0);
+	QCOMPARE(statistics.requestCount(AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS), 0);
+	QCOMPARE(statistics.maxQueueDepth(), 1);
+	QCOMPARE(statistics.bytesSent(), Q_INT64_C(0));
+}
+
+void test_DeviceStatistics::openMetrics()
+{
+	QObject device;
+	device.setObjectName("plc");
+	DeviceStatistics statistics(& device);
+	QJsonObject readRequest = ReadHoldingRegistersRequest(2);
+	QJsonObject writeRequest = WriteCoilRequest();
+	QJsonObject timeoutReply = Reply(false, 1500);
+	timeoutReply.insert("errorCode", QModbusDevice::TimeoutError);
+
+	statistics.recordRequest(readRequest);
+	statistics.recordReply(readRequest, Reply(true, 4));
+	statistics.recordRequest(writeRequest);
+	statistics.recordReply(writeRequest, timeoutReply);
+	statistics.recordQueueDepth(1);
+	statistics.recordPollingCycle(250);
+
+	QStringList expected = {
+		"# TYPE cutehmi_modbus_requests counter",
+		"# HELP cutehmi_modbus_requests Requests issued.",
+		"cutehmi_modbus_requests_total{device=\"plc\",function=\"read_holding_registers\"} 1",
+		"cutehmi_modbus_requests_total{device=\"plc\",function=\"write_coil\"} 1",
+		"# TYPE cutehmi_modbus_replies counter",
+		"# HELP cutehmi_modbus_replies Replies handled.",
+		"cutehmi_modbus_replies_total{device=\"plc\",function=\"read_holding_registers\"} 1",
+		"cutehmi_modbus_replies_total{device=\"plc\",function=\"write_coil\"} 1",
+		"# TYPE cutehmi_modbus_errors counter",
+		"# HELP cutehmi_modbus_errors Failed requests.",
+		"cutehmi_modbus_errors_total{device=\"plc\",function=\"read_holding_registers\"} 0",
+		"cutehmi_modbus_errors_total{device=\"plc\",function=\"write_coil\"} 1",
+		"# TYPE cutehmi_modbus_timeouts counter",
+		"# HELP cutehmi_modbus_timeouts Timed out requests.",
+		"cutehmi_modbus_timeouts_total{device=\"plc\",function=\"read_holding_registers\"} 0",
+		"cutehmi_modbus_timeouts_total{device=\"plc\",function=\"write_coil\"} 1",
+		"# TYPE cutehmi_modbus_queue_depth gauge",
+		"# HELP cutehmi_modbus_queue_depth Pending requests.",
+		"cutehmi_modbus_queue_depth{device=\"plc\"} 1",
+		"# TYPE cutehmi_modbus_bytes counter",
+		"# UNIT cutehmi_modbus_bytes bytes",
+		"# HELP cutehmi_modbus_bytes Estimated size of protocol data units.",
+		"cutehmi_modbus_bytes_total{device=\"plc\",direction=\"sent\"} 10",
+		"cutehmi_modbus_bytes_total{device=\"plc\",direction=\"received\"} 6",
+		"# TYPE cutehmi_modbus_round_trip_time_seconds histogram",
+		"# UNIT cutehmi_modbus_round_trip_time_seconds seconds",
+		"# HELP cutehmi_modbus_round_trip_time_seconds Time between issuing a request and handling its reply.",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.001\"} 0",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.002\"} 0",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.005\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.01\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.02\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.05\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.1\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.2\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"0.5\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"1\"} 1",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"2\"} 2",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"5\"} 2",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"10\"} 2",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"30\"} 2",
+		"cutehmi_modbus_round_trip_time_seconds_bucket{device=\"plc\",le=\"+Inf\"} 2",
+		"cutehmi_modbus_round_trip_time_seconds_sum{device=\"plc\"} 1.504",
+		"cutehmi_modbus_round_trip_time_seconds_count{device=\"plc\"} 2",
+		"# TYPE cutehmi_modbus_polling_cycle_duration_seconds gauge",
+		"# UNIT cutehmi_modbus_polling_cycle_duration_seconds seconds",
+		"# HELP cutehmi_modbus_polling_cycle_duration_seconds Duration of last complete polling cycle.",
+		"cutehmi_modbus_polling_cycle_duration_seconds{device=\"plc\"} 0.25",
+		"# EOF"
+	};
+	QCOMPARE(statistics.toOpenMetrics().split('\n'), expected << "");
+}
+
+void test_DeviceStatistics::deviceLabel()
+{
+	// Without device name metrics are not labeled, unless they have labels of their own.
+	DeviceStatistics statistics;
+	QVERIFY(statistics.toOpenMetrics().contains("\ncutehmi_modbus_queue_depth 0\n"));
+	QVERIFY(statistics.toOpenMetrics().contains("\ncutehmi_modbus_bytes_total{direction=\"sent\"} 0\n"));
+
+	// Quotes and backslashes in device name are escaped.
+	QObject device;
+	device.setObjectName("plc \"1\\2\"");
+	DeviceStatistics deviceStatistics(& device);
+	QVERIFY(deviceStatistics.toOpenMetrics().contains("\ncutehmi_modbus_queue_depth{device=\"plc \\\"1\\\\2\\\"\"} 0\n"));
+}
+
+QJsonObject test_DeviceStatistics::ReadHoldingRegistersRequest(int amount)
+{
+	return QJsonObject{{"function", AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS}, {"payload", QJsonObject{{"address", 0}, {"amount", amount}}}};
+}
+
+QJsonObject test_DeviceStatistics::WriteCoilRequest()
+{
+	return QJsonObject{{"function", AbstractDevice::FUNCTION_WRITE_COIL}, {"payload", QJsonObject{{"address", 0}, {"value", true}}}};
+}
+
+QJsonObject test_DeviceStatistics::Reply(bool success, int elapsed)
+{
+	return QJsonObject{{"success", success}, {"elapsed", elapsed}};
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::test_DeviceStatistics)
+#include "test_DeviceStatistics.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,232 @@
+#include <cutehmi/modbus/TCPClient.hpp>
+#include <cutehmi/modbus/internal/QtClientBackend.hpp>
+
+#include <QtTest/QtTest>
+#include <QModbusDevice>
+#include <QTcpServer>
+#include <QTcpSocket>
+
+namespace cutehmi {
+namespace modbus {
+
+/**
+ * Test of responsiveness tracking of Qt client backend. Backend is driven by TCPClient, which is connected to a minimal Modbus TCP
+ * slave, that can be told to stop responding.
+ */
+class test_QtClientBackend:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void init();
+
+		void cleanup();
+
+		void probing();
+
+		void reconnect();
+
+		void span();
+
+	private:
+		static constexpr int TIMEOUT = 200;
+
+		static constexpr quint16 VALUE = 0x1234;
+
+		/**
+		 * Minimal Modbus TCP slave, which responds to read holding registers requests.
+		 */
+		class Slave:
+			public QTcpServer
+		{
+			public:
+				bool responding = true;
+
+				int requestCount = 0;
+
+				Slave();
+
+			private:
+				void readRequests(QTcpSocket * socket);
+		};
+
+		void open();
+
+		QJsonObject request();
+
+		std::unique_ptr<Slave> m_slave;
+
+		std::unique_ptr<TCPClient> m_client;
+};
+
+constexpr int test_QtClientBackend::TIMEOUT;
+constexpr quint16 test_QtClientBackend::VALUE;
+
+void test_QtClientBackend::init()
+{
+	m_slave = std::make_unique<Slave>();
+	QVERIFY(m_slave->listen(QHostAddress::LocalHost));
+
+	m_client = std::make_unique<TCPClient>();
+	m_client->setHost("127.0.0.1");
+	m_client->setPort(m_slave->serverPort());
+	m_client->setTimeout(TIMEOUT);
+	m_client->setAdaptiveTimeout(false);
+	m_client->setNumberOfRetries(0);
+}
+
+void test_QtClientBackend::cleanup()
+{
+	m_client.reset();
+	m_slave.reset();
+}
+
+void test_QtClientBackend::probing()
+{
+	open();
+	QSignalSpy brokeSpy(m_client.get(), SIGNAL(broke()));
+
+	QJsonObject reply = request();
+	QVERIFY(reply.value("success").toBool());
+	QCOMPARE(m_client->holdingRegisterAt(0)->value(), VALUE);
+
+	// Timeouts do not break the client, but after several consecutive ones slave is considered not responding.
+	m_slave->responding = false;
+	for (int i = 0; i < internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS; i++) {
+		QVERIFY(m_client->responding());
+		reply = request();
+		QVERIFY(!reply.value("success").toBool());
+		QCOMPARE(reply.value("errorCode").toInt(), static_cast<int>(QModbusDevice::TimeoutError));
+	}
+	QVERIFY(!m_client->responding());
+	QCOMPARE(m_slave->requestCount, 1 + internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS);
+
+	// Requests are rejected without touching the bus until probe interval elapses.
+	reply = request();
+	QCOMPARE(reply.value("error").toString(), QString("Slave is not responding."));
+	QCOMPARE(m_slave->requestCount, 1 + internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS);
+
+	// Request issued after probe interval is sent as a probe. Timed out probe doubles probe interval.
+	QTest::qWait(TIMEOUT + TIMEOUT / 4);
+	reply = request();
+	QCOMPARE(reply.value("errorCode").toInt(), static_cast<int>(QModbusDevice::TimeoutError));
+	QCOMPARE(m_slave->requestCount, 2 + internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS);
+	reply = request();
+	QCOMPARE(reply.value("error").toString(), QString("Slave is not responding."));
+	QCOMPARE(m_slave->requestCount, 2 + internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS);
+
+	// First successful probe marks slave as responding again.
+	m_slave->responding = true;
+	QTest::qWait(2 * TIMEOUT);
+	reply = request();
+	QVERIFY(reply.value("success").toBool());
+	QVERIFY(m_client->responding());
+
+	QCOMPARE(m_client->state(), AbstractDevice::OPENED);
+	QCOMPARE(brokeSpy.count(), 0);
+}
+
+void test_QtClientBackend::reconnect()
+{
+	open();
+
+	m_slave->responding = false;
+	for (int i = 0; i < internal::QtClientBackend::UNRESPONSIVE_TIMEOUTS; i++)
+		request();
+	QVERIFY(!m_client->responding());
+
+	// Slave may have been replaced while client was disconnected.
+	m_client->close();
+	QTRY_COMPARE(m_client->state(), AbstractDevice::CLOSED);
+	QTRY_VERIFY(m_client->responding());
+}
+
+void test_QtClientBackend::span()
+{
+	open();
+
+	// Values are stored directly in device registers and reply carries only the range of registers, which have been updated.
+	QSignalSpy spy(m_client.get(), & AbstractDevice::requestCompleted);
+	m_client->requestReadHoldingRegisters(5, 3);
+	QVERIFY(spy.wait(4 * TIMEOUT));
+	QJsonObject reply = spy.last().at(1).toJsonObject();
+	QVERIFY(reply.value("success").toBool());
+	QVERIFY(!reply.contains("values"));
+	QCOMPARE(reply.value("span").toObject().value("address").toInt(), 5);
+	QCOMPARE(reply.value("span").toObject().value("amount").toInt(), 3);
+	for (quint16 address = 5; address < 8; address++)
+		QCOMPARE(m_client->holdingRegisterAt(address)->value(), VALUE);
+	QCOMPARE(m_client->holdingRegisterAt(4)->value(), static_cast<quint16>(0));
+	QCOMPARE(m_client->holdingRegisterAt(8)->value(), static_cast<quint16>(0));
+}
+
+test_QtClientBackend::Slave::Slave()
+{
+	connect(this, & QTcpServer::newConnection, this, [this]() {
+		while (QTcpSocket * socket = nextPendingConnection()) {
+			connect(socket, & QTcpSocket::disconnected, socket, & QObject::deleteLater);
+			connect(socket, & QTcpSocket::readyRead, this, [this, socket]() {
+				readRequests(socket);
+			});
+		}
+	});
+}
+
+void test_QtClientBackend::Slave::readRequests(QTcpSocket * socket)
+{
+	// MBAP header (transaction id, protocol id, length, unit id) followed by function code, address and quantity.
+	static constexpr int REQUEST_SIZE = 12;
+
+	while (socket->bytesAvailable() >= REQUEST_SIZE) {
+		QByteArray request = socket->read(REQUEST_SIZE);
+		requestCount++;
+		if (!responding)
+			continue;
+
+		quint16 quantity = static_cast<quint16>((static_cast<quint8>(request.at(10)) << 8) | static_cast<quint8>(request.at(11)));
+		QByteArray response = request.left(4);
+		response.append(static_cast<char>(0));
+		response.append(static_cast<char>(3 + 2 * quantity));
+		response.append(request.at(6));
+		response.append(request.at(7));
+		response.append(static_cast<char>(2 * quantity));
+		for (quint16 i = 0; i < quantity; i++) {
+			response.append(static_cast<char>(VALUE >> 8));
+			response.append(static_cast<char>(VALUE & 0xFF));
+		}
+		socket->write(response);
+	}
+}
+
+void test_QtClientBackend::open()
+{
+	m_client->open();
+	QTRY_COMPARE(m_client->state(), AbstractDevice::OPENED);
+}
+
+QJsonObject test_QtClientBackend::request()
+{
+	QSignalSpy spy(m_client.get(), & AbstractDevice::requestCompleted);
+	m_client->requestReadHoldingRegisters(0);
+	if (!spy.wait(4 * TIMEOUT))
+		return QJsonObject();
+	return spy.last().at(1).toJsonObject();
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::test_QtClientBackend)
+#include "test_QtClientBackend.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
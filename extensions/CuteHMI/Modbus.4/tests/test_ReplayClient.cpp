@@ -0,0 +1,202 @@
+#include <cutehmi/modbus/ReplayClient.hpp>
+#include <cutehmi/modbus/SimulatorClient.hpp>
+#include <cutehmi/modbus/internal/TrafficCapture.hpp>
+
+#include <QtTest/QtTest>
+#include <QTemporaryDir>
+
+namespace cutehmi {
+namespace modbus {
+
+class test_ReplayClient:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void captureLoad();
+
+		void truncated();
+
+		void notCapture();
+
+		void roundTrip();
+
+	private:
+		static void Open(AbstractClient & client);
+
+		static QJsonObject LastReply(const QSignalSpy & spy);
+};
+
+void test_ReplayClient::captureLoad()
+{
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	QString fileName = dir.filePath("capture.bin");
+
+	QUuid readId = QUuid::createUuid();
+	QUuid writeId = QUuid::createUuid();
+	QJsonObject readPayload{{"address", 10}, {"amount", 2}};
+	QJsonObject readReply{{"success", true}, {"values", QJsonArray{1, 2}}};
+	QJsonObject writePayload{{"address", 3}, {"value", true}};
+	QJsonObject writeReply{{"success", true}};
+	{
+		internal::TrafficCapture capture;
+		QVERIFY(capture.open(fileName));
+		capture.recordRequest(readId, AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS, readPayload);
+		capture.recordRequest(writeId, AbstractDevice::FUNCTION_WRITE_COIL, writePayload);
+		QCOMPARE(capture.function(readId), static_cast<int>(AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS));
+		capture.recordReply(writeId, writeReply);
+		capture.recordReply(readId, readReply);
+		QCOMPARE(capture.function(readId), static_cast<int>(AbstractDevice::FUNCTION_INVALID));
+	}
+
+	internal::TrafficCapture::RecordsContainer records;
+	QVERIFY(internal::TrafficCapture::Load(fileName, records));
+	QCOMPARE(records.count(), 4);
+
+	QCOMPARE(records.at(0).kind, internal::TrafficCapture::REQUEST);
+	QCOMPARE(records.at(0).id, readId);
+	QCOMPARE(records.at(0).function, static_cast<int>(AbstractDevice::FUNCTION_READ_HOLDING_REGISTERS));
+	QCOMPARE(records.at(0).object, readPayload);
+
+	QCOMPARE(records.at(1).kind, internal::TrafficCapture::REQUEST);
+	QCOMPARE(records.at(1).id, writeId);
+	QCOMPARE(records.at(1).function, static_cast<int>(AbstractDevice::FUNCTION_WRITE_COIL));
+	QCOMPARE(records.at(1).object, writePayload);
+
+	QCOMPARE(records.at(2).kind, internal::TrafficCapture::REPLY);
+	QCOMPARE(records.at(2).id, writeId);
+	QCOMPARE(records.at(2).object, writeReply);
+
+	QCOMPARE(records.at(3).kind, internal::TrafficCapture::REPLY);
+	QCOMPARE(records.at(3).id, readId);
+	QCOMPARE(records.at(3).object, readReply);
+
+	for (int i = 1; i < records.count(); i++)
+		QVERIFY(records.at(i).timestamp >= records.at(i - 1).timestamp);
+}
+
+void test_ReplayClient::truncated()
+{
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	QString fileName = dir.filePath("capture.bin");
+
+	{
+		internal::TrafficCapture capture;
+		QVERIFY(capture.open(fileName));
+		QUuid id = QUuid::createUuid();
+		capture.recordRequest(id, AbstractDevice::FUNCTION_READ_COILS, QJsonObject{{"address", 0}, {"amount", 1}});
+		capture.recordReply(id, QJsonObject{{"success", true}, {"values", QJsonArray{true}}});
+	}
+
+	QFile file(fileName);
+	QVERIFY(file.resize(file.size() - 1));
+
+	// Truncated last record is dropped, but records preceding it are preserved.
+	internal::TrafficCapture::RecordsContainer records;
+	QVERIFY(internal::TrafficCapture::Load(fileName, records));
+	QCOMPARE(records.count(), 1);
+	QCOMPARE(records.at(0).kind, internal::TrafficCapture::REQUEST);
+}
+
+void test_ReplayClient::notCapture()
+{
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	QString fileName = dir.filePath("capture.bin");
+
+	QFile file(fileName);
+	QVERIFY(file.open(QIODevice::WriteOnly));
+	file.write("This is not a capture file.");
+	file.close();
+
+	internal::TrafficCapture::RecordsContainer records;
+	QVERIFY(!internal::TrafficCapture::Load(fileName, records));
+	QVERIFY(!internal::TrafficCapture::Load(dir.filePath("missing.bin"), records));
+}
+
+void test_ReplayClient::roundTrip()
+{
+	QTemporaryDir dir;
+	QVERIFY(dir.isValid());
+	QString fileName = dir.filePath("capture.bin");
+
+	QList<quint16> recorded;
+	{
+		SimulatorClient simulator;
+		simulator.setLatency(100);
+		simulator.setLatencyDeviation(0);
+		simulator.setDynamics(QJsonArray{
+			QJsonObject{{"register", "holdingRegister"}, {"address", 0}, {"type", "ramp"}, {"low", 0}, {"high", 1000}, {"period", 1000}}
+		});
+		simulator.setCaptureFile(fileName);
+		Open(simulator);
+
+		QSignalSpy spy(& simulator, & AbstractDevice::requestCompleted);
+		for (int i = 0; i < 3; i++) {
+			simulator.requestReadHoldingRegisters(0);
+			QTRY_COMPARE(spy.count(), i + 1);
+			recorded.append(simulator.holdingRegisterAt(0)->value());
+		}
+		simulator.requestWriteCoil(1, true);
+		QTRY_COMPARE(spy.count(), 4);
+	}
+	// Ramp yields distinct values, so that order of replayed replies can be verified.
+	QCOMPARE(recorded, QList<quint16>({100, 200, 300}));
+
+	internal::TrafficCapture::RecordsContainer records;
+	QVERIFY(internal::TrafficCapture::Load(fileName, records));
+	QCOMPARE(records.count(), 8);
+
+	ReplayClient replay;
+	replay.setFile(fileName);
+	Open(replay);
+
+	QSignalSpy spy(& replay, & AbstractDevice::requestCompleted);
+	// Replies are served in recorded order and then the sequence starts over.
+	for (int i = 0; i < 4; i++) {
+		replay.requestReadHoldingRegisters(0);
+		QTRY_COMPARE(spy.count(), i + 1);
+		QVERIFY(LastReply(spy).value("success").toBool());
+		QCOMPARE(replay.holdingRegisterAt(0)->value(), recorded.at(i % recorded.count()));
+	}
+
+	replay.requestWriteCoil(1, true);
+	QTRY_COMPARE(spy.count(), 5);
+	QVERIFY(LastReply(spy).value("success").toBool());
+
+	// Request, which has not been recorded.
+	replay.requestWriteCoil(1, false);
+	QTRY_COMPARE(spy.count(), 6);
+	QVERIFY(!LastReply(spy).value("success").toBool());
+}
+
+void test_ReplayClient::Open(AbstractClient & client)
+{
+	client.open();
+	QTRY_COMPARE(client.state(), AbstractDevice::OPENED);
+}
+
+QJsonObject test_ReplayClient::LastReply(const QSignalSpy & spy)
+{
+	return spy.last().at(1).toJsonObject();
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::test_ReplayClient)
+#include "test_ReplayClient.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,166 @@
+#include <cutehmi/modbus/internal/RoundTripEstimator.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace modbus {
+namespace internal {
+
+class test_RoundTripEstimator:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initial();
+
+		void firstSample();
+
+		void smoothing();
+
+		void convergence();
+
+		void backOff();
+
+		void bounds();
+
+		void reset();
+};
+
+void test_RoundTripEstimator::initial()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	QVERIFY(!estimator.hasSamples());
+	QCOMPARE(estimator.smoothedRoundTripTime(), 0);
+	QCOMPARE(estimator.roundTripTimeVariation(), 0);
+	QCOMPARE(estimator.timeout(), 1000);
+
+	// Without samples back-off has nothing to act on.
+	estimator.backOff();
+	QCOMPARE(estimator.timeout(), 1000);
+}
+
+void test_RoundTripEstimator::firstSample()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	estimator.sample(100);
+	QVERIFY(estimator.hasSamples());
+	QCOMPARE(estimator.smoothedRoundTripTime(), 100);
+	QCOMPARE(estimator.roundTripTimeVariation(), 50);
+	QCOMPARE(estimator.timeout(), 300);
+}
+
+void test_RoundTripEstimator::smoothing()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	estimator.sample(100);
+	estimator.sample(100);
+	// RTTVAR = 3/4 * 50 + 1/4 * |100 - 100| = 37.5, SRTT = 7/8 * 100 + 1/8 * 100 = 100.
+	QCOMPARE(estimator.smoothedRoundTripTime(), 100);
+	QCOMPARE(estimator.roundTripTimeVariation(), 38);
+	QCOMPARE(estimator.timeout(), 250);
+
+	estimator.sample(180);
+	// RTTVAR = 3/4 * 37.5 + 1/4 * |100 - 180| = 48.125, SRTT = 7/8 * 100 + 1/8 * 180 = 110.
+	QCOMPARE(estimator.smoothedRoundTripTime(), 110);
+	QCOMPARE(estimator.roundTripTimeVariation(), 49);
+	QCOMPARE(estimator.timeout(), 303);
+}
+
+void test_RoundTripEstimator::convergence()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	for (int i = 0; i < 100; i++)
+		estimator.sample(100);
+	QCOMPARE(estimator.smoothedRoundTripTime(), 100);
+	QCOMPARE(estimator.roundTripTimeVariation(), 1);
+	// Variation term is never smaller than clock granularity.
+	QCOMPARE(estimator.timeout(), 100 + RoundTripEstimator::CLOCK_GRANULARITY);
+}
+
+void test_RoundTripEstimator::backOff()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	estimator.sample(100);
+	QCOMPARE(estimator.timeout(), 300);
+
+	estimator.backOff();
+	QCOMPARE(estimator.timeout(), 600);
+
+	estimator.backOff();
+	QCOMPARE(estimator.timeout(), 1000);
+
+	// Excessive back-off must not overflow.
+	for (int i = 0; i < 100; i++)
+		estimator.backOff();
+	QCOMPARE(estimator.timeout(), 1000);
+
+	// Sample cancels back-off.
+	estimator.sample(100);
+	QCOMPARE(estimator.timeout(), 250);
+}
+
+void test_RoundTripEstimator::bounds()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	estimator.sample(1);
+	QCOMPARE(estimator.timeout(), 20);
+
+	estimator.setMinTimeout(50);
+	QCOMPARE(estimator.timeout(), 50);
+
+	estimator.reset();
+	estimator.sample(5000);
+	QCOMPARE(estimator.timeout(), 1000);
+
+	estimator.setMaxTimeout(2000);
+	QCOMPARE(estimator.timeout(), 2000);
+
+	// Upper bound takes precedence over lower bound.
+	estimator.reset();
+	estimator.setMinTimeout(500);
+	estimator.setMaxTimeout(100);
+	estimator.sample(10);
+	QCOMPARE(estimator.timeout(), 100);
+}
+
+void test_RoundTripEstimator::reset()
+{
+	RoundTripEstimator estimator(20, 1000);
+
+	estimator.sample(100);
+	estimator.backOff();
+	estimator.reset();
+	QVERIFY(!estimator.hasSamples());
+	QCOMPARE(estimator.smoothedRoundTripTime(), 0);
+	QCOMPARE(estimator.roundTripTimeVariation(), 0);
+	QCOMPARE(estimator.timeout(), 1000);
+
+	// Estimator starts over as if no samples have been taken.
+	estimator.sample(100);
+	QCOMPARE(estimator.timeout(), 300);
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::internal::test_RoundTripEstimator)
+#include "test_RoundTripEstimator.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
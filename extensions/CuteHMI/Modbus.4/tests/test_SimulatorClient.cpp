@@ -0,0 +1,206 @@
+#include <cutehmi/modbus/SimulatorClient.hpp>
+
+#include <QtTest/QtTest>
+#include <QModbusDevice>
+
+#include <memory>
+#include <vector>
+
+namespace cutehmi {
+namespace modbus {
+
+class test_SimulatorClient:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void openClose();
+
+		void writeRead();
+
+		void latency();
+
+		void loss();
+
+		void dynamics();
+
+		void wallClock();
+
+		void multipleClients();
+
+	private:
+		static void Open(SimulatorClient & client);
+
+		static QJsonObject LastReply(const QSignalSpy & spy);
+};
+
+void test_SimulatorClient::openClose()
+{
+	SimulatorClient client;
+	QCOMPARE(client.state(), AbstractDevice::CLOSED);
+
+	Open(client);
+
+	client.close();
+	QTRY_COMPARE(client.state(), AbstractDevice::CLOSED);
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestReadHoldingRegisters(0);
+	QTRY_COMPARE(spy.count(), 1);
+	QVERIFY(!LastReply(spy).value("success").toBool());
+}
+
+void test_SimulatorClient::writeRead()
+{
+	SimulatorClient client;
+	Open(client);
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestWriteHoldingRegister(10, 1234);
+	QTRY_COMPARE(spy.count(), 1);
+	QVERIFY(LastReply(spy).value("success").toBool());
+
+	client.requestReadHoldingRegisters(10);
+	QTRY_COMPARE(spy.count(), 2);
+	QVERIFY(LastReply(spy).value("success").toBool());
+	QCOMPARE(client.holdingRegisterAt(10)->value(), static_cast<quint16>(1234));
+
+	client.requestWriteCoil(3, true);
+	client.requestReadCoils(3);
+	QTRY_COMPARE(spy.count(), 4);
+	QVERIFY(client.coilAt(3)->value());
+}
+
+void test_SimulatorClient::latency()
+{
+	SimulatorClient client;
+	client.setLatency(5);
+	client.setLatencyDeviation(0);
+	Open(client);
+	QCOMPARE(client.virtualTime(), Q_INT64_C(0));
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestReadHoldingRegisters(0);
+	client.requestReadHoldingRegisters(1);
+	QTRY_COMPARE(spy.count(), 2);
+	QTRY_COMPARE(client.virtualTime(), Q_INT64_C(10));
+}
+
+void test_SimulatorClient::loss()
+{
+	SimulatorClient client;
+	client.setLatency(5);
+	client.setLatencyDeviation(0);
+	client.setTimeout(100);
+	client.setLossProbability(1.0);
+	Open(client);
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestReadHoldingRegisters(0);
+	QTRY_COMPARE(spy.count(), 1);
+	QVERIFY(!LastReply(spy).value("success").toBool());
+	QCOMPARE(LastReply(spy).value("errorCode").toInt(), static_cast<int>(QModbusDevice::TimeoutError));
+	QTRY_COMPARE(client.virtualTime(), Q_INT64_C(100));
+}
+
+void test_SimulatorClient::dynamics()
+{
+	SimulatorClient client;
+	client.setLatency(250);
+	client.setLatencyDeviation(0);
+	client.setTimeout(1000);
+	client.setDynamics(QJsonArray{
+		QJsonObject{{"register", "inputRegister"}, {"address", 0}, {"count", 2}, {"value", 42}},
+		QJsonObject{{"register", "discreteInput"}, {"address", 0}, {"type", "square"}, {"low", 0}, {"high", 1}, {"period", 1000}}
+	});
+	Open(client);
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestReadInputRegisters(0, 2);
+	QTRY_COMPARE(spy.count(), 1);
+	QCOMPARE(client.inputRegisterAt(0)->value(), static_cast<quint16>(42));
+	QCOMPARE(client.inputRegisterAt(1)->value(), static_cast<quint16>(42));
+
+	// Square wave is high during the first half of the period. Requests are processed at virtual times 500, 750 and 1000.
+	client.requestReadDiscreteInputs(0);
+	QTRY_COMPARE(spy.count(), 2);
+	QVERIFY(!client.discreteInputAt(0)->value());
+
+	client.requestReadDiscreteInputs(0);
+	QTRY_COMPARE(spy.count(), 3);
+	QVERIFY(!client.discreteInputAt(0)->value());
+
+	client.requestReadDiscreteInputs(0);
+	QTRY_COMPARE(spy.count(), 4);
+	QVERIFY(client.discreteInputAt(0)->value());
+}
+
+void test_SimulatorClient::wallClock()
+{
+	SimulatorClient client;
+	client.setLatency(0);
+	client.setLatencyDeviation(0);
+	client.setTimeScale(1.0);
+	Open(client);
+
+	QTest::qWait(200);
+
+	QSignalSpy spy(& client, & AbstractDevice::requestCompleted);
+	client.requestReadHoldingRegisters(0);
+	QTRY_COMPARE(spy.count(), 1);
+	QTRY_VERIFY(client.virtualTime() >= 200);
+}
+
+void test_SimulatorClient::multipleClients()
+{
+	static constexpr int CLIENT_COUNT = 4;
+
+	std::vector<std::unique_ptr<SimulatorClient>> clients;
+	for (int i = 0; i < CLIENT_COUNT; i++) {
+		clients.push_back(std::make_unique<SimulatorClient>());
+		Open(*clients.back());
+	}
+
+	for (int i = 0; i < CLIENT_COUNT; i++)
+		clients.at(i)->requestWriteHoldingRegister(0, static_cast<quint16>(i));
+	for (int i = 0; i < CLIENT_COUNT; i++)
+		clients.at(i)->requestReadHoldingRegisters(0);
+	for (int i = 0; i < CLIENT_COUNT; i++)
+		QTRY_COMPARE(clients.at(i)->holdingRegisterAt(0)->value(), static_cast<quint16>(i));
+
+	// Destroying one client must not disturb the others.
+	clients.erase(clients.begin());
+	QSignalSpy spy(clients.front().get(), & AbstractDevice::requestCompleted);
+	clients.front()->requestReadHoldingRegisters(0);
+	QTRY_COMPARE(spy.count(), 1);
+	QVERIFY(LastReply(spy).value("success").toBool());
+}
+
+void test_SimulatorClient::Open(SimulatorClient & client)
+{
+	client.open();
+	QTRY_COMPARE(client.state(), AbstractDevice::OPENED);
+}
+
+QJsonObject test_SimulatorClient::LastReply(const QSignalSpy & spy)
+{
+	return spy.last().at(1).toJsonObject();
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::modbus::test_SimulatorClient)
+#include "test_SimulatorClient.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
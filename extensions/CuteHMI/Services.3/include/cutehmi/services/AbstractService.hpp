@@ -13,6 +13,7 @@
 #include <QStateMachine>
 #include <QTimer>
 #include <QQmlEngine>
+#include <QVariantMap>
 #include <QQmlListProperty>
 
 namespace cutehmi {
@@ -20,6 +21,12 @@ namespace services {
 
 class AbstractServiceController;
 
+namespace internal {
+
+class ServiceMetrics;
+
+}
+
 /**
  * Abstract service.
  *
@@ -60,6 +67,8 @@ class CUTEHMI_SERVICES_API AbstractService:
 
 		Q_PROPERTY(cutehmi::services::StateInterface * states READ states CONSTANT)
 
+		Q_PROPERTY(QVariantMap metrics READ metrics NOTIFY metricsChanged)
+
 		Q_PROPERTY(QQmlListProperty<cutehmi::services::AbstractServiceController> defaultControllers READ defaultControllerList CONSTANT)
 
 		//<CuteHMI.Services-6.workaround target="Qt5" cause="missing">
@@ -121,6 +130,30 @@ class CUTEHMI_SERVICES_API AbstractService:
 		 */
 		cutehmi::services::StateInterface * states() const;
 
+		/**
+		 * Get service metrics. Metrics are collected throughout service lifetime and they can be used to tune timeouts or to find
+		 * services, which take long to start.
+		 * @return map containing following entries:
+		 *	- @p name - name of the service.
+		 *	- @p state - name of current state.
+		 *	- @p transitions - number of transitions.
+		 *	- @p states - map, which for each state name (@p "stopped", @p "starting", @p "yielding", @p "active", @p "idling",
+		 *	@p "stopping", @p "broken", @p "repairing", @p "evacuating", @p "interrupted" and @p "undefined") contains a map with
+		 *	@p count (number of times state has been entered), @p total (total time spent in the state), @p last (time spent in the
+		 *	state during the last visit, including current visit) and @p max (longest visit) entries. Times are given in
+		 *	milliseconds.
+		 *	- @p history - list of maps with @p timestamp (milliseconds since epoch), @p from and @p to entries describing up to 16
+		 *	recent transitions, starting from the oldest one.
+		 *	- @p repairs - map with @p attempts, @p successes and @p rate entries (@p rate is @p null if there were no attempts).
+		 *	.
+		 */
+		QVariantMap metrics() const;
+
+		/**
+		 * Reset service metrics.
+		 */
+		Q_INVOKABLE void resetMetrics();
+
 		QQmlListProperty<cutehmi::services::AbstractServiceController> defaultControllerList();
 
 		QQmlListProperty<cutehmi::services::AbstractServiceController> controllerList();
@@ -149,6 +182,8 @@ class CUTEHMI_SERVICES_API AbstractService:
 
 		void statusChanged();
 
+		void metricsChanged();
+
 		void started();
 
 		void stopped();
@@ -210,6 +245,7 @@ class CUTEHMI_SERVICES_API AbstractService:
 			QString name = INITIAL_NAME;
 			QString status;
 			StateInterface * stateInterface;
+			internal::ServiceMetrics * metrics;
 			ControllersContainer controllers;
 			QQmlListProperty<AbstractServiceController> controllerList;
 			QQmlListProperty<AbstractServiceController> defaultControllerList;
@@ -217,6 +253,7 @@ class CUTEHMI_SERVICES_API AbstractService:
 			Members(AbstractService * p_parent, StateInterface * p_stateInterface, const QString & p_status, const ControllersContainer * p_defaultControllers):
 				status(p_status),
 				stateInterface(p_stateInterface),
+				metrics(nullptr),
 				controllerList(p_parent, & controllers, & AbstractService::ControllerListAppend, & AbstractService::ControllerListCount, & AbstractService::ControllerListAt, & AbstractService::ControllerListClear),
 				defaultControllerList(p_parent, const_cast<ControllersContainer *>(p_defaultControllers), & AbstractService::DefaultControllerListCount, & AbstractService::DefaultControllerListAt)
 			{
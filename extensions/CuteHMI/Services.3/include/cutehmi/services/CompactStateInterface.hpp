@@ -0,0 +1,145 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SERVICES_3_INCLUDE_CUTEHMI_SERVICES_COMPACTSTATEINTERFACE_HPP
+#define H_EXTENSIONS_CUTEHMI_SERVICES_3_INCLUDE_CUTEHMI_SERVICES_COMPACTSTATEINTERFACE_HPP
+
+#include "internal/common.hpp"
+#include "StateInterface.hpp"
+
+#include <QBasicTimer>
+
+namespace cutehmi {
+namespace services {
+
+namespace internal {
+
+class StateFacade;
+
+}
+
+/**
+ * Compact state interface.
+ *
+ * Compact state interface implements standard states with a transition table instead of a state machine. Current state is held by
+ * a single enumeration value (see StateInterface::current), so the whole interface is a single QObject. This makes it suitable for
+ * services, which come in large quantities and do not need to customize their states through Serviceable interface.
+ *
+ * State objects, which are exposed through StateInterface properties, are created lazily on first access. They are driven by a
+ * state machine that follows the table, so their @a active property is updated asynchronously, once the control returns to the
+ * event loop. Code, which tracks service states, should rather rely on StateInterface::current property and
+ * StateInterface::currentChanged() signal.
+ *
+ * %Service, which is constructed with compact state interface, connects its AbstractService::started(), AbstractService::stopped()
+ * and AbstractService::activated() signals to start(), stop() and activate() slots and it follows the status of the interface.
+ * %Service reports its progress with transitionToStarted(), transitionToStopped(), transitionToBroken(), transitionToYielding() and
+ * transitionToIdling() slots. Transitions, which are not declared with constructor parameter, are taken automatically, just like
+ * when Serviceable function returns @p nullptr.
+ */
+class CUTEHMI_SERVICES_API CompactStateInterface:
+	public StateInterface
+{
+		Q_OBJECT
+
+	public:
+		enum Transition {
+			TRANSITION_TO_STARTED = 0x01,	///< Service calls transitionToStarted().
+			TRANSITION_TO_STOPPED = 0x02,	///< Service calls transitionToStopped().
+			TRANSITION_TO_YIELDING = 0x04,	///< Service calls transitionToYielding().
+			ALL_TRANSITIONS = TRANSITION_TO_STARTED | TRANSITION_TO_STOPPED | TRANSITION_TO_YIELDING	///< Service calls all of the above.
+		};
+		Q_DECLARE_FLAGS(Transitions, Transition)
+
+		Q_PROPERTY(QString status READ status NOTIFY statusChanged)
+
+		/**
+		 * Constructor.
+		 * @param transitions transitions, which are going to be triggered by the service.
+		 * @param parent parent object.
+		 */
+		explicit CompactStateInterface(Transitions transitions = Transitions(), QObject * parent = nullptr);
+
+		QString status() const;
+
+		QAbstractState * stopped() const override;
+
+		QAbstractState * starting() const override;
+
+		QAbstractState * started() const override;
+
+		QAbstractState * stopping() const override;
+
+		QAbstractState * broken() const override;
+
+		QAbstractState * repairing() const override;
+
+		QAbstractState * evacuating() const override;
+
+		QAbstractState * interrupted() const override;
+
+		StartedStateInterface * startedStates() const override;
+
+	public slots:
+		void start();
+
+		void stop();
+
+		void activate();
+
+		void transitionToStarted();
+
+		void transitionToStopped();
+
+		void transitionToBroken();
+
+		void transitionToYielding();
+
+		void transitionToIdling();
+
+	signals:
+		void statusChanged(const QString & status);
+
+	protected:
+		void timerEvent(QTimerEvent * event) override;
+
+	private:
+		static QString Status(State state);
+
+		void process(int event);
+
+		void enter(State state);
+
+		internal::StateFacade * facade() const;
+
+		struct Members
+		{
+			Transitions transitions;
+			QBasicTimer timeoutTimer;
+			State lastNotifiableState;
+			mutable internal::StateFacade * facade;
+
+			Members(Transitions p_transitions):
+				transitions(p_transitions),
+				lastNotifiableState(UNDEFINED),
+				facade(nullptr)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(cutehmi::services::CompactStateInterface::Transitions)
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -9,7 +9,6 @@
 
 #include <memory>
 
-class QAbstractState;
 class QTimer;
 
 namespace cutehmi {
@@ -62,10 +61,7 @@ class CUTEHMI_SERVICES_API ServiceAutoRepair:
 	private:
 		struct ServiceEntry {
 			QTimer * timer;
-			QMetaObject::Connection startingEnteredConnection;
-			QMetaObject::Connection startedEnteredConnection;
-			QMetaObject::Connection repairingEnteredConnection;
-			QMetaObject::Connection brokenEnteredConnection;
+			QMetaObject::Connection currentChangedConnection;
 		};
 
 		typedef QHash<AbstractService *, ServiceEntry *> ServiceDataContainer;
@@ -76,11 +72,7 @@ class CUTEHMI_SERVICES_API ServiceAutoRepair:
 		// associated with the object if possible.
 		static QJSEngine & JSEngine(const QObject & object);
 
-		QMetaObject::Connection connectResetIntervalOnStateEntered(const QAbstractState * state, QTimer * timer);
-
-		QMetaObject::Connection connectRepairingEntered(const AbstractService * service, QTimer * timer);
-
-		QMetaObject::Connection connectBrokenEntered(const AbstractService * service, QTimer * timer);
+		QMetaObject::Connection connectCurrentChanged(const AbstractService * service, QTimer * timer);
 
 		void clearServiceEntry(AbstractService * service);
 
@@ -17,6 +17,12 @@
 namespace cutehmi {
 namespace services {
 
+namespace internal {
+
+class StartupScheduler;
+
+}
+
 /**
  * %Service group.
  *
@@ -29,6 +35,11 @@ namespace services {
  * These substates are executed in parallel, so for example all services will be started at once. However if some
  * @ref ServiceGroupRule "service group rule" can be applied to a particular service, then additional subsequent states are added to
  * the substate created for a particular service and the rule defines the transition between them.
+ *
+ * @ref ServiceDependency "Service dependencies" are handled by a scheduler, which computes dependency graph once, when the group is
+ * configured. Services are then started in topological waves - each service is requested to start as soon as all of its required
+ * services have started, without waiting for condition check events. Startup latencies and critical path of the last startup can
+ * be obtained with startupReport(). Metrics of the services can be aggregated with metricsReport().
  */
 class CUTEHMI_SERVICES_API ServiceGroup:
 	public cutehmi::services::AbstractService,
@@ -112,6 +123,33 @@ class CUTEHMI_SERVICES_API ServiceGroup:
 
 		Q_INVOKABLE void clearServices();
 
+		/**
+		 * Get startup report. Report describes the last time the group has been starting or repairing.
+		 * @return map containing following entries:
+		 *	- @p waves - list of waves, each of which is a list of names of services, which could have been started in parallel.
+		 *	- @p criticalPath - list of names of services, which have successively delayed the startup the most.
+		 *	- @p duration - time [ms] after which the last service has started or @p -1 if no service has started.
+		 *	- @p services - list of maps with @p name, @p wave, @p requested, @p started and @p latency entries describing each service
+		 *	(times are given in milliseconds since the group has entered the state and @p -1 denotes that event has not occurred).
+		 *	.
+		 */
+		Q_INVOKABLE QVariantMap startupReport() const;
+
+		/**
+		 * Get metrics report. Report aggregates @ref AbstractService::metrics "metrics" of the services managed by the group.
+		 * @return map containing following entries:
+		 *	- @p transitions - total number of transitions performed by the services.
+		 *	- @p states - map, which for each state name contains a map with @p count, @p total and @p max entries computed over
+		 *	all services.
+		 *	- @p repairs - map with @p attempts, @p successes and @p rate entries computed over all services.
+		 *	- @p slowest - map, which for @p starting, @p stopping, @p repairing and @p evacuating states lists maps with @p name,
+		 *	@p last and @p max entries, sorted by the longest visit in the descending order.
+		 *	- @p services - list of metrics of each service.
+		 *	- @p group - metrics of the group itself.
+		 *	.
+		 */
+		Q_INVOKABLE QVariantMap metricsReport() const;
+
 		void configureStarting(QState * starting, AssignStatusFunction assignStatus) override;
 
 		void configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus) override;
@@ -212,17 +250,8 @@ class CUTEHMI_SERVICES_API ServiceGroup:
 
 	private:
 		struct ConnectionData {
-			QMetaObject::Connection stopped;
-			QMetaObject::Connection starting;
-			QMetaObject::Connection started;
-			QMetaObject::Connection stopping;
-			QMetaObject::Connection broken;
-			QMetaObject::Connection repairing;
-			QMetaObject::Connection evacuating;
-			QMetaObject::Connection interrupted;
-			QMetaObject::Connection yielding;
-			QMetaObject::Connection active;
-			QMetaObject::Connection idling;
+			QMetaObject::Connection connection;
+			StateInterface::State state;	// State, which has been counted.
 		};
 
 		typedef QHash<AbstractService *, ConnectionData *> ServiceConnectionsContainer;
@@ -251,6 +280,10 @@ class CUTEHMI_SERVICES_API ServiceGroup:
 
 		static void ConnectStateCounters(ConnectionData & connectionData, ServiceGroup * serviceGroup, AbstractService * service);
 
+		static void DisconnectStateCounters(ConnectionData & connectionData, ServiceGroup * serviceGroup);
+
+		static void CountState(ServiceGroup * serviceGroup, StateInterface::State state, int delta);
+
 		static ConnectionData * CreateConnectionDataEntry(ServiceConnectionsContainer & serviceConnections, AbstractService * service);
 
 		static void DeleteConnectionDataEntry(ServiceConnectionsContainer & serviceConnections, AbstractService * service);
@@ -269,6 +302,7 @@ class CUTEHMI_SERVICES_API ServiceGroup:
 			ServicesContainer services;
 			QQmlListProperty<AbstractService> serviceList;
 			ServiceConnectionsContainer serviceConnections;
+			internal::StartupScheduler * startupScheduler;
 			int stoppedCount;
 			int startingCount;
 			int startedCount;
@@ -285,6 +319,7 @@ class CUTEHMI_SERVICES_API ServiceGroup:
 			Members(ServiceGroup * p_parent):
 				ruleList(p_parent, & rules, & ServiceGroup::RuleListAppend, & ServiceGroup::RuleListCount, & ServiceGroup::RuleListAt, & ServiceGroup::RuleListClear),
 				serviceList(p_parent, & services, & ServiceGroup::ServiceListAppend, & ServiceGroup::ServiceListCount, & ServiceGroup::ServiceListAt, & ServiceGroup::ServiceListClear),
+				startupScheduler(nullptr),
 				stoppedCount(0),
 				startingCount(0),
 				startedCount(0),
@@ -24,6 +24,9 @@ class AbstractService;
  * states and any existing signal-slot connections intact. Typically you should rely on persistent states and don't bother about
  * ephemeric variants, but this information is given to avoid confusion when dealing with Serviceable and noticing that it's using
  * different state objects.
+ *
+ * Standard state, in which service currently is, can be also obtained without dealing with state objects through @ref current
+ * property. Property is updated synchronously, as soon as the state is entered.
  */
 class CUTEHMI_SERVICES_API StateInterface:
 	public QObject
@@ -33,6 +36,24 @@ class CUTEHMI_SERVICES_API StateInterface:
 		QML_UNCREATABLE("StateInterface is an abstract class")
 
 	public:
+		/**
+		 * Standard state. Substates of @p started state are listed individually.
+		 */
+		enum State {
+			UNDEFINED,	///< Service is not in any of the standard states (e.g. it has not been configured yet).
+			STOPPED,
+			STARTING,
+			YIELDING,	///< Substate of @p started state.
+			ACTIVE,	///< Substate of @p started state.
+			IDLING,	///< Substate of @p started state.
+			STOPPING,
+			BROKEN,
+			REPAIRING,
+			EVACUATING,
+			INTERRUPTED
+		};
+		Q_ENUM(State)
+
 		Q_PROPERTY(QAbstractState * stopped READ stopped CONSTANT)
 
 		Q_PROPERTY(QAbstractState * starting READ starting CONSTANT)
@@ -51,6 +72,15 @@ class CUTEHMI_SERVICES_API StateInterface:
 
 		Q_PROPERTY(cutehmi::services::StartedStateInterface * startedStates READ startedStates CONSTANT)
 
+		Q_PROPERTY(cutehmi::services::StateInterface::State current READ current NOTIFY currentChanged)
+
+		/**
+		 * Check whether state is a substate of @p started state.
+		 * @param state state.
+		 * @return @p true if @a state is one of @p started substates, @p false otherwise.
+		 */
+		static bool IsStarted(State state);
+
 		virtual QAbstractState * stopped() const = 0;
 
 		virtual QAbstractState * starting() const = 0;
@@ -89,8 +119,29 @@ class CUTEHMI_SERVICES_API StateInterface:
 		 */
 		Q_INVOKABLE QAbstractState * findState(const QString & name) const;
 
+		State current() const;
+
+	signals:
+		/**
+		 * This signal is emitted when service enters another standard state.
+		 * @param previous state, which has been left.
+		 */
+		void currentChanged(cutehmi::services::StateInterface::State previous);
+
 	protected:
+		StateInterface(QObject * parent = nullptr);
+
 		AbstractService * service() const;
+
+		void setCurrent(State current);
+
+	private:
+		struct Members
+		{
+			State current = UNDEFINED;
+		};
+
+		MPtr<Members> m;
 };
 
 }
@@ -2,7 +2,9 @@
 
 #include <cutehmi/Notification.hpp>
 #include <cutehmi/services/AbstractServiceController.hpp>
+#include <cutehmi/services/CompactStateInterface.hpp>
 #include <cutehmi/services/ServiceAutoRepair.hpp>
+#include "internal/ServiceMetrics.hpp"
 
 #include <QCoreApplication>
 
@@ -94,6 +96,18 @@ StateInterface * AbstractService::states() const
 	return m->stateInterface;
 }
 
+QVariantMap AbstractService::metrics() const
+{
+	QVariantMap result = m->metrics->toVariantMap();
+	result.insert("name", name());
+	return result;
+}
+
+void AbstractService::resetMetrics()
+{
+	m->metrics->reset();
+}
+
 QQmlListProperty<AbstractServiceController> AbstractService::defaultControllerList()
 {
 	return m->defaultControllerList;
@@ -135,6 +149,18 @@ AbstractService::AbstractService(StateInterface * stateInterface, const QString
 {
 	m->stateInterface->setParent(this);
 
+	// Compact state interface is driven directly by the signals of the service.
+	if (CompactStateInterface * compactStateInterface = qobject_cast<CompactStateInterface *>(m->stateInterface)) {
+		connect(this, & AbstractService::started, compactStateInterface, & CompactStateInterface::start);
+		connect(this, & AbstractService::stopped, compactStateInterface, & CompactStateInterface::stop);
+		connect(this, & AbstractService::activated, compactStateInterface, & CompactStateInterface::activate);
+		connect(compactStateInterface, & CompactStateInterface::statusChanged, this, & AbstractService::setStatus);
+		setStatus(compactStateInterface->status());
+	}
+
+	m->metrics = new internal::ServiceMetrics(m->stateInterface, this);
+	connect(m->metrics, & internal::ServiceMetrics::updated, this, & AbstractService::metricsChanged);
+
 	for (auto && controller : *defaultControllerListData())
 		appendController(controller);
 }
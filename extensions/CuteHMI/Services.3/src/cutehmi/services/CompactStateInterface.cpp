@@ -0,0 +1,244 @@
+#include <cutehmi/services/CompactStateInterface.hpp>
+#include <cutehmi/services/AbstractService.hpp>
+#include "internal/StateFacade.hpp"
+#include "internal/StateTable.hpp"
+
+#include <cutehmi/Notification.hpp>
+
+#include <QTimerEvent>
+
+namespace cutehmi {
+namespace services {
+
+CompactStateInterface::CompactStateInterface(Transitions transitions, QObject * parent):
+	StateInterface(parent),
+	m(new Members(transitions))
+{
+	setCurrent(STOPPED);
+}
+
+QString CompactStateInterface::status() const
+{
+	return Status(current());
+}
+
+QAbstractState * CompactStateInterface::stopped() const
+{
+	return facade()->state(STOPPED);
+}
+
+QAbstractState * CompactStateInterface::starting() const
+{
+	return facade()->state(STARTING);
+}
+
+QAbstractState * CompactStateInterface::started() const
+{
+	return facade()->started();
+}
+
+QAbstractState * CompactStateInterface::stopping() const
+{
+	return facade()->state(STOPPING);
+}
+
+QAbstractState * CompactStateInterface::broken() const
+{
+	return facade()->state(BROKEN);
+}
+
+QAbstractState * CompactStateInterface::repairing() const
+{
+	return facade()->state(REPAIRING);
+}
+
+QAbstractState * CompactStateInterface::evacuating() const
+{
+	return facade()->state(EVACUATING);
+}
+
+QAbstractState * CompactStateInterface::interrupted() const
+{
+	return facade()->state(INTERRUPTED);
+}
+
+StartedStateInterface * CompactStateInterface::startedStates() const
+{
+	return facade()->startedStates();
+}
+
+void CompactStateInterface::start()
+{
+	process(internal::StateTable::EVENT_START);
+}
+
+void CompactStateInterface::stop()
+{
+	process(internal::StateTable::EVENT_STOP);
+}
+
+void CompactStateInterface::activate()
+{
+	process(internal::StateTable::EVENT_ACTIVATE);
+}
+
+void CompactStateInterface::transitionToStarted()
+{
+	process(internal::StateTable::EVENT_STARTED);
+}
+
+void CompactStateInterface::transitionToStopped()
+{
+	process(internal::StateTable::EVENT_STOPPED);
+}
+
+void CompactStateInterface::transitionToBroken()
+{
+	process(internal::StateTable::EVENT_BROKEN);
+}
+
+void CompactStateInterface::transitionToYielding()
+{
+	process(internal::StateTable::EVENT_YIELDING);
+}
+
+void CompactStateInterface::transitionToIdling()
+{
+	process(internal::StateTable::EVENT_IDLING);
+}
+
+void CompactStateInterface::timerEvent(QTimerEvent * event)
+{
+	if (event->timerId() == m->timeoutTimer.timerId()) {
+		m->timeoutTimer.stop();
+		process(internal::StateTable::EVENT_TIMEOUT);
+	} else
+		StateInterface::timerEvent(event);
+}
+
+QString CompactStateInterface::Status(State state)
+{
+	switch (state) {
+		case STOPPED:
+			return tr("Stopped");
+		case STARTING:
+			return tr("Starting");
+		case YIELDING:
+			return tr("Yielding");
+		case ACTIVE:
+			return tr("Active");
+		case IDLING:
+			return tr("Idling");
+		case STOPPING:
+			return tr("Stopping");
+		case BROKEN:
+			return tr("Broken");
+		case REPAIRING:
+			return tr("Repairing");
+		case EVACUATING:
+			return tr("Evacuating");
+		case INTERRUPTED:
+			return tr("Interrupted");
+		default:
+			return QString();
+	}
+}
+
+void CompactStateInterface::process(int event)
+{
+	State target = internal::StateTable::Target(current(), static_cast<internal::StateTable::Event>(event));
+	if (target != UNDEFINED)
+		enter(target);
+}
+
+void CompactStateInterface::enter(State state)
+{
+	m->timeoutTimer.stop();
+
+	setCurrent(state);
+	emit statusChanged(Status(state));
+
+	if (m->facade)
+		m->facade->sync(state);
+
+	// Notify if notifiable state was entered. Started substates are represented by yielding state.
+	State notifiableState = IsStarted(state) ? YIELDING : state;
+	if (m->lastNotifiableState != notifiableState && service()) {
+		switch (notifiableState) {
+			case STOPPED:
+				Notification::Info(tr("Service '%1' is stopped.").arg(service()->name()));
+				m->lastNotifiableState = notifiableState;
+				break;
+			case YIELDING:
+				Notification::Info(tr("Service '%1' has started.").arg(service()->name()));
+				m->lastNotifiableState = notifiableState;
+				break;
+			case BROKEN:
+				Notification::Critical(tr("Service '%1' broke.").arg(service()->name()));
+				m->lastNotifiableState = notifiableState;
+				break;
+			case INTERRUPTED:
+				Notification::Critical(tr("Stop sequence of '%1' service has been interrupted, because it took more than %2 [ms] to stop the service.").arg(service()->name()).arg(service()->stopTimeout()));
+				m->lastNotifiableState = notifiableState;
+				break;
+			default:
+				break;
+		}
+	}
+
+	int timeout = -1;
+	switch (internal::StateTable::StateTimeout(state)) {
+		case internal::StateTable::TIMEOUT_START:
+			timeout = service() ? service()->startTimeout() : AbstractService::INITIAL_START_TIMEOUT;
+			break;
+		case internal::StateTable::TIMEOUT_STOP:
+			timeout = service() ? service()->stopTimeout() : AbstractService::INITIAL_STOP_TIMEOUT;
+			break;
+		case internal::StateTable::TIMEOUT_REPAIR:
+			timeout = service() ? service()->repairTimeout() : AbstractService::INITIAL_REPAIR_TIMEOUT;
+			break;
+		default:
+			break;
+	}
+
+	// Transitions, which are not declared are taken immediately.
+	bool declared = true;
+	switch (internal::StateTable::CompletionEvent(state)) {
+		case internal::StateTable::EVENT_STARTED:
+			declared = m->transitions.testFlag(TRANSITION_TO_STARTED);
+			break;
+		case internal::StateTable::EVENT_STOPPED:
+			declared = m->transitions.testFlag(TRANSITION_TO_STOPPED);
+			break;
+		case internal::StateTable::EVENT_YIELDING:
+			declared = m->transitions.testFlag(TRANSITION_TO_YIELDING);
+			break;
+		default:
+			break;
+	}
+	if (!declared)
+		process(internal::StateTable::CompletionEvent(state));
+	else if (timeout >= 0)
+		m->timeoutTimer.start(timeout, this);
+}
+
+internal::StateFacade * CompactStateInterface::facade() const
+{
+	if (!m->facade)
+		m->facade = new internal::StateFacade(const_cast<CompactStateInterface *>(this));
+	return m->facade;
+}
+
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -1,8 +1,6 @@
 #include <cutehmi/services/ServiceAutoActivate.hpp>
 #include <cutehmi/services/AbstractService.hpp>
 
-#include <QAbstractState>
-
 namespace cutehmi {
 namespace services {
 
@@ -19,7 +17,11 @@ void ServiceAutoActivate::subscribe(AbstractService * service)
 		return;
 	}
 
-	auto connection = connect(service->states()->startedStates()->yielding(), & QAbstractState::entered, service, & AbstractService::activate);
+	// Queued connection prevents state interface from being reentered, while it is notifying about entering yielding state.
+	auto connection = connect(service->states(), & StateInterface::currentChanged, service, [service]() {
+		if (service->states()->current() == StateInterface::YIELDING)
+			service->activate();
+	}, Qt::QueuedConnection);
 	m->serviceData.insert(service, connection);
 }
 
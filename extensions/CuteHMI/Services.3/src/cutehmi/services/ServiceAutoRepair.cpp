@@ -75,15 +75,8 @@ void ServiceAutoRepair::subscribe(AbstractService * service)
 	serviceEntry->timer->setSingleShot(true);
 	serviceEntry->timer->setInterval(initialInterval());
 
-	// Reset interval when the service was in started or starting state (all states that lead to broken, except of repairing).
-	serviceEntry->startedEnteredConnection = connectResetIntervalOnStateEntered(service->states()->started(), serviceEntry->timer);
-	serviceEntry->startingEnteredConnection = connectResetIntervalOnStateEntered(service->states()->starting(), serviceEntry->timer);
-
-	// Set new interval, when the service entered repairing state (if service fails to start the new interval will be used).
-	serviceEntry->repairingEnteredConnection = connectRepairingEntered(service, serviceEntry->timer);
-
-	// Trigger the timer, when the service enters broken state.
-	serviceEntry->brokenEnteredConnection = connectBrokenEntered(service, serviceEntry->timer);
+	// Reset interval, set new interval or trigger the timer depending on the state entered by the service.
+	serviceEntry->currentChangedConnection = connectCurrentChanged(service, serviceEntry->timer);
 
 	// Trigger the repair when the timer timeout is reached.
 	connect(serviceEntry->timer, & QTimer::timeout, service, & AbstractService::start);
@@ -118,38 +111,39 @@ QJSEngine & ServiceAutoRepair::JSEngine(const QObject & object)
 	return qmlEngine(& object) ? *qmlEngine(& object) : engine;
 }
 
-QMetaObject::Connection ServiceAutoRepair::connectResetIntervalOnStateEntered(const QAbstractState * state, QTimer * timer)
-{
-	return connect(state, & QAbstractState::entered, timer, [this, timer] {
-		timer->setInterval(initialInterval());
-	});
-}
-
-QMetaObject::Connection ServiceAutoRepair::connectRepairingEntered(const AbstractService * service, QTimer * timer)
-{
-	return connect(service->states()->repairing(), & QAbstractState::entered, timer, [this, timer] {
-		QJSValue newInterval = intervalFunction().isNumber() ? intervalFunction() : intervalFunction().call({timer->interval()});
-		if (!newInterval.isNumber())
-			CUTEHMI_CRITICAL("Expression given as 'intervalFunction' does not evaluate to a number.");
-		else
-			timer->setInterval(newInterval.toInt());
-	});
-}
-
-QMetaObject::Connection ServiceAutoRepair::connectBrokenEntered(const AbstractService * service, QTimer * timer)
-{
-	return connect(service->states()->broken(), & QAbstractState::entered, timer, [timer] {
-		timer->start();
+QMetaObject::Connection ServiceAutoRepair::connectCurrentChanged(const AbstractService * service, QTimer * timer)
+{
+	return connect(service->states(), & StateInterface::currentChanged, timer, [this, service, timer](StateInterface::State previous) {
+		StateInterface::State current = service->states()->current();
+		switch (current) {
+			case StateInterface::STARTING:
+				// Reset interval when the service was in started or starting state (all states that lead to broken, except of repairing).
+				timer->setInterval(initialInterval());
+				break;
+			case StateInterface::REPAIRING: {
+				// Set new interval, when the service entered repairing state (if service fails to start the new interval will be used).
+				QJSValue newInterval = intervalFunction().isNumber() ? intervalFunction() : intervalFunction().call({timer->interval()});
+				if (!newInterval.isNumber())
+					CUTEHMI_CRITICAL("Expression given as 'intervalFunction' does not evaluate to a number.");
+				else
+					timer->setInterval(newInterval.toInt());
+				break;
+			}
+			case StateInterface::BROKEN:
+				// Trigger the timer, when the service enters broken state.
+				timer->start();
+				break;
+			default:
+				if (StateInterface::IsStarted(current) && !StateInterface::IsStarted(previous))
+					timer->setInterval(initialInterval());
+		}
 	});
 }
 
 void ServiceAutoRepair::clearServiceEntry(AbstractService * service)
 {
 	ServiceEntry * serviceEntry = m->serviceData.take(service);
-	disconnect(serviceEntry->startingEnteredConnection);
-	disconnect(serviceEntry->startedEnteredConnection);
-	disconnect(serviceEntry->repairingEnteredConnection);
-	disconnect(serviceEntry->brokenEnteredConnection);
+	disconnect(serviceEntry->currentChangedConnection);
 	disconnect(serviceEntry->timer, & QTimer::timeout, service, & AbstractService::start);
 	serviceEntry->timer->deleteLater();
 	delete serviceEntry;
@@ -93,8 +93,9 @@ ServiceDependency::StartConditionTransition::StartConditionTransition(QPointer<S
 {
 	if (m->serviceDependency)
 		for (auto && requiredService : m->serviceDependency->requiredServices()) {
-			connect(requiredService->states()->started(), & QState::entered, this, [this]() {
-				ServiceGroup::PostConditionCheckEvent(machine());
+			connect(requiredService->states(), & StateInterface::currentChanged, this, [this, requiredService](StateInterface::State previous) {
+				if (StateInterface::IsStarted(requiredService->states()->current()) && !StateInterface::IsStarted(previous))
+					ServiceGroup::PostConditionCheckEvent(machine());
 			});
 		}
 }
@@ -104,7 +105,7 @@ bool ServiceDependency::StartConditionTransition::eventTest(QEvent * event)
 	if (event->type() == static_cast<QEvent::Type>(ServiceGroup::CONDITION_CHECK_EVENT)) {
 		if (m->serviceDependency)
 			for (auto && requiredService : m->serviceDependency->requiredServices())
-				if (!requiredService->states()->started()->active())
+				if (!StateInterface::IsStarted(requiredService->states()->current()))
 					return false;
 
 		return true;
@@ -118,11 +119,10 @@ ServiceDependency::StopConditionTransition::StopConditionTransition(QPointer<Ser
 	serviceDependency})
 {
 	if (m->serviceDependency) {
-		connect(m->serviceDependency->service()->states()->stopped(), & QState::entered, this, [this]() {
-			ServiceGroup::PostConditionCheckEvent(machine());
-		});
-		connect(m->serviceDependency->service()->states()->interrupted(), & QState::entered, this, [this]() {
-			ServiceGroup::PostConditionCheckEvent(machine());
+		StateInterface * states = m->serviceDependency->service()->states();
+		connect(states, & StateInterface::currentChanged, this, [this, states]() {
+			if (states->current() == StateInterface::STOPPED || states->current() == StateInterface::INTERRUPTED)
+				ServiceGroup::PostConditionCheckEvent(machine());
 		});
 	}
 }
@@ -130,9 +130,10 @@ ServiceDependency::StopConditionTransition::StopConditionTransition(QPointer<Ser
 bool ServiceDependency::StopConditionTransition::eventTest(QEvent * event)
 {
 	if (event->type() == static_cast<QEvent::Type>(ServiceGroup::CONDITION_CHECK_EVENT)) {
-		if (m->serviceDependency)
-			return m->serviceDependency->service()->states()->stopped()->active()
-					|| m->serviceDependency->service()->states()->interrupted()->active();
+		if (m->serviceDependency) {
+			StateInterface::State current = m->serviceDependency->service()->states()->current();
+			return current == StateInterface::STOPPED || current == StateInterface::INTERRUPTED;
+		}
 
 		return true;
 	}
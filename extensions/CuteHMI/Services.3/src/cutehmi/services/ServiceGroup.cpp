@@ -1,9 +1,12 @@
 #include <cutehmi/services/ServiceGroup.hpp>
 #include <cutehmi/services/ServiceAutoActivate.hpp>
 #include <cutehmi/services/ServiceAutoStart.hpp>
+#include <cutehmi/services/ServiceDependency.hpp>
 
+#include "internal/ServiceMetrics.hpp"
 #include "internal/ServiceStateMachine.hpp"
 #include "internal/ServiceStateInterface.hpp"
+#include "internal/StartupScheduler.hpp"
 
 #include <list>
 
@@ -22,6 +25,8 @@ ServiceGroup::ServiceGroup(QObject * parent):
 	AbstractService(new internal::ServiceStateInterface, DefaultStatus(), parent, & DefaultControllers()),
 	m(new Members(this))
 {
+	m->startupScheduler = new internal::StartupScheduler(this);
+
 	// Service status is read-only property, thus it is updated through state interface writebale double.
 	connect(stateInterface(), & internal::ServiceStateInterface::statusChanged, this, & ServiceGroup::setStatus);
 
@@ -130,8 +135,28 @@ void ServiceGroup::clearServices()
 	ServiceListClear(& m->serviceList);
 }
 
+QVariantMap ServiceGroup::startupReport() const
+{
+	return m->startupScheduler->report();
+}
+
+QVariantMap ServiceGroup::metricsReport() const
+{
+	QVariantList services;
+	for (auto && service : m->services)
+		services.append(service->metrics());
+
+	QVariantMap result = internal::ServiceMetrics::Aggregate(services);
+	result.insert("services", services);
+	result.insert("group", metrics());
+	return result;
+}
+
 void ServiceGroup::configureStarting(QState * starting, AssignStatusFunction assignStatus)
 {
+	// Dependency graph is computed once here and it is shared by starting and repairing states.
+	m->startupScheduler->configure(m->services, m->rules);
+
 	configureStartingOrRepairing(starting, assignStatus);
 }
 
@@ -416,8 +441,10 @@ void ServiceGroup::ServiceListClear(QQmlListProperty<AbstractService> * property
 {
 	ServiceGroup * serviceGroup = static_cast<ServiceGroup *>(property->object);
 
-	for (ServicesContainer::iterator it = serviceGroup->services().begin(); it != serviceGroup->services().end(); ++it)
+	for (ServicesContainer::iterator it = serviceGroup->services().begin(); it != serviceGroup->services().end(); ++it) {
+		DisconnectStateCounters(*serviceGroup->m->serviceConnections.value(*it), serviceGroup);
 		DeleteConnectionDataEntry(serviceGroup->m->serviceConnections, *it);
+	}
 
 	serviceGroup->m->serviceConnections.clear();
 
@@ -442,98 +469,69 @@ void ServiceGroup::ServiceListAppend(QQmlListProperty<AbstractService> * propert
 
 void ServiceGroup::ConnectStateCounters(ConnectionData & connectionData, ServiceGroup * serviceGroup, AbstractService * service)
 {
-	struct StateConnectionParams {
-		QMetaObject::Connection * connection;
-		int (ServiceGroup::*getter)(void) const;
-		void (ServiceGroup::*setter)(int);
-		union {
-			QAbstractState * (StateInterface::*stateGetter)(void) const;
-			QAbstractState * (StartedStateInterface::*startedStateGetter)(void) const;
-		};
-		bool startedSubstate = false;
-	};
-
-	QList<StateConnectionParams> stateConnectionParamsList;
-
-	stateConnectionParamsList << StateConnectionParams{
-		& connectionData.stopped,
-		& ServiceGroup::stoppedCount,
-		& ServiceGroup::setStoppedCount,
-		{ & StateInterface::stopped },
-	} << StateConnectionParams{
-		& connectionData.starting,
-		& ServiceGroup::startingCount,
-		& ServiceGroup::setStartingCount,
-		{ & StateInterface::starting },
-	} << StateConnectionParams{
-		& connectionData.started,
-		& ServiceGroup::startedCount,
-		& ServiceGroup::setStartedCount,
-		{ & StateInterface::started },
-	} << StateConnectionParams{
-		& connectionData.stopping,
-		& ServiceGroup::stoppingCount,
-		& ServiceGroup::setStoppingCount,
-		{ & StateInterface::stopping },
-	} << StateConnectionParams{
-		& connectionData.broken,
-		& ServiceGroup::brokenCount,
-		& ServiceGroup::setBrokenCount,
-		{ & StateInterface::broken },
-	} << StateConnectionParams{
-		& connectionData.repairing,
-		& ServiceGroup::repairingCount,
-		& ServiceGroup::setRepairingCount,
-		{ & StateInterface::repairing },
-	} << StateConnectionParams{
-		& connectionData.evacuating,
-		& ServiceGroup::evacuatingCount,
-		& ServiceGroup::setEvacuatingCount,
-		{ & StateInterface::evacuating },
-	} << StateConnectionParams{
-		& connectionData.interrupted,
-		& ServiceGroup::interruptedCount,
-		& ServiceGroup::setInterruptedCount,
-		{ & StateInterface::interrupted },
-	};
-
-	// Designated initializers are not available until C++20, so lets initialize started substates verbosely.
-	StateConnectionParams yieldingConnectionParams;
-	yieldingConnectionParams.connection = & connectionData.yielding;
-	yieldingConnectionParams.getter = & ServiceGroup::yieldingCount;
-	yieldingConnectionParams.setter = & ServiceGroup::setYieldingCount;
-	yieldingConnectionParams.startedStateGetter = & StartedStateInterface::yielding;
-	yieldingConnectionParams.startedSubstate = true;
-	stateConnectionParamsList << yieldingConnectionParams;
-
-	StateConnectionParams activeConnectionParams;
-	activeConnectionParams.connection = & connectionData.active;
-	activeConnectionParams.getter = & ServiceGroup::activeCount;
-	activeConnectionParams.setter = & ServiceGroup::setActiveCount;
-	activeConnectionParams.startedStateGetter = & StartedStateInterface::active;
-	activeConnectionParams.startedSubstate = true;
-	stateConnectionParamsList << activeConnectionParams;
-
-	StateConnectionParams idlingConnectionParams;
-	idlingConnectionParams.connection = & connectionData.idling;
-	idlingConnectionParams.getter = & ServiceGroup::idlingCount;
-	idlingConnectionParams.setter = & ServiceGroup::setIdlingCount;
-	idlingConnectionParams.startedStateGetter = & StartedStateInterface::idling;
-	idlingConnectionParams.startedSubstate = true;
-	stateConnectionParamsList << idlingConnectionParams;
-
-	for (auto && params : stateConnectionParamsList) {
-		QAbstractState * state;
-		if (params.startedSubstate)
-			state = (service->states()->startedStates()->*params.startedStateGetter)();
-		else
-			state = (service->states()->*params.stateGetter)();
-
-		auto getter = params.getter;
-		auto setter = params.setter;
-		*params.connection = connect(state, & QAbstractState::activeChanged, serviceGroup, [getter, setter, serviceGroup](bool active) {
-			(serviceGroup->*setter)((serviceGroup->*getter)() + (active ? 1 : -1));
-		});
+	// Single connection per service is sufficient, because state interface reports the state, which has been left and the one
+	// that has been entered.
+	StateInterface * states = service->states();
+	ConnectionData * data = & connectionData;
+	data->state = states->current();
+	data->connection = connect(states, & StateInterface::currentChanged, serviceGroup, [data, states, serviceGroup]() {
+		StateInterface::State previous = data->state;
+		data->state = states->current();
+		CountState(serviceGroup, previous, -1);
+		CountState(serviceGroup, data->state, 1);
+		// Transitions between started substates do not affect started count.
+		if (StateInterface::IsStarted(previous) != StateInterface::IsStarted(data->state))
+			serviceGroup->setStartedCount(serviceGroup->startedCount() + (StateInterface::IsStarted(data->state) ? 1 : -1));
+	});
+	CountState(serviceGroup, data->state, 1);
+	if (StateInterface::IsStarted(data->state))
+		serviceGroup->setStartedCount(serviceGroup->startedCount() + 1);
+}
+
+void ServiceGroup::DisconnectStateCounters(ConnectionData & connectionData, ServiceGroup * serviceGroup)
+{
+	disconnect(connectionData.connection);
+	CountState(serviceGroup, connectionData.state, -1);
+	if (StateInterface::IsStarted(connectionData.state))
+		serviceGroup->setStartedCount(serviceGroup->startedCount() - 1);
+	connectionData.state = StateInterface::UNDEFINED;
+}
+
+void ServiceGroup::CountState(ServiceGroup * serviceGroup, StateInterface::State state, int delta)
+{
+	switch (state) {
+		case StateInterface::STOPPED:
+			serviceGroup->setStoppedCount(serviceGroup->stoppedCount() + delta);
+			break;
+		case StateInterface::STARTING:
+			serviceGroup->setStartingCount(serviceGroup->startingCount() + delta);
+			break;
+		case StateInterface::YIELDING:
+			serviceGroup->setYieldingCount(serviceGroup->yieldingCount() + delta);
+			break;
+		case StateInterface::ACTIVE:
+			serviceGroup->setActiveCount(serviceGroup->activeCount() + delta);
+			break;
+		case StateInterface::IDLING:
+			serviceGroup->setIdlingCount(serviceGroup->idlingCount() + delta);
+			break;
+		case StateInterface::STOPPING:
+			serviceGroup->setStoppingCount(serviceGroup->stoppingCount() + delta);
+			break;
+		case StateInterface::BROKEN:
+			serviceGroup->setBrokenCount(serviceGroup->brokenCount() + delta);
+			break;
+		case StateInterface::REPAIRING:
+			serviceGroup->setRepairingCount(serviceGroup->repairingCount() + delta);
+			break;
+		case StateInterface::EVACUATING:
+			serviceGroup->setEvacuatingCount(serviceGroup->evacuatingCount() + delta);
+			break;
+		case StateInterface::INTERRUPTED:
+			serviceGroup->setInterruptedCount(serviceGroup->interruptedCount() + delta);
+			break;
+		default:
+			break;
 	}
 }
 
@@ -546,19 +544,7 @@ ServiceGroup::ConnectionData * ServiceGroup::CreateConnectionDataEntry(ServiceCo
 
 void ServiceGroup::DeleteConnectionDataEntry(ServiceConnectionsContainer & serviceConnections, AbstractService * service)
 {
-	ConnectionData * connectionData = serviceConnections.value(service);
-	disconnect(connectionData->stopped);
-	disconnect(connectionData->starting);
-	disconnect(connectionData->started);
-	disconnect(connectionData->stopping);
-	disconnect(connectionData->broken);
-	disconnect(connectionData->repairing);
-	disconnect(connectionData->evacuating);
-	disconnect(connectionData->interrupted);
-	disconnect(connectionData->yielding);
-	disconnect(connectionData->active);
-	disconnect(connectionData->idling);
-	delete connectionData;
+	delete serviceConnections.value(service);
 }
 
 internal::ServiceStateInterface * ServiceGroup::stateInterface() const
@@ -611,14 +597,23 @@ void ServiceGroup::configureStartingOrRepairing(QState * state, AssignStatusFunc
 
 	state->setChildMode(QState::ParallelStates);
 
+	connect(state, & QState::entered, m->startupScheduler, & internal::StartupScheduler::begin);
+
 	for (auto && service : m->services) {
 		QState * serviceSequence = new QState(state);
 
 		QState * startService = new QState(serviceSequence);
+		connect(startService, & QState::entered, m->startupScheduler, [this, service]() {
+			m->startupScheduler->recordStartRequested(service);
+		});
 		connect(startService, & QState::entered, service, & AbstractService::start);
 
 		std::list<std::unique_ptr<QAbstractTransition>> transitionList;
 		for (auto && rule : m->rules) {
+			// Start conditions of service dependencies are handled by startup scheduler.
+			if (qobject_cast<ServiceDependency *>(rule))
+				continue;
+
 			auto transition = rule->conditionalTransition(ServiceGroupRule::SERVICE_START, service);
 			if (transition)
 				transitionList.push_back(std::move(transition));
@@ -635,6 +630,17 @@ void ServiceGroup::configureStartingOrRepairing(QState * state, AssignStatusFunc
 			lastState = conditionWait;
 		}
 
+		if (m->startupScheduler->hasRequirements(service)) {
+			auto transition = m->startupScheduler->readyTransition(service);
+			transition->setTargetState(lastState);
+			QState * requirementsWait = new QState(serviceSequence);
+			connect(requirementsWait, & QState::entered, m->startupScheduler, [this, service]() {
+				m->startupScheduler->wait(service);
+			});
+			requirementsWait->addTransition(transition.release());
+			lastState = requirementsWait;
+		}
+
 		serviceSequence->setInitialState(lastState);
 	}
 }
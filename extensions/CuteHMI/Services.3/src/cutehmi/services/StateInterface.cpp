@@ -4,6 +4,11 @@
 namespace cutehmi {
 namespace services {
 
+bool StateInterface::IsStarted(State state)
+{
+	return state == YIELDING || state == ACTIVE || state == IDLING;
+}
+
 QAbstractState * StateInterface::findState(const QString & name) const
 {
 	for (auto && state : {
@@ -24,11 +29,31 @@ QAbstractState * StateInterface::findState(const QString & name) const
 	return nullptr;
 }
 
+StateInterface::State StateInterface::current() const
+{
+	return m->current;
+}
+
+StateInterface::StateInterface(QObject * parent):
+	QObject(parent),
+	m(new Members)
+{
+}
+
 AbstractService * StateInterface::service() const
 {
 	return static_cast<AbstractService *>(parent());
 }
 
+void StateInterface::setCurrent(State current)
+{
+	if (m->current != current) {
+		State previous = m->current;
+		m->current = current;
+		emit currentChanged(previous);
+	}
+}
+
 }
 }
 
@@ -0,0 +1,197 @@
+#include "ServiceMetrics.hpp"
+
+#include <QDateTime>
+#include <QHash>
+#include <QMetaEnum>
+
+#include <algorithm>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+constexpr int ServiceMetrics::HISTORY_SIZE;
+constexpr int ServiceMetrics::STATE_COUNT;
+
+ServiceMetrics::ServiceMetrics(const StateInterface * stateInterface, QObject * parent):
+	QObject(parent),
+	m(new Members(stateInterface))
+{
+	m->timer.start();
+	m->states[m->stateInterface->current()].count = 1;
+
+	connect(stateInterface, & StateInterface::currentChanged, this, & ServiceMetrics::record);
+}
+
+QVariantMap ServiceMetrics::toVariantMap() const
+{
+	qint64 now = m->timer.elapsed();
+	StateInterface::State current = m->stateInterface->current();
+
+	QVariantMap result;
+	result.insert("state", StateName(current));
+	result.insert("transitions", m->transitions);
+
+	QVariantMap states;
+	for (int state = 0; state < STATE_COUNT; state++) {
+		StateRecord record = m->states[state];
+		if (state == current) {
+			record.last = now - m->entered;
+			record.total += record.last;
+			record.max = std::max(record.max, record.last);
+		}
+		QVariantMap entry;
+		entry.insert("count", record.count);
+		entry.insert("total", record.total);
+		entry.insert("last", record.last);
+		entry.insert("max", record.max);
+		states.insert(StateName(static_cast<StateInterface::State>(state)), entry);
+	}
+	result.insert("states", states);
+
+	QVariantList history;
+	for (qint64 i = std::max(m->transitions - HISTORY_SIZE, Q_INT64_C(0)); i < m->transitions; i++) {
+		const TransitionRecord & transition = m->history[i % HISTORY_SIZE];
+		QVariantMap entry;
+		entry.insert("timestamp", transition.timestamp);
+		entry.insert("from", StateName(transition.from));
+		entry.insert("to", StateName(transition.to));
+		history.append(entry);
+	}
+	result.insert("history", history);
+
+	QVariantMap repairs;
+	repairs.insert("attempts", m->repairAttempts);
+	repairs.insert("successes", m->repairSuccesses);
+	repairs.insert("rate", m->repairAttempts > 0 ? QVariant(static_cast<qreal>(m->repairSuccesses) / m->repairAttempts) : QVariant());
+	result.insert("repairs", repairs);
+
+	return result;
+}
+
+void ServiceMetrics::reset()
+{
+	m->states = {};
+	m->history = {};
+	m->transitions = 0;
+	m->repairAttempts = 0;
+	m->repairSuccesses = 0;
+	m->entered = m->timer.elapsed();
+	m->states[m->stateInterface->current()].count = 1;
+
+	emit updated();
+}
+
+QVariantMap ServiceMetrics::Aggregate(const QVariantList & metrics)
+{
+	qint64 transitions = 0;
+	qint64 repairAttempts = 0;
+	qint64 repairSuccesses = 0;
+	QHash<QString, StateRecord> stateRecords;
+	QHash<QString, QVariantList> slowest;
+	const QStringList slowestStates = {
+		StateName(StateInterface::STARTING),
+		StateName(StateInterface::STOPPING),
+		StateName(StateInterface::REPAIRING),
+		StateName(StateInterface::EVACUATING)
+	};
+
+	for (auto && serviceMetrics : metrics) {
+		QVariantMap map = serviceMetrics.toMap();
+		transitions += map.value("transitions").toLongLong();
+		repairAttempts += map.value("repairs").toMap().value("attempts").toLongLong();
+		repairSuccesses += map.value("repairs").toMap().value("successes").toLongLong();
+
+		QVariantMap states = map.value("states").toMap();
+		for (auto it = states.constBegin(); it != states.constEnd(); ++it) {
+			QVariantMap entry = it.value().toMap();
+			StateRecord & record = stateRecords[it.key()];
+			record.count += entry.value("count").toLongLong();
+			record.total += entry.value("total").toLongLong();
+			record.max = std::max(record.max, entry.value("max").toLongLong());
+
+			if (slowestStates.contains(it.key()) && entry.value("count").toLongLong() > 0) {
+				QVariantMap slowEntry;
+				slowEntry.insert("name", map.value("name"));
+				slowEntry.insert("last", entry.value("last"));
+				slowEntry.insert("max", entry.value("max"));
+				slowest[it.key()].append(slowEntry);
+			}
+		}
+	}
+
+	QVariantMap result;
+	result.insert("transitions", transitions);
+
+	QVariantMap states;
+	for (auto it = stateRecords.constBegin(); it != stateRecords.constEnd(); ++it) {
+		QVariantMap entry;
+		entry.insert("count", it->count);
+		entry.insert("total", it->total);
+		entry.insert("max", it->max);
+		states.insert(it.key(), entry);
+	}
+	result.insert("states", states);
+
+	QVariantMap repairs;
+	repairs.insert("attempts", repairAttempts);
+	repairs.insert("successes", repairSuccesses);
+	repairs.insert("rate", repairAttempts > 0 ? QVariant(static_cast<qreal>(repairSuccesses) / repairAttempts) : QVariant());
+	result.insert("repairs", repairs);
+
+	QVariantMap slowestMap;
+	for (auto && state : slowestStates) {
+		QVariantList list = slowest.value(state);
+		std::stable_sort(list.begin(), list.end(), [](const QVariant & a, const QVariant & b) {
+			return a.toMap().value("max").toLongLong() > b.toMap().value("max").toLongLong();
+		});
+		slowestMap.insert(state, list);
+	}
+	result.insert("slowest", slowestMap);
+
+	return result;
+}
+
+QString ServiceMetrics::StateName(StateInterface::State state)
+{
+	return QString(QMetaEnum::fromType<StateInterface::State>().valueToKey(state)).toLower();
+}
+
+void ServiceMetrics::record(StateInterface::State previous)
+{
+	qint64 now = m->timer.elapsed();
+	StateInterface::State current = m->stateInterface->current();
+
+	StateRecord & previousRecord = m->states[previous];
+	previousRecord.last = now - m->entered;
+	previousRecord.total += previousRecord.last;
+	previousRecord.max = std::max(previousRecord.max, previousRecord.last);
+
+	m->states[current].count++;
+	m->entered = now;
+
+	m->history[m->transitions % HISTORY_SIZE] = TransitionRecord{QDateTime::currentMSecsSinceEpoch(), previous, current};
+	m->transitions++;
+
+	if (current == StateInterface::REPAIRING)
+		m->repairAttempts++;
+	else if (previous == StateInterface::REPAIRING && StateInterface::IsStarted(current))
+		m->repairSuccesses++;
+
+	emit updated();
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,132 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_SERVICEMETRICS_HPP
+#define H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_SERVICEMETRICS_HPP
+
+#include <cutehmi/services/internal/common.hpp>
+#include <cutehmi/services/StateInterface.hpp>
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QVariantMap>
+
+#include <array>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+/**
+ * Service metrics. Metrics follow StateInterface::current property and record time spent in each state, number of transitions,
+ * timestamps of recent transitions and outcome of repair attempts. Metrics are kept in fixed-size arrays, so recording a transition
+ * does not allocate memory.
+ */
+class CUTEHMI_SERVICES_PRIVATE ServiceMetrics:
+	public QObject
+{
+		Q_OBJECT
+
+	public:
+		static constexpr int HISTORY_SIZE = 16;
+
+		/**
+		 * Constructor.
+		 * @param stateInterface state interface to follow.
+		 * @param parent parent object.
+		 */
+		explicit ServiceMetrics(const StateInterface * stateInterface, QObject * parent = nullptr);
+
+		/**
+		 * Get metrics.
+		 * @return map containing following entries:
+		 *	- @p state - name of current state.
+		 *	- @p transitions - number of transitions.
+		 *	- @p states - map, which for each state name contains a map with @p count (number of times state has been entered),
+		 *	@p total (total time spent in the state), @p last (time spent in the state during the last visit, including current
+		 *	visit) and @p max (longest visit) entries. Times are given in milliseconds.
+		 *	- @p history - list of maps with @p timestamp (milliseconds since epoch), @p from and @p to entries describing recent
+		 *	transitions, starting from the oldest one.
+		 *	- @p repairs - map with @p attempts, @p successes and @p rate entries (@p rate is @p null if there were no attempts).
+		 *	.
+		 */
+		QVariantMap toVariantMap() const;
+
+		/**
+		 * Reset metrics. Time spent in current state is counted from now on.
+		 */
+		void reset();
+
+		/**
+		 * Aggregate metrics of multiple services.
+		 * @param metrics list of maps returned by toVariantMap(). Maps should additionally contain @p name entry.
+		 * @return map containing @p transitions, @p states and @p repairs entries, which are computed over all services (@p last
+		 * entries of @p states are omitted) and @p slowest entry, which for @p starting, @p stopping, @p repairing and
+		 * @p evacuating states lists services, sorted by the longest visit in the descending order.
+		 */
+		static QVariantMap Aggregate(const QVariantList & metrics);
+
+		static QString StateName(StateInterface::State state);
+
+	signals:
+		void updated();
+
+	private:
+		static constexpr int STATE_COUNT = StateInterface::INTERRUPTED + 1;
+
+		struct StateRecord
+		{
+			qint64 count = 0;
+			qint64 total = 0;
+			qint64 last = 0;
+			qint64 max = 0;
+		};
+
+		struct TransitionRecord
+		{
+			qint64 timestamp;
+			StateInterface::State from;
+			StateInterface::State to;
+		};
+
+		void record(StateInterface::State previous);
+
+		struct Members
+		{
+			const StateInterface * stateInterface;
+			std::array<StateRecord, STATE_COUNT> states;
+			std::array<TransitionRecord, HISTORY_SIZE> history;
+			qint64 transitions;
+			qint64 repairAttempts;
+			qint64 repairSuccesses;
+			qint64 entered;
+			QElapsedTimer timer;
+
+			Members(const StateInterface * p_stateInterface):
+				stateInterface(p_stateInterface),
+				states(),
+				history(),
+				transitions(0),
+				repairAttempts(0),
+				repairSuccesses(0),
+				entered(0)
+			{
+			}
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
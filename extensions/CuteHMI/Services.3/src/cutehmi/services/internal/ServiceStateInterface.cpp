@@ -425,6 +425,27 @@ void ServiceStateInterface::initializePersistentStates()
 
 	m->interrupted.persistent->setObjectName("interrupted");
 	m->interrupted.persistent->assignProperty(this, "status", tr("Interrupted"));
+
+	// Keep track of current state. Persistent states are entered whenever their ephemeric children are entered.
+	for (auto && entry : std::initializer_list<std::pair<QAbstractState *, State>>{
+			{m->stopped.persistent, STOPPED},
+			{m->starting.persistent, STARTING},
+			{startedInterface()->yielding(), YIELDING},
+			{startedInterface()->active(), ACTIVE},
+			{startedInterface()->idling(), IDLING},
+			{m->stopping.persistent, STOPPING},
+			{m->broken.persistent, BROKEN},
+			{m->repairing.persistent, REPAIRING},
+			{m->evacuating.persistent, EVACUATING},
+			{m->interrupted.persistent, INTERRUPTED}}) {
+		State state = entry.second;
+		connect(entry.first, & QAbstractState::entered, this, [this, state]() {
+			setCurrent(state);
+		});
+	}
+	connect(m->stateMachine, & QStateMachine::stopped, this, [this]() {
+		setCurrent(UNDEFINED);
+	});
 }
 
 void ServiceStateInterface::resetEphemericStates()
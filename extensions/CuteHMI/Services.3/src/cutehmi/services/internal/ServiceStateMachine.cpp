@@ -3,6 +3,7 @@
 #include <cutehmi/Notification.hpp>
 #include <cutehmi/services/Service.hpp>
 #include <cutehmi/services/AbstractService.hpp>
+#include <cutehmi/trace.hpp>
 
 
 namespace cutehmi {
@@ -10,7 +11,8 @@ namespace services {
 namespace internal {
 
 ServiceStateMachine::ServiceStateMachine(QObject * parent):
-	QStateMachine(parent)
+	QStateMachine(parent),
+	m(new Members{-1})
 {
 }
 
@@ -20,6 +22,25 @@ void ServiceStateMachine::start()
 	QCoreApplication::processEvents();	// This is required in order to truly start state machine and prevent it from ignoring incoming events.
 }
 
+void ServiceStateMachine::beginMicrostep(QEvent * event)
+{
+	QStateMachine::beginMicrostep(event);
+
+	if constexpr (CUTEHMI_TRACE_ENABLED(TRACE_SERVICES))
+		m->microstepBegin = Tracer::IsRecording() ? Tracer::Now() : -1;
+}
+
+void ServiceStateMachine::endMicrostep(QEvent * event)
+{
+	// Each microstep corresponds to a transition taken by the state machine.
+	if (m->microstepBegin >= 0) {
+		Tracer::RecordComplete(TRACE_SERVICES, "ServiceStateMachine::transition", m->microstepBegin, Tracer::Now());
+		m->microstepBegin = -1;
+	}
+
+	QStateMachine::endMicrostep(event);
+}
+
 }
 }
 }
@@ -33,6 +33,19 @@ class CUTEHMI_SERVICES_PRIVATE ServiceStateMachine:
 		 * This is shadowed function, which additionaly calls QCoreApplication::processEvents().
 		 */
 		void start();
+
+	protected:
+		void beginMicrostep(QEvent * event) override;
+
+		void endMicrostep(QEvent * event) override;
+
+	private:
+		struct Members
+		{
+			qint64 microstepBegin;
+		};
+
+		MPtr<Members> m;
 };
 
 }
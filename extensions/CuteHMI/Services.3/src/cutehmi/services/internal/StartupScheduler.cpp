@@ -0,0 +1,290 @@
+#include "StartupScheduler.hpp"
+
+#include <cutehmi/services/AbstractService.hpp>
+#include <cutehmi/services/ServiceDependency.hpp>
+
+#include <QSet>
+#include <QStateMachine>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+StartupScheduler::StartupScheduler(QObject * parent):
+	QObject(parent),
+	m(new Members)
+{
+}
+
+void StartupScheduler::configure(const QList<AbstractService *> & services, const QList<ServiceGroupRule *> & rules)
+{
+	for (auto && connection : m->connections)
+		disconnect(connection);
+	m->connections.clear();
+	m->nodes.clear();
+	m->dependents.clear();
+	m->waves.clear();
+	m->timer.invalidate();
+	m->services = services;
+
+	for (auto && service : services)
+		m->nodes.insert(service, Node());
+
+	for (auto && rule : rules) {
+		ServiceDependency * dependency = qobject_cast<ServiceDependency *>(rule);
+		if (dependency == nullptr)
+			continue;
+
+		NodesContainer::iterator node = m->nodes.find(dependency->service());
+		if (node == m->nodes.end())
+			continue;
+
+		QQmlListProperty<AbstractService> requiredServices = dependency->requiredServiceList();
+		for (int i = 0; i < requiredServices.count(& requiredServices); i++) {
+			AbstractService * requiredService = requiredServices.at(& requiredServices, i);
+			if (requiredService && !node->requirements.contains(requiredService)) {
+				node->requirements.append(requiredService);
+				m->dependents[requiredService].append(dependency->service());
+			}
+		}
+	}
+
+	QSet<AbstractService *> observed(services.begin(), services.end());
+	for (DependentsContainer::const_iterator it = m->dependents.cbegin(); it != m->dependents.cend(); ++it)
+		observed.insert(const_cast<AbstractService *>(it.key()));
+	for (auto && service : observed)
+		m->connections.append(connect(service->states(), & StateInterface::currentChanged, this, [this, service](StateInterface::State previous) {
+			if (StateInterface::IsStarted(service->states()->current()) && !StateInterface::IsStarted(previous))
+				onServiceStarted(service);
+		}));
+
+	computeWaves();
+}
+
+bool StartupScheduler::hasRequirements(const AbstractService * service) const
+{
+	return !m->nodes.value(service).requirements.isEmpty();
+}
+
+std::unique_ptr<QAbstractTransition> StartupScheduler::readyTransition(const AbstractService * service)
+{
+	return std::make_unique<ReadyTransition>(this, service);
+}
+
+void StartupScheduler::begin()
+{
+	m->timer.start();
+	m->startedCount = 0;
+	m->reported = false;
+	for (NodesContainer::iterator node = m->nodes.begin(); node != m->nodes.end(); ++node) {
+		node->waiting = false;
+		node->requested = -1;
+		node->blocker = nullptr;
+		if (StateInterface::IsStarted(node.key()->states()->current())) {
+			node->started = 0;
+			m->startedCount++;
+		} else
+			node->started = -1;
+	}
+}
+
+void StartupScheduler::wait(AbstractService * service)
+{
+	NodesContainer::iterator node = m->nodes.find(service);
+	if (node == m->nodes.end())
+		return;
+
+	node->waiting = true;
+	if (isReady(*node)) {
+		// Requirements are met already, so blocker is the requirement, which has started as the last one.
+		AbstractService * blocker = nullptr;
+		qint64 latest = -1;
+		for (auto && requirement : node->requirements) {
+			qint64 started = m->nodes.value(requirement).started;
+			if (started > latest) {
+				latest = started;
+				blocker = requirement;
+			}
+		}
+		release(service, *node, blocker);
+	}
+}
+
+void StartupScheduler::recordStartRequested(AbstractService * service)
+{
+	NodesContainer::iterator node = m->nodes.find(service);
+	if (node != m->nodes.end() && m->timer.isValid())
+		node->requested = m->timer.elapsed();
+}
+
+QVariantMap StartupScheduler::report() const
+{
+	QVariantMap result;
+
+	QVariantList waves;
+	for (auto && wave : m->waves) {
+		QStringList names;
+		for (auto && service : wave)
+			names.append(service->name());
+		waves.append(names);
+	}
+	result.insert("waves", waves);
+
+	qint64 duration;
+	result.insert("criticalPath", criticalPath(& duration));
+	result.insert("duration", duration);
+
+	QVariantList services;
+	for (auto && service : m->services) {
+		const Node & node = m->nodes[service];
+		QVariantMap entry;
+		entry.insert("name", service->name());
+		entry.insert("wave", node.wave);
+		entry.insert("requested", node.requested);
+		entry.insert("started", node.started);
+		entry.insert("latency", node.requested >= 0 && node.started >= 0 ? node.started - node.requested : Q_INT64_C(-1));
+		services.append(entry);
+	}
+	result.insert("services", services);
+
+	return result;
+}
+
+StartupScheduler::ReadyTransition::ReadyTransition(StartupScheduler * scheduler, const AbstractService * service):
+	QSignalTransition(scheduler, & StartupScheduler::serviceReady),
+	m(new Members{service})
+{
+}
+
+bool StartupScheduler::ReadyTransition::eventTest(QEvent * event)
+{
+	if (!QSignalTransition::eventTest(event))
+		return false;
+
+	QStateMachine::SignalEvent * signalEvent = static_cast<QStateMachine::SignalEvent *>(event);
+	return signalEvent->arguments().value(0).value<QObject *>() == m->service;
+}
+
+void StartupScheduler::computeWaves()
+{
+	// Kahn's algorithm; each wave contains services, which have all their requirements within the group in preceding waves.
+	QHash<const AbstractService *, int> pending;
+	QList<AbstractService *> wave;
+	for (auto && service : m->services) {
+		int count = 0;
+		for (auto && requirement : m->nodes[service].requirements)
+			if (m->nodes.contains(requirement))
+				count++;
+		pending.insert(service, count);
+		if (count == 0)
+			wave.append(service);
+	}
+
+	int placed = 0;
+	while (!wave.isEmpty()) {
+		QList<AbstractService *> nextWave;
+		for (auto && service : wave) {
+			m->nodes[service].wave = m->waves.count();
+			placed++;
+			for (auto && dependent : m->dependents.value(service))
+				if (--pending[dependent] == 0)
+					nextWave.append(dependent);
+		}
+		m->waves.append(wave);
+		wave = nextWave;
+	}
+
+	if (placed < m->services.count()) {
+		QStringList names;
+		for (auto && service : m->services)
+			if (pending.value(service) > 0) {
+				m->nodes[service].wave = -1;
+				names.append(service->name());
+			}
+		CUTEHMI_WARNING("Services '" << names.join("', '") << "' can not be started, because they form cyclic dependency.");
+	}
+}
+
+bool StartupScheduler::isReady(const Node & node) const
+{
+	for (auto && requirement : node.requirements)
+		if (!StateInterface::IsStarted(requirement->states()->current()))
+			return false;
+	return true;
+}
+
+void StartupScheduler::onServiceStarted(AbstractService * service)
+{
+	if (!m->timer.isValid())
+		return;
+
+	NodesContainer::iterator node = m->nodes.find(service);
+	if (node != m->nodes.end() && node->started < 0) {
+		node->started = m->timer.elapsed();
+		m->startedCount++;
+	}
+
+	for (auto && dependent : m->dependents.value(service)) {
+		Node & dependentNode = m->nodes[dependent];
+		if (dependentNode.waiting && isReady(dependentNode))
+			release(dependent, dependentNode, service);
+	}
+
+	if (!m->reported && m->startedCount == m->nodes.count()) {
+		m->reported = true;
+		reportStartup();
+	}
+}
+
+void StartupScheduler::release(AbstractService * service, Node & node, AbstractService * blocker)
+{
+	node.waiting = false;
+	node.blocker = blocker;
+	emit serviceReady(service);
+}
+
+QStringList StartupScheduler::criticalPath(qint64 * duration) const
+{
+	const AbstractService * last = nullptr;
+	*duration = -1;
+	for (NodesContainer::const_iterator node = m->nodes.cbegin(); node != m->nodes.cend(); ++node)
+		if (node->started > *duration) {
+			*duration = node->started;
+			last = node.key();
+		}
+
+	QStringList result;
+	QSet<const AbstractService *> visited;
+	while (last != nullptr && !visited.contains(last)) {
+		visited.insert(last);
+		result.prepend(last->name());
+		last = m->nodes.value(last).blocker;
+	}
+	return result;
+}
+
+void StartupScheduler::reportStartup() const
+{
+	qint64 duration;
+	QStringList path = criticalPath(& duration);
+	CUTEHMI_INFO("Services have started in " << duration << " [ms] (" << m->waves.count() << " dependency waves), critical path: " << path.join(" -> ") << ".");
+	for (auto && service : m->services) {
+		const Node & node = m->nodes[service];
+		CUTEHMI_DEBUG("Service '" << service->name() << "' (wave " << node.wave << ") has been requested to start at " << node.requested << " [ms] and has started at " << node.started << " [ms].");
+	}
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
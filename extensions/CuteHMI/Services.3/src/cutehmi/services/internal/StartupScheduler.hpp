@@ -0,0 +1,160 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STARTUPSCHEDULER_HPP
+#define H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STARTUPSCHEDULER_HPP
+
+#include <cutehmi/services/internal/common.hpp>
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QSignalTransition>
+#include <QVariantMap>
+
+#include <memory>
+
+namespace cutehmi {
+namespace services {
+
+class AbstractService;
+class ServiceGroupRule;
+
+namespace internal {
+
+/**
+ * Startup scheduler. Scheduler computes dependency graph of services belonging to a service group, as defined by ServiceDependency
+ * rules. Graph is computed once per configuration of the group. Whenever a service enters started state, its dependents, which have
+ * all their requirements met, are released immediately through signal transitions, which the state machine processes without a
+ * round trip through the event loop.
+ *
+ * Scheduler also measures startup latency of each service and determines critical path - the chain of services, which have
+ * delayed startup of the group the most.
+ */
+class CUTEHMI_SERVICES_PRIVATE StartupScheduler:
+	public QObject
+{
+		Q_OBJECT
+
+	public:
+		explicit StartupScheduler(QObject * parent = nullptr);
+
+		/**
+		 * Configure scheduler.
+		 * @param services services belonging to the group.
+		 * @param rules rules of the group. Requirements are taken from ServiceDependency rules.
+		 */
+		void configure(const QList<AbstractService *> & services, const QList<ServiceGroupRule *> & rules);
+
+		/**
+		 * Check whether service has any requirements.
+		 * @param service service.
+		 * @return @p true if service requires other services to be started, @p false otherwise.
+		 */
+		bool hasRequirements(const AbstractService * service) const;
+
+		/**
+		 * Create transition, which is triggered once all requirements of the service are met.
+		 * @param service service.
+		 * @return transition object.
+		 */
+		std::unique_ptr<QAbstractTransition> readyTransition(const AbstractService * service);
+
+		/**
+		 * Begin startup. Should be called whenever group enters starting or repairing state.
+		 */
+		void begin();
+
+		/**
+		 * Wait for requirements of the service. If requirements are met already, then service is released immediately.
+		 * @param service service.
+		 */
+		void wait(AbstractService * service);
+
+		/**
+		 * Record the time, when service has been requested to start.
+		 * @param service service.
+		 */
+		void recordStartRequested(AbstractService * service);
+
+		/**
+		 * Get report of last startup.
+		 * @return report containing waves of topological order, critical path, total duration and per-service latencies.
+		 */
+		QVariantMap report() const;
+
+	signals:
+		void serviceReady(QObject * service);
+
+	private:
+		class ReadyTransition:
+			public QSignalTransition
+		{
+			public:
+				ReadyTransition(StartupScheduler * scheduler, const AbstractService * service);
+
+			protected:
+				bool eventTest(QEvent * event) override;
+
+			private:
+				struct Members {
+					const AbstractService * service;
+				};
+
+				MPtr<Members> m;
+		};
+
+		struct Node
+		{
+			QList<AbstractService *> requirements;
+			int wave = 0;
+			bool waiting = false;
+			qint64 requested = -1;
+			qint64 started = -1;
+			AbstractService * blocker = nullptr;
+		};
+
+		typedef QHash<const AbstractService *, Node> NodesContainer;
+
+		typedef QHash<const AbstractService *, QList<AbstractService *>> DependentsContainer;
+
+		void computeWaves();
+
+		bool isReady(const Node & node) const;
+
+		void onServiceStarted(AbstractService * service);
+
+		void release(AbstractService * service, Node & node, AbstractService * blocker);
+
+		QStringList criticalPath(qint64 * duration) const;
+
+		void reportStartup() const;
+
+		struct Members
+		{
+			QList<AbstractService *> services;
+			NodesContainer nodes;
+			DependentsContainer dependents;
+			QList<QList<AbstractService *>> waves;
+			QList<QMetaObject::Connection> connections;
+			QElapsedTimer timer;
+			int startedCount = 0;
+			bool reported = false;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,172 @@
+#include "StateFacade.hpp"
+
+#include <QAbstractTransition>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+class StateFacade::SyncEvent:
+	public QEvent
+{
+	public:
+		static QEvent::Type RegisteredType()
+		{
+			static int type = QEvent::registerEventType();
+			return static_cast<QEvent::Type>(type);
+		}
+
+		explicit SyncEvent(StateInterface::State state):
+			QEvent(RegisteredType()),
+			m_state(state)
+		{
+		}
+
+		StateInterface::State state() const
+		{
+			return m_state;
+		}
+
+	private:
+		StateInterface::State m_state;
+};
+
+class StateFacade::SyncTransition:
+	public QAbstractTransition
+{
+	public:
+		SyncTransition(StateInterface::State state, QAbstractState * target):
+			m_state(state)
+		{
+			setTargetState(target);
+		}
+
+	protected:
+		bool eventTest(QEvent * event) override
+		{
+			return event->type() == SyncEvent::RegisteredType() && static_cast<SyncEvent *>(event)->state() == m_state;
+		}
+
+		void onTransition(QEvent * event) override
+		{
+			Q_UNUSED(event)
+		}
+
+	private:
+		StateInterface::State m_state;
+};
+
+constexpr int StateFacade::STATE_COUNT;
+
+StateFacade::StateFacade(StateInterface * stateInterface):
+	QStateMachine(stateInterface),
+	m(new Members{
+	new QState(this),
+	nullptr,
+	{},
+	nullptr})
+{
+	m->started = new QState(m->root);
+	m->started->setObjectName("started");
+
+	m->states[StateInterface::STOPPED] = new QState(m->root);
+	m->states[StateInterface::STOPPED]->setObjectName("stopped");
+	m->states[StateInterface::STARTING] = new QState(m->root);
+	m->states[StateInterface::STARTING]->setObjectName("starting");
+	m->states[StateInterface::YIELDING] = new QState(m->started);
+	m->states[StateInterface::YIELDING]->setObjectName("started.yielding");
+	m->states[StateInterface::ACTIVE] = new QState(m->started);
+	m->states[StateInterface::ACTIVE]->setObjectName("started.active");
+	m->states[StateInterface::IDLING] = new QState(m->started);
+	m->states[StateInterface::IDLING]->setObjectName("started.idling");
+	m->states[StateInterface::STOPPING] = new QState(m->root);
+	m->states[StateInterface::STOPPING]->setObjectName("stopping");
+	m->states[StateInterface::BROKEN] = new QState(m->root);
+	m->states[StateInterface::BROKEN]->setObjectName("broken");
+	m->states[StateInterface::REPAIRING] = new QState(m->root);
+	m->states[StateInterface::REPAIRING]->setObjectName("repairing");
+	m->states[StateInterface::EVACUATING] = new QState(m->root);
+	m->states[StateInterface::EVACUATING]->setObjectName("evacuating");
+	m->states[StateInterface::INTERRUPTED] = new QState(m->root);
+	m->states[StateInterface::INTERRUPTED]->setObjectName("interrupted");
+
+	// Transitions are attached to the root state, so that any state can be reached from any other state in a single step.
+	for (int state = StateInterface::STOPPED; state < STATE_COUNT; state++)
+		m->root->addTransition(new SyncTransition(static_cast<StateInterface::State>(state), m->states[state]));
+
+	m->started->setInitialState(m->states[StateInterface::YIELDING]);
+	m->root->setInitialState(m->states[StateInterface::STOPPED]);
+	setInitialState(m->root);
+
+	m->startedStates = new StartedStates(stateInterface, this);
+
+	sync(stateInterface->current());
+	start();
+}
+
+QAbstractState * StateFacade::state(StateInterface::State state) const
+{
+	return m->states[state];
+}
+
+QAbstractState * StateFacade::started() const
+{
+	return m->started;
+}
+
+StartedStateInterface * StateFacade::startedStates() const
+{
+	return m->startedStates;
+}
+
+void StateFacade::sync(StateInterface::State state)
+{
+	if (state == StateInterface::UNDEFINED)
+		return;
+
+	// Until state machine is running initial state can be simply adjusted.
+	if (!isRunning()) {
+		if (StateInterface::IsStarted(state)) {
+			m->started->setInitialState(m->states[state]);
+			m->root->setInitialState(m->started);
+		} else
+			m->root->setInitialState(m->states[state]);
+	} else
+		postEvent(new SyncEvent(state));
+}
+
+StateFacade::StartedStates::StartedStates(StateInterface * parent, const StateFacade * facade):
+	StartedStateInterface(parent),
+	m_facade(facade)
+{
+}
+
+QAbstractState * StateFacade::StartedStates::yielding() const
+{
+	return m_facade->state(StateInterface::YIELDING);
+}
+
+QAbstractState * StateFacade::StartedStates::active() const
+{
+	return m_facade->state(StateInterface::ACTIVE);
+}
+
+QAbstractState * StateFacade::StartedStates::idling() const
+{
+	return m_facade->state(StateInterface::IDLING);
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
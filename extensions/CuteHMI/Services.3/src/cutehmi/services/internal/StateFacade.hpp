@@ -0,0 +1,101 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STATEFACADE_HPP
+#define H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STATEFACADE_HPP
+
+#include <cutehmi/services/internal/common.hpp>
+#include <cutehmi/services/StateInterface.hpp>
+#include <cutehmi/services/StartedStateInterface.hpp>
+
+#include <QState>
+#include <QStateMachine>
+
+#include <array>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+/**
+ * State facade. State machine, which provides state objects for state interfaces, that do not use state machine to implement
+ * standard states. Facade does not define standard transitions. Instead it simply follows the state it has been told to sync to.
+ */
+class CUTEHMI_SERVICES_PRIVATE StateFacade:
+	public QStateMachine
+{
+		Q_OBJECT
+
+	public:
+		/**
+		 * Constructor.
+		 * @param stateInterface state interface, which is going to be parent of the facade and whose state machine is going to
+		 * follow. Started substates are exposed through StartedStateInterface, which is also a child of @a stateInterface.
+		 */
+		explicit StateFacade(StateInterface * stateInterface);
+
+		/**
+		 * Get state object.
+		 * @param state standard state.
+		 * @return state object. For StateInterface::UNDEFINED @p nullptr is returned.
+		 */
+		QAbstractState * state(StateInterface::State state) const;
+
+		QAbstractState * started() const;
+
+		StartedStateInterface * startedStates() const;
+
+		/**
+		 * Make state machine follow the state interface. State machine processes events asynchronously, so state objects are
+		 * updated, once control returns to the event loop.
+		 * @param state state to sync to.
+		 */
+		void sync(StateInterface::State state);
+
+	private:
+		class StartedStates:
+			public StartedStateInterface
+		{
+			public:
+				StartedStates(StateInterface * parent, const StateFacade * facade);
+
+				QAbstractState * yielding() const override;
+
+				QAbstractState * active() const override;
+
+				QAbstractState * idling() const override;
+
+			private:
+				const StateFacade * m_facade;
+		};
+
+		class SyncEvent;
+
+		class SyncTransition;
+
+		static constexpr int STATE_COUNT = StateInterface::INTERRUPTED + 1;
+
+		struct Members
+		{
+			QState * root;
+			QState * started;
+			std::array<QState *, STATE_COUNT> states;
+			StartedStates * startedStates;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,92 @@
+#include "StateTable.hpp"
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+namespace {
+
+constexpr int STATE_COUNT = StateInterface::INTERRUPTED + 1;
+
+constexpr int EVENT_COUNT = StateTable::EVENT_NONE;
+
+typedef StateInterface S;
+
+// Rows are indexed by states, columns by events. StateInterface::UNDEFINED denotes that event is ignored.
+constexpr StateInterface::State TRANSITIONS[STATE_COUNT][EVENT_COUNT] = {
+	//		START			STOP			ACTIVATE		STARTED			STOPPED			BROKEN			YIELDING		IDLING			TIMEOUT
+	/* UNDEFINED */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED},
+	/* STOPPED */	{S::STARTING,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED},
+	/* STARTING */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::YIELDING,	S::UNDEFINED,	S::BROKEN,		S::UNDEFINED,	S::UNDEFINED,	S::BROKEN},
+	/* YIELDING */	{S::UNDEFINED,	S::STOPPING,	S::ACTIVE,		S::UNDEFINED,	S::UNDEFINED,	S::BROKEN,		S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED},
+	/* ACTIVE */	{S::UNDEFINED,	S::STOPPING,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::BROKEN,		S::UNDEFINED,	S::IDLING,		S::UNDEFINED},
+	/* IDLING */	{S::UNDEFINED,	S::STOPPING,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::BROKEN,		S::YIELDING,	S::UNDEFINED,	S::UNDEFINED},
+	/* STOPPING */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::STOPPED,		S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::INTERRUPTED},
+	/* BROKEN */	{S::REPAIRING,	S::EVACUATING,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED},
+	/* REPAIRING */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::YIELDING,	S::UNDEFINED,	S::BROKEN,		S::UNDEFINED,	S::UNDEFINED,	S::BROKEN},
+	/* EVACUATING */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::STOPPED,		S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::INTERRUPTED},
+	/* INTERRUPTED */	{S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED,	S::UNDEFINED}
+};
+
+constexpr StateTable::Event COMPLETIONS[STATE_COUNT] = {
+	StateTable::EVENT_NONE,	// UNDEFINED
+	StateTable::EVENT_NONE,	// STOPPED
+	StateTable::EVENT_STARTED,	// STARTING
+	StateTable::EVENT_NONE,	// YIELDING
+	StateTable::EVENT_NONE,	// ACTIVE
+	StateTable::EVENT_YIELDING,	// IDLING
+	StateTable::EVENT_STOPPED,	// STOPPING
+	StateTable::EVENT_NONE,	// BROKEN
+	StateTable::EVENT_STARTED,	// REPAIRING
+	StateTable::EVENT_STOPPED,	// EVACUATING
+	StateTable::EVENT_NONE	// INTERRUPTED
+};
+
+constexpr StateTable::Timeout TIMEOUTS[STATE_COUNT] = {
+	StateTable::TIMEOUT_NONE,	// UNDEFINED
+	StateTable::TIMEOUT_NONE,	// STOPPED
+	StateTable::TIMEOUT_START,	// STARTING
+	StateTable::TIMEOUT_NONE,	// YIELDING
+	StateTable::TIMEOUT_NONE,	// ACTIVE
+	StateTable::TIMEOUT_NONE,	// IDLING
+	StateTable::TIMEOUT_STOP,	// STOPPING
+	StateTable::TIMEOUT_NONE,	// BROKEN
+	StateTable::TIMEOUT_REPAIR,	// REPAIRING
+	StateTable::TIMEOUT_STOP,	// EVACUATING
+	StateTable::TIMEOUT_NONE	// INTERRUPTED
+};
+
+}
+
+StateInterface::State StateTable::Target(StateInterface::State state, Event event)
+{
+	if (event == EVENT_NONE)
+		return StateInterface::UNDEFINED;
+
+	return TRANSITIONS[state][event];
+}
+
+StateTable::Event StateTable::CompletionEvent(StateInterface::State state)
+{
+	return COMPLETIONS[state];
+}
+
+StateTable::Timeout StateTable::StateTimeout(StateInterface::State state)
+{
+	return TIMEOUTS[state];
+}
+
+}
+}
+}
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,77 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STATETABLE_HPP
+#define H_EXTENSIONS_CUTEHMI_SERVICES_3_SRC_CUTEHMI_SERVICES_INTERNAL_STATETABLE_HPP
+
+#include <cutehmi/services/internal/common.hpp>
+#include <cutehmi/services/StateInterface.hpp>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+/**
+ * State table. Transition table of standard states, as defined in `dev/StandardStates.scxml`. Each event is named after the signal
+ * or Serviceable function, which triggers corresponding transition in the state machine.
+ */
+class CUTEHMI_SERVICES_PRIVATE StateTable
+{
+	public:
+		enum Event {
+			EVENT_START,	///< AbstractService::started().
+			EVENT_STOP,	///< AbstractService::stopped().
+			EVENT_ACTIVATE,	///< AbstractService::activated().
+			EVENT_STARTED,	///< Serviceable::transitionToStarted().
+			EVENT_STOPPED,	///< Serviceable::transitionToStopped().
+			EVENT_BROKEN,	///< Serviceable::transitionToBroken().
+			EVENT_YIELDING,	///< Serviceable::transitionToYielding().
+			EVENT_IDLING,	///< Serviceable::transitionToIdling().
+			EVENT_TIMEOUT,	///< Timeout of the state.
+			EVENT_NONE
+		};
+
+		enum Timeout {
+			TIMEOUT_NONE,
+			TIMEOUT_START,	///< AbstractService::startTimeout.
+			TIMEOUT_STOP,	///< AbstractService::stopTimeout.
+			TIMEOUT_REPAIR	///< AbstractService::repairTimeout.
+		};
+
+		/**
+		 * Get target of a transition.
+		 * @param state source state.
+		 * @param event event.
+		 * @return target state or StateInterface::UNDEFINED if @a event does not trigger any transition in @a state.
+		 */
+		static StateInterface::State Target(StateInterface::State state, Event event);
+
+		/**
+		 * Get event, which is generated automatically, when Serviceable does not provide a transition (Serviceable function returns
+		 * @p nullptr).
+		 * @param state state.
+		 * @return completion event or EVENT_NONE if state does not have such event.
+		 */
+		static Event CompletionEvent(StateInterface::State state);
+
+		/**
+		 * Get timeout, which applies to a state.
+		 * @param state state.
+		 * @return timeout.
+		 */
+		static Timeout StateTimeout(StateInterface::State state);
+};
+
+}
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,192 @@
+#include <cutehmi/services/AbstractService.hpp>
+#include <cutehmi/services/CompactStateInterface.hpp>
+#include <cutehmi/services/Service.hpp>
+#include <cutehmi/services/Serviceable.hpp>
+
+#include <cutehmi/test/bench.hpp>
+
+#include <QtTest/QtTest>
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+#include <memory>
+#include <vector>
+
+namespace cutehmi {
+namespace services {
+
+/**
+ * Benchmark of standard states. Benchmark compares services, which implement standard states with a state machine (Service), with
+ * services, which rely on CompactStateInterface. It measures construction time, resident memory per service and transition
+ * throughput. Each cycle starts and then stops all the services, which makes four transitions per service.
+ *
+ * Benchmark is configured with environment variables:
+ * - @p CUTEHMI_SERVICES_BENCH_SERVICES - comma-separated list of service counts (default "100,1000").
+ * - @p CUTEHMI_SERVICES_BENCH_CYCLES - number of start-stop cycles (default 10).
+ * - @p CUTEHMI_SERVICES_BENCH_OUTPUT - path to a file, to which results are appended. If not set, results are printed to
+ *   standard output.
+ *
+ * Each case yields a single line of JSON (JSON Lines format).
+ */
+class bench_states:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void states_data();
+
+		void states();
+
+	private:
+		static constexpr int TIMEOUT = 60000;
+
+		class NullServiceable:
+			public QObject,
+			public Serviceable
+		{
+			public:
+				void configureStarting(QState *, AssignStatusFunction) override {}
+
+				void configureStarted(QState *, const QState *, const QState *, AssignStatusFunction) override {}
+
+				void configureStopping(QState *, AssignStatusFunction) override {}
+
+				void configureBroken(QState *, AssignStatusFunction) override {}
+
+				void configureRepairing(QState *, AssignStatusFunction) override {}
+
+				void configureEvacuating(QState *, AssignStatusFunction) override {}
+
+				std::unique_ptr<QAbstractTransition> transitionToStarted() const override
+				{
+					return nullptr;
+				}
+
+				std::unique_ptr<QAbstractTransition> transitionToStopped() const override
+				{
+					return nullptr;
+				}
+
+				std::unique_ptr<QAbstractTransition> transitionToBroken() const override
+				{
+					return nullptr;
+				}
+
+				std::unique_ptr<QAbstractTransition> transitionToYielding() const override
+				{
+					return nullptr;
+				}
+
+				std::unique_ptr<QAbstractTransition> transitionToIdling() const override
+				{
+					return nullptr;
+				}
+		};
+
+		class CompactService:
+			public AbstractService
+		{
+			public:
+				CompactService():
+					AbstractService(new CompactStateInterface, QString())
+				{
+				}
+		};
+
+		static bool WaitFor(const std::vector<std::unique_ptr<AbstractService>> & services, StateInterface::State state);
+};
+
+constexpr int bench_states::TIMEOUT;
+
+void bench_states::states_data()
+{
+	QTest::addColumn<QString>("engine");
+	QTest::addColumn<int>("count");
+
+	for (auto && engine : {"machine", "compact"})
+		for (int count : test::intListEnv("CUTEHMI_SERVICES_BENCH_SERVICES", {100, 1000}))
+			QTest::newRow(QString("%1/%2 services").arg(engine).arg(count).toLocal8Bit().constData()) << QString(engine) << count;
+}
+
+void bench_states::states()
+{
+	QFETCH(QString, engine);
+	QFETCH(int, count);
+
+	int cycles = test::intEnv("CUTEHMI_SERVICES_BENCH_CYCLES", 10);
+	NullServiceable serviceable;
+	std::vector<std::unique_ptr<AbstractService>> services;
+	services.reserve(static_cast<std::size_t>(count));
+
+	QElapsedTimer timer;
+	qint64 memoryBefore = test::residentMemory();
+	timer.start();
+	for (int i = 0; i < count; i++) {
+		if (engine == "machine") {
+			std::unique_ptr<Service> service = std::make_unique<Service>();
+			service->setServiceable(QVariant::fromValue(static_cast<QObject *>(& serviceable)));
+			services.push_back(std::move(service));
+		} else
+			services.push_back(std::make_unique<CompactService>());
+	}
+	QVERIFY(WaitFor(services, StateInterface::STOPPED));
+	qint64 constructionTime = timer.nsecsElapsed();
+	qint64 memoryAfter = test::residentMemory();
+
+	timer.restart();
+	for (int cycle = 0; cycle < cycles; cycle++) {
+		for (auto && service : services)
+			service->start();
+		QVERIFY(WaitFor(services, StateInterface::YIELDING));
+
+		for (auto && service : services)
+			service->stop();
+		QVERIFY(WaitFor(services, StateInterface::STOPPED));
+	}
+	qint64 transitionTime = timer.nsecsElapsed();
+	qint64 transitions = 4 * static_cast<qint64>(count) * cycles;
+
+	timer.restart();
+	services.clear();
+	qint64 destructionTime = timer.nsecsElapsed();
+
+	QJsonObject result;
+	result.insert("engine", engine);
+	result.insert("services", count);
+	result.insert("cycles", cycles);
+	result.insert("constructionUs", constructionTime / 1000.0);
+	result.insert("constructionPerServiceUs", constructionTime / 1000.0 / count);
+	result.insert("memoryPerServiceBytes", memoryBefore >= 0 && memoryAfter >= 0 ? static_cast<double>(memoryAfter - memoryBefore) / count : -1.0);
+	result.insert("transitions", transitions);
+	result.insert("transitionsPerSecond", transitionTime > 0 ? transitions * 1e9 / transitionTime : -1.0);
+	result.insert("destructionUs", destructionTime / 1000.0);
+	test::report(result, "CUTEHMI_SERVICES_BENCH_OUTPUT");
+}
+
+bool bench_states::WaitFor(const std::vector<std::unique_ptr<AbstractService>> & services, StateInterface::State state)
+{
+	return QTest::qWaitFor([& services, state]() {
+		for (auto && service : services)
+			if (service->states()->current() != state)
+				return false;
+		return true;
+	}, TIMEOUT);
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::services::bench_states)
+#include "bench_states.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,288 @@
+#include <cutehmi/services/AbstractService.hpp>
+#include <cutehmi/services/CompactStateInterface.hpp>
+#include <cutehmi/services/ServiceAutoActivate.hpp>
+#include <cutehmi/services/ServiceAutoRepair.hpp>
+#include <cutehmi/services/ServiceGroup.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace services {
+
+class test_CompactStateInterface:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void transitions();
+
+		void ignoredEvents();
+
+		void completionEvents();
+
+		void timeouts();
+
+		void transitionInTime();
+
+		void controllers();
+
+		void counting();
+
+	private:
+		static constexpr int TIMEOUT = 50;
+
+		class CompactService:
+			public AbstractService
+		{
+			public:
+				explicit CompactService(CompactStateInterface::Transitions transitions = CompactStateInterface::Transitions()):
+					AbstractService(new CompactStateInterface(transitions), QString())
+				{
+				}
+
+				CompactStateInterface * stateInterface() const
+				{
+					return static_cast<CompactStateInterface *>(states());
+				}
+		};
+};
+
+constexpr int test_CompactStateInterface::TIMEOUT;
+
+void test_CompactStateInterface::transitions()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+
+	states.start();
+	QCOMPARE(states.current(), StateInterface::STARTING);
+	states.transitionToStarted();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+	states.activate();
+	QCOMPARE(states.current(), StateInterface::ACTIVE);
+	states.transitionToIdling();
+	QCOMPARE(states.current(), StateInterface::IDLING);
+	states.transitionToYielding();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+	states.transitionToBroken();
+	QCOMPARE(states.current(), StateInterface::BROKEN);
+	states.start();
+	QCOMPARE(states.current(), StateInterface::REPAIRING);
+	states.transitionToBroken();
+	QCOMPARE(states.current(), StateInterface::BROKEN);
+	states.start();
+	QCOMPARE(states.current(), StateInterface::REPAIRING);
+	states.transitionToStarted();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+	states.stop();
+	QCOMPARE(states.current(), StateInterface::STOPPING);
+	states.transitionToStopped();
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+
+	states.start();
+	states.transitionToBroken();
+	QCOMPARE(states.current(), StateInterface::BROKEN);
+	states.stop();
+	QCOMPARE(states.current(), StateInterface::EVACUATING);
+	states.transitionToStopped();
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+}
+
+void test_CompactStateInterface::ignoredEvents()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	QSignalSpy currentSpy(& states, & StateInterface::currentChanged);
+
+	states.stop();
+	states.activate();
+	states.transitionToStarted();
+	states.transitionToBroken();
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+
+	states.start();
+	states.start();
+	states.stop();
+	states.activate();
+	QCOMPARE(states.current(), StateInterface::STARTING);
+
+	states.transitionToStarted();
+	states.transitionToStarted();
+	states.transitionToYielding();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+
+	QCOMPARE(currentSpy.count(), 2);
+}
+
+void test_CompactStateInterface::completionEvents()
+{
+	CompactStateInterface states;
+	QSignalSpy currentSpy(& states, & StateInterface::currentChanged);
+
+	// Undeclared transitions are taken immediately.
+	states.start();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+	QCOMPARE(currentSpy.count(), 2);
+	QCOMPARE(currentSpy.at(0).at(0).value<StateInterface::State>(), StateInterface::STOPPED);
+	QCOMPARE(currentSpy.at(1).at(0).value<StateInterface::State>(), StateInterface::STARTING);
+
+	states.activate();
+	QCOMPARE(states.current(), StateInterface::ACTIVE);
+
+	// Transition to idling is always declared by the service, but transition from idling back to yielding is not.
+	currentSpy.clear();
+	states.transitionToIdling();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+	QCOMPARE(currentSpy.count(), 2);
+	QCOMPARE(currentSpy.at(1).at(0).value<StateInterface::State>(), StateInterface::IDLING);
+
+	states.transitionToBroken();
+	QCOMPARE(states.current(), StateInterface::BROKEN);
+	states.start();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+
+	states.stop();
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+
+	states.start();
+	states.transitionToBroken();
+	states.stop();
+	QCOMPARE(states.current(), StateInterface::STOPPED);
+}
+
+void test_CompactStateInterface::timeouts()
+{
+	CompactService service(CompactStateInterface::ALL_TRANSITIONS);
+	service.clearControllers();
+	service.setStartTimeout(TIMEOUT);
+	service.setStopTimeout(TIMEOUT);
+	service.setRepairTimeout(TIMEOUT);
+
+	service.start();
+	QCOMPARE(service.states()->current(), StateInterface::STARTING);
+	QTRY_COMPARE(service.states()->current(), StateInterface::BROKEN);
+
+	service.start();
+	QCOMPARE(service.states()->current(), StateInterface::REPAIRING);
+	QTRY_COMPARE(service.states()->current(), StateInterface::BROKEN);
+
+	service.stop();
+	QCOMPARE(service.states()->current(), StateInterface::EVACUATING);
+	QTRY_COMPARE(service.states()->current(), StateInterface::INTERRUPTED);
+
+	CompactService stoppingService(CompactStateInterface::ALL_TRANSITIONS);
+	stoppingService.clearControllers();
+	stoppingService.setStopTimeout(TIMEOUT);
+	stoppingService.start();
+	stoppingService.stateInterface()->transitionToStarted();
+	stoppingService.stop();
+	QCOMPARE(stoppingService.states()->current(), StateInterface::STOPPING);
+	QTRY_COMPARE(stoppingService.states()->current(), StateInterface::INTERRUPTED);
+}
+
+void test_CompactStateInterface::transitionInTime()
+{
+	CompactService service(CompactStateInterface::ALL_TRANSITIONS);
+	service.clearControllers();
+	service.setStartTimeout(TIMEOUT);
+
+	QCOMPARE(service.status(), service.stateInterface()->status());
+	service.start();
+	QCOMPARE(service.status(), service.stateInterface()->status());
+	service.stateInterface()->transitionToStarted();
+	QCOMPARE(service.states()->current(), StateInterface::YIELDING);
+	QCOMPARE(service.status(), service.stateInterface()->status());
+
+	QTest::qWait(2 * TIMEOUT);
+	QCOMPARE(service.states()->current(), StateInterface::YIELDING);
+}
+
+void test_CompactStateInterface::controllers()
+{
+	// Controllers must outlive the service, which unsubscribes from them on destruction.
+	ServiceAutoActivate autoActivate;
+	ServiceAutoRepair autoRepair;
+	autoRepair.setInitialInterval(TIMEOUT);
+	CompactService service(CompactStateInterface::ALL_TRANSITIONS);
+	service.clearControllers();
+	service.appendController(& autoActivate);
+	service.appendController(& autoRepair);
+
+	service.start();
+	service.stateInterface()->transitionToStarted();
+	QTRY_COMPARE(service.states()->current(), StateInterface::ACTIVE);
+
+	service.stateInterface()->transitionToBroken();
+	QCOMPARE(service.states()->current(), StateInterface::BROKEN);
+	QTRY_COMPARE(service.states()->current(), StateInterface::REPAIRING);
+
+	service.stateInterface()->transitionToStarted();
+	QTRY_COMPARE(service.states()->current(), StateInterface::ACTIVE);
+}
+
+void test_CompactStateInterface::counting()
+{
+	CompactService service1;
+	CompactService service2;
+	service1.clearControllers();
+	service2.clearControllers();
+	ServiceGroup group;
+	group.appendService(& service1);
+	group.appendService(& service2);
+	QCOMPARE(group.stoppedCount(), 2);
+	QCOMPARE(group.startedCount(), 0);
+
+	service1.start();
+	QCOMPARE(service1.states()->current(), StateInterface::YIELDING);
+	QCOMPARE(group.stoppedCount(), 1);
+	QCOMPARE(group.startingCount(), 0);
+	QCOMPARE(group.startedCount(), 1);
+	QCOMPARE(group.yieldingCount(), 1);
+
+	// Transitions between started substates do not affect started count.
+	QSignalSpy startedCountSpy(& group, & ServiceGroup::startedCountChanged);
+	service1.activate();
+	QCOMPARE(group.startedCount(), 1);
+	QCOMPARE(group.yieldingCount(), 0);
+	QCOMPARE(group.activeCount(), 1);
+	service1.stateInterface()->transitionToIdling();
+	QCOMPARE(group.startedCount(), 1);
+	QCOMPARE(group.activeCount(), 0);
+	QCOMPARE(group.yieldingCount(), 1);
+	QCOMPARE(startedCountSpy.count(), 0);
+
+	service2.start();
+	QCOMPARE(group.startedCount(), 2);
+	QCOMPARE(group.stoppedCount(), 0);
+	QCOMPARE(startedCountSpy.count(), 1);
+
+	service1.stateInterface()->transitionToBroken();
+	QCOMPARE(group.startedCount(), 1);
+	QCOMPARE(group.brokenCount(), 1);
+
+	service1.stop();
+	service2.stop();
+	QCOMPARE(group.stoppedCount(), 2);
+	QCOMPARE(group.startedCount(), 0);
+	QCOMPARE(group.brokenCount(), 0);
+
+	group.clearServices();
+	QCOMPARE(group.stoppedCount(), 0);
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::services::test_CompactStateInterface)
+#include "test_CompactStateInterface.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
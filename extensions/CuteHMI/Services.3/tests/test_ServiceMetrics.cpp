@@ -0,0 +1,273 @@
+#include <cutehmi/services/internal/ServiceMetrics.hpp>
+
+#include <cutehmi/services/CompactStateInterface.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+class test_ServiceMetrics:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void stateTime();
+
+		void transitionCounts();
+
+		void history();
+
+		void repairRate();
+
+		void reset();
+
+		void aggregate();
+
+	private:
+		static constexpr int DELAY = 20;
+
+		static void Cycle(CompactStateInterface & states);
+
+		static QVariantMap State(const QVariantMap & metrics, const QString & name);
+
+		static QVariantMap StateEntry(qint64 count, qint64 total, qint64 last, qint64 max);
+};
+
+constexpr int test_ServiceMetrics::DELAY;
+
+void test_ServiceMetrics::stateTime()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	ServiceMetrics metrics(& states);
+
+	states.start();
+	QTest::qSleep(DELAY);
+	states.transitionToStarted();
+	QTest::qSleep(DELAY);
+
+	QVariantMap result = metrics.toVariantMap();
+	QCOMPARE(result.value("state").toString(), QString("yielding"));
+
+	QVariantMap starting = State(result, "starting");
+	QCOMPARE(starting.value("count").toInt(), 1);
+	QVERIFY(starting.value("last").toLongLong() >= DELAY);
+	QCOMPARE(starting.value("total").toInt(), starting.value("last").toInt());
+	QCOMPARE(starting.value("max").toInt(), starting.value("last").toInt());
+
+	// Time spent in current state includes current visit.
+	QVariantMap yielding = State(result, "yielding");
+	QCOMPARE(yielding.value("count").toInt(), 1);
+	QVERIFY(yielding.value("last").toLongLong() >= DELAY);
+	QCOMPARE(yielding.value("total").toInt(), yielding.value("last").toInt());
+
+	QCOMPARE(State(result, "stopped").value("count").toInt(), 1);
+	QCOMPARE(State(result, "active").value("count").toInt(), 0);
+	QCOMPARE(State(result, "active").value("total").toInt(), 0);
+}
+
+void test_ServiceMetrics::transitionCounts()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	ServiceMetrics metrics(& states);
+	QSignalSpy updatedSpy(& metrics, & ServiceMetrics::updated);
+
+	const int cycles = 3;
+	for (int i = 0; i < cycles; i++)
+		Cycle(states);
+
+	QVariantMap result = metrics.toVariantMap();
+	QCOMPARE(result.value("transitions").toInt(), 4 * cycles);
+	QCOMPARE(updatedSpy.count(), 4 * cycles);
+	QCOMPARE(State(result, "stopped").value("count").toInt(), cycles + 1);
+	QCOMPARE(State(result, "starting").value("count").toInt(), cycles);
+	QCOMPARE(State(result, "yielding").value("count").toInt(), cycles);
+	QCOMPARE(State(result, "stopping").value("count").toInt(), cycles);
+	QCOMPARE(State(result, "broken").value("count").toInt(), 0);
+}
+
+void test_ServiceMetrics::history()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	ServiceMetrics metrics(& states);
+
+	states.start();
+	QVariantList history = metrics.toVariantMap().value("history").toList();
+	QCOMPARE(history.count(), 1);
+	QCOMPARE(history.at(0).toMap().value("from").toString(), QString("stopped"));
+	QCOMPARE(history.at(0).toMap().value("to").toString(), QString("starting"));
+	states.transitionToStarted();
+	states.stop();
+	states.transitionToStopped();
+
+	// Overflow history ring, so that it wraps around.
+	const int cycles = ServiceMetrics::HISTORY_SIZE / 4 + 2;
+	for (int i = 1; i < cycles; i++)
+		Cycle(states);
+
+	QVariantMap result = metrics.toVariantMap();
+	QCOMPARE(result.value("transitions").toInt(), 4 * cycles);
+	history = result.value("history").toList();
+	QCOMPARE(history.count(), ServiceMetrics::HISTORY_SIZE);
+
+	// History starts from the oldest transition, which still fits in the ring.
+	QCOMPARE(history.first().toMap().value("from").toString(), QString("stopped"));
+	QCOMPARE(history.first().toMap().value("to").toString(), QString("starting"));
+	QCOMPARE(history.last().toMap().value("from").toString(), QString("stopping"));
+	QCOMPARE(history.last().toMap().value("to").toString(), QString("stopped"));
+	for (int i = 1; i < history.count(); i++) {
+		QCOMPARE(history.at(i).toMap().value("from").toString(), history.at(i - 1).toMap().value("to").toString());
+		QVERIFY(history.at(i).toMap().value("timestamp").toLongLong() >= history.at(i - 1).toMap().value("timestamp").toLongLong());
+	}
+}
+
+void test_ServiceMetrics::repairRate()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	ServiceMetrics metrics(& states);
+
+	QVariantMap repairs = metrics.toVariantMap().value("repairs").toMap();
+	QCOMPARE(repairs.value("attempts").toInt(), 0);
+	QVERIFY(repairs.value("rate").isNull());
+
+	states.start();
+	states.transitionToBroken();
+	states.start();
+	QCOMPARE(states.current(), StateInterface::REPAIRING);
+	states.transitionToBroken();
+	states.start();
+	states.transitionToStarted();
+	QCOMPARE(states.current(), StateInterface::YIELDING);
+
+	repairs = metrics.toVariantMap().value("repairs").toMap();
+	QCOMPARE(repairs.value("attempts").toInt(), 2);
+	QCOMPARE(repairs.value("successes").toInt(), 1);
+	QCOMPARE(repairs.value("rate").toReal(), 0.5);
+
+	// Successful start, which is not preceded by repair attempt is not counted.
+	states.stop();
+	states.transitionToStopped();
+	states.start();
+	states.transitionToStarted();
+	repairs = metrics.toVariantMap().value("repairs").toMap();
+	QCOMPARE(repairs.value("attempts").toInt(), 2);
+	QCOMPARE(repairs.value("successes").toInt(), 1);
+}
+
+void test_ServiceMetrics::reset()
+{
+	CompactStateInterface states(CompactStateInterface::ALL_TRANSITIONS);
+	ServiceMetrics metrics(& states);
+	Cycle(states);
+	states.start();
+	QTest::qSleep(DELAY);
+
+	QSignalSpy updatedSpy(& metrics, & ServiceMetrics::updated);
+	metrics.reset();
+	QCOMPARE(updatedSpy.count(), 1);
+
+	QVariantMap result = metrics.toVariantMap();
+	QCOMPARE(result.value("state").toString(), QString("starting"));
+	QCOMPARE(result.value("transitions").toInt(), 0);
+	QVERIFY(result.value("history").toList().isEmpty());
+	QCOMPARE(State(result, "starting").value("count").toInt(), 1);
+	QVERIFY(State(result, "starting").value("total").toLongLong() < DELAY);
+	QCOMPARE(State(result, "stopped").value("count").toInt(), 0);
+	QCOMPARE(State(result, "stopped").value("total").toInt(), 0);
+}
+
+void test_ServiceMetrics::aggregate()
+{
+	QVariantMap a;
+	a.insert("name", "a");
+	a.insert("transitions", 4);
+	a.insert("states", QVariantMap({
+		{"starting", StateEntry(1, 30, 30, 30)},
+		{"stopped", StateEntry(2, 100, 50, 60)},
+		{"repairing", StateEntry(1, 5, 5, 5)}}));
+	a.insert("repairs", QVariantMap({{"attempts", 1}, {"successes", 1}}));
+
+	QVariantMap b;
+	b.insert("name", "b");
+	b.insert("transitions", 6);
+	b.insert("states", QVariantMap({
+		{"starting", StateEntry(2, 50, 10, 40)},
+		{"stopped", StateEntry(1, 20, 20, 20)}}));
+	b.insert("repairs", QVariantMap({{"attempts", 3}, {"successes", 0}}));
+
+	QVariantMap c;
+	c.insert("name", "c");
+	c.insert("transitions", 0);
+	c.insert("states", QVariantMap({
+		{"starting", StateEntry(0, 0, 0, 0)},
+		{"stopped", StateEntry(1, 10, 10, 10)}}));
+	c.insert("repairs", QVariantMap({{"attempts", 0}, {"successes", 0}}));
+
+	QVariantMap result = ServiceMetrics::Aggregate({a, b, c});
+	QCOMPARE(result.value("transitions").toInt(), 10);
+
+	QVariantMap starting = State(result, "starting");
+	QCOMPARE(starting.value("count").toInt(), 3);
+	QCOMPARE(starting.value("total").toInt(), 80);
+	QCOMPARE(starting.value("max").toInt(), 40);
+	QVERIFY(!starting.contains("last"));
+	QCOMPARE(State(result, "stopped").value("count").toInt(), 4);
+	QCOMPARE(State(result, "stopped").value("max").toInt(), 60);
+
+	QVariantMap repairs = result.value("repairs").toMap();
+	QCOMPARE(repairs.value("attempts").toInt(), 4);
+	QCOMPARE(repairs.value("successes").toInt(), 1);
+	QCOMPARE(repairs.value("rate").toReal(), 0.25);
+
+	// Services, which have never visited the state, are not listed among the slowest ones.
+	QVariantMap slowest = result.value("slowest").toMap();
+	QVariantList slowestStarting = slowest.value("starting").toList();
+	QCOMPARE(slowestStarting.count(), 2);
+	QCOMPARE(slowestStarting.at(0).toMap().value("name").toString(), QString("b"));
+	QCOMPARE(slowestStarting.at(1).toMap().value("name").toString(), QString("a"));
+	QCOMPARE(slowestStarting.at(1).toMap().value("last").toInt(), 30);
+	QCOMPARE(slowest.value("repairing").toList().count(), 1);
+	QVERIFY(slowest.contains("stopping"));
+	QVERIFY(slowest.value("stopping").toList().isEmpty());
+	QVERIFY(!slowest.contains("stopped"));
+
+	QVERIFY(ServiceMetrics::Aggregate(QVariantList()).value("repairs").toMap().value("rate").isNull());
+}
+
+void test_ServiceMetrics::Cycle(CompactStateInterface & states)
+{
+	states.start();
+	states.transitionToStarted();
+	states.stop();
+	states.transitionToStopped();
+}
+
+QVariantMap test_ServiceMetrics::State(const QVariantMap & metrics, const QString & name)
+{
+	return metrics.value("states").toMap().value(name).toMap();
+}
+
+QVariantMap test_ServiceMetrics::StateEntry(qint64 count, qint64 total, qint64 last, qint64 max)
+{
+	return QVariantMap({{"count", count}, {"total", total}, {"last", last}, {"max", max}});
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::services::internal::test_ServiceMetrics)
+#include "test_ServiceMetrics.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,299 @@
+#include <cutehmi/services/internal/StartupScheduler.hpp>
+
+#include <cutehmi/services/AbstractService.hpp>
+#include <cutehmi/services/CompactStateInterface.hpp>
+#include <cutehmi/services/ServiceDependency.hpp>
+#include <cutehmi/services/ServiceGroup.hpp>
+
+#include <QtTest/QtTest>
+
+namespace cutehmi {
+namespace services {
+namespace internal {
+
+class test_StartupScheduler:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void waves();
+
+		void release();
+
+		void immediateRelease();
+
+		void criticalPath();
+
+		void cycle();
+
+		void serviceGroup();
+
+	private:
+		static constexpr int DELAY = 20;
+
+		class CompactService:
+			public AbstractService
+		{
+			public:
+				explicit CompactService(const QString & name, CompactStateInterface::Transitions transitions = CompactStateInterface::Transitions()):
+					AbstractService(new CompactStateInterface(transitions), QString())
+				{
+					setName(name);
+					clearControllers();
+				}
+
+				CompactStateInterface * stateInterface() const
+				{
+					return static_cast<CompactStateInterface *>(states());
+				}
+		};
+
+		static ServiceDependency * Dependency(AbstractService * service, const QList<AbstractService *> & requiredServices, QObject * parent);
+
+		static QVariantMap ServiceEntry(const QVariantMap & report, const QString & name);
+};
+
+constexpr int test_StartupScheduler::DELAY;
+
+void test_StartupScheduler::waves()
+{
+	CompactService a("a");
+	CompactService b("b");
+	CompactService c("c");
+	CompactService d("d");
+	QObject rules;
+
+	StartupScheduler scheduler;
+	scheduler.configure({& a, & b, & c, & d}, {
+		Dependency(& b, {& a}, & rules),
+		Dependency(& c, {& a, & b}, & rules)});
+
+	QVERIFY(!scheduler.hasRequirements(& a));
+	QVERIFY(scheduler.hasRequirements(& b));
+	QVERIFY(scheduler.hasRequirements(& c));
+	QVERIFY(!scheduler.hasRequirements(& d));
+
+	QVariantMap report = scheduler.report();
+	QVariantList waves = report.value("waves").toList();
+	QCOMPARE(waves.count(), 3);
+	QCOMPARE(waves.at(0).toStringList(), QStringList({"a", "d"}));
+	QCOMPARE(waves.at(1).toStringList(), QStringList({"b"}));
+	QCOMPARE(waves.at(2).toStringList(), QStringList({"c"}));
+	QCOMPARE(ServiceEntry(report, "a").value("wave").toInt(), 0);
+	QCOMPARE(ServiceEntry(report, "b").value("wave").toInt(), 1);
+	QCOMPARE(ServiceEntry(report, "c").value("wave").toInt(), 2);
+	QCOMPARE(ServiceEntry(report, "d").value("wave").toInt(), 0);
+}
+
+void test_StartupScheduler::release()
+{
+	CompactService a("a");
+	CompactService b("b");
+	CompactService c("c");
+	QObject rules;
+
+	StartupScheduler scheduler;
+	scheduler.configure({& a, & b, & c}, {
+		Dependency(& b, {& a}, & rules),
+		Dependency(& c, {& a, & b}, & rules)});
+	QSignalSpy readySpy(& scheduler, & StartupScheduler::serviceReady);
+
+	scheduler.begin();
+	scheduler.wait(& b);
+	scheduler.wait(& c);
+	QCOMPARE(readySpy.count(), 0);
+
+	// Dependents are released synchronously, as soon as their requirements enter started state.
+	a.start();
+	QCOMPARE(readySpy.count(), 1);
+	QCOMPARE(readySpy.at(0).at(0).value<QObject *>(), static_cast<QObject *>(& b));
+
+	b.start();
+	QCOMPARE(readySpy.count(), 2);
+	QCOMPARE(readySpy.at(1).at(0).value<QObject *>(), static_cast<QObject *>(& c));
+
+	// Services, which are not waiting, are not released again.
+	c.start();
+	a.stop();
+	a.start();
+	QCOMPARE(readySpy.count(), 2);
+}
+
+void test_StartupScheduler::immediateRelease()
+{
+	CompactService a("a");
+	CompactService b("b");
+	QObject rules;
+
+	StartupScheduler scheduler;
+	scheduler.configure({& a, & b}, {Dependency(& b, {& a}, & rules)});
+	QSignalSpy readySpy(& scheduler, & StartupScheduler::serviceReady);
+
+	scheduler.begin();
+	a.start();
+	QCOMPARE(readySpy.count(), 0);
+
+	// Requirements are met already, so service is released within the call.
+	scheduler.wait(& b);
+	QCOMPARE(readySpy.count(), 1);
+	QCOMPARE(readySpy.at(0).at(0).value<QObject *>(), static_cast<QObject *>(& b));
+}
+
+void test_StartupScheduler::criticalPath()
+{
+	CompactService a("a");
+	CompactService b("b");
+	CompactService c("c");
+	CompactService d("d");
+	QObject rules;
+
+	StartupScheduler scheduler;
+	scheduler.configure({& a, & b, & c, & d}, {
+		Dependency(& b, {& a}, & rules),
+		Dependency(& c, {& a, & b}, & rules)});
+
+	scheduler.begin();
+	for (auto && service : {& a, & b, & c, & d})
+		scheduler.recordStartRequested(service);
+	scheduler.wait(& b);
+	scheduler.wait(& c);
+
+	d.start();
+	QTest::qSleep(DELAY);
+	a.start();
+	QTest::qSleep(DELAY);
+	b.start();
+	QTest::qSleep(DELAY);
+	c.start();
+
+	QVariantMap report = scheduler.report();
+	QCOMPARE(report.value("criticalPath").toStringList(), QStringList({"a", "b", "c"}));
+	QVERIFY(report.value("duration").toLongLong() >= 3 * DELAY);
+	QVERIFY(ServiceEntry(report, "c").value("latency").toLongLong() >= 3 * DELAY);
+	QVERIFY(ServiceEntry(report, "d").value("latency").toLongLong() >= 0);
+}
+
+void test_StartupScheduler::cycle()
+{
+	CompactService e("e");
+	CompactService f("f");
+	CompactService g("g");
+	QObject rules;
+
+	StartupScheduler scheduler;
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Services 'e', 'f' can not be started, because they form cyclic dependency"));
+	scheduler.configure({& e, & f, & g}, {
+		Dependency(& e, {& f}, & rules),
+		Dependency(& f, {& e}, & rules)});
+
+	QVariantMap report = scheduler.report();
+	QVariantList waves = report.value("waves").toList();
+	QCOMPARE(waves.count(), 1);
+	QCOMPARE(waves.at(0).toStringList(), QStringList({"g"}));
+	QCOMPARE(ServiceEntry(report, "e").value("wave").toInt(), -1);
+	QCOMPARE(ServiceEntry(report, "f").value("wave").toInt(), -1);
+	QCOMPARE(ServiceEntry(report, "g").value("wave").toInt(), 0);
+}
+
+void test_StartupScheduler::serviceGroup()
+{
+	// Services remain in starting state, until they are told to transition to started state.
+	CompactService a("a", CompactStateInterface::TRANSITION_TO_STARTED);
+	CompactService b("b", CompactStateInterface::TRANSITION_TO_STARTED);
+	CompactService c("c", CompactStateInterface::TRANSITION_TO_STARTED);
+	CompactService d("d", CompactStateInterface::TRANSITION_TO_STARTED);
+	QObject rules;
+
+	ServiceGroup group;
+	group.clearControllers();
+	for (auto && service : {& a, & b, & c, & d})
+		group.appendService(service);
+	group.appendRule(Dependency(& b, {& a}, & rules));
+	group.appendRule(Dependency(& c, {& a, & b}, & rules));
+	QTRY_VERIFY(group.states()->stopped()->active());
+
+	group.start();
+	QTRY_COMPARE(a.states()->current(), StateInterface::STARTING);
+	QTRY_COMPARE(d.states()->current(), StateInterface::STARTING);
+	QCOMPARE(b.states()->current(), StateInterface::STOPPED);
+	QCOMPARE(c.states()->current(), StateInterface::STOPPED);
+
+	d.stateInterface()->transitionToStarted();
+	QTest::qWait(DELAY);
+	QCOMPARE(b.states()->current(), StateInterface::STOPPED);
+
+	// Dependent services are started in waves, as soon as their requirements have started.
+	a.stateInterface()->transitionToStarted();
+	QTRY_COMPARE(b.states()->current(), StateInterface::STARTING);
+	QCOMPARE(c.states()->current(), StateInterface::STOPPED);
+	QTest::qWait(DELAY);
+
+	b.stateInterface()->transitionToStarted();
+	QTRY_COMPARE(c.states()->current(), StateInterface::STARTING);
+	QTest::qWait(DELAY);
+
+	c.stateInterface()->transitionToStarted();
+	QTRY_VERIFY(group.states()->started()->active());
+
+	QVariantMap report = group.startupReport();
+	QVariantList waves = report.value("waves").toList();
+	QCOMPARE(waves.count(), 3);
+	QCOMPARE(waves.at(0).toStringList(), QStringList({"a", "d"}));
+	QCOMPARE(waves.at(1).toStringList(), QStringList({"b"}));
+	QCOMPARE(waves.at(2).toStringList(), QStringList({"c"}));
+	QCOMPARE(report.value("criticalPath").toStringList(), QStringList({"a", "b", "c"}));
+	QVERIFY(report.value("duration").toLongLong() >= 3 * DELAY);
+
+	QVariantMap entryA = ServiceEntry(report, "a");
+	QVariantMap entryB = ServiceEntry(report, "b");
+	QVariantMap entryC = ServiceEntry(report, "c");
+	QVariantMap entryD = ServiceEntry(report, "d");
+	for (auto && entry : {entryA, entryB, entryC, entryD}) {
+		QVERIFY(entry.value("requested").toLongLong() >= 0);
+		QVERIFY(entry.value("started").toLongLong() >= entry.value("requested").toLongLong());
+		QCOMPARE(entry.value("latency").toLongLong(), entry.value("started").toLongLong() - entry.value("requested").toLongLong());
+	}
+	QVERIFY(entryB.value("requested").toLongLong() >= entryA.value("started").toLongLong());
+	QVERIFY(entryC.value("requested").toLongLong() >= entryB.value("started").toLongLong());
+	QVERIFY(entryA.value("latency").toLongLong() >= DELAY);
+	QVERIFY(entryD.value("latency").toLongLong() < entryA.value("latency").toLongLong());
+
+	group.stop();
+	QTRY_VERIFY(group.states()->stopped()->active());
+}
+
+ServiceDependency * test_StartupScheduler::Dependency(AbstractService * service, const QList<AbstractService *> & requiredServices, QObject * parent)
+{
+	ServiceDependency * dependency = new ServiceDependency(parent);
+	dependency->setService(service);
+	for (auto && requiredService : requiredServices)
+		dependency->appendRequiredService(requiredService);
+	return dependency;
+}
+
+QVariantMap test_StartupScheduler::ServiceEntry(const QVariantMap & report, const QString & name)
+{
+	for (auto && entry : report.value("services").toList())
+		if (entry.toMap().value("name").toString() == name)
+			return entry.toMap();
+	return QVariantMap();
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::services::internal::test_StartupScheduler)
+#include "test_StartupScheduler.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
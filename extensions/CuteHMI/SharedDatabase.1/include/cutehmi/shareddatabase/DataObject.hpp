@@ -97,6 +97,14 @@ class CUTEHMI_SHAREDDATABASE_API DataObject:
 		 */
 		void pushError(const QSqlError & sqlError, const QString & query = QString());
 
+		/**
+		 * Clear SQL errors. Errors accumulated with pushError() function, which have not yet been processed, are discarded. This
+		 * can be used to drop errors caused by deliberately cancelled queries.
+		 *
+		 * @threadsafe
+		 */
+		void clearErrors();
+
 		/**
 		 * Create database worker and assign it a task. Worker ready() signal is connected to processErrors() slot. Each worker is
 		 * also connected to incrementBusy() and decrementBusy() slots to reflect its status within @a busy property.
@@ -34,6 +34,12 @@ class CUTEHMI_SHAREDDATABASE_API Database:
 		static const char * INITIAL_USER;
 		static const char * INITIAL_PASSWORD;
 		static constexpr bool INITIAL_THREADED = true;
+		static const char * INITIAL_SQLITE_JOURNAL_MODE;
+		static const char * INITIAL_SQLITE_SYNCHRONOUS;
+		static constexpr int INITIAL_SQLITE_PAGE_SIZE = 4096;
+		static constexpr int INITIAL_SQLITE_CACHE_SIZE = -8192;
+		static constexpr qint64 INITIAL_SQLITE_MMAP_SIZE = 64 * 1024 * 1024;
+		static constexpr int INITIAL_SQLITE_CHECKPOINT_INTERVAL = 60000;
 
 		/**
 		  Database type. Use Qt [driver name](https://doc.qt.io/qt-5/qsqldatabase.html#addDatabase-1) to specify the type.
@@ -54,8 +60,55 @@ class CUTEHMI_SHAREDDATABASE_API Database:
 
 		Q_PROPERTY(bool threaded READ threaded WRITE setThreaded NOTIFY threadedChanged)
 
+		/**
+		  SQLite journal mode (@p DELETE, @p TRUNCATE, @p PERSIST, @p MEMORY, @p WAL or @p OFF). Default is @p DELETE, which is
+		  the default mode of SQLite. Write-ahead log (@p WAL) lets readers proceed concurrently with a writer and turns each
+		  transaction into a single sequential write, but it requires shared memory, thus database file can not reside on a
+		  network file system. Unrecognized modes are ignored.
+		  */
+		Q_PROPERTY(QString sqliteJournalMode READ sqliteJournalMode WRITE setSqliteJournalMode NOTIFY sqliteJournalModeChanged)
+
+		/**
+		  SQLite synchronous setting (@p OFF, @p NORMAL, @p FULL or @p EXTRA). Default is @p FULL, which is the default setting
+		  of SQLite. In WAL mode @p NORMAL is safe against corruption, but most recent transactions may be lost on power failure.
+		  Unrecognized settings are ignored.
+		  */
+		Q_PROPERTY(QString sqliteSynchronous READ sqliteSynchronous WRITE setSqliteSynchronous NOTIFY sqliteSynchronousChanged)
+
+		/**
+		  SQLite page size [B]. Page size can not be changed, once database file has been created in WAL mode.
+		  */
+		Q_PROPERTY(int sqlitePageSize READ sqlitePageSize WRITE setSqlitePageSize NOTIFY sqlitePageSizeChanged)
+
+		/**
+		  SQLite cache size. Positive value denotes number of pages, negative value denotes size in KiB.
+		  */
+		Q_PROPERTY(int sqliteCacheSize READ sqliteCacheSize WRITE setSqliteCacheSize NOTIFY sqliteCacheSizeChanged)
+
+		/**
+		  SQLite memory-mapped I/O size [B]. Memory-mapped I/O is disabled if set to 0.
+		  */
+		Q_PROPERTY(qint64 sqliteMmapSize READ sqliteMmapSize WRITE setSqliteMmapSize NOTIFY sqliteMmapSizeChanged)
+
+		/**
+		  Interval [ms] between passive WAL checkpoints. Checkpoints are scheduled only in WAL mode. If set to 0, only automatic
+		  checkpoints of SQLite take place.
+		  */
+		Q_PROPERTY(int sqliteCheckpointInterval READ sqliteCheckpointInterval WRITE setSqliteCheckpointInterval NOTIFY sqliteCheckpointIntervalChanged)
+
 		static bool IsConnected(const QString & connectionName);
 
+		/**
+		 * Notify listeners within the process. Function dispatches notification to NotificationListener objects of this process.
+		 * It is intended for drivers, which do not support notifications (e.g. SQLite). Notifications sent with database
+		 * specific statements, such as PostgreSQL @p NOTIFY, are delivered to all the listening processes, including this one.
+		 * This function is thread-safe.
+		 * @param connectionName connection name.
+		 * @param channel notification channel.
+		 * @param payload notification payload.
+		 */
+		static void Notify(const QString & connectionName, const QString & channel, const QString & payload = QString());
+
 		Database(QObject * parent = nullptr);
 
 		~Database() override;
@@ -157,6 +210,30 @@ class CUTEHMI_SHAREDDATABASE_API Database:
 		 */
 		void setThreaded(bool threaded);
 
+		QString sqliteJournalMode() const;
+
+		void setSqliteJournalMode(const QString & sqliteJournalMode);
+
+		QString sqliteSynchronous() const;
+
+		void setSqliteSynchronous(const QString & sqliteSynchronous);
+
+		int sqlitePageSize() const;
+
+		void setSqlitePageSize(int sqlitePageSize);
+
+		int sqliteCacheSize() const;
+
+		void setSqliteCacheSize(int sqliteCacheSize);
+
+		qint64 sqliteMmapSize() const;
+
+		void setSqliteMmapSize(qint64 sqliteMmapSize);
+
+		int sqliteCheckpointInterval() const;
+
+		void setSqliteCheckpointInterval(int sqliteCheckpointInterval);
+
 		void configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus) override;
 
 		void configureStarting(QState * starting, AssignStatusFunction assignStatus) override;
@@ -196,6 +273,18 @@ class CUTEHMI_SHAREDDATABASE_API Database:
 
 		void threadedChanged();
 
+		void sqliteJournalModeChanged();
+
+		void sqliteSynchronousChanged();
+
+		void sqlitePageSizeChanged();
+
+		void sqliteCacheSizeChanged();
+
+		void sqliteMmapSizeChanged();
+
+		void sqliteCheckpointIntervalChanged();
+
 		void connected();
 
 		void disconnected();
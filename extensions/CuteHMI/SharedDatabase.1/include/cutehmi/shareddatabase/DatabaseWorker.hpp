@@ -4,6 +4,7 @@
 #include "internal/common.hpp"
 
 #include <cutehmi/Worker.hpp>
+#include <cutehmi/Executor.hpp>
 
 #include <QSqlDatabase>
 
@@ -12,6 +13,10 @@ namespace shareddatabase {
 
 /**
  * %Database worker. Convenient worker class that runs tasks in the same thread as where database connection lives.
+ *
+ * Alternatively worker can be employed by an Executor (see setExecutor()). In such case each executor thread uses its own clone
+ * of the database connection, so that read-only or independent jobs can run concurrently. Since clones are separate connections,
+ * they do not share transactions with the original connection and they can not be used with in-memory SQLite databases.
  */
 class CUTEHMI_SHAREDDATABASE_API DatabaseWorker:
 	public QObject
@@ -33,6 +38,18 @@ class CUTEHMI_SHAREDDATABASE_API DatabaseWorker:
 		 */
 		void setTask(std::function<void(QSqlDatabase & db)> task);
 
+		/**
+		 * Get executor.
+		 * @return executor, which runs the job or @p nullptr if job is run in database thread.
+		 */
+		Executor * executor() const;
+
+		/**
+		 * Set executor. Executor should not be changed while the worker is working.
+		 * @param executor executor, which should run the job. If @p nullptr is passed, job is run in database thread.
+		 */
+		void setExecutor(Executor * executor);
+
 		/**
 		 * %Worker's job. This function can be reimplemented. Default implementation calls @a task function if it has been set (it
 		 * can be passed to the \ref DatabseWorker(const QString & connectionName, std::function<void(QSqlDatabase & db)> task)
@@ -118,9 +135,17 @@ class CUTEHMI_SHAREDDATABASE_API DatabaseWorker:
 	private:
 		void instantiateWorker();
 
+		/**
+		 * Get connection for current thread. If worker is employed by an executor, connection is cloned and opened on first
+		 * use. Cloned connection is removed, when the thread finishes.
+		 * @return database connection usable in current thread.
+		 */
+		QSqlDatabase threadDatabase() const;
+
 		struct Members {
 			const QString connectionName;
 			std::function<void(QSqlDatabase & db)> task;
+			Executor * executor;
 			std::unique_ptr<Worker> worker;
 			std::unique_ptr<QSqlDatabase> db;
 		};
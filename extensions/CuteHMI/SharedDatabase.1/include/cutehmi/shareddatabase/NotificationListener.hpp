@@ -0,0 +1,91 @@
+#ifndef H_EXTENSIONS_CUTEHMI_SHAREDDATABASE_1_INCLUDE_CUTEHMI_SHAREDDATABASE_NOTIFICATIONLISTENER_HPP
+#define H_EXTENSIONS_CUTEHMI_SHAREDDATABASE_1_INCLUDE_CUTEHMI_SHAREDDATABASE_NOTIFICATIONLISTENER_HPP
+
+#include "internal/common.hpp"
+
+#include <QObject>
+#include <QQmlEngine>
+
+namespace cutehmi {
+namespace shareddatabase {
+
+/**
+ * Notification listener. Listener receives notifications sent to particular channel of database connection.
+ *
+ * For drivers, which support notifications (e.g. PostgreSQL), listener subscribes to the channel through database driver, so that
+ * notifications sent with @p NOTIFY statement by any database client are received. Notifications dispatched within the process
+ * with Database::Notify() are received regardless of the driver.
+ */
+class CUTEHMI_SHAREDDATABASE_API NotificationListener:
+	public QObject
+{
+		Q_OBJECT
+		QML_NAMED_ELEMENT(NotificationListener)
+
+	public:
+		/**
+		  Database connection name.
+		  */
+		Q_PROPERTY(QString connectionName READ connectionName WRITE setConnectionName NOTIFY connectionNameChanged)
+
+		/**
+		  Notification channel. Listener is inactive, when channel is empty.
+		  */
+		Q_PROPERTY(QString channel READ channel WRITE setChannel NOTIFY channelChanged)
+
+		NotificationListener(QObject * parent = nullptr);
+
+		~NotificationListener() override;
+
+		QString connectionName() const;
+
+		void setConnectionName(const QString & connectionName);
+
+		QString channel() const;
+
+		void setChannel(const QString & channel);
+
+	signals:
+		void connectionNameChanged();
+
+		void channelChanged();
+
+		/**
+		 * Notified. Signal is emitted, when notification has been received.
+		 * @param payload notification payload.
+		 */
+		void notified(QString payload);
+
+	private slots:
+		void onNotified(QString connectionName, QString channel, QString payload);
+
+	private:
+		void subscribe();
+
+		void unsubscribe();
+
+		struct Members
+		{
+			QString connectionName;
+			QString channel;
+			bool subscribed = false;
+		};
+
+		MPtr<Members> m;
+};
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
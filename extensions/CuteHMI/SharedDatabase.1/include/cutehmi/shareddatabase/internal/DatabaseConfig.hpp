@@ -27,6 +27,12 @@ class CUTEHMI_SHAREDDATABASE_PRIVATE DatabaseConfig final
 				QString user;
 				QString password;
 				QString connectionName;
+				QString sqliteJournalMode;
+				QString sqliteSynchronous;
+				int sqlitePageSize;
+				int sqliteCacheSize;
+				qint64 sqliteMmapSize;
+				int sqliteCheckpointInterval;
 		};
 
 		typedef QSharedDataPointer<Data> DataPtr;
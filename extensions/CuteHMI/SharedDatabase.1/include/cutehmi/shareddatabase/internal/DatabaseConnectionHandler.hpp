@@ -9,6 +9,7 @@
 #include <QObject>
 #include <QBasicTimer>
 #include <QSqlDatabase>
+#include <QSqlDriver>
 
 
 namespace cutehmi {
@@ -22,6 +23,8 @@ class CUTEHMI_SHAREDDATABASE_PRIVATE DatabaseConnectionHandler:
 
 		typedef QObject Parent;
 
+		friend class test_DatabaseConnectionHandler;
+
 	public:
 		static constexpr int INITIAL_MONITOR_INTERVAL = 1000;
 
@@ -47,13 +50,26 @@ class CUTEHMI_SHAREDDATABASE_PRIVATE DatabaseConnectionHandler:
 	private slots:
 		void printError(cutehmi::InplaceError error);
 
+		void subscribe(QString connectionName, QString channel);
+
+		void unsubscribe(QString connectionName, QString channel);
+
+		void onNotification(const QString & name, QSqlDriver::NotificationSource source, const QVariant & payload);
+
 	private:
+		void subscribeNotifications();
+
+		void configureSqlite();
+
+		void checkpointSqlite();
+
 		struct Members
 		{
 			int monitorInterval;
 			int maintenanceCount;
 			DatabaseConfig config;
 			QBasicTimer monitorTimer;
+			QBasicTimer checkpointTimer;
 			QSqlDatabase db;
 			QString connectionName;
 
@@ -1,5 +1,7 @@
 #include <cutehmi/shareddatabase/DataObject.hpp>
 
+#include <cutehmi/trace.hpp>
+
 #include <QMutexLocker>
 
 namespace cutehmi {
@@ -41,9 +43,19 @@ void DataObject::pushError(const QSqlError & sqlError, const QString & query)
 	m->sqlErrors.append({sqlError, query});
 }
 
+void DataObject::clearErrors()
+{
+	QMutexLocker locker(& m->sqlErrorsMutex);
+	m->sqlErrors.clear();
+}
+
 DatabaseWorker * DataObject::worker(std::function<void (QSqlDatabase & db)> task) const
 {
-	std::unique_ptr<DatabaseWorker> databaseWorker(new DatabaseWorker(m->connectionName, task));
+	std::unique_ptr<DatabaseWorker> databaseWorker(new DatabaseWorker(m->connectionName, [task](QSqlDatabase & db) {
+		CUTEHMI_TRACE_SCOPE(TRACE_DATABASE, "DataObject::worker");
+
+		task(db);
+	}));
 	connect(databaseWorker.get(), & DatabaseWorker::ready, this, & DataObject::processErrors);
 	connect(databaseWorker.get(), & DatabaseWorker::started, this, & DataObject::incrementBusy);
 	connect(databaseWorker.get(), & DatabaseWorker::ready, this, & DataObject::decrementBusy);
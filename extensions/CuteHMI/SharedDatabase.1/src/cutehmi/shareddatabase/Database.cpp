@@ -11,6 +11,12 @@ constexpr int Database::INITIAL_PORT;
 const char * Database::INITIAL_NAME = "dbname";
 const char * Database::INITIAL_USER = "user";
 const char * Database::INITIAL_PASSWORD = "password";
+const char * Database::INITIAL_SQLITE_JOURNAL_MODE = "DELETE";
+const char * Database::INITIAL_SQLITE_SYNCHRONOUS = "FULL";
+constexpr int Database::INITIAL_SQLITE_PAGE_SIZE;
+constexpr int Database::INITIAL_SQLITE_CACHE_SIZE;
+constexpr qint64 Database::INITIAL_SQLITE_MMAP_SIZE;
+constexpr int Database::INITIAL_SQLITE_CHECKPOINT_INTERVAL;
 
 bool Database::IsConnected(const QString & connectionName)
 {
@@ -22,6 +28,11 @@ bool Database::IsConnected(const QString & connectionName)
 	}
 }
 
+void Database::Notify(const QString & connectionName, const QString & channel, const QString & payload)
+{
+	internal::DatabaseDictionary::Instance().notify(connectionName, channel, payload);
+}
+
 Database::Database(QObject * parent):
 	QObject(parent),
 	m(new Members)
@@ -141,6 +152,84 @@ void Database::setThreaded(bool threaded)
 	}
 }
 
+QString Database::sqliteJournalMode() const
+{
+	return m->config.data()->sqliteJournalMode;
+}
+
+void Database::setSqliteJournalMode(const QString & sqliteJournalMode)
+{
+	if (m->config.data()->sqliteJournalMode != sqliteJournalMode) {
+		m->config.data()->sqliteJournalMode = sqliteJournalMode;
+		emit sqliteJournalModeChanged();
+	}
+}
+
+QString Database::sqliteSynchronous() const
+{
+	return m->config.data()->sqliteSynchronous;
+}
+
+void Database::setSqliteSynchronous(const QString & sqliteSynchronous)
+{
+	if (m->config.data()->sqliteSynchronous != sqliteSynchronous) {
+		m->config.data()->sqliteSynchronous = sqliteSynchronous;
+		emit sqliteSynchronousChanged();
+	}
+}
+
+int Database::sqlitePageSize() const
+{
+	return m->config.data()->sqlitePageSize;
+}
+
+void Database::setSqlitePageSize(int sqlitePageSize)
+{
+	if (m->config.data()->sqlitePageSize != sqlitePageSize) {
+		m->config.data()->sqlitePageSize = sqlitePageSize;
+		emit sqlitePageSizeChanged();
+	}
+}
+
+int Database::sqliteCacheSize() const
+{
+	return m->config.data()->sqliteCacheSize;
+}
+
+void Database::setSqliteCacheSize(int sqliteCacheSize)
+{
+	if (m->config.data()->sqliteCacheSize != sqliteCacheSize) {
+		m->config.data()->sqliteCacheSize = sqliteCacheSize;
+		emit sqliteCacheSizeChanged();
+	}
+}
+
+qint64 Database::sqliteMmapSize() const
+{
+	return m->config.data()->sqliteMmapSize;
+}
+
+void Database::setSqliteMmapSize(qint64 sqliteMmapSize)
+{
+	if (m->config.data()->sqliteMmapSize != sqliteMmapSize) {
+		m->config.data()->sqliteMmapSize = sqliteMmapSize;
+		emit sqliteMmapSizeChanged();
+	}
+}
+
+int Database::sqliteCheckpointInterval() const
+{
+	return m->config.data()->sqliteCheckpointInterval;
+}
+
+void Database::setSqliteCheckpointInterval(int sqliteCheckpointInterval)
+{
+	if (m->config.data()->sqliteCheckpointInterval != sqliteCheckpointInterval) {
+		m->config.data()->sqliteCheckpointInterval = sqliteCheckpointInterval;
+		emit sqliteCheckpointIntervalChanged();
+	}
+}
+
 void Database::configureStarted(QState * active, const QState * idling, const QState * yielding, AssignStatusFunction assignStatus)
 {
 	Q_UNUSED(idling)
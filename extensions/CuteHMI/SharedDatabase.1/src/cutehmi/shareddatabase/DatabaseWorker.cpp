@@ -4,12 +4,13 @@
 
 #include <QSqlDatabase>
 #include <QSqlDriver>
+#include <QSqlError>
 
 namespace cutehmi {
 namespace shareddatabase {
 
 DatabaseWorker::DatabaseWorker(const QString & connectionName, std::function<void (QSqlDatabase & db)> task):
-	m(new Members{connectionName, task, nullptr, {}})
+	m(new Members{connectionName, task, nullptr, nullptr, {}})
 {
 	connect(& internal::DatabaseDictionary::Instance(), & internal::DatabaseDictionary::threadChanged, this, & DatabaseWorker::updateDbThread);
 	instantiateWorker();
@@ -20,6 +21,21 @@ void DatabaseWorker::setTask(std::function<void (QSqlDatabase & db)> task)
 	m->task = task;
 }
 
+Executor * DatabaseWorker::executor() const
+{
+	return m->executor;
+}
+
+void DatabaseWorker::setExecutor(Executor * executor)
+{
+	if (m->executor != executor) {
+		if (m->worker)
+			m->worker->wait();
+		m->executor = executor;
+		instantiateWorker();
+	}
+}
+
 void DatabaseWorker::job(QSqlDatabase & db)
 {
 	if (m->task)
@@ -75,7 +91,7 @@ void DatabaseWorker::updateDbThread(const QString & connectionName)
 void DatabaseWorker::instantiateWorker()
 {
 	m->worker.reset(new Worker([this]() {
-		m->db.reset(new QSqlDatabase(QSqlDatabase::database(m->connectionName)));
+		m->db.reset(new QSqlDatabase(threadDatabase()));
 		if (!m->db->isOpen()) {
 			CUTEHMI_CRITICAL("Database worker '" << this << "' refuses to do the job, because database connection '" << m->connectionName << "' is not open.");
 			emit refused(QObject::tr("database connection '%1' is not open").arg(m->connectionName));
@@ -83,7 +99,10 @@ void DatabaseWorker::instantiateWorker()
 			job(*m->db);
 		m->db.reset();
 	}));
-	if (dbThread()) {
+	if (m->executor) {
+		m->worker->employ(*m->executor, false);
+		CUTEHMI_DEBUG("Database worker for connection '" << m->connectionName << "' has been employed by an executor.");
+	} else if (dbThread()) {
 		if (dbThread() == QThread::currentThread())
 			CUTEHMI_DEBUG("Database worker for connection '" << m->connectionName << "' will operate from current thread.");
 		else {
@@ -95,6 +114,25 @@ void DatabaseWorker::instantiateWorker()
 	connect(m->worker.get(), & Worker::ready, this, & DatabaseWorker::ready);
 }
 
+QSqlDatabase DatabaseWorker::threadDatabase() const
+{
+	if (!m->executor)
+		return QSqlDatabase::database(m->connectionName);
+
+	QString cloneName = QStringLiteral("%1@%2").arg(m->connectionName).arg(reinterpret_cast<quintptr>(QThread::currentThread()), 0, 16);
+	if (!QSqlDatabase::contains(cloneName)) {
+		QSqlDatabase clone = QSqlDatabase::cloneDatabase(m->connectionName, cloneName);
+		if (!clone.open())
+			CUTEHMI_WARNING("Could not open clone of database connection '" << m->connectionName << "': " << clone.lastError().text());
+		else
+			CUTEHMI_DEBUG("Opened clone '" << cloneName << "' of database connection '" << m->connectionName << "'.");
+		QObject::connect(QThread::currentThread(), & QThread::finished, [cloneName]() {
+			QSqlDatabase::removeDatabase(cloneName);
+		});
+	}
+	return QSqlDatabase::database(cloneName);
+}
+
 }
 }
 
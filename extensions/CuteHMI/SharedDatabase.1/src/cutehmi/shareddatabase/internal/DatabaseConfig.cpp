@@ -15,7 +15,13 @@ DatabaseConfig::Data::Data():
 	name(Database::INITIAL_NAME),
 	user(Database::INITIAL_USER),
 	password(Database::INITIAL_PASSWORD),
-	connectionName(QUuid::createUuid().toString())
+	connectionName(QUuid::createUuid().toString()),
+	sqliteJournalMode(Database::INITIAL_SQLITE_JOURNAL_MODE),
+	sqliteSynchronous(Database::INITIAL_SQLITE_SYNCHRONOUS),
+	sqlitePageSize(Database::INITIAL_SQLITE_PAGE_SIZE),
+	sqliteCacheSize(Database::INITIAL_SQLITE_CACHE_SIZE),
+	sqliteMmapSize(Database::INITIAL_SQLITE_MMAP_SIZE),
+	sqliteCheckpointInterval(Database::INITIAL_SQLITE_CHECKPOINT_INTERVAL)
 {
 }
 
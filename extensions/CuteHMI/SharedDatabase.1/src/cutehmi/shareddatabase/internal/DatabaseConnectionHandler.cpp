@@ -1,6 +1,8 @@
 #include <cutehmi/shareddatabase/internal/DatabaseConnectionHandler.hpp>
 #include <cutehmi/shareddatabase/DatabaseWorker.hpp>
 
+#include "DatabaseDictionary.hpp"
+
 #include <QTimer>
 #include <QSqlQuery>
 #include <QSqlError>
@@ -31,6 +33,9 @@ void DatabaseConnectionHandler::connect()
 	else {
 		if (m->db.open()) {
 			CUTEHMI_DEBUG("Connected with database.");
+			if (m->db.driverName() == "QSQLITE")
+				configureSqlite();
+			subscribeNotifications();
 			emit connected(m->connectionName);
 		} else {
 			emit errored(CUTEHMI_ERROR(tr("Failed to establish connection with database.")));
@@ -42,7 +47,9 @@ void DatabaseConnectionHandler::connect()
 
 void DatabaseConnectionHandler::disconnect()
 {
+	DatabaseDictionary::Instance().disconnect(this);
 	m->monitorTimer.stop();
+	m->checkpointTimer.stop();
 	m->db.close();
 	emit disconnected(m->connectionName);
 }
@@ -96,7 +103,9 @@ void DatabaseConnectionHandler::timerEvent(QTimerEvent * event)
 			emit errored(CUTEHMI_ERROR(tr("Lost connection with database.")));
 			m->maintenanceCount = 0;
 		}
-	} else
+	} else if (event->timerId() == m->checkpointTimer.timerId())
+		checkpointSqlite();
+	else
 		Parent::timerEvent(event);
 }
 
@@ -105,6 +114,89 @@ void DatabaseConnectionHandler::printError(InplaceError error)
 	CUTEHMI_CRITICAL(error.str());
 }
 
+void DatabaseConnectionHandler::subscribe(QString connectionName, QString channel)
+{
+	if (connectionName != m->connectionName)
+		return;
+
+	if (!m->db.driver()->subscribeToNotification(channel))
+		CUTEHMI_WARNING("Could not subscribe to notification channel '" << channel << "' of connection '" << connectionName << "'.");
+}
+
+void DatabaseConnectionHandler::unsubscribe(QString connectionName, QString channel)
+{
+	if (connectionName != m->connectionName)
+		return;
+
+	m->db.driver()->unsubscribeFromNotification(channel);
+}
+
+void DatabaseConnectionHandler::onNotification(const QString & name, QSqlDriver::NotificationSource source, const QVariant & payload)
+{
+	Q_UNUSED(source)
+
+	DatabaseDictionary::Instance().notify(m->connectionName, name, payload.toString());
+}
+
+void DatabaseConnectionHandler::configureSqlite()
+{
+	// Keywords are interpolated into statements, so only the ones recognized by SQLite are accepted.
+	static const QStringList JOURNAL_MODES = {"DELETE", "TRUNCATE", "PERSIST", "MEMORY", "WAL", "OFF"};
+	static const QStringList SYNCHRONOUS_SETTINGS = {"OFF", "NORMAL", "FULL", "EXTRA"};
+
+	// Page size has to be set before journal mode, because it can not be changed once database has been created in WAL mode.
+	QStringList pragmas;
+	pragmas << QString("PRAGMA page_size = %1").arg(m->config.data()->sqlitePageSize);
+	if (JOURNAL_MODES.contains(m->config.data()->sqliteJournalMode, Qt::CaseInsensitive))
+		pragmas << QString("PRAGMA journal_mode = %1").arg(m->config.data()->sqliteJournalMode);
+	else
+		CUTEHMI_WARNING("Ignoring unrecognized SQLite journal mode '" << m->config.data()->sqliteJournalMode << "'.");
+	if (SYNCHRONOUS_SETTINGS.contains(m->config.data()->sqliteSynchronous, Qt::CaseInsensitive))
+		pragmas << QString("PRAGMA synchronous = %1").arg(m->config.data()->sqliteSynchronous);
+	else
+		CUTEHMI_WARNING("Ignoring unrecognized SQLite synchronous setting '" << m->config.data()->sqliteSynchronous << "'.");
+	pragmas << QString("PRAGMA cache_size = %1").arg(m->config.data()->sqliteCacheSize)
+			<< QString("PRAGMA mmap_size = %1").arg(m->config.data()->sqliteMmapSize)
+			<< "PRAGMA temp_store = MEMORY";
+
+	QSqlQuery query(m->db);
+	for (auto && pragma : pragmas) {
+		CUTEHMI_DEBUG("Executing '" << pragma << "'...");
+		if (!query.exec(pragma))
+			CUTEHMI_WARNING("Could not execute '" << pragma << "': " << query.lastError().text());
+		else if (query.next())
+			CUTEHMI_DEBUG("Result: " << query.value(0).toString());
+		query.finish();
+	}
+
+	if (m->config.data()->sqliteJournalMode.compare("WAL", Qt::CaseInsensitive) == 0 && m->config.data()->sqliteCheckpointInterval > 0)
+		m->checkpointTimer.start(m->config.data()->sqliteCheckpointInterval, this);
+}
+
+void DatabaseConnectionHandler::checkpointSqlite()
+{
+	// Passive checkpoint does not wait for readers or writers, so it does not stall data acquisition.
+	QSqlQuery query(m->db);
+	CUTEHMI_DEBUG("Performing WAL checkpoint...");
+	if (!query.exec("PRAGMA wal_checkpoint(PASSIVE)"))
+		CUTEHMI_WARNING("WAL checkpoint failed: " << query.lastError().text());
+	else if (query.next())
+		CUTEHMI_DEBUG("Checkpoint busy: " << query.value(0).toInt() << ", log frames: " << query.value(1).toInt() << ", checkpointed frames: " << query.value(2).toInt() << ".");
+}
+
+void DatabaseConnectionHandler::subscribeNotifications()
+{
+	// Drivers without notification support (e.g. SQLite) rely on notifications dispatched within the process.
+	if (!m->db.driver()->hasFeature(QSqlDriver::EventNotifications))
+		return;
+
+	QObject::connect(m->db.driver(), QOverload<const QString &, QSqlDriver::NotificationSource, const QVariant &>::of(& QSqlDriver::notification), this, & DatabaseConnectionHandler::onNotification);
+	QObject::connect(& DatabaseDictionary::Instance(), & DatabaseDictionary::subscribed, this, & DatabaseConnectionHandler::subscribe);
+	QObject::connect(& DatabaseDictionary::Instance(), & DatabaseDictionary::unsubscribed, this, & DatabaseConnectionHandler::unsubscribe);
+	for (auto && channel : DatabaseDictionary::Instance().subscriptions(m->connectionName))
+		subscribe(m->connectionName, channel);
+}
+
 }
 }
 }
@@ -52,6 +52,45 @@ bool DatabaseDictionary::isManaged(const QString & connectionName) const
 	return m->managed.contains(connectionName);
 }
 
+void DatabaseDictionary::subscribe(const QString & connectionName, const QString & channel)
+{
+	QMutexLocker locker(& m->subscriptionsMutex);
+
+	if (m->subscriptions[connectionName][channel]++ == 0) {
+		locker.unlock();
+		emit subscribed(connectionName, channel);
+	}
+}
+
+void DatabaseDictionary::unsubscribe(const QString & connectionName, const QString & channel)
+{
+	QMutexLocker locker(& m->subscriptionsMutex);
+
+	SubscriptionsContainer::iterator channels = m->subscriptions.find(connectionName);
+	if (channels == m->subscriptions.end() || !channels->contains(channel))
+		return;
+
+	if (--(*channels)[channel] == 0) {
+		channels->remove(channel);
+		if (channels->isEmpty())
+			m->subscriptions.erase(channels);
+		locker.unlock();
+		emit unsubscribed(connectionName, channel);
+	}
+}
+
+QStringList DatabaseDictionary::subscriptions(const QString & connectionName) const
+{
+	QMutexLocker locker(& m->subscriptionsMutex);
+
+	return m->subscriptions.value(connectionName).keys();
+}
+
+void DatabaseDictionary::notify(const QString & connectionName, const QString & channel, const QString & payload)
+{
+	emit notified(connectionName, channel, payload);
+}
+
 DatabaseDictionary::DatabaseDictionary():
 	m(new Members)
 {
@@ -1,10 +1,13 @@
 #ifndef H_EXTENSIONS_CUTEHMI_SHAREDDATABASE_1_SRC_CUTEHMI_SHAREDDATABASE_INTERNAL_DATABASEDICTIONARY_HPP
 #define H_EXTENSIONS_CUTEHMI_SHAREDDATABASE_1_SRC_CUTEHMI_SHAREDDATABASE_INTERNAL_DATABASEDICTIONARY_HPP
 
+#include <cutehmi/shareddatabase/internal/common.hpp>
+
 #include <cutehmi/Singleton.hpp>
 
 #include <QHash>
 #include <QSet>
+#include <QMutex>
 
 class QThread;
 
@@ -12,7 +15,7 @@ namespace cutehmi {
 namespace shareddatabase {
 namespace internal {
 
-class DatabaseDictionary:
+class CUTEHMI_SHAREDDATABASE_PRIVATE DatabaseDictionary:
 	public QObject,
 	public Singleton<DatabaseDictionary>
 {
@@ -39,21 +42,49 @@ class DatabaseDictionary:
 
 		bool isManaged(const QString & connectionName) const;
 
+		/**
+		 * Subscribe to notification channel. Subscriptions are reference counted.
+		 * @param connectionName connection name.
+		 * @param channel notification channel.
+		 */
+		void subscribe(const QString & connectionName, const QString & channel);
+
+		void unsubscribe(const QString & connectionName, const QString & channel);
+
+		QStringList subscriptions(const QString & connectionName) const;
+
+		/**
+		 * Dispatch notification. This function is thread-safe.
+		 * @param connectionName connection name.
+		 * @param channel notification channel.
+		 * @param payload notification payload.
+		 */
+		void notify(const QString & connectionName, const QString & channel, const QString & payload);
+
 	protected:
 		DatabaseDictionary();
 
 	signals:
 		void threadChanged(QString connectionName);
 
+		void subscribed(QString connectionName, QString channel);
+
+		void unsubscribed(QString connectionName, QString channel);
+
+		void notified(QString connectionName, QString channel, QString payload);
+
 	private:
 		typedef QHash<QString, QThread *> ThreadsContainer;
 		typedef QSet<QString> ConnectedContainer;
 		typedef QSet<QString> ManagedContainer;
+		typedef QHash<QString, QHash<QString, int>> SubscriptionsContainer;
 
 		struct Members {
 			ThreadsContainer threads;
 			ConnectedContainer connected;
 			ManagedContainer managed;
+			SubscriptionsContainer subscriptions;
+			mutable QMutex subscriptionsMutex;
 		};
 
 		MPtr<Members> m;
@@ -18,6 +18,11 @@ class Database: public cutehmi::shareddatabase::Database {};
  */
 class DataObject: public cutehmi::shareddatabase::DataObject {};
 
+/**
+ * Exposes cutehmi::shareddatabase::NotificationListener to QML.
+ */
+class NotificationListener: public cutehmi::shareddatabase::NotificationListener {};
+
 /**
  * Exposes cutehmi::shareddatabase::PostgresMaintenance to QML.
  */
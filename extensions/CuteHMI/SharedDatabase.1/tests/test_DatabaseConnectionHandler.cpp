@@ -0,0 +1,153 @@
+#include <cutehmi/shareddatabase/Database.hpp>
+#include <cutehmi/shareddatabase/internal/DatabaseConnectionHandler.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+
+#include <memory>
+
+namespace cutehmi {
+namespace shareddatabase {
+namespace internal {
+
+class test_DatabaseConnectionHandler:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void cleanup();
+
+		void defaultProfile();
+
+		void walProfile();
+
+		void unrecognizedSettings();
+
+	private:
+		static QVariant Pragma(const QString & connectionName, const QString & pragma);
+
+		DatabaseConfig config(const QString & connectionName) const;
+
+		void connectHandler(const DatabaseConfig & config);
+
+		QTemporaryDir m_dir;
+		std::unique_ptr<DatabaseConnectionHandler> m_handler;
+};
+
+void test_DatabaseConnectionHandler::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+}
+
+void test_DatabaseConnectionHandler::cleanup()
+{
+	if (m_handler) {
+		QString connectionName = m_handler->m->connectionName;
+		m_handler->disconnect();
+		m_handler.reset();
+		QSqlDatabase::removeDatabase(connectionName);
+	}
+}
+
+void test_DatabaseConnectionHandler::defaultProfile()
+{
+	// Journal mode and synchronous setting default to the ones of SQLite.
+	connectHandler(config("defaultProfile"));
+	QCOMPARE(Pragma("defaultProfile", "journal_mode").toString(), QString("delete"));
+	QCOMPARE(Pragma("defaultProfile", "synchronous").toInt(), 2);	// FULL.
+	QCOMPARE(Pragma("defaultProfile", "page_size").toInt(), Database::INITIAL_SQLITE_PAGE_SIZE);
+	QCOMPARE(Pragma("defaultProfile", "cache_size").toInt(), Database::INITIAL_SQLITE_CACHE_SIZE);
+	QCOMPARE(Pragma("defaultProfile", "temp_store").toInt(), 2);	// MEMORY.
+
+	// Checkpoints are scheduled only in WAL mode.
+	QVERIFY(!m_handler->m->checkpointTimer.isActive());
+}
+
+void test_DatabaseConnectionHandler::walProfile()
+{
+	DatabaseConfig walConfig = config("walProfile");
+	walConfig.data()->sqliteJournalMode = "wal";
+	walConfig.data()->sqliteSynchronous = "NORMAL";
+	walConfig.data()->sqlitePageSize = 8192;
+	walConfig.data()->sqliteCacheSize = 100;
+	connectHandler(walConfig);
+	QCOMPARE(Pragma("walProfile", "journal_mode").toString(), QString("wal"));
+	QCOMPARE(Pragma("walProfile", "synchronous").toInt(), 1);	// NORMAL.
+	QCOMPARE(Pragma("walProfile", "page_size").toInt(), 8192);
+	QCOMPARE(Pragma("walProfile", "cache_size").toInt(), 100);
+	QVERIFY(m_handler->m->checkpointTimer.isActive());
+
+	// WAL mode is persistent, thus other connections see it as well.
+	{
+		QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "walProfile_other");
+		db.setDatabaseName(m_dir.filePath("walProfile.sqlite"));
+		QVERIFY(db.open());
+		QSqlQuery query("PRAGMA journal_mode", db);
+		QVERIFY(query.next());
+		QCOMPARE(query.value(0).toString(), QString("wal"));
+	}
+	QSqlDatabase::removeDatabase("walProfile_other");
+}
+
+void test_DatabaseConnectionHandler::unrecognizedSettings()
+{
+	DatabaseConfig unrecognizedConfig = config("unrecognizedSettings");
+	unrecognizedConfig.data()->sqliteJournalMode = "WAL; DROP TABLE x";
+	unrecognizedConfig.data()->sqliteSynchronous = "SOMETIMES";
+	unrecognizedConfig.data()->sqliteCheckpointInterval = 1;
+
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Ignoring unrecognized SQLite journal mode"));
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("Ignoring unrecognized SQLite synchronous setting"));
+	connectHandler(unrecognizedConfig);
+	QCOMPARE(Pragma("unrecognizedSettings", "journal_mode").toString(), QString("delete"));
+	QCOMPARE(Pragma("unrecognizedSettings", "synchronous").toInt(), 2);
+	QVERIFY(!m_handler->m->checkpointTimer.isActive());
+}
+
+QVariant test_DatabaseConnectionHandler::Pragma(const QString & connectionName, const QString & pragma)
+{
+	QSqlQuery query(QString("PRAGMA %1").arg(pragma), QSqlDatabase::database(connectionName, false));
+	if (!query.next())
+		return QVariant();
+	return query.value(0);
+}
+
+DatabaseConfig test_DatabaseConnectionHandler::config(const QString & connectionName) const
+{
+	DatabaseConfig result;
+	result.data()->type = "QSQLITE";
+	result.data()->name = m_dir.filePath(connectionName + ".sqlite");
+	result.data()->connectionName = connectionName;
+	return result;
+}
+
+void test_DatabaseConnectionHandler::connectHandler(const DatabaseConfig & config)
+{
+	m_handler = std::make_unique<DatabaseConnectionHandler>(config);
+	QSignalSpy connectedSpy(m_handler.get(), & DatabaseConnectionHandler::connected);
+	m_handler->connect();
+	QCOMPARE(connectedSpy.count(), 1);
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::shareddatabase::internal::test_DatabaseConnectionHandler)
+#include "test_DatabaseConnectionHandler.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,143 @@
+#include <cutehmi/shareddatabase/internal/DatabaseDictionary.hpp>
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+namespace cutehmi {
+namespace shareddatabase {
+namespace internal {
+
+class test_DatabaseDictionary:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void subscriptions();
+
+		void unknownSubscription();
+
+		void notify();
+
+		void threads();
+
+		void connectedAndManaged();
+};
+
+void test_DatabaseDictionary::subscriptions()
+{
+	DatabaseDictionary & dictionary = DatabaseDictionary::Instance();
+	QSignalSpy subscribedSpy(& dictionary, & DatabaseDictionary::subscribed);
+	QSignalSpy unsubscribedSpy(& dictionary, & DatabaseDictionary::unsubscribed);
+
+	// Subscriptions are reference counted, so driver gets subscribed only once per channel.
+	dictionary.subscribe("subscriptions", "channel");
+	dictionary.subscribe("subscriptions", "channel");
+	dictionary.subscribe("subscriptions", "other");
+	QCOMPARE(subscribedSpy.count(), 2);
+	QCOMPARE(subscribedSpy.at(0).at(0).toString(), QString("subscriptions"));
+	QCOMPARE(subscribedSpy.at(0).at(1).toString(), QString("channel"));
+	QStringList channels = dictionary.subscriptions("subscriptions");
+	channels.sort();
+	QCOMPARE(channels, QStringList({"channel", "other"}));
+
+	dictionary.unsubscribe("subscriptions", "channel");
+	QCOMPARE(unsubscribedSpy.count(), 0);
+	QCOMPARE(dictionary.subscriptions("subscriptions").count(), 2);
+
+	dictionary.unsubscribe("subscriptions", "channel");
+	QCOMPARE(unsubscribedSpy.count(), 1);
+	QCOMPARE(unsubscribedSpy.at(0).at(1).toString(), QString("channel"));
+	QCOMPARE(dictionary.subscriptions("subscriptions"), QStringList({"other"}));
+
+	dictionary.unsubscribe("subscriptions", "other");
+	QCOMPARE(unsubscribedSpy.count(), 2);
+	QVERIFY(dictionary.subscriptions("subscriptions").isEmpty());
+}
+
+void test_DatabaseDictionary::unknownSubscription()
+{
+	DatabaseDictionary & dictionary = DatabaseDictionary::Instance();
+	QSignalSpy unsubscribedSpy(& dictionary, & DatabaseDictionary::unsubscribed);
+
+	dictionary.unsubscribe("unknownSubscription", "channel");
+	dictionary.subscribe("unknownSubscription", "channel");
+	dictionary.unsubscribe("unknownSubscription", "other");
+	QCOMPARE(unsubscribedSpy.count(), 0);
+	QCOMPARE(dictionary.subscriptions("unknownSubscription"), QStringList({"channel"}));
+
+	dictionary.unsubscribe("unknownSubscription", "channel");
+	dictionary.unsubscribe("unknownSubscription", "channel");
+	QCOMPARE(unsubscribedSpy.count(), 1);
+}
+
+void test_DatabaseDictionary::notify()
+{
+	DatabaseDictionary & dictionary = DatabaseDictionary::Instance();
+	QSignalSpy notifiedSpy(& dictionary, & DatabaseDictionary::notified);
+
+	dictionary.notify("notify", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 1);
+	QCOMPARE(notifiedSpy.at(0).at(0).toString(), QString("notify"));
+	QCOMPARE(notifiedSpy.at(0).at(1).toString(), QString("channel"));
+	QCOMPARE(notifiedSpy.at(0).at(2).toString(), QString("payload"));
+
+	// Notifications may be dispatched from database threads.
+	std::unique_ptr<QThread> thread(QThread::create([& dictionary]() {
+		dictionary.notify("notify", "channel", "thread");
+	}));
+	thread->start();
+	QVERIFY(thread->wait(5000));
+	QCOMPARE(notifiedSpy.count(), 2);
+	QCOMPARE(notifiedSpy.at(1).at(2).toString(), QString("thread"));
+}
+
+void test_DatabaseDictionary::threads()
+{
+	DatabaseDictionary & dictionary = DatabaseDictionary::Instance();
+	QSignalSpy threadChangedSpy(& dictionary, & DatabaseDictionary::threadChanged);
+	QThread thread;
+
+	QVERIFY(dictionary.associatedThread("threads") == nullptr);
+	dictionary.associateThread("threads", & thread);
+	QCOMPARE(dictionary.associatedThread("threads"), & thread);
+	QCOMPARE(dictionary.dissociateThread("threads"), 1);
+	QVERIFY(dictionary.associatedThread("threads") == nullptr);
+	QCOMPARE(dictionary.dissociateThread("threads"), 0);
+	QCOMPARE(threadChangedSpy.count(), 3);
+}
+
+void test_DatabaseDictionary::connectedAndManaged()
+{
+	DatabaseDictionary & dictionary = DatabaseDictionary::Instance();
+
+	QVERIFY(!dictionary.isConnected("connectedAndManaged"));
+	dictionary.addConnected("connectedAndManaged");
+	QVERIFY(dictionary.isConnected("connectedAndManaged"));
+	dictionary.removeConnected("connectedAndManaged");
+	QVERIFY(!dictionary.isConnected("connectedAndManaged"));
+
+	QVERIFY(!dictionary.isManaged("connectedAndManaged"));
+	dictionary.addManaged("connectedAndManaged");
+	QVERIFY(dictionary.isManaged("connectedAndManaged"));
+	dictionary.removeManaged("connectedAndManaged");
+	QVERIFY(!dictionary.isManaged("connectedAndManaged"));
+}
+
+}
+}
+}
+
+QTEST_MAIN(cutehmi::shareddatabase::internal::test_DatabaseDictionary)
+#include "test_DatabaseDictionary.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
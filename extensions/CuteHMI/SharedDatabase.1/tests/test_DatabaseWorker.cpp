@@ -0,0 +1,128 @@
+#include <cutehmi/shareddatabase/DatabaseWorker.hpp>
+
+#include <QtTest/QtTest>
+#include <QSqlQuery>
+#include <QTemporaryDir>
+
+namespace cutehmi {
+namespace shareddatabase {
+
+class test_DatabaseWorker:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void initTestCase();
+
+		void cleanupTestCase();
+
+		void currentThread();
+
+		void executor();
+
+	private:
+		static constexpr const char * CONNECTION_NAME = "test_DatabaseWorker";
+
+		QTemporaryDir m_dir;
+};
+
+void test_DatabaseWorker::initTestCase()
+{
+	QVERIFY(m_dir.isValid());
+	QVERIFY(QSqlDatabase::isDriverAvailable("QSQLITE"));
+
+	QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", CONNECTION_NAME);
+	db.setDatabaseName(m_dir.filePath("test_DatabaseWorker.sqlite"));
+	QVERIFY(db.open());
+	QSqlQuery query(db);
+	QVERIFY(query.exec("CREATE TABLE value (id INTEGER PRIMARY KEY)"));
+	QVERIFY(query.exec("INSERT INTO value (id) VALUES (1), (2), (3)"));
+}
+
+void test_DatabaseWorker::cleanupTestCase()
+{
+	QSqlDatabase::database(CONNECTION_NAME).close();
+	QSqlDatabase::removeDatabase(CONNECTION_NAME);
+}
+
+void test_DatabaseWorker::currentThread()
+{
+	QThread * jobThread = nullptr;
+	QString jobConnectionName;
+	int count = 0;
+
+	// There is no dedicated database thread associated with the connection.
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("will operate from current thread"));
+	DatabaseWorker worker(CONNECTION_NAME, [& jobThread, & jobConnectionName, & count](QSqlDatabase & db) {
+		jobThread = QThread::currentThread();
+		jobConnectionName = db.connectionName();
+		QSqlQuery query("SELECT COUNT(*) FROM value", db);
+		if (query.next())
+			count = query.value(0).toInt();
+	});
+	QVERIFY(worker.executor() == nullptr);
+
+	worker.work();
+	worker.wait();
+	QCOMPARE(jobThread, QThread::currentThread());
+	QCOMPARE(jobConnectionName, QString(CONNECTION_NAME));
+	QCOMPARE(count, 3);
+}
+
+void test_DatabaseWorker::executor()
+{
+	Executor executor(2);
+	QThread * jobThread = nullptr;
+	QString jobConnectionName;
+	int count = 0;
+
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("will operate from current thread"));
+	DatabaseWorker worker(CONNECTION_NAME, [& jobThread, & jobConnectionName, & count](QSqlDatabase & db) {
+		jobThread = QThread::currentThread();
+		jobConnectionName = db.connectionName();
+		QSqlQuery query("SELECT COUNT(*) FROM value", db);
+		if (query.next())
+			count = query.value(0).toInt();
+	});
+	QSignalSpy readySpy(& worker, & DatabaseWorker::ready);
+
+	// Job runs in executor thread using a clone of the connection.
+	worker.setExecutor(& executor);
+	QCOMPARE(worker.executor(), & executor);
+	worker.work();
+	worker.wait();
+	QVERIFY(jobThread != QThread::currentThread());
+	QVERIFY(jobConnectionName != QString(CONNECTION_NAME));
+	QVERIFY(jobConnectionName.startsWith(QString(CONNECTION_NAME) + "@"));
+	QCOMPARE(count, 3);
+	QTRY_COMPARE(readySpy.count(), 1);
+
+	// Worker goes back to current thread, once executor is unset.
+	QTest::ignoreMessage(QtWarningMsg, QRegularExpression("will operate from current thread"));
+	worker.setExecutor(nullptr);
+	QVERIFY(worker.executor() == nullptr);
+	count = 0;
+	worker.work();
+	worker.wait();
+	QCOMPARE(jobThread, QThread::currentThread());
+	QCOMPARE(jobConnectionName, QString(CONNECTION_NAME));
+	QCOMPARE(count, 3);
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::shareddatabase::test_DatabaseWorker)
+#include "test_DatabaseWorker.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -0,0 +1,149 @@
+#include <cutehmi/shareddatabase/Database.hpp>
+#include <cutehmi/shareddatabase/NotificationListener.hpp>
+
+#include <QtTest/QtTest>
+#include <QThread>
+
+namespace cutehmi {
+namespace shareddatabase {
+
+class test_NotificationListener:
+	public QObject
+{
+		Q_OBJECT
+
+	private slots:
+		void notified();
+
+		void filtering();
+
+		void inactive();
+
+		void channelChange();
+
+		void multipleListeners();
+
+		void crossThread();
+};
+
+void test_NotificationListener::notified()
+{
+	NotificationListener listener;
+	listener.setConnectionName("notified");
+	listener.setChannel("channel");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	Database::Notify("notified", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 1);
+	QCOMPARE(notifiedSpy.at(0).at(0).toString(), QString("payload"));
+
+	Database::Notify("notified", "channel");
+	QCOMPARE(notifiedSpy.count(), 2);
+	QVERIFY(notifiedSpy.at(1).at(0).toString().isEmpty());
+}
+
+void test_NotificationListener::filtering()
+{
+	NotificationListener listener;
+	listener.setConnectionName("filtering");
+	listener.setChannel("channel");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	Database::Notify("filtering", "other", "payload");
+	Database::Notify("other", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 0);
+}
+
+void test_NotificationListener::inactive()
+{
+	NotificationListener listener;
+	listener.setConnectionName("inactive");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	// Listener is inactive, when channel is empty.
+	Database::Notify("inactive", QString(), "payload");
+	QCOMPARE(notifiedSpy.count(), 0);
+
+	listener.setChannel("channel");
+	listener.setChannel(QString());
+	Database::Notify("inactive", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 0);
+}
+
+void test_NotificationListener::channelChange()
+{
+	NotificationListener listener;
+	listener.setConnectionName("channelChange");
+	listener.setChannel("channel");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	listener.setChannel("other");
+	Database::Notify("channelChange", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 0);
+	Database::Notify("channelChange", "other", "payload");
+	QCOMPARE(notifiedSpy.count(), 1);
+
+	listener.setConnectionName("otherConnection");
+	Database::Notify("channelChange", "other", "payload");
+	QCOMPARE(notifiedSpy.count(), 1);
+	Database::Notify("otherConnection", "other", "payload");
+	QCOMPARE(notifiedSpy.count(), 2);
+}
+
+void test_NotificationListener::multipleListeners()
+{
+	NotificationListener listener;
+	listener.setConnectionName("multipleListeners");
+	listener.setChannel("channel");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	{
+		NotificationListener otherListener;
+		otherListener.setConnectionName("multipleListeners");
+		otherListener.setChannel("channel");
+		QSignalSpy otherNotifiedSpy(& otherListener, & NotificationListener::notified);
+
+		Database::Notify("multipleListeners", "channel", "payload");
+		QCOMPARE(notifiedSpy.count(), 1);
+		QCOMPARE(otherNotifiedSpy.count(), 1);
+	}
+
+	// Destroying one listener must not unsubscribe the other.
+	Database::Notify("multipleListeners", "channel", "payload");
+	QCOMPARE(notifiedSpy.count(), 2);
+}
+
+void test_NotificationListener::crossThread()
+{
+	NotificationListener listener;
+	listener.setConnectionName("crossThread");
+	listener.setChannel("channel");
+	QSignalSpy notifiedSpy(& listener, & NotificationListener::notified);
+
+	std::unique_ptr<QThread> thread(QThread::create([]() {
+		Database::Notify("crossThread", "channel", "payload");
+	}));
+	thread->start();
+	QVERIFY(thread->wait(5000));
+
+	// Notification is delivered to the thread of the listener.
+	QTRY_COMPARE(notifiedSpy.count(), 1);
+	QCOMPARE(notifiedSpy.at(0).at(0).toString(), QString("payload"));
+}
+
+}
+}
+
+QTEST_MAIN(cutehmi::shareddatabase::test_NotificationListener)
+#include "test_NotificationListener.moc"
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
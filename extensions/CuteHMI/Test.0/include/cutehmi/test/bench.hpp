@@ -0,0 +1,57 @@
+#ifndef H_EXTENSIONS_CUTEHMI_TEST_0_INCLUDE_CUTEHMI_TEST_BENCH_HPP
+#define H_EXTENSIONS_CUTEHMI_TEST_0_INCLUDE_CUTEHMI_TEST_BENCH_HPP
+
+#include "internal/common.hpp"
+
+#include <QJsonObject>
+#include <QList>
+
+namespace cutehmi {
+namespace test {
+
+/**
+ * Get integer value of environment variable.
+ * @param name name of environment variable.
+ * @param defaultValue value returned if variable is not set or it can not be converted to integer.
+ * @return value of environment variable or @a defaultValue.
+ */
+int CUTEHMI_TEST_API intEnv(const char * name, int defaultValue);
+
+/**
+ * Get list of integers from environment variable. Items of the list are separated by commas.
+ * @param name name of environment variable.
+ * @param defaultValue value returned if variable is not set.
+ * @return list of integers or @a defaultValue.
+ */
+QList<int> CUTEHMI_TEST_API intListEnv(const char * name, const QList<int> & defaultValue);
+
+/**
+ * Get resident memory of the process.
+ * @return resident set size in bytes or -1 if it can not be determined on this platform.
+ */
+qint64 CUTEHMI_TEST_API residentMemory();
+
+/**
+ * Report benchmark result. Result is written as a single line of JSON (JSON Lines format) and appended to a file, whose path is
+ * given by @a outputVariable environment variable. If variable is not set or file can not be opened, result is printed to standard
+ * output.
+ * @param result benchmark result.
+ * @param outputVariable name of environment variable holding path to the output file.
+ */
+void CUTEHMI_TEST_API report(const QJsonObject & result, const char * outputVariable);
+
+}
+}
+
+#endif
+
+//(c)C: Copyright © 2026, Michał Policht <michal@policht.pl>. All rights reserved.
+//(c)C: SPDX-License-Identifier: LGPL-3.0-or-later OR MIT
+//(c)C: This file is a part of CuteHMI.
+//(c)C: CuteHMI is free software: you can redistribute it and/or modify it under the terms of the GNU Lesser General Public License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later version.
+//(c)C: CuteHMI is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+//(c)C: You should have received a copy of the GNU Lesser General Public License along with CuteHMI.  If not, see <https://www.gnu.org/licenses/>.
+//(c)C: Additionally, this file is licensed under terms of MIT license as expressed below.
+//(c)C: Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//(c)C: The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//(c)C: THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
@@ -4,6 +4,7 @@
 #include <QRegularExpression>
 #include <QQmlExpression>
 #include <QMetaObject>
+#include <QJsonDocument>
 
 namespace cutehmi {
 namespace console {
@@ -137,6 +138,13 @@ Interpreter::Interpreter(QQmlApplicationEngine * engine, QObject * parent):
 	m_commands.scope->addSubcommand(m_commands.scope->object.get());
 
 
+	m_commands.metrics = std::make_unique<Commands::Metrics>(QStringList({"metrics", "m"}));
+	m_commands.metrics->setHelp(tr("Print metrics of current scope object. If scope object provides `metricsReport()` function (for"
+					" example service group), then aggregated report is printed, otherwise value of `metrics` property is printed."
+					" Metrics are printed in JSON format."));
+	m_consoleCommand.addSubcommand(m_commands.metrics.get());
+
+
 	m_commands.quit = std::make_unique<Commands::Quit>(QStringList({"quit", "q"}));
 	m_commands.quit->setHelp(tr("Quit the console."));
 	m_consoleCommand.addSubcommand(m_commands.quit.get());
@@ -272,6 +280,20 @@ QStringList Interpreter::parseLine(const QString & line)
 	return commands;
 }
 
+QString Interpreter::Commands::Metrics::execute(ExecutionContext & context)
+{
+	QVariantMap metrics;
+	if (context.scopeObject->metaObject()->indexOfMethod("metricsReport()") != -1) {
+		if (!QMetaObject::invokeMethod(context.scopeObject, "metricsReport", Qt::DirectConnection, Q_RETURN_ARG(QVariantMap, metrics)))
+			return strError(QCoreApplication::translate("cutehmi::console::Interpreter", "Could not invoke 'metricsReport()' function."));
+	} else if (context.scopeObject->metaObject()->indexOfProperty("metrics") != -1)
+		metrics = context.scopeObject->property("metrics").toMap();
+	else
+		return strError(QCoreApplication::translate("cutehmi::console::Interpreter", "Scope object '%1' does not provide metrics.").arg(qobjectShortInfo(context.scopeObject)));
+
+	return QString::fromUtf8(QJsonDocument::fromVariant(metrics).toJson(QJsonDocument::Indented)).trimmed();
+}
+
 QString Interpreter::Commands::Quit::execute(ExecutionContext & context)
 {
 	Q_UNUSED(context)
@@ -69,6 +69,14 @@ class Interpreter:
 				};
 				std::unique_ptr<Scope> scope;
 
+				class Metrics : public Command {
+					public:
+						using Command::Command;
+
+						QString execute(ExecutionContext & context) override;
+				};
+				std::unique_ptr<Metrics> metrics;
+
 				class Quit : public Command {
 					public:
 						using Command::Command;